@@ -520,7 +520,7 @@ function deleteCard(index) {
 }
 
 
-// Refresh network list - UI update part will be in pollApiStatus
+// Refresh network list - UI update part will be in applyStatus
 function _updateNetworksListUI(networks) {
     const select = document.getElementById('ssid');
     const currentVal = select.value;
@@ -605,147 +605,203 @@ function requestScanNetworks() {
         });
 }
 
-// Main function to poll /api/status and update UI
+// Device status, kept current by the /api/events stream (or /api/status polling as a fallback)
 let lastProcessedAction = null;
 let lastProcessedActionMessage = "";
 let initialDeviceConfigLoaded = false;
-let lastWifiUpdateTime = 0;
-const WIFI_UPDATE_INTERVAL = 10000; // Update WiFi list every 10 seconds
+let lastNetworksScanTime = null;
+const deviceStatus = {};
+const STATUS_POLL_INTERVAL = 3000; // Fallback polling period when EventSource is unavailable
+let statusPollTimer = null;
 
-function pollApiStatus() {
-    fetch('/api/status')
-        .then(response => response.json())
-        .then(data => {
-            const portalStatus = data.portal;
-            const globalActionStatusEl = document.getElementById('global-action-status');
+// Update the UI for the status sections named in `changed` (all of them when null)
+function applyStatus(changed) {
+    const data = deviceStatus;
+    const has = (...sections) => !changed || sections.some(section => changed.includes(section));
+    const portalStatus = data.portal;
+    const globalActionStatusEl = document.getElementById('global-action-status');
 
-            if (portalStatus && globalActionStatusEl) {
-                if (portalStatus.action_in_progress && portalStatus.action_in_progress !== 'NONE') {
-                    globalActionStatusEl.textContent = `Processing: ${portalStatus.action_in_progress.replace(/_/g, ' ').toLowerCase()}...`;
-                    globalActionStatusEl.className = 'status-message info'; 
-                    globalActionStatusEl.style.display = 'block';
-                    lastProcessedAction = null; 
-                }
-                else if (portalStatus.last_action_completed && portalStatus.last_action_completed !== 'NONE') {
-                    const completedActionKey = portalStatus.last_action_completed + '-' + (portalStatus.last_action_status || 'UNKNOWN') + '-' + (portalStatus.last_action_message || 'NO_MSG');
-
-                    if (lastProcessedAction !== completedActionKey) {
-                        console.log(`Action completed: ${portalStatus.last_action_completed}, Status: ${portalStatus.last_action_status}, Msg: ${portalStatus.last_action_message}`);
-
-                        if (portalStatus.last_action_status === 'SUCCESS') {
-                            let successMsg = portalStatus.last_action_message || `${portalStatus.last_action_completed.replace(/_/g, ' ')} successful.`;
-                            if (!portalStatus.last_action_message) {
-                                switch (portalStatus.last_action_completed) {
-                                    case 'SAVE_WIFI': 
-                                        successMsg = 'WiFi configuration saved. Device will attempt to connect.'; 
-                                        if (data.wifi && data.wifi.is_connected) {
-                                            successMsg += ` Connected to ${data.wifi.connected_ssid}.`;
-                                        } else if (data.wifi) {
-                                            successMsg += ' Checking connection...';
-                                        }
-                                        break;
-                                    case 'SAVE_DEVICE_CONFIG': successMsg = 'Device configuration saved.'; break;
-                                    case 'SAVE_INSIGHT': successMsg = 'New insight saved.'; break;
-                                    case 'DELETE_INSIGHT': successMsg = 'Insight deleted.'; break;
-                                }
-                            }
-                            globalActionStatusEl.textContent = successMsg;
-                            globalActionStatusEl.className = 'status-message success';
-                            globalActionStatusEl.style.display = 'block';
-
-                            setTimeout(() => {
-                                if (globalActionStatusEl.textContent === successMsg && !globalActionStatusEl.className.includes('info')) { 
-                                    globalActionStatusEl.style.display = 'none';
-                                    globalActionStatusEl.textContent = '';
-                                    globalActionStatusEl.className = 'status-message';
+    if (has('portal') && portalStatus && globalActionStatusEl) {
+        if (portalStatus.action_in_progress && portalStatus.action_in_progress !== 'NONE') {
+            globalActionStatusEl.textContent = `Processing: ${portalStatus.action_in_progress.replace(/_/g, ' ').toLowerCase()}...`;
+            globalActionStatusEl.className = 'status-message info'; 
+            globalActionStatusEl.style.display = 'block';
+            lastProcessedAction = null; 
+        }
+        else if (portalStatus.last_action_completed && portalStatus.last_action_completed !== 'NONE') {
+            const completedActionKey = portalStatus.last_action_completed + '-' + (portalStatus.last_action_status || 'UNKNOWN') + '-' + (portalStatus.last_action_message || 'NO_MSG');
+
+            if (lastProcessedAction !== completedActionKey) {
+                console.log(`Action completed: ${portalStatus.last_action_completed}, Status: ${portalStatus.last_action_status}, Msg: ${portalStatus.last_action_message}`);
+
+                if (portalStatus.last_action_status === 'SUCCESS') {
+                    let successMsg = portalStatus.last_action_message || `${portalStatus.last_action_completed.replace(/_/g, ' ')} successful.`;
+                    if (!portalStatus.last_action_message) {
+                        switch (portalStatus.last_action_completed) {
+                            case 'SAVE_WIFI': 
+                                successMsg = 'WiFi configuration saved. Device will attempt to connect.'; 
+                                if (data.wifi && data.wifi.is_connected) {
+                                    successMsg += ` Connected to ${data.wifi.connected_ssid}.`;
+                                } else if (data.wifi) {
+                                    successMsg += ' Checking connection...';
                                 }
-                            }, 7000); 
-
-                        } else if (portalStatus.last_action_status === 'ERROR') {
-                            const errorMsgText = portalStatus.last_action_message || "An unknown error occurred with " + portalStatus.last_action_completed + ".";
-                            console.error("Action failed:", errorMsgText);
-                            if (globalActionStatusEl) {
-                                globalActionStatusEl.textContent = `Status: ${errorMsgText}`;
-                                globalActionStatusEl.className = 'status-message error';
-                                globalActionStatusEl.style.display = 'block';
-                                setTimeout(() => {
-                                    if (globalActionStatusEl.className.includes('error')) {
-                                        globalActionStatusEl.style.display = 'none';
-                                        globalActionStatusEl.textContent = '';
-                                        globalActionStatusEl.className = 'status-message';
-                                    }
-                                }, 10000); 
-                            }
+                                break;
+                            case 'SAVE_DEVICE_CONFIG': successMsg = 'Device configuration saved.'; break;
+                            case 'SAVE_INSIGHT': successMsg = 'New insight saved.'; break;
+                            case 'DELETE_INSIGHT': successMsg = 'Insight deleted.'; break;
                         }
-                        lastProcessedAction = completedActionKey;
                     }
-                } else {
-                    if (globalActionStatusEl.className.includes('info') && globalActionStatusEl.textContent.startsWith('Processing:')) {
-                    } 
-                }
-            } else if (globalActionStatusEl && portalStatus === null) { 
-                 if (globalActionStatusEl.style.display !== 'none' && !globalActionStatusEl.className.includes('success') && !globalActionStatusEl.className.includes('error')){
-                    globalActionStatusEl.style.display = 'none';
-                    globalActionStatusEl.textContent = '';
-                    globalActionStatusEl.className = 'status-message';
-                 }
-            }
+                    globalActionStatusEl.textContent = successMsg;
+                    globalActionStatusEl.className = 'status-message success';
+                    globalActionStatusEl.style.display = 'block';
 
-            // 2. Update WiFi Info
-            if (data.wifi) {
-                // Update WiFi networks list only if enough time has passed
-                const currentTime = Date.now();
-                if (currentTime - lastWifiUpdateTime >= WIFI_UPDATE_INTERVAL) {
-                    _updateNetworksListUI(data.wifi.networks);
-                    lastWifiUpdateTime = currentTime;
-                }
-                
-                // Always update connection status
-                const wifiStatusEl = document.getElementById('wifi-connection-status');
-                if (wifiStatusEl) {
-                    if (data.wifi.is_connected) {
-                        wifiStatusEl.textContent = `Connected to ${data.wifi.connected_ssid} (${data.wifi.ip_address})`;
-                    } else if (portalStatus && portalStatus.action_in_progress === 'SAVE_WIFI') {
-                        wifiStatusEl.textContent = "Attempting to connect...";
-                    } else {
-                        wifiStatusEl.textContent = "Not Connected";
+                    setTimeout(() => {
+                        if (globalActionStatusEl.textContent === successMsg && !globalActionStatusEl.className.includes('info')) { 
+                            globalActionStatusEl.style.display = 'none';
+                            globalActionStatusEl.textContent = '';
+                            globalActionStatusEl.className = 'status-message';
+                        }
+                    }, 7000); 
+
+                } else if (portalStatus.last_action_status === 'ERROR') {
+                    const errorMsgText = portalStatus.last_action_message || "An unknown error occurred with " + portalStatus.last_action_completed + ".";
+                    console.error("Action failed:", errorMsgText);
+                    if (globalActionStatusEl) {
+                        globalActionStatusEl.textContent = `Status: ${errorMsgText}`;
+                        globalActionStatusEl.className = 'status-message error';
+                        globalActionStatusEl.style.display = 'block';
+                        setTimeout(() => {
+                            if (globalActionStatusEl.className.includes('error')) {
+                                globalActionStatusEl.style.display = 'none';
+                                globalActionStatusEl.textContent = '';
+                                globalActionStatusEl.className = 'status-message';
+                            }
+                        }, 10000); 
                     }
                 }
+                lastProcessedAction = completedActionKey;
             }
+        } else {
+            if (globalActionStatusEl.className.includes('info') && globalActionStatusEl.textContent.startsWith('Processing:')) {
+            } 
+        }
+    } else if (globalActionStatusEl && portalStatus === null) { 
+         if (globalActionStatusEl.style.display !== 'none' && !globalActionStatusEl.className.includes('success') && !globalActionStatusEl.className.includes('error')){
+            globalActionStatusEl.style.display = 'none';
+            globalActionStatusEl.textContent = '';
+            globalActionStatusEl.className = 'status-message';
+         }
+    }
 
-            // 3. Update Device Config Info
-            if (data.device_config) {
-                _updateDeviceConfigUI(data.device_config);
+    // 2. Update WiFi Info
+    if (has('wifi', 'portal') && data.wifi) {
+        // Rebuild the networks list only when a new scan has landed
+        if (data.wifi.last_scan_time !== lastNetworksScanTime) {
+            _updateNetworksListUI(data.wifi.networks);
+            lastNetworksScanTime = data.wifi.last_scan_time;
+        }
+        
+        // Always update connection status
+        const wifiStatusEl = document.getElementById('wifi-connection-status');
+        if (wifiStatusEl) {
+            if (data.wifi.is_connected) {
+                wifiStatusEl.textContent = `Connected to ${data.wifi.connected_ssid} (${data.wifi.ip_address})`;
+            } else if (portalStatus && portalStatus.action_in_progress === 'SAVE_WIFI') {
+                wifiStatusEl.textContent = "Attempting to connect...";
+            } else {
+                wifiStatusEl.textContent = "Not Connected";
             }
+        }
+    }
 
-            
-            // 4a. Refresh card configuration periodically
-            // Note: We refresh cards on successful completion of card-related actions
-            if (portalStatus && portalStatus.last_action_completed && 
-                (portalStatus.last_action_completed.includes('CARD') || 
-                 portalStatus.last_action_status === 'SUCCESS')) {
-                // Refresh card data when actions complete
-                loadConfiguredCards();
-            }
+    // 3. Update Device Config Info
+    if (has('device_config') && data.device_config) {
+        _updateDeviceConfigUI(data.device_config);
+    }
 
-            // 5. Update OTA Firmware Info & UI State
-            if (data.ota) {
-                updateOtaUI(data.ota, data.portal);
-            }
+    
+    // 4a. Refresh card configuration periodically
+    // Note: We refresh cards on successful completion of card-related actions
+    if (has('portal') && portalStatus && portalStatus.last_action_completed && 
+        (portalStatus.last_action_completed.includes('CARD') || 
+         portalStatus.last_action_status === 'SUCCESS')) {
+        // Refresh card data when actions complete
+        loadConfiguredCards();
+    }
+
+    // 5. Update OTA Firmware Info & UI State
+    if (has('ota', 'portal') && data.ota) {
+        updateOtaUI(data.ota, data.portal);
+    }
+}
+
+function showConnectionLost() {
+    const globalActionStatusEl = document.getElementById('global-action-status');
+    if(globalActionStatusEl) {
+        globalActionStatusEl.textContent = 'Lost connection to device. Please check and refresh.';
+        globalActionStatusEl.className = 'status-message error';
+        globalActionStatusEl.style.display = 'block';
+    }
+}
 
+function pollApiStatus() {
+    fetch('/api/status')
+        .then(response => response.json())
+        .then(data => {
+            Object.assign(deviceStatus, data);
+            applyStatus(null);
         })
         .catch(error => {
             console.error('Error polling /api/status:', error);
-            const globalActionStatusEl = document.getElementById('global-action-status');
-            if(globalActionStatusEl) {
-                globalActionStatusEl.textContent = 'Lost connection to device. Please check and refresh.';
-                globalActionStatusEl.className = 'status-message error';
-                globalActionStatusEl.style.display = 'block';
-            }
+            showConnectionLost();
         });
 }
 
-// Load current configuration - UI update part will be in pollApiStatus
+function startStatusPolling() {
+    if (statusPollTimer === null) {
+        pollApiStatus();
+        statusPollTimer = setInterval(pollApiStatus, STATUS_POLL_INTERVAL);
+    }
+}
+
+// Subscribe to /api/events: a full "status" snapshot on connect, then one event per changed section
+function connectStatusEvents() {
+    if (!window.EventSource) {
+        startStatusPolling();
+        return;
+    }
+
+    const source = new EventSource('/api/events');
+    source.addEventListener('status', event => {
+        Object.assign(deviceStatus, JSON.parse(event.data));
+        applyStatus(null);
+    });
+    ['portal', 'wifi', 'device_config', 'ota', 'system'].forEach(section => {
+        source.addEventListener(section, event => {
+            deviceStatus[section] = JSON.parse(event.data);
+            applyStatus([section]);
+        });
+    });
+    source.onerror = () => {
+        if (source.readyState === EventSource.CLOSED) {
+            // The browser gave up reconnecting; keep the page alive by polling
+            console.warn('Status event stream closed, falling back to polling /api/status');
+            startStatusPolling();
+        } else {
+            showConnectionLost();
+        }
+    };
+    source.onopen = () => {
+        const globalActionStatusEl = document.getElementById('global-action-status');
+        if (globalActionStatusEl && globalActionStatusEl.textContent.startsWith('Lost connection')) {
+            globalActionStatusEl.style.display = 'none';
+            globalActionStatusEl.textContent = '';
+            globalActionStatusEl.className = 'status-message';
+        }
+    };
+}
+
+// Load current configuration - UI update part will be in applyStatus
 function _updateDeviceConfigUI(config) {
     if (!initialDeviceConfigLoaded) {
         if (config.team_id !== undefined) {
@@ -799,8 +855,7 @@ document.addEventListener('DOMContentLoaded', function() {
         installUpdateBtn.addEventListener('click', requestStartFirmwareUpdate);
     }
 
-    pollApiStatus();
-    setInterval(pollApiStatus, 3000); // Poll every 3 seconds for responsiveness
+    connectStatusEvents();
 
     const refreshBtn = document.getElementById('refresh-networks-btn');
     if(refreshBtn) {
@@ -1,5 +1,7 @@
 #!/usr/bin/env python3
 print("DEBUG: htmlconvert.py is being loaded!")
+import gzip
+import hashlib
 import os
 import re
 
@@ -11,12 +13,31 @@ js_file = f"{html_dir}/portal.js"      # The JavaScript file
 output_dir = "include"                 # Output directory for header file
 header_name = "html_portal.h"          # Name for the header file
 
-def escape_for_cpp(text):
-    """Escape text for C++ string literals"""
-    text = text.replace('\\', '\\\\')
-    text = text.replace('"', '\\"')
-    text = text.replace('\n', '\\n"\n"')
-    return text
+def minify_css(css):
+    """Drop comments and indentation; whitespace inside rules is left alone"""
+    css = re.sub(r'/\*.*?\*/', '', css, flags=re.S)
+    return '\n'.join(line.strip() for line in css.splitlines() if line.strip())
+
+def minify_js(js):
+    """Conservative: indentation, blank lines and whole-line // comments only.
+    Line breaks are kept so automatic semicolon insertion still works."""
+    lines = []
+    for line in js.splitlines():
+        line = line.strip()
+        if line and not line.startswith('//'):
+            lines.append(line)
+    return '\n'.join(lines)
+
+def minify_html(html):
+    html = re.sub(r'<!--.*?-->', '', html, flags=re.S)
+    return '\n'.join(line.strip() for line in html.splitlines() if line.strip())
+
+def bytes_to_cpp(data, per_line=20):
+    """Format bytes as the body of a C array initializer"""
+    rows = []
+    for i in range(0, len(data), per_line):
+        rows.append('    ' + ', '.join(f'0x{b:02x}' for b in data[i:i + per_line]))
+    return ',\n'.join(rows)
 
 def html_to_header():
     """Convert the HTML file to a C++ header file, inlining CSS and JS"""
@@ -49,19 +70,27 @@ def html_to_header():
         print(f"DEBUG: JS file not found, skipping inline: {e}")
         js_content = None
     
+    raw_size = len(html_content) + len(css_content or '') + len(js_content or '')
+    html_content = minify_html(html_content)
+
     # Inline CSS if found
     if css_content:
         html_content = html_content.replace(
             '<link rel="stylesheet" href="portal.css">',
-            f'<style>\n{css_content}\n</style>'
+            f'<style>\n{minify_css(css_content)}\n</style>'
         )
     
     # Inline JavaScript if found
     if js_content:
         html_content = html_content.replace(
             '<script src="portal.js"></script>',
-            f'<script>\n{js_content}\n</script>'
+            f'<script>\n{minify_js(js_content)}\n</script>'
         )
+
+    # mtime=0 keeps the output (and so the ETag) identical across builds
+    minified = html_content.encode('utf-8')
+    compressed = gzip.compress(minified, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(compressed).hexdigest()[:16]
     
     # Create output directory if it doesn't exist
     try:
@@ -73,10 +102,16 @@ def html_to_header():
     
     # Create header content
     header_content = f"""// Generated file - do not edit!
-// Source: {html_file}
+// Source: {html_file} (with {css_file} and {js_file} inlined), minified and gzipped
 #pragma once
 #include <pgmspace.h>
-static const char PORTAL_HTML[] PROGMEM = "{escape_for_cpp(html_content)}";
+#include <stddef.h>
+#include <stdint.h>
+static const uint8_t PORTAL_HTML_GZ[] PROGMEM = {{
+{bytes_to_cpp(compressed)}
+}};
+static const size_t PORTAL_HTML_GZ_LEN = {len(compressed)};
+static const char PORTAL_HTML_ETAG[] = "\\"{etag}\\"";
 """
     
     # Write header file
@@ -85,12 +120,15 @@ static const char PORTAL_HTML[] PROGMEM = "{escape_for_cpp(html_content)}";
         with open(header_path, 'w', encoding='utf-8') as f:
             f.write(header_content)
         print(f"DEBUG: Successfully generated {header_path}")
-        print(f"DEBUG: Final HTML size: {len(html_content)} bytes")
+        print(f"DEBUG: Portal size: {raw_size} bytes raw, {len(minified)} minified, {len(compressed)} gzipped")
         print(f"DEBUG: Generated header size: {os.path.getsize(header_path)} bytes")
     except Exception as e:
         print(f"DEBUG: Error writing header file: {e}")
 
 # Run the conversion
 print("DEBUG: About to convert HTML")
-Import("env")
+try:
+    Import("env")  # Provided when run as a PlatformIO pre-script
+except NameError:
+    pass
 html_to_header()
\ No newline at end of file
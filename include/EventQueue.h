@@ -28,6 +28,8 @@ enum class EventType {
     CARD_TITLE_UPDATED,
     POKEAPI_FETCH_REQUEST,
     POKEAPI_FETCH_SPRITE,
+    POKEAPI_PREFETCH_REQUEST,
+    POKEAPI_PREFETCH_CANCEL,
     POKEAPI_DATA_READY,
     POKEAPI_SPRITE_READY,
     POKEAPI_ERROR
@@ -92,6 +94,8 @@ private:
     bool isRunning;
     
 public:
+    static const uint32_t TASK_STACK_SIZE = 4096;  ///< Bytes for the event processing task
+
     EventQueue(size_t queueSize = 10);
     ~EventQueue();
     
@@ -1,28 +1,34 @@
 #pragma once
 
 #include <FastLED.h>
+#include "hardware/LedStatus.h"
 
-// Define the data pin for the NeoPixel. 
+// Define the data pin for the NeoPixel.
 // This should match PIN_NEOPIXEL from pins_arduino.h for the board (33 for Adafruit ESP32-S3 Reverse TFT)
 #ifndef NEOPIXEL_DATA_PIN // Allow override from build flags if needed
-  #define NEOPIXEL_DATA_PIN 33 
+  #define NEOPIXEL_DATA_PIN 33
 #endif
 
+/**
+ * @class NeoPixelController
+ * @brief Shows the LedStatus pattern on the board's NeoPixel
+ */
 class NeoPixelController {
 public:
     NeoPixelController();
     void begin();
-    void update();
+
+    /**
+     * @brief Show the current status frame, pushing it to the LED only if it changed
+     * @return ms until the next keyframe, or LedStatus::FOREVER to wait for a status change
+     */
+    uint32_t update();
 
 private:
     static constexpr uint8_t NUM_PIXELS = 1;
-    static constexpr uint16_t UPDATE_INTERVAL_MS = 16;  // ~60fps
-    static constexpr float BREATH_SPEED = 0.0167f * .75f ;
-    static constexpr float BREATH_CYCLE = 2.0f * PI;
-    static constexpr float COLOR_VARIANCE = 0.2f;
-    // static constexpr uint8_t DATA_PIN = 33; // Explicitly define data pin for FastLED
 
     CRGB leds[NUM_PIXELS]; // Changed from Adafruit_NeoPixel pixel;
-    unsigned long lastUpdate;
-    float breathPhase;
-}; 
\ No newline at end of file
+    LedPattern _pattern;
+    uint32_t _patternStart;     ///< millis() when the current pattern began
+    LedColor _shown;
+};
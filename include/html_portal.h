@@ -1,1479 +1,475 @@
 // Generated file - do not edit!
-// Source: html/portal.html
+// Source: html/portal.html (with html/portal.css and html/portal.js inlined), minified and gzipped
 #pragma once
 #include <pgmspace.h>
-static const char PORTAL_HTML[] PROGMEM = "<!DOCTYPE html>\n"
-"<html>\n"
-"<head>\n"
-"    <meta charset=\"UTF-8\">\n"
-"    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">\n"
-"    <title>Configure DeskHog</title>\n"
-"    <style>\n"
-":root {\n"
-"    background-color: #E5E7DF;\n"
-"    --border-color: #DCDED4;\n"
-"    --container-color: #F3F4F0;\n"
-"    --button-border: #CCCCCC;\n"
-"    --button-border-hover: #AAA;\n"
-"    --radius: 8px;\n"
-"    --input-color: #FFF;\n"
-"    --panel-color: #FFF;\n"
-"    --label-color: #a0a0a0;\n"
-"    --button-shadow: #E1DDDD;\n"
-"    --tip-color: #343434;\n"
-"    --link-color: rgb(245 78 0);\n"
-"    --default-font: system-ui, -apple-system, sans-serif; \n"
-"    font-family: var(--default-font);\n"
-"\n"
-"}\n"
-"\n"
-"body { \n"
-"    margin: 0; \n"
-"    padding: 1rem; \n"
-"    background-color: var(--container-color); \n"
-"    color: #333; \n"
-"    max-width: 70ch;\n"
-"    margin-left: auto;\n"
-"    margin-right: auto;\n"
-"    border: 1px solid var(--border-color);\n"
-"}\n"
-"\n"
-"a {\n"
-"    color: var(--link-color);\n"
-"    font-weight: 600;\n"
-"    text-decoration: none;\n"
-"}\n"
-"\n"
-".tip {\n"
-"    font-weight: 400;\n"
-"    font-size: 0.9rem;\n"
-"    color: var(--tip-color);\n"
-"    margin-bottom: 1.5rem;\n"
-"}\n"
-"\n"
-".config-section {\n"
-"    background-color: var(--panel-color);\n"
-"    padding: 1rem;\n"
-"    border-radius: var(--radius);\n"
-"    margin-bottom: 1rem;\n"
-"    border: 1px solid var(--border-color);\n"
-"}\n"
-"\n"
-"\n"
-"\n"
-"h1, h2 { color: #000000;\n"
-"}\n"
-"\n"
-"h1 {\n"
-"    font-weight: 700;\n"
-"    font-size: 1.5rem;\n"
-"\n"
-"}\n"
-"\n"
-"h2 {\n"
-"    font-weight: 600;\n"
-"    font-size: 1.1rem;\n"
-"    margin-bottom: 0.5rem;\n"
-"}\n"
-"\n"
-".form-group { margin-bottom: 15px; }\n"
-"label { \n"
-"    display: block; \n"
-"    margin-bottom: 0.5rem; \n"
-"    font-weight: 600;\n"
-"}\n"
-"input[type='text'], input[type='password'] { \n"
-"    width: 100%; \n"
-"    padding: 8px; \n"
-"    border: 1px solid #ddd; \n"
-"    border-radius: 8px; \n"
-"    box-sizing: border-box; \n"
-"    font-size: 1rem;\n"
-"}\n"
-".button-container { \n"
-"    margin-top: 15px; \n"
-"    text-align: center; \n"
-"}\n"
-"button, select { \n"
-"    display: inline-block; \n"
-"    width: 100%;\n"
-"    font-size: 16px;\n"
-"    font-weight: 600;\n"
-"    height: 40px;\n"
-"    text-decoration: none; \n"
-"    background-color: var(--input-color);\n"
-"    border: 1px solid var(--button-border);\n"
-"    border-radius: var(--radius); \n"
-"    cursor: pointer; \n"
-"    padding: 0 16px;\n"
-"\n"
-"    box-shadow: 0 4px 0 0 var(--button-shadow),\n"
-"                0 5px 0 0 var(--button-border);\n"
-"    color: inherit;\n"
-"    -webkit-tap-highlight-color: transparent;\n"
-"}\n"
-"\n"
-"input, select {\n"
-"    height: 40px;\n"
-"}\n"
-"\n"
-"button:active {\n"
-"    background-color: #DCDDD9;\n"
-"}\n"
-"\n"
-"ul {\n"
-"    list-style: none;\n"
-"    padding: 0;\n"
-"    margin: 0;\n"
-"}\n"
-"\n"
-"li {\n"
-"    margin-bottom: 1rem;\n"
-"}\n"
-"\n"
-"li:last-child {\n"
-"    margin-bottom: 0;\n"
-"}\n"
-"\n"
-"footer { \n"
-"    text-align: center; \n"
-"    margin-top: 4rem; \n"
-"    color: #777; \n"
-"    font-size: 0.8em; \n"
-"}\n"
-".network-list {\n"
-"    max-height: 200px;\n"
-"    overflow-y: auto;\n"
-"    border: 1px solid #ddd;\n"
-"    border-radius: 4px;\n"
-"    margin-bottom: 15px;\n"
-"}\n"
-".network-item {\n"
-"    padding: 8px 15px;\n"
-"    border-bottom: 1px solid #eee;\n"
-"    cursor: pointer;\n"
-"}\n"
-".network-item:hover {\n"
-"    background-color: #f5f5f5;\n"
-"}\n"
-".network-item.selected {\n"
-"    background-color: #e0f0ff;\n"
-"}\n"
-"\n"
-".lock-icon {\n"
-"    margin-left: 5px;\n"
-"}\n"
-".success-icon {\n"
-"    color: #28a745;\n"
-"    font-size: 48px;\n"
-"    text-align: center;\n"
-"    margin: 20px 0;\n"
-"}\n"
-".progress {\n"
-"    height: 6px;\n"
-"    background-color: #e9ecef;\n"
-"    border-radius: 2px;\n"
-"    margin: 20px 0;\n"
-"    overflow: hidden;\n"
-"}\n"
-".progress-bar {\n"
-"    height: 100%;\n"
-"    background-color: #cc7000;\n"
-"    width: 0%;\n"
-"    transition: width 10s linear;\n"
-"}\n"
-".hidden {\n"
-"    display: none;\n"
-"}\n"
-"\n"
-"select {\n"
-"    -webkit-appearance: none;\n"
-"    -moz-appearance: none;\n"
-"    appearance: none;\n"
-"    background-image: url(\"data:image/svg+xml;charset=US-ASCII,%3Csvg xmlns='http://www.w3.org/2000/svg' width='24' height='24' viewBox='0 0 24 24' fill='none' stroke='%23333333' stroke-width='2' stroke-linecap='round' stroke-linejoin='round'%3E%3Cpolyline points='6 9 12 15 18 9'%3E%3C/polyline%3E%3C/svg%3E\");\n"
-"    background-repeat: no-repeat;\n"
-"    background-position: right 0.7rem top 50%;\n"
-"    background-size: 1rem auto;\n"
-"    padding-right: 2rem;\n"
-"    background-color: var(--input-color);\n"
-"    font-family: var(--default-font);\n"
-"}\n"
-"\n"
-"select::-ms-expand {\n"
-"    display: none;\n"
-"}\n"
-"\n"
-"/* Status message styling (used by global-action-status) */\n"
-".status-message {\n"
-"    padding: 0.75em;\n"
-"    margin-bottom: 1em;\n"
-"    border-radius: 4px;\n"
-"    text-align: center;\n"
-"    font-family: monospace; /* Added for fixed-width font */\n"
-"}\n"
-"\n"
-"#firmware-update-section {\n"
-"    font-family: monospace;\n"
-"}\n"
-"\n"
-".status-message.info {\n"
-"    background-color: #e7f3fe; /* Light blue for info */\n"
-"    border: 1px solid #d0eaff;\n"
-"    color: #31708f;\n"
-"}\n"
-"\n"
-".status-message.success {\n"
-"    background-color: #d4edda; /* Light green for success */\n"
-"    border: 1px solid #c3e6cb;\n"
-"    color: #155724;\n"
-"}\n"
-"\n"
-".status-message.error {\n"
-"    background-color: #f8d7da; /* Light red for error */\n"
-"    border: 1px solid #f5c6cb;\n"
-"    color: #721c24;\n"
-"}\n"
-"\n"
-"/* Release notes box specific styling */\n"
-"#release-notes {\n"
-"    /* Assuming .release-notes-box class already exists or you style #release-notes directly */\n"
-"    /* If .release-notes-box is the primary selector for layout, add font-family there */\n"
-"    /* For direct styling of the <pre> tag by ID: */\n"
-"    font-family: monospace; /* Added for fixed-width font */\n"
-"    white-space: pre-wrap;  /* Ensures long lines wrap */\n"
-"    word-wrap: break-word;  /* Breaks long words if necessary */\n"
-"    background-color: #f8f9fa; /* Light background for the box */\n"
-"    border: 1px solid #dee2e6;   /* Border for the box */\n"
-"    padding: 10px;              /* Padding inside the box */\n"
-"    max-height: 200px;          /* Max height with scroll if content exceeds */\n"
-"    overflow-y: auto;           /* Enable vertical scroll */\n"
-"    border-radius: var(--radius); /* Consistent border radius */\n"
-"}\n"
-"\n"
-"/* Available cards list styling */\n"
-".available-card-item {\n"
-"    border: 1px solid var(--border-color);\n"
-"    border-radius: var(--radius);\n"
-"    padding: 1rem;\n"
-"    margin-bottom: 0.5rem;\n"
-"    background-color: var(--input-color);\n"
-"    display: flex;\n"
-"    justify-content: space-between;\n"
-"    align-items: center;\n"
-"}\n"
-"\n"
-".available-card-info {\n"
-"    flex: 1;\n"
-"}\n"
-"\n"
-".available-card-name {\n"
-"    font-weight: 600;\n"
-"    margin-bottom: 0.25rem;\n"
-"}\n"
-"\n"
-".available-card-description {\n"
-"    font-size: 0.9rem;\n"
-"    color: var(--label-color);\n"
-"    margin-bottom: 0.25rem;\n"
-"}\n"
-"\n"
-".available-card-status {\n"
-"    font-size: 0.8rem;\n"
-"    color: var(--label-color);\n"
-"    font-style: italic;\n"
-"}\n"
-"\n"
-".available-card-actions {\n"
-"    display: flex;\n"
-"    flex-direction: column;\n"
-"    gap: 0.5rem;\n"
-"    min-width: 120px;\n"
-"}\n"
-"\n"
-".add-card-btn {\n"
-"    background-color: var(--input-color);\n"
-"    border: 1px solid var(--button-border);\n"
-"    padding: 0.5rem 1rem;\n"
-"    border-radius: var(--radius);\n"
-"    cursor: pointer;\n"
-"    font-weight: 600;\n"
-"    width: 100%;\n"
-"    box-shadow: 0 4px 0 0 var(--button-shadow),\n"
-"                0 5px 0 0 var(--button-border);\n"
-"}\n"
-"\n"
-".add-card-btn:hover {\n"
-"    background-color: #DCDDD9;\n"
-"}\n"
-"\n"
-".add-card-btn:active {\n"
-"    background-color: #DCDDD9;\n"
-"}\n"
-"\n"
-".delete-card-btn {\n"
-"    background-color: var(--input-color);\n"
-"    color: #dc3545;\n"
-"    border: 1px solid var(--button-border);\n"
-"    padding: 5px 10px;\n"
-"    border-radius: var(--radius);\n"
-"    cursor: pointer;\n"
-"    font-weight: 600;\n"
-"    box-shadow: 0 2px 0 0 var(--button-shadow),\n"
-"                0 3px 0 0 var(--button-border);\n"
-"}\n"
-"\n"
-".delete-card-btn:hover {\n"
-"    background-color: #DCDDD9;\n"
-"}\n"
-"\n"
-".delete-card-btn:active {\n"
-"    background-color: #DCDDD9;\n"
-"}\n"
-"\n"
-".config-input {\n"
-"    padding: 0.25rem 0.5rem;\n"
-"    border: 1px solid var(--border-color);\n"
-"    border-radius: 4px;\n"
-"    font-size: 0.9rem;\n"
-"    width: 100%;\n"
-"    box-sizing: border-box;\n"
-"}\n"
-"\n"
-"/* Drag and drop styling for configured cards */\n"
-".card-item {\n"
-"    border: 1px solid var(--border-color);\n"
-"    padding: 10px;\n"
-"    margin: 5px 0;\n"
-"    border-radius: 5px;\n"
-"    background: #f9f9f9;\n"
-"    cursor: move;\n"
-"    transition: all 0.2s ease;\n"
-"}\n"
-"\n"
-".card-item:hover {\n"
-"    background: #f0f0f0;\n"
-"    box-shadow: 0 2px 4px rgba(0,0,0,0.1);\n"
-"}\n"
-"\n"
-".card-item.dragging {\n"
-"    opacity: 0.5;\n"
-"    transform: rotate(2deg);\n"
-"}\n"
-"\n"
-".card-item.drag-over {\n"
-"    border-color: #007bff;\n"
-"    background: #e3f2fd;\n"
-"    border-style: dashed;\n"
-"    border-width: 2px;\n"
-"}\n"
-"\n"
-".drag-handle {\n"
-"    color: var(--label-color);\n"
-"    cursor: grab;\n"
-"    font-size: 1.2rem;\n"
-"    margin-right: 0.5rem;\n"
-"    user-select: none;\n"
-"}\n"
-"\n"
-".drag-handle:active {\n"
-"    cursor: grabbing;\n"
-"}\n"
-"</style>\n"
-"    <script>\n"
-"function showScreen(screenId) {\n"
-"    const screens = ['config-screen'];\n"
-"    screens.forEach(id => {\n"
-"        const el = document.getElementById(id);\n"
-"        if (el) el.classList.add('hidden');\n"
-"    });\n"
-"    const screenToShow = document.getElementById(screenId);\n"
-"    if (screenToShow) screenToShow.classList.remove('hidden');\n"
-"    \n"
-"    let title = \"DeskHog configuration\";\n"
-"    document.getElementById('page-title').textContent = title;\n"
-"}\n"
-"\n"
-"// Handle WiFi form submission\n"
-"function saveWifiConfig() {\n"
-"    const form = document.getElementById('wifi-form');\n"
-"    const formData = new FormData(form);\n"
-"    const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"    \n"
-"    fetch('/api/actions/save-wifi', { \n"
-"        method: 'POST',\n"
-"        body: formData\n"
-"    })\n"
-"    .then(response => response.json())\n"
-"    .then(data => {\n"
-"        if (data && data.status === 'queued') {\n"
-"            console.log(\"Save WiFi action successfully queued.\", data.message);\n"
-"            if (globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = data.message || \"Save WiFi initiated. Device will attempt to connect.\";\n"
-"                globalActionStatusEl.className = 'status-message info';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"                setTimeout(() => {\n"
-"                    if (globalActionStatusEl.textContent === (data.message || \"Save WiFi initiated. Device will attempt to connect.\")) {\n"
-"                        globalActionStatusEl.style.display = 'none';\n"
-"                        globalActionStatusEl.textContent = '';\n"
-"                        globalActionStatusEl.className = 'status-message';\n"
-"                    }\n"
-"                }, 5000);\n"
-"            }\n"
-"        } else {\n"
-"            const errorMessage = (data && data.message) ? data.message : \"Failed to initiate WiFi save.\";\n"
-"            console.error(\"Failed to initiate WiFi save:\", errorMessage);\n"
-"            if (globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = errorMessage;\n"
-"                globalActionStatusEl.className = 'status-message error';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"                setTimeout(() => {\n"
-"                    if (globalActionStatusEl.className.includes('error')) {\n"
-"                        globalActionStatusEl.style.display = 'none';\n"
-"                        globalActionStatusEl.textContent = '';\n"
-"                        globalActionStatusEl.className = 'status-message';\n"
-"                    }\n"
-"                }, 7000);\n"
-"            }\n"
-"        }\n"
-"    })\n"
-"    .catch(() => {\n"
-"        console.error(\"Communication error trying to save WiFi.\");\n"
-"        if (globalActionStatusEl) {\n"
-"            globalActionStatusEl.textContent = \"Communication error trying to save WiFi.\";\n"
-"            globalActionStatusEl.className = 'status-message error';\n"
-"            globalActionStatusEl.style.display = 'block';\n"
-"            setTimeout(() => {\n"
-"                if (globalActionStatusEl.className.includes('error')) {\n"
-"                    globalActionStatusEl.style.display = 'none';\n"
-"                    globalActionStatusEl.textContent = '';\n"
-"                    globalActionStatusEl.className = 'status-message';\n"
-"                }\n"
-"            }, 7000);\n"
-"        }\n"
-"    });\n"
-"    \n"
-"    return false; \n"
-"}\n"
-"\n"
-"// Handle device config form submission\n"
-"function saveDeviceConfig() {\n"
-"    const form = document.getElementById('device-form');\n"
-"    const formData = new FormData(form);\n"
-"    const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"    \n"
-"    fetch('/api/actions/save-device-config', { \n"
-"        method: 'POST',\n"
-"        body: formData\n"
-"    })\n"
-"    .then(response => response.json())\n"
-"    .then(data => {\n"
-"        if (data && data.status === 'queued') {\n"
-"            console.log(\"Save device config action successfully queued.\", data.message);\n"
-"            if (globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = data.message || \"Device configuration save initiated.\";\n"
-"                globalActionStatusEl.className = 'status-message info';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"                setTimeout(() => {\n"
-"                     if (globalActionStatusEl.textContent === (data.message || \"Device configuration save initiated.\")) {\n"
-"                        globalActionStatusEl.style.display = 'none';\n"
-"                        globalActionStatusEl.textContent = '';\n"
-"                        globalActionStatusEl.className = 'status-message';\n"
-"                    }\n"
-"                }, 5000);\n"
-"            }\n"
-"        } else {\n"
-"            const errorMessage = (data && data.message) ? data.message : \"Failed to initiate device config save.\";\n"
-"            console.error(\"Failed to initiate device config save:\", errorMessage);\n"
-"            if (globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = errorMessage;\n"
-"                globalActionStatusEl.className = 'status-message error';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"                setTimeout(() => {\n"
-"                    if (globalActionStatusEl.className.includes('error')) {\n"
-"                        globalActionStatusEl.style.display = 'none';\n"
-"                        globalActionStatusEl.textContent = '';\n"
-"                        globalActionStatusEl.className = 'status-message';\n"
-"                    }\n"
-"                }, 7000);\n"
-"            }\n"
-"        }\n"
-"    })\n"
-"    .catch(() => {\n"
-"        console.error(\"Communication error saving device config.\");\n"
-"        if (globalActionStatusEl) {\n"
-"            globalActionStatusEl.textContent = \"Communication error saving device config.\";\n"
-"            globalActionStatusEl.className = 'status-message error';\n"
-"            globalActionStatusEl.style.display = 'block';\n"
-"            setTimeout(() => {\n"
-"                if (globalActionStatusEl.className.includes('error')) {\n"
-"                    globalActionStatusEl.style.display = 'none';\n"
-"                    globalActionStatusEl.textContent = '';\n"
-"                    globalActionStatusEl.className = 'status-message';\n"
-"                }\n"
-"            }, 7000);\n"
-"        }\n"
-"    });\n"
-"    \n"
-"    return false;\n"
-"}\n"
-"\n"
-"// Toggle API key visibility\n"
-"function toggleApiKeyVisibility() {\n"
-"    const apiKeyInput = document.getElementById('apiKey');\n"
-"    apiKeyInput.type = apiKeyInput.type === 'password' ? 'text' : 'password';\n"
-"}\n"
-"\n"
-"// Global variables for card management\n"
-"let availableCardTypes = [];\n"
-"let configuredCards = [];\n"
-"\n"
-"// Load card definitions from the device\n"
-"async function loadCardDefinitions() {\n"
-"    try {\n"
-"        const response = await fetch('/api/cards/definitions');\n"
-"        if (!response.ok) {\n"
-"            throw new Error(`HTTP ${response.status}: ${response.statusText}`);\n"
-"        }\n"
-"        const definitions = await response.json();\n"
-"        availableCardTypes = definitions;\n"
-"        updateAvailableCardsList();\n"
-"        console.log('Loaded', definitions.length, 'card definitions');\n"
-"    } catch (error) {\n"
-"        console.error('Failed to load card definitions:', error);\n"
-"        // Set empty array as fallback\n"
-"        availableCardTypes = [];\n"
-"    }\n"
-"}\n"
-"\n"
-"// Load configured cards from the device\n"
-"async function loadConfiguredCards() {\n"
-"    try {\n"
-"        const response = await fetch('/api/cards/configured');\n"
-"        if (!response.ok) {\n"
-"            throw new Error(`HTTP ${response.status}: ${response.statusText}`);\n"
-"        }\n"
-"        const cards = await response.json();\n"
-"        configuredCards = cards;\n"
-"        updateCardsListUI();\n"
-"        updateAvailableCardsList(); // Update availability status\n"
-"        console.log('Loaded', cards.length, 'configured cards');\n"
-"    } catch (error) {\n"
-"        console.error('Failed to load configured cards:', error);\n"
-"        // Set empty array as fallback\n"
-"        configuredCards = [];\n"
-"        updateCardsListUI();\n"
-"        updateAvailableCardsList(); // Update availability status\n"
-"    }\n"
-"}\n"
-"\n"
-"// Update the available cards list\n"
-"function updateAvailableCardsList() {\n"
-"    const container = document.getElementById('available-cards-list');\n"
-"    if (!container) return;\n"
-"    \n"
-"    // Handle empty state\n"
-"    if (!availableCardTypes || availableCardTypes.length === 0) {\n"
-"        if (container.innerHTML !== '<p>No card types available</p>') {\n"
-"            container.innerHTML = '<p>No card types available</p>';\n"
-"        }\n"
-"        return;\n"
-"    }\n"
-"    \n"
-"    // Update existing items or create new ones\n"
-"    availableCardTypes.forEach(cardDef => {\n"
-"        let cardItem = container.querySelector(`[data-card-type=\"${cardDef.id}\"]`);\n"
-"        \n"
-"        // Check if this card type is already configured and if it allows multiple instances\n"
-"        const existingCount = configuredCards.filter(card => card.type === cardDef.id).length;\n"
-"        const canAdd = cardDef.allowMultiple || existingCount === 0;\n"
-"        \n"
-"        let statusText = '';\n"
-"        if (!cardDef.allowMultiple && existingCount > 0) {\n"
-"            statusText = 'Already added (single instance)';\n"
-"        } else if (existingCount > 0) {\n"
-"            statusText = `${existingCount} instance${existingCount > 1 ? 's' : ''} configured`;\n"
-"        }\n"
-"        \n"
-"        if (!cardItem) {\n"
-"            // Create new item only if it doesn't exist\n"
-"            cardItem = document.createElement('div');\n"
-"            cardItem.className = 'available-card-item';\n"
-"            cardItem.setAttribute('data-card-type', cardDef.id);\n"
-"            \n"
-"            cardItem.innerHTML = `\n"
-"                <div class=\"available-card-info\">\n"
-"                    <div class=\"available-card-name\">${cardDef.name}</div>\n"
-"                    <div class=\"available-card-description\">${cardDef.description || cardDef.uiDescription || ''}</div>\n"
-"                    <div class=\"available-card-status\"></div>\n"
-"                </div>\n"
-"                <div class=\"available-card-actions\">\n"
-"                    ${cardDef.needsConfigInput ? `\n"
-"                        <input type=\"text\" class=\"config-input\" placeholder=\"${cardDef.configInputLabel}\" id=\"config-${cardDef.id}\">\n"
-"                    ` : ''}\n"
-"                    <button class=\"add-card-btn\" onclick=\"addCardFromList('${cardDef.id}')\" ${!canAdd ? 'style=\"display:none\"' : ''}>\n"
-"                        + Add card\n"
-"                    </button>\n"
-"                </div>\n"
-"            `;\n"
-"            \n"
-"            container.appendChild(cardItem);\n"
-"        } else {\n"
-"            // Update existing item without destroying input values\n"
-"            const statusEl = cardItem.querySelector('.available-card-status');\n"
-"            if (statusEl) {\n"
-"                statusEl.textContent = statusText;\n"
-"            }\n"
-"            \n"
-"            const addBtn = cardItem.querySelector('.add-card-btn');\n"
-"            if (addBtn) {\n"
-"                addBtn.style.display = canAdd ? '' : 'none';\n"
-"            }\n"
-"        }\n"
-"    });\n"
-"    \n"
-"    // Remove any cards that no longer exist in availableCardTypes\n"
-"    const existingItems = container.querySelectorAll('[data-card-type]');\n"
-"    existingItems.forEach(item => {\n"
-"        const cardType = item.getAttribute('data-card-type');\n"
-"        if (!availableCardTypes.find(def => def.id === cardType)) {\n"
-"            item.remove();\n"
-"        }\n"
-"    });\n"
-"}\n"
-"\n"
-"// Save card configuration to device\n"
-"async function saveCardConfiguration() {\n"
-"    try {\n"
-"        const response = await fetch('/api/cards/configured', {\n"
-"            method: 'POST',\n"
-"            headers: {\n"
-"                'Content-Type': 'application/json'\n"
-"            },\n"
-"            body: JSON.stringify(configuredCards)\n"
-"        });\n"
-"        \n"
-"        const result = await response.json();\n"
-"        if (result.success) {\n"
-"            console.log('Card configuration saved successfully');\n"
-"            // Reload to reflect changes\n"
-"            await loadConfiguredCards();\n"
-"        } else {\n"
-"            console.error('Failed to save card configuration:', result.message);\n"
-"        }\n"
-"    } catch (error) {\n"
-"        console.error('Error saving card configuration:', error);\n"
-"    }\n"
-"}\n"
-"\n"
-"// Add new card from the list interface\n"
-"function addCardFromList(cardTypeId) {\n"
-"    const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"    \n"
-"    // Find the card definition\n"
-"    const cardDef = availableCardTypes.find(def => def.id === cardTypeId);\n"
-"    if (!cardDef) {\n"
-"        console.error('Card definition not found for type:', cardTypeId);\n"
-"        return;\n"
-"    }\n"
-"    \n"
-"    // Get config value if needed\n"
-"    let cardConfig = '';\n"
-"    if (cardDef.needsConfigInput) {\n"
-"        const configInput = document.getElementById(`config-${cardTypeId}`);\n"
-"        if (!configInput || !configInput.value.trim()) {\n"
-"            // Show error\n"
-"            if (globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = `Please enter a value for ${cardDef.configInputLabel}`;\n"
-"                globalActionStatusEl.className = 'status-message error';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"                setTimeout(() => {\n"
-"                    globalActionStatusEl.style.display = 'none';\n"
-"                    globalActionStatusEl.textContent = '';\n"
-"                    globalActionStatusEl.className = 'status-message';\n"
-"                }, 3000);\n"
-"            }\n"
-"            return;\n"
-"        }\n"
-"        cardConfig = configInput.value.trim();\n"
-"    }\n"
-"    \n"
-"    // Create new card configuration\n"
-"    const newCard = {\n"
-"        type: cardTypeId,\n"
-"        config: cardConfig,\n"
-"        name: cardDef.name,\n"
-"        order: configuredCards.length // Add to end\n"
-"    };\n"
-"    \n"
-"    // Add to current configuration\n"
-"    configuredCards.push(newCard);\n"
-"    \n"
-"    // Save to device\n"
-"    saveCardConfiguration();\n"
-"    \n"
-"    // Clear the config input if it exists\n"
-"    if (cardDef.needsConfigInput) {\n"
-"        const configInput = document.getElementById(`config-${cardTypeId}`);\n"
-"        if (configInput) {\n"
-"            configInput.value = '';\n"
-"        }\n"
-"    }\n"
-"    \n"
-"    // Update the available cards list to reflect new state\n"
-"    updateAvailableCardsList();\n"
-"    \n"
-"    if (globalActionStatusEl) {\n"
-"        globalActionStatusEl.textContent = \"Card added successfully\";\n"
-"        globalActionStatusEl.className = 'status-message info';\n"
-"        globalActionStatusEl.style.display = 'block';\n"
-"        setTimeout(() => {\n"
-"            globalActionStatusEl.style.display = 'none';\n"
-"            globalActionStatusEl.textContent = '';\n"
-"            globalActionStatusEl.className = 'status-message';\n"
-"        }, 3000);\n"
-"    }\n"
-"}\n"
-"\n"
-"// Update the cards list UI with drag-and-drop functionality\n"
-"function updateCardsListUI() {\n"
-"    const container = document.getElementById('cards-list');\n"
-"    if (!container) return;\n"
-"    \n"
-"    container.innerHTML = '';\n"
-"    \n"
-"    if (!configuredCards || configuredCards.length === 0) {\n"
-"        container.innerHTML = '<p>No cards configured</p>';\n"
-"        return;\n"
-"    }\n"
-"    \n"
-"    // Sort cards by order\n"
-"    const sortedCards = [...configuredCards].sort((a, b) => a.order - b.order);\n"
-"    \n"
-"    const list = document.createElement('div');\n"
-"    list.className = 'cards-list';\n"
-"    \n"
-"    sortedCards.forEach((card, index) => {\n"
-"        const item = document.createElement('div');\n"
-"        item.className = 'card-item';\n"
-"        item.draggable = true;\n"
-"        item.dataset.cardIndex = index;\n"
-"        \n"
-"        item.innerHTML = `\n"
-"            <div style=\"display: flex; justify-content: space-between; align-items: center;\">\n"
-"                <div style=\"display: flex; align-items: center;\">\n"
-"                    <span class=\"drag-handle\">⋮⋮</span>\n"
-"                    <div>\n"
-"                        <strong>${card.name}</strong>\n"
-"                        <br>\n"
-"                        <small>Type: ${card.type}${card.config ? ` • Config: ${card.config}` : ''}</small>\n"
-"                    </div>\n"
-"                </div>\n"
-"                <div>\n"
-"                    <button onclick=\"deleteCard(${index})\" class=\"delete-card-btn\">Delete</button>\n"
-"                </div>\n"
-"            </div>\n"
-"        `;\n"
-"        \n"
-"        // Add drag event listeners\n"
-"        item.addEventListener('dragstart', handleDragStart);\n"
-"        item.addEventListener('dragover', handleDragOver);\n"
-"        item.addEventListener('drop', handleDrop);\n"
-"        item.addEventListener('dragend', handleDragEnd);\n"
-"        item.addEventListener('dragenter', handleDragEnter);\n"
-"        item.addEventListener('dragleave', handleDragLeave);\n"
-"        \n"
-"        list.appendChild(item);\n"
-"    });\n"
-"    \n"
-"    container.appendChild(list);\n"
-"}\n"
-"\n"
-"// Drag and drop variables\n"
-"let draggedElement = null;\n"
-"let draggedIndex = null;\n"
-"\n"
-"// Drag event handlers\n"
-"function handleDragStart(e) {\n"
-"    draggedElement = e.target;\n"
-"    draggedIndex = parseInt(e.target.dataset.cardIndex);\n"
-"    e.target.classList.add('dragging');\n"
-"    e.dataTransfer.effectAllowed = 'move';\n"
-"    e.dataTransfer.setData('text/html', e.target.outerHTML);\n"
-"}\n"
-"\n"
-"function handleDragOver(e) {\n"
-"    if (e.preventDefault) {\n"
-"        e.preventDefault();\n"
-"    }\n"
-"    e.dataTransfer.dropEffect = 'move';\n"
-"    return false;\n"
-"}\n"
-"\n"
-"function handleDragEnter(e) {\n"
-"    if (e.target !== draggedElement) {\n"
-"        e.target.classList.add('drag-over');\n"
-"    }\n"
-"}\n"
-"\n"
-"function handleDragLeave(e) {\n"
-"    e.target.classList.remove('drag-over');\n"
-"}\n"
-"\n"
-"function handleDrop(e) {\n"
-"    if (e.stopPropagation) {\n"
-"        e.stopPropagation();\n"
-"    }\n"
-"    \n"
-"    const dropIndex = parseInt(e.target.closest('.card-item').dataset.cardIndex);\n"
-"    \n"
-"    if (draggedIndex !== dropIndex) {\n"
-"        // Reorder the cards\n"
-"        const sortedCards = [...configuredCards].sort((a, b) => a.order - b.order);\n"
-"        const draggedCard = sortedCards[draggedIndex];\n"
-"        \n"
-"        // Remove the dragged card from its current position\n"
-"        sortedCards.splice(draggedIndex, 1);\n"
-"        \n"
-"        // Insert it at the new position\n"
-"        sortedCards.splice(dropIndex, 0, draggedCard);\n"
-"        \n"
-"        // Update order values\n"
-"        sortedCards.forEach((card, index) => {\n"
-"            card.order = index;\n"
-"        });\n"
-"        \n"
-"        // Update the global array\n"
-"        configuredCards = sortedCards;\n"
-"        \n"
-"        // Save and update UI\n"
-"        saveCardConfiguration();\n"
-"    }\n"
-"    \n"
-"    return false;\n"
-"}\n"
-"\n"
-"function handleDragEnd(e) {\n"
-"    e.target.classList.remove('dragging');\n"
-"    \n"
-"    // Clean up drag-over classes from all items\n"
-"    document.querySelectorAll('.card-item').forEach(item => {\n"
-"        item.classList.remove('drag-over');\n"
-"    });\n"
-"    \n"
-"    draggedElement = null;\n"
-"    draggedIndex = null;\n"
-"}\n"
-"\n"
-"// Delete a card\n"
-"function deleteCard(index) {\n"
-"    const sortedCards = [...configuredCards].sort((a, b) => a.order - b.order);\n"
-"    const cardToDelete = sortedCards[index];\n"
-"    \n"
-"    if (!confirm(`Are you sure you want to delete \"${cardToDelete.name}\"?`)) {\n"
-"        return;\n"
-"    }\n"
-"    \n"
-"    // Remove the card from the array\n"
-"    configuredCards = configuredCards.filter(card => \n"
-"        card.type !== cardToDelete.type || \n"
-"        card.config !== cardToDelete.config || \n"
-"        card.order !== cardToDelete.order\n"
-"    );\n"
-"    \n"
-"    // Reorder remaining cards\n"
-"    configuredCards.forEach((card, idx) => {\n"
-"        card.order = idx;\n"
-"    });\n"
-"    \n"
-"    // Save and update UI\n"
-"    saveCardConfiguration();\n"
-"    \n"
-"    const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"    if (globalActionStatusEl) {\n"
-"        globalActionStatusEl.textContent = \"Card deleted successfully\";\n"
-"        globalActionStatusEl.className = 'status-message info';\n"
-"        globalActionStatusEl.style.display = 'block';\n"
-"        setTimeout(() => {\n"
-"            globalActionStatusEl.style.display = 'none';\n"
-"            globalActionStatusEl.textContent = '';\n"
-"            globalActionStatusEl.className = 'status-message';\n"
-"        }, 3000);\n"
-"    }\n"
-"}\n"
-"\n"
-"\n"
-"// Refresh network list - UI update part will be in pollApiStatus\n"
-"function _updateNetworksListUI(networks) {\n"
-"    const select = document.getElementById('ssid');\n"
-"    const currentVal = select.value;\n"
-"    select.innerHTML = '<option value=\"\">Select a network</option>';\n"
-"    \n"
-"    if (!networks || networks.length === 0) {\n"
-"        select.innerHTML += '<option disabled>No networks found</option>';\n"
-"        return;\n"
-"    }\n"
-"    \n"
-"    networks.forEach(network => {\n"
-"        const option = document.createElement('option');\n"
-"        option.value = network.ssid;\n"
-"        \n"
-"        let label = network.ssid;\n"
-"        if (network.rssi >= -50) label += ' (Excellent)';\n"
-"        else if (network.rssi >= -60) label += ' (Good)';\n"
-"        else if (network.rssi >= -70) label += ' (Fair)';\n"
-"        else label += ' (Poor)';\n"
-"        if (network.encrypted) label += ' 🔒';\n"
-"        \n"
-"        option.textContent = label;\n"
-"        if (network.ssid === currentVal) {\n"
-"            option.selected = true;\n"
-"        }\n"
-"        select.appendChild(option);\n"
-"    });\n"
-"}\n"
-"\n"
-"function requestScanNetworks() {\n"
-"    const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"    fetch('/api/actions/start-wifi-scan', { method: 'POST' })\n"
-"        .then(response => {\n"
-"            if (!response.ok) {\n"
-"                return response.json().then(errData => {\n"
-"                    throw new Error(errData.message || `HTTP error ${response.status}`);\n"
-"                }).catch(() => {\n"
-"                    throw new Error(`HTTP error ${response.status}`);\n"
-"                });\n"
-"            }\n"
-"            return response.json();\n"
-"        })\n"
-"        .then(data => {\n"
-"            if (data.status === 'queued') {\n"
-"                console.log(\"WiFi scan action successfully queued:\", data.message);\n"
-"                const ssidSelect = document.getElementById('ssid');\n"
-"                if (globalActionStatusEl) {\n"
-"                    globalActionStatusEl.textContent = data.message || \"WiFi scan requested. List will update shortly.\";\n"
-"                    globalActionStatusEl.className = 'status-message info';\n"
-"                    globalActionStatusEl.style.display = 'block';\n"
-"                    setTimeout(() => {\n"
-"                        if (globalActionStatusEl.textContent === (data.message || \"WiFi scan requested. List will update shortly.\")) {\n"
-"                            globalActionStatusEl.style.display = 'none';\n"
-"                            globalActionStatusEl.textContent = '';\n"
-"                            globalActionStatusEl.className = 'status-message';\n"
-"                        }\n"
-"                    }, 5000);\n"
-"                }\n"
-"                if (ssidSelect && (ssidSelect.options.length <= 1 || ssidSelect.firstChild.value === \"\")) {\n"
-"                     ssidSelect.innerHTML = '<option>Scan requested, list updating...</option>';\n"
-"                }\n"
-"\n"
-"            } else {\n"
-"                const errorMessage = `Failed to queue WiFi scan: ${data.message || 'Unexpected server response.'}`;\n"
-"                console.error(errorMessage);\n"
-"                if (globalActionStatusEl) {\n"
-"                    globalActionStatusEl.textContent = errorMessage;\n"
-"                    globalActionStatusEl.className = 'status-message error';\n"
-"                    globalActionStatusEl.style.display = 'block';\n"
-"                }\n"
-"                document.getElementById('ssid').innerHTML = '<option>Scan request issue.</option>';\n"
-"            }\n"
-"        })\n"
-"        .catch(error => {\n"
-"            console.error('Error requesting network scan:', error.message);\n"
-"            if (globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = `Error requesting scan: ${error.message}`;\n"
-"                globalActionStatusEl.className = 'status-message error';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"            }\n"
-"            document.getElementById('ssid').innerHTML = '<option value=\"\">Error starting scan</option>';\n"
-"        });\n"
-"}\n"
-"\n"
-"// Main function to poll /api/status and update UI\n"
-"let lastProcessedAction = null;\n"
-"let lastProcessedActionMessage = \"\";\n"
-"let initialDeviceConfigLoaded = false;\n"
-"let lastWifiUpdateTime = 0;\n"
-"const WIFI_UPDATE_INTERVAL = 10000; // Update WiFi list every 10 seconds\n"
-"\n"
-"function pollApiStatus() {\n"
-"    fetch('/api/status')\n"
-"        .then(response => response.json())\n"
-"        .then(data => {\n"
-"            const portalStatus = data.portal;\n"
-"            const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"\n"
-"            if (portalStatus && globalActionStatusEl) {\n"
-"                if (portalStatus.action_in_progress && portalStatus.action_in_progress !== 'NONE') {\n"
-"                    globalActionStatusEl.textContent = `Processing: ${portalStatus.action_in_progress.replace(/_/g, ' ').toLowerCase()}...`;\n"
-"                    globalActionStatusEl.className = 'status-message info'; \n"
-"                    globalActionStatusEl.style.display = 'block';\n"
-"                    lastProcessedAction = null; \n"
-"                }\n"
-"                else if (portalStatus.last_action_completed && portalStatus.last_action_completed !== 'NONE') {\n"
-"                    const completedActionKey = portalStatus.last_action_completed + '-' + (portalStatus.last_action_status || 'UNKNOWN') + '-' + (portalStatus.last_action_message || 'NO_MSG');\n"
-"\n"
-"                    if (lastProcessedAction !== completedActionKey) {\n"
-"                        console.log(`Action completed: ${portalStatus.last_action_completed}, Status: ${portalStatus.last_action_status}, Msg: ${portalStatus.last_action_message}`);\n"
-"\n"
-"                        if (portalStatus.last_action_status === 'SUCCESS') {\n"
-"                            let successMsg = portalStatus.last_action_message || `${portalStatus.last_action_completed.replace(/_/g, ' ')} successful.`;\n"
-"                            if (!portalStatus.last_action_message) {\n"
-"                                switch (portalStatus.last_action_completed) {\n"
-"                                    case 'SAVE_WIFI': \n"
-"                                        successMsg = 'WiFi configuration saved. Device will attempt to connect.'; \n"
-"                                        if (data.wifi && data.wifi.is_connected) {\n"
-"                                            successMsg += ` Connected to ${data.wifi.connected_ssid}.`;\n"
-"                                        } else if (data.wifi) {\n"
-"                                            successMsg += ' Checking connection...';\n"
-"                                        }\n"
-"                                        break;\n"
-"                                    case 'SAVE_DEVICE_CONFIG': successMsg = 'Device configuration saved.'; break;\n"
-"                                    case 'SAVE_INSIGHT': successMsg = 'New insight saved.'; break;\n"
-"                                    case 'DELETE_INSIGHT': successMsg = 'Insight deleted.'; break;\n"
-"                                }\n"
-"                            }\n"
-"                            globalActionStatusEl.textContent = successMsg;\n"
-"                            globalActionStatusEl.className = 'status-message success';\n"
-"                            globalActionStatusEl.style.display = 'block';\n"
-"\n"
-"                            setTimeout(() => {\n"
-"                                if (globalActionStatusEl.textContent === successMsg && !globalActionStatusEl.className.includes('info')) { \n"
-"                                    globalActionStatusEl.style.display = 'none';\n"
-"                                    globalActionStatusEl.textContent = '';\n"
-"                                    globalActionStatusEl.className = 'status-message';\n"
-"                                }\n"
-"                            }, 7000); \n"
-"\n"
-"                        } else if (portalStatus.last_action_status === 'ERROR') {\n"
-"                            const errorMsgText = portalStatus.last_action_message || \"An unknown error occurred with \" + portalStatus.last_action_completed + \".\";\n"
-"                            console.error(\"Action failed:\", errorMsgText);\n"
-"                            if (globalActionStatusEl) {\n"
-"                                globalActionStatusEl.textContent = `Status: ${errorMsgText}`;\n"
-"                                globalActionStatusEl.className = 'status-message error';\n"
-"                                globalActionStatusEl.style.display = 'block';\n"
-"                                setTimeout(() => {\n"
-"                                    if (globalActionStatusEl.className.includes('error')) {\n"
-"                                        globalActionStatusEl.style.display = 'none';\n"
-"                                        globalActionStatusEl.textContent = '';\n"
-"                                        globalActionStatusEl.className = 'status-message';\n"
-"                                    }\n"
-"                                }, 10000); \n"
-"                            }\n"
-"                        }\n"
-"                        lastProcessedAction = completedActionKey;\n"
-"                    }\n"
-"                } else {\n"
-"                    if (globalActionStatusEl.className.includes('info') && globalActionStatusEl.textContent.startsWith('Processing:')) {\n"
-"                    } \n"
-"                }\n"
-"            } else if (globalActionStatusEl && portalStatus === null) { \n"
-"                 if (globalActionStatusEl.style.display !== 'none' && !globalActionStatusEl.className.includes('success') && !globalActionStatusEl.className.includes('error')){\n"
-"                    globalActionStatusEl.style.display = 'none';\n"
-"                    globalActionStatusEl.textContent = '';\n"
-"                    globalActionStatusEl.className = 'status-message';\n"
-"                 }\n"
-"            }\n"
-"\n"
-"            // 2. Update WiFi Info\n"
-"            if (data.wifi) {\n"
-"                // Update WiFi networks list only if enough time has passed\n"
-"                const currentTime = Date.now();\n"
-"                if (currentTime - lastWifiUpdateTime >= WIFI_UPDATE_INTERVAL) {\n"
-"                    _updateNetworksListUI(data.wifi.networks);\n"
-"                    lastWifiUpdateTime = currentTime;\n"
-"                }\n"
-"                \n"
-"                // Always update connection status\n"
-"                const wifiStatusEl = document.getElementById('wifi-connection-status');\n"
-"                if (wifiStatusEl) {\n"
-"                    if (data.wifi.is_connected) {\n"
-"                        wifiStatusEl.textContent = `Connected to ${data.wifi.connected_ssid} (${data.wifi.ip_address})`;\n"
-"                    } else if (portalStatus && portalStatus.action_in_progress === 'SAVE_WIFI') {\n"
-"                        wifiStatusEl.textContent = \"Attempting to connect...\";\n"
-"                    } else {\n"
-"                        wifiStatusEl.textContent = \"Not Connected\";\n"
-"                    }\n"
-"                }\n"
-"            }\n"
-"\n"
-"            // 3. Update Device Config Info\n"
-"            if (data.device_config) {\n"
-"                _updateDeviceConfigUI(data.device_config);\n"
-"            }\n"
-"\n"
-"            \n"
-"            // 4a. Refresh card configuration periodically\n"
-"            // Note: We refresh cards on successful completion of card-related actions\n"
-"            if (portalStatus && portalStatus.last_action_completed && \n"
-"                (portalStatus.last_action_completed.includes('CARD') || \n"
-"                 portalStatus.last_action_status === 'SUCCESS')) {\n"
-"                // Refresh card data when actions complete\n"
-"                loadConfiguredCards();\n"
-"            }\n"
-"\n"
-"            // 5. Update OTA Firmware Info & UI State\n"
-"            if (data.ota) {\n"
-"                updateOtaUI(data.ota, data.portal);\n"
-"            }\n"
-"\n"
-"        })\n"
-"        .catch(error => {\n"
-"            console.error('Error polling /api/status:', error);\n"
-"            const globalActionStatusEl = document.getElementById('global-action-status');\n"
-"            if(globalActionStatusEl) {\n"
-"                globalActionStatusEl.textContent = 'Lost connection to device. Please check and refresh.';\n"
-"                globalActionStatusEl.className = 'status-message error';\n"
-"                globalActionStatusEl.style.display = 'block';\n"
-"            }\n"
-"        });\n"
-"}\n"
-"\n"
-"// Load current configuration - UI update part will be in pollApiStatus\n"
-"function _updateDeviceConfigUI(config) {\n"
-"    if (!initialDeviceConfigLoaded) {\n"
-"        if (config.team_id !== undefined) {\n"
-"            const teamIdField = document.getElementById('teamId');\n"
-"            // Only set value if field exists and is empty\n"
-"            if (teamIdField && !teamIdField.value) {\n"
-"                teamIdField.value = config.team_id;\n"
-"            }\n"
-"        }\n"
-"        if (config.api_key_display !== undefined) { \n"
-"            const apiKeyField = document.getElementById('apiKey');\n"
-"            // Only set value if field exists and is empty\n"
-"            if (apiKeyField && !apiKeyField.value) {\n"
-"                apiKeyField.value = config.api_key_display;\n"
-"            }\n"
-"        }\n"
-"        if (config.region !== undefined) {\n"
-"            // Handle region - set radio button or dropdown depending on UI\n"
-"            const regionRadios = document.querySelectorAll('input[name=\"region\"]');\n"
-"            regionRadios.forEach(radio => {\n"
-"                if (radio.value === config.region) {\n"
-"                    radio.checked = true;\n"
-"                }\n"
-"            });\n"
-"            // Also handle dropdown if it exists\n"
-"            const regionSelect = document.getElementById('region');\n"
-"            if (regionSelect) {\n"
-"                regionSelect.value = config.region;\n"
-"            }\n"
-"        }\n"
-"        initialDeviceConfigLoaded = true;\n"
-"    }\n"
-"}\n"
-"\n"
-"// Initialize page\n"
-"document.addEventListener('DOMContentLoaded', function() {\n"
-"    const hash = window.location.hash.substr(1);\n"
-"    if (hash && ['config-screen'].includes(hash)) {\n"
-"        showScreen(hash);\n"
-"    } else {\n"
-"        showScreen('config-screen');\n"
-"    }\n"
-"\n"
-"    const checkUpdateBtn = document.getElementById('check-update-btn');\n"
-"    const installUpdateBtn = document.getElementById('install-update-btn');\n"
-"\n"
-"    if (checkUpdateBtn) {\n"
-"        checkUpdateBtn.addEventListener('click', requestCheckFirmwareUpdate);\n"
-"    }\n"
-"    if (installUpdateBtn) {\n"
-"        installUpdateBtn.addEventListener('click', requestStartFirmwareUpdate);\n"
-"    }\n"
-"\n"
-"    pollApiStatus();\n"
-"    setInterval(pollApiStatus, 3000); // Poll every 3 seconds for responsiveness\n"
-"\n"
-"    const refreshBtn = document.getElementById('refresh-networks-btn');\n"
-"    if(refreshBtn) {\n"
-"        refreshBtn.addEventListener('click', requestScanNetworks);\n"
-"    }\n"
-"    \n"
-"    // Initialize card management with a small delay to avoid overwhelming the device\n"
-"    setTimeout(() => {\n"
-"        loadCardDefinitions();\n"
-"        setTimeout(() => {\n"
-"            loadConfiguredCards();\n"
-"        }, 500);\n"
-"    }, 1000);\n"
-"});\n"
-"\n"
-"// Enum for OtaManager::UpdateStatus::State (mirror from C++)\n"
-"// This helps in making the JS code more readable when checking status.\n"
-"const OTA_STATUS_STATE = {\n"
-"    IDLE: 0,\n"
-"    CHECKING_VERSION: 1,\n"
-"    DOWNLOADING: 2,\n"
-"    WRITING: 3,\n"
-"    SUCCESS: 4,\n"
-"    ERROR_WIFI: 5,\n"
-"    ERROR_HTTP_CHECK: 6,\n"
-"    ERROR_HTTP_DOWNLOAD: 7,\n"
-"    ERROR_JSON: 8,\n"
-"    ERROR_UPDATE_BEGIN: 9,\n"
-"    ERROR_UPDATE_WRITE: 10,\n"
-"    ERROR_UPDATE_END: 11,\n"
-"    ERROR_NO_ASSET: 12,\n"
-"    ERROR_NO_SPACE: 13\n"
-"};\n"
-"\n"
-"function requestCheckFirmwareUpdate() {\n"
-"    console.log(\"Requesting firmware update check...\");\n"
-"    const checkUpdateBtn = document.getElementById('check-update-btn');\n"
-"    if(checkUpdateBtn) checkUpdateBtn.disabled = true;\n"
-"\n"
-"    fetch('/api/actions/check-ota-update', { method: 'POST' })\n"
-"        .then(response => response.json())\n"
-"        .then(data => {\n"
-"            if (data.status === 'initiated') {\n"
-"                console.log('Firmware check initiated.');\n"
-"            } else {\n"
-"                console.error('Failed to initiate firmware check:', data.message);\n"
-"                if(checkUpdateBtn) checkUpdateBtn.disabled = false;\n"
-"                const updateStatusTextEl = document.getElementById('update-status-text');\n"
-"                if(updateStatusTextEl) updateStatusTextEl.textContent = `${data.message || 'Could not start check.'}`;\n"
-"            }\n"
-"        })\n"
-"        .catch(error => {\n"
-"            console.error('Error requesting firmware check:', error);\n"
-"            if(checkUpdateBtn) checkUpdateBtn.disabled = false;\n"
-"            const updateStatusTextEl = document.getElementById('update-status-text');\n"
-"            if(updateStatusTextEl) updateStatusTextEl.textContent = 'Communication error during check request.';\n"
-"        });\n"
-"}\n"
-"\n"
-"function requestStartFirmwareUpdate() {\n"
-"    console.log(\"Requesting firmware update start...\");\n"
-"    const installUpdateBtn = document.getElementById('install-update-btn');\n"
-"    const checkUpdateBtn = document.getElementById('check-update-btn');\n"
-"    if(installUpdateBtn) installUpdateBtn.disabled = true;\n"
-"    if(checkUpdateBtn) checkUpdateBtn.disabled = true;\n"
-"\n"
-"    fetch('/api/actions/start-ota-update', { method: 'POST' })\n"
-"        .then(response => response.json())\n"
-"        .then(data => {\n"
-"            if (data.status === 'initiated') {\n"
-"                console.log('Firmware update process initiated.');\n"
-"            } else {\n"
-"                console.error('Failed to initiate firmware update:', data.message);\n"
-"                if(installUpdateBtn) installUpdateBtn.disabled = false;\n"
-"                if(checkUpdateBtn) checkUpdateBtn.disabled = false;\n"
-"                const updateStatusTextEl = document.getElementById('update-status-text');\n"
-"                if(updateStatusTextEl) updateStatusTextEl.textContent = `Error: ${data.message || 'Could not start update.'}`;\n"
-"            }\n"
-"        })\n"
-"        .catch(error => {\n"
-"            console.error('Error requesting firmware update start:', error);\n"
-"            if(installUpdateBtn) installUpdateBtn.disabled = false;\n"
-"            if(checkUpdateBtn) checkUpdateBtn.disabled = false;\n"
-"            const updateStatusTextEl = document.getElementById('update-status-text');\n"
-"            if(updateStatusTextEl) updateStatusTextEl.textContent = 'Communication error during update request.';\n"
-"        });\n"
-"}\n"
-"\n"
-"// Helper function to update OTA UI based on status from /api/status\n"
-"function updateOtaUI(otaData, portalData) {\n"
-"    const currentVersionEl = document.getElementById('current-version');\n"
-"    const availableVersionEl = document.getElementById('available-version');\n"
-"    const availableVersionContainerEl = document.getElementById('available-version-container');\n"
-"    const releaseNotesEl = document.getElementById('release-notes');\n"
-"    const updateAvailableSection = document.getElementById('update-available-section');\n"
-"    const installUpdateBtn = document.getElementById('install-update-btn');\n"
-"    const updateStatusTextEl = document.getElementById('update-status-text');\n"
-"    const updateErrorEl = document.getElementById('update-error-message');\n"
-"    const checkUpdateBtn = document.getElementById('check-update-btn');\n"
-"    const updateProgressContainer = document.getElementById('update-progress-container');\n"
-"    const updateProgressBar = document.getElementById('update-progress-bar');\n"
-"\n"
-"    let portalOtaMessageDisplayed = false;\n"
-"    if (portalData && portalData.portal_ota_action_message) {\n"
-"        if (updateStatusTextEl) updateStatusTextEl.textContent = portalData.portal_ota_action_message;\n"
-"        portalOtaMessageDisplayed = true;\n"
-"        if (portalData.action_in_progress === 'CHECK_OTA_UPDATE' || portalData.action_in_progress === 'START_OTA_UPDATE') {\n"
-"            if (checkUpdateBtn) checkUpdateBtn.disabled = true;\n"
-"            if (installUpdateBtn) installUpdateBtn.disabled = true;\n"
-"        } else {\n"
-"        }\n"
-"    }\n"
-"\n"
-"    if (currentVersionEl) currentVersionEl.textContent = otaData.current_firmware_version || 'N/A';\n"
-"    \n"
-"    if (availableVersionContainerEl && availableVersionEl) {\n"
-"        if (otaData.update_available && otaData.available_version && otaData.available_version !== 'N/A') {\n"
-"            availableVersionEl.textContent = otaData.available_version;\n"
-"            availableVersionContainerEl.style.display = '';\n"
-"        } else {\n"
-"            availableVersionEl.textContent = 'N/A';\n"
-"            availableVersionContainerEl.style.display = 'none';\n"
-"        }\n"
-"    }\n"
-"\n"
-"    if (releaseNotesEl) releaseNotesEl.textContent = otaData.update_available ? (otaData.release_notes || 'No release notes.') : '';\n"
-"\n"
-"    if (updateAvailableSection) updateAvailableSection.style.display = otaData.update_available ? 'block' : 'none';\n"
-"    \n"
-"    if (installUpdateBtn) {\n"
-"        installUpdateBtn.disabled = !otaData.update_available || \n"
-"                                  (portalData && (portalData.action_in_progress === 'START_OTA_UPDATE' || portalData.action_in_progress === 'CHECK_OTA_UPDATE')) ||\n"
-"                                  otaData.status_code === OTA_STATUS_STATE.DOWNLOADING || \n"
-"                                  otaData.status_code === OTA_STATUS_STATE.WRITING;\n"
-"    }\n"
-"    \n"
-"    if (checkUpdateBtn) {\n"
-"        checkUpdateBtn.disabled = (portalData && (portalData.action_in_progress === 'CHECK_OTA_UPDATE' || portalData.action_in_progress === 'START_OTA_UPDATE')) ||\n"
-"                                otaData.status_code === OTA_STATUS_STATE.CHECKING_VERSION || \n"
-"                                otaData.status_code === OTA_STATUS_STATE.DOWNLOADING || \n"
-"                                otaData.status_code === OTA_STATUS_STATE.WRITING;\n"
-"    }\n"
-"\n"
-"    if (!portalOtaMessageDisplayed || (portalData && portalData.portal_ota_action_message && portalData.portal_ota_action_message.includes(\"Successfully dispatched\"))) {\n"
-"        if (updateStatusTextEl) {\n"
-"            let displayMessage = otaData.status_message || 'Idle';\n"
-"            if (portalOtaMessageDisplayed && otaData.status_message && otaData.status_message !== \"Idle\") {\n"
-"                updateStatusTextEl.textContent = displayMessage;\n"
-"            } else if (!portalOtaMessageDisplayed) {\n"
-"                 updateStatusTextEl.textContent = displayMessage;\n"
-"            }\n"
-"        }\n"
-"    }\n"
-"    \n"
-"    if (updateErrorEl) {\n"
-"        updateErrorEl.textContent = otaData.error_message || '';\n"
-"    }\n"
-"\n"
-"    if (otaData.status_code === OTA_STATUS_STATE.DOWNLOADING || otaData.status_code === OTA_STATUS_STATE.WRITING) {\n"
-"        if (updateProgressContainer) updateProgressContainer.style.display = 'block';\n"
-"        if (updateProgressBar) updateProgressBar.style.width = `${otaData.progress || 0}%`;\n"
-"    } else {\n"
-"        if (otaData.status_code !== OTA_STATUS_STATE.SUCCESS && updateProgressContainer) {\n"
-"        }\n"
-"    }\n"
-"    \n"
-"    if (otaData.status_code === OTA_STATUS_STATE.SUCCESS) {\n"
-"        if (updateStatusTextEl) updateStatusTextEl.textContent = otaData.status_message || 'Update successful! Device will reboot.';\n"
-"        if (updateProgressBar) updateProgressBar.style.width = '100%';\n"
-"        if (updateProgressContainer) updateProgressContainer.style.display = 'block';\n"
-"        if (installUpdateBtn) installUpdateBtn.disabled = true;\n"
-"        if (checkUpdateBtn) checkUpdateBtn.disabled = true;\n"
-"    }\n"
-"}\n"
-"</script>\n"
-"</head>\n"
-"<body>\n"
-"    <div class=\"header\">\n"
-"        <h1 id=\"page-title\">Configure your DeskHog</h1>\n"
-"    </div>\n"
-"    \n"
-"    <!-- Configuration Screen -->\n"
-"    <div id=\"config-screen\">\n"
-"        <div id=\"global-action-status\" class=\"status-message\" style=\"display:none; margin-bottom: 1em; padding: 0.75em; border-radius: 4px; text-align: center;\"></div>\n"
-"        <h2>WiFi</h2>\n"
-"        <div class=\"config-section\">\n"
-"            \n"
-"            <form id=\"wifi-form\" onsubmit=\"return saveWifiConfig()\">\n"
-"                <div class=\"form-group\">\n"
-"                    <select name=\"ssid\" id=\"ssid\" required>\n"
-"                        <option value=\"\">Select a network</option>\n"
-"                    </select>\n"
-"                </div>\n"
-"                \n"
-"                <div class=\"form-group\">\n"
-"                    <label for=\"password\">Password</label>\n"
-"                    <input type=\"password\" name=\"password\" id=\"password\">\n"
-"                </div>\n"
-"\n"
-"                <p class=\"tip\">If your network doesn't need a password, you can leave this blank.</p>\n"
-"                \n"
-"                <div class=\"button-container\">\n"
-"                    <button type=\"submit\">Save WiFi</button>\n"
-"                </div>\n"
-"            </form>\n"
-"            \n"
-"            <div class=\"button-container\">\n"
-"                <button type=\"button\" id=\"refresh-networks-btn\">Refresh network list</button>\n"
-"            </div>\n"
-"        </div>\n"
-"\n"
-"        <h2>Welcome to DeskHog</h2>\n"
-"        <div class=\"config-section\">\n"
-"            <p>DeskHog is a tiny platform for having fun with code, hardware and the internet. Check out the <a href=\"https://github.com/posthog/deskhog/blob/main/README.md\" target=\"_blank\">readme</a> to get hacking, especially the <a href=\"https://github.com/posthog/deskhog/blob/main/tech-details.md\" target=\"_blank\">tech details file</a>.</p>\n"
-"        </div>\n"
-"\n"
-"        <h2>PostHog API configuration</h2>\n"
-"\n"
-"        <div class=\"config-section\">\n"
-"            <form id=\"device-form\" onsubmit=\"return saveDeviceConfig()\">\n"
-"                <div class=\"form-group\">\n"
-"                    <label for=\"region\">Region</label>\n"
-"                    <select name=\"region\" id=\"region\" required>\n"
-"                        <option value=\"\">Select a region</option>\n"
-"                        <option value=\"us\">US</option>\n"
-"                        <option value=\"eu\">EU</option>\n"
-"                    </select>\n"
-"                </div>\n"
-"                <div class=\"form-group\">\n"
-"                    <label for=\"teamId\">Team ID</label>\n"
-"                    <input type=\"text\" name=\"teamId\" id=\"teamId\" min=\"-1\" required>\n"
-"                    <p class=\"tip\">This is the numeral that appears at the end of the URL when you're looking at your <a href=\"https://app.posthog.com/\" target=\"_blank\">project's homepage dashboard</a>.</p>\n"
-"                </div>\n"
-"                \n"
-"                <div class=\"form-group\">\n"
-"                    <label for=\"apiKey\">API key</label>\n"
-"                    <input type=\"text\" name=\"apiKey\" id=\"apiKey\">\n"
-"                    <p class=\"tip\">Create a <a href=\"https://app.posthog.com/settings/user-api-keys\" target=\"_blank\">new API key in your project settings</a>. Give it read access to insights.</p>\n"
-"                </div>\n"
-"                \n"
-"                <div class=\"button-container\">\n"
-"                    <button type=\"submit\">Save API configuration</button>\n"
-"                </div>\n"
-"            </form>\n"
-"        </div>\n"
-"\n"
-"        <h2>Add cards</h2>\n"
-"\n"
-"        <div class=\"config-section\">\n"
-"            <div id=\"available-cards-list\">\n"
-"                <!-- Will be populated by JavaScript -->\n"
-"                <p>Loading available card types...</p>\n"
-"            </div>\n"
-"        </div>\n"
-"\n"
-"        <h2>Manage cards</h2>\n"
-"        <div class=\"config-section\">\n"
-"            <div id=\"cards-list\">\n"
-"                <!-- Will be populated by JavaScript -->\n"
-"                <p>Loading cards...</p>\n"
-"            </div>\n"
-"        </div>\n"
-"\n"
-"        <!-- Firmware Update Section -->\n"
-"        <h2>Firmware update</h2>\n"
-"        <div class=\"config-section\" id=\"firmware-update-section\">\n"
-"            <p>Current version: <span id=\"current-version\">Checking...</span></p>\n"
-"            <p id=\"available-version-container\">Available version: <span id=\"available-version\">N/A</span></p>\n"
-"            <div class=\"button-container\">\n"
-"                <button type=\"button\" id=\"check-update-btn\">Check for updates</button>\n"
-"            </div>\n"
-"            <div id=\"update-available-section\" style=\"display:none;\">\n"
-"                <h4>Update details:</h4>\n"
-"                <pre id=\"release-notes\" class=\"release-notes-box\"></pre>\n"
-"                <div class=\"button-container\">\n"
-"                    <button type=\"button\" id=\"install-update-btn\">Install update</button>\n"
-"                </div>\n"
-"            </div>\n"
-"            <div id=\"update-status-container\" style=\"margin-top: 15px;\">\n"
-"                <p id=\"update-status-text\"></p>\n"
-"                <div class=\"progress\" id=\"update-progress-container\" style=\"display:none;\">\n"
-"                    <div id=\"update-progress-bar\" class=\"progress-bar\" style=\"width: 0%;\"></div>\n"
-"                </div>\n"
-"                <p id=\"update-error-message\" class=\"error-message\"></p>\n"
-"            </div>\n"
-"        </div>\n"
-"        <!-- End Firmware Update Section -->\n"
-"\n"
-"    </div>\n"
-"    \n"
-"    <footer>People who are really serious about software should make their own hardware. - Alan Kay</footer>\n"
-"\n"
-"</body>\n"
-"</html>";
+#include <stddef.h>
+#include <stdint.h>
+static const uint8_t PORTAL_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xed, 0x72, 0x1b, 0x37, 0x92, 0xff, 0xf9, 0x14,
+    0x30, 0x93, 0xec, 0x90, 0xb5, 0xfc, 0x92, 0x2c, 0x45, 0x0e, 0x29, 0x71, 0x4b, 0x91, 0xe8, 0x44, 0x17, 0x47, 0x72, 0x99,
+    0x72, 0x52, 0x57, 0x29, 0x97, 0x34, 0xe2, 0x80, 0xe4, 0xac, 0x86, 0x1c, 0xde, 0xcc, 0xd0, 0xb2, 0xd6, 0x61, 0xd5, 0xfd,
+    0xbf, 0x7f, 0x57, 0xf7, 0xff, 0xaa, 0xee, 0x01, 0xee, 0xa1, 0xee, 0x09, 0xee, 0x11, 0xae, 0xbb, 0xf1, 0x31, 0xc0, 0x7c,
+    0x90, 0x94, 0xac, 0x4d, 0xbc, 0x7b, 0x6b, 0xb9, 0x24, 0x12, 0x03, 0x34, 0x1a, 0x8d, 0x46, 0x7f, 0xa1, 0x81, 0x39, 0x7c,
+    0x76, 0x7a, 0x71, 0x72, 0xf9, 0xcf, 0xaf, 0x07, 0x6c, 0x9a, 0xcc, 0x82, 0x7e, 0xe5, 0x50, 0xfd, 0xe1, 0xae, 0x07, 0x7f,
+    0x66, 0x3c, 0x71, 0xd9, 0x68, 0xea, 0x46, 0x31, 0x4f, 0x8e, 0xaa, 0x6f, 0x2f, 0x5f, 0x36, 0x5f, 0x54, 0x55, 0xf1, 0xdc,
+    0x9d, 0xf1, 0xa3, 0xea, 0x7b, 0x9f, 0xdf, 0x2d, 0xc2, 0x28, 0xa9, 0xb2, 0x51, 0x38, 0x4f, 0xf8, 0x1c, 0xaa, 0xdd, 0xf9,
+    0x5e, 0x32, 0x3d, 0xf2, 0xf8, 0x7b, 0x7f, 0xc4, 0x9b, 0xf4, 0xa5, 0xc1, 0xfc, 0xb9, 0x9f, 0xf8, 0x6e, 0xd0, 0x8c, 0x47,
+    0x6e, 0xc0, 0x8f, 0x76, 0x5a, 0x1d, 0x04, 0x93, 0xf8, 0x49, 0xc0, 0xfb, 0x27, 0xe1, 0x7c, 0xec, 0x4f, 0x96, 0x11, 0x67,
+    0xa7, 0x3c, 0xbe, 0xfd, 0x3e, 0x9c, 0x1c, 0xb6, 0xc5, 0x83, 0xca, 0x61, 0x9c, 0xdc, 0xe3, 0xdf, 0x6e, 0x14, 0x86, 0x09,
+    0xfb, 0x58, 0xb9, 0x71, 0x47, 0xb7, 0x93, 0x28, 0x5c, 0xce, 0xbd, 0xe6, 0x28, 0x0c, 0xc2, 0xa8, 0xcb, 0xbe, 0x18, 0xec,
+    0x0f, 0x0e, 0x4e, 0x5f, 0xf6, 0x2a, 0xcd, 0xe6, 0x4d, 0x18, 0x79, 0x3c, 0xd2, 0x0f, 0x4e, 0x4f, 0x4e, 0x07, 0xa7, 0x7b,
+    0xf8, 0x00, 0xf1, 0x72, 0xfd, 0xb9, 0xf1, 0xec, 0xe5, 0xf3, 0x97, 0x7b, 0x2f, 0x3b, 0xd4, 0x68, 0x99, 0x24, 0xe1, 0x5c,
+    0xb6, 0x85, 0x27, 0x27, 0xf4, 0x2f, 0xf7, 0xa4, 0x39, 0x0d, 0xdf, 0xd3, 0xf3, 0xe3, 0xe3, 0x63, 0x7c, 0x18, 0xb9, 0x9e,
+    0xbf, 0x8c, 0xbb, 0xec, 0xc5, 0xe2, 0x03, 0x7e, 0xf5, 0xe7, 0x8b, 0x65, 0x92, 0x42, 0x7f, 0x49, 0xf8, 0x2c, 0xdc, 0x39,
+    0x0f, 0xb2, 0x85, 0x81, 0x7b, 0x63, 0x14, 0xba, 0x1d, 0xfc, 0x31, 0x7a, 0x8b, 0xa7, 0xae, 0x17, 0xde, 0xe1, 0xb0, 0x76,
+    0x4e, 0xe1, 0x1f, 0x3e, 0x49, 0xfc, 0x85, 0xae, 0xff, 0x7c, 0x0f, 0x7f, 0x08, 0x8e, 0x3f, 0xbf, 0x55, 0xc5, 0xd1, 0xe4,
+    0xa6, 0xb6, 0xbb, 0xb7, 0xcf, 0x0e, 0x5e, 0xb0, 0x4e, 0x1d, 0x1f, 0x7a, 0x7c, 0xec, 0x2e, 0x83, 0xa4, 0x39, 0x86, 0x81,
+    0x77, 0x59, 0x7c, 0x1f, 0x27, 0x7c, 0xd6, 0x5c, 0xfa, 0x0d, 0xd6, 0x74, 0x17, 0x8b, 0x80, 0x37, 0x45, 0x49, 0x83, 0xc5,
+    0xee, 0x3c, 0x6e, 0xc6, 0x3c, 0xf2, 0xc7, 0xbd, 0x0a, 0xd6, 0x6d, 0x8e, 0xdd, 0x99, 0x1f, 0xdc, 0x77, 0xd9, 0x7b, 0x37,
+    0xaa, 0xd9, 0x60, 0x00, 0xee, 0xaa, 0x72, 0x13, 0x7a, 0xf7, 0x30, 0x0b, 0x33, 0x37, 0x9a, 0xf8, 0xf3, 0x2e, 0x03, 0xc4,
+    0x17, 0xae, 0xe7, 0xf9, 0xf3, 0x49, 0x97, 0xed, 0x44, 0x7c, 0xd6, 0x2b, 0x98, 0x1f, 0x01, 0x29, 0x33, 0x03, 0x00, 0x4c,
+    0x8f, 0xe8, 0xf9, 0xf3, 0x1e, 0x00, 0xfc, 0x20, 0xd8, 0xa4, 0xcb, 0x0e, 0x3a, 0xa3, 0x69, 0x4f, 0xf6, 0xd0, 0x0c, 0xf8,
+    0x18, 0xf0, 0x77, 0x97, 0x49, 0xa8, 0x8b, 0x22, 0x7f, 0x32, 0xd5, 0x65, 0x6a, 0xd6, 0x76, 0x16, 0x1f, 0x58, 0x1c, 0x06,
+    0xbe, 0x27, 0xbb, 0x33, 0x39, 0x81, 0x10, 0x77, 0x01, 0x6b, 0x0b, 0xa1, 0x94, 0x7c, 0x75, 0x39, 0xf4, 0x3b, 0x2e, 0x20,
+    0x7f, 0xdd, 0x81, 0x61, 0x25, 0xfc, 0x43, 0x02, 0xc3, 0x1f, 0x85, 0x91, 0x9b, 0xf8, 0x21, 0x0c, 0x75, 0x1e, 0xce, 0x39,
+    0x02, 0x6a, 0xc1, 0x6c, 0x00, 0x2c, 0xab, 0xc5, 0x1e, 0xb6, 0xa0, 0x92, 0xd8, 0xff, 0x0b, 0x07, 0xb2, 0xb4, 0xbe, 0x21,
+    0x62, 0x58, 0x1d, 0xea, 0x59, 0xac, 0xeb, 0xa1, 0xdc, 0x84, 0x30, 0xe5, 0x33, 0xc0, 0xbe, 0xb5, 0x4f, 0xf5, 0x01, 0xfa,
+    0x88, 0x56, 0x02, 0x4c, 0xc9, 0x08, 0xbb, 0x2d, 0x64, 0x78, 0x01, 0xce, 0xe0, 0xad, 0x7a, 0x7e, 0x16, 0xc4, 0xf0, 0x15,
+    0x8f, 0x8a, 0x16, 0xe2, 0x5b, 0x41, 0xef, 0x46, 0x93, 0x2d, 0x28, 0x39, 0xdd, 0x69, 0xb0, 0xe9, 0x2e, 0xfb, 0xc8, 0xd4,
+    0x04, 0x76, 0xe8, 0x9f, 0x78, 0x94, 0xa5, 0xcc, 0x41, 0x86, 0x32, 0xe9, 0x48, 0x11, 0x44, 0x01, 0xdd, 0xad, 0xba, 0x02,
+    0xb3, 0x0c, 0xba, 0x9d, 0x94, 0x58, 0xe3, 0x30, 0x9a, 0x35, 0x91, 0x38, 0x30, 0x23, 0x2c, 0x3b, 0xaa, 0x7d, 0x58, 0x98,
+    0x6c, 0x55, 0xa1, 0xe5, 0x06, 0x5d, 0x79, 0x7e, 0xbc, 0x08, 0x5c, 0xe0, 0xec, 0x9b, 0x20, 0x1c, 0xdd, 0x96, 0x42, 0xcd,
+    0x63, 0xb4, 0xaa, 0xd0, 0xda, 0xfe, 0x25, 0xb9, 0x5f, 0xf0, 0x23, 0x07, 0xf9, 0xc2, 0x79, 0x87, 0xc2, 0x2c, 0x2d, 0x5b,
+    0xb8, 0x71, 0x7c, 0x07, 0x64, 0x72, 0xde, 0x41, 0x3f, 0x92, 0x8b, 0x77, 0x3a, 0x9d, 0xaf, 0x8c, 0x69, 0x21, 0x29, 0x91,
+    0x27, 0xf1, 0x17, 0x9e, 0xe7, 0xe5, 0x66, 0x4b, 0xd6, 0xfd, 0x80, 0x64, 0xa0, 0xc6, 0xf2, 0x39, 0x14, 0xd9, 0xf4, 0x51,
+    0x64, 0x90, 0x92, 0x43, 0x2f, 0x31, 0xbd, 0x40, 0x9b, 0x49, 0xb8, 0x90, 0x94, 0x10, 0x0c, 0xed, 0x06, 0xfe, 0x04, 0x78,
+    0x79, 0x04, 0x32, 0x9a, 0x47, 0xb4, 0x9e, 0xa9, 0x29, 0xc8, 0x01, 0x1e, 0x00, 0xc7, 0x99, 0x64, 0xf2, 0xe7, 0xb0, 0x42,
+    0x78, 0x53, 0x52, 0xcb, 0x1a, 0x95, 0x89, 0xc3, 0xd7, 0x8b, 0x0f, 0x45, 0x44, 0x9b, 0xea, 0x95, 0xa1, 0xfb, 0xce, 0x2f,
+    0xa6, 0x32, 0xd6, 0x36, 0x64, 0x69, 0x7d, 0x0d, 0x63, 0x9a, 0xd2, 0xb9, 0xbe, 0x89, 0xe7, 0x47, 0xcb, 0x28, 0xc6, 0x1e,
+    0x16, 0xa1, 0x2f, 0xc6, 0xae, 0xa7, 0xa6, 0x23, 0x07, 0x41, 0x14, 0x97, 0xc2, 0xb7, 0xc3, 0xf6, 0xa0, 0xb7, 0x0e, 0xfc,
+    0x58, 0x7d, 0x89, 0xc7, 0xf5, 0x46, 0xa5, 0xc3, 0xf6, 0x8b, 0x9e, 0x6b, 0x5c, 0xe4, 0x70, 0xfc, 0xf9, 0x14, 0x44, 0x6b,
+    0x02, 0x02, 0xf9, 0x8e, 0xdf, 0xdc, 0xfa, 0x49, 0x33, 0x71, 0x17, 0xcd, 0x29, 0x50, 0x26, 0x40, 0xea, 0xa8, 0x41, 0x27,
+    0x11, 0x08, 0xe1, 0x85, 0x1b, 0xc1, 0xa4, 0x68, 0x6e, 0x33, 0x66, 0xc4, 0x26, 0xa5, 0x9a, 0xb2, 0xae, 0x0b, 0x02, 0xe2,
+    0x3d, 0x2f, 0xd6, 0x88, 0xa0, 0xf8, 0x4e, 0x4f, 0xbf, 0xc1, 0xca, 0x4b, 0x64, 0xfd, 0xc0, 0x8f, 0x61, 0xbe, 0x50, 0x8f,
+    0x2a, 0xca, 0xa7, 0x83, 0xef, 0x99, 0xb2, 0x1c, 0x56, 0x8b, 0x9f, 0x32, 0x8f, 0x2d, 0x1f, 0xf0, 0x59, 0x37, 0x70, 0x01,
+    0xd2, 0x68, 0xea, 0x07, 0x5e, 0xbe, 0x1a, 0xb5, 0x1f, 0x83, 0x96, 0x26, 0x06, 0x2c, 0x62, 0x37, 0x93, 0x29, 0xf7, 0x4c,
+    0x01, 0xf9, 0xc5, 0xc1, 0xc1, 0x41, 0x46, 0x80, 0xbe, 0x90, 0xbc, 0x3d, 0xe7, 0x09, 0x2c, 0xad, 0xdb, 0x26, 0x8e, 0x81,
+    0xfa, 0xfc, 0xd0, 0x54, 0x04, 0xd9, 0xed, 0x10, 0x45, 0x50, 0x2d, 0x8f, 0x83, 0xf0, 0xae, 0x79, 0x5f, 0xae, 0x14, 0x0a,
+    0xd7, 0xd9, 0x1e, 0xb6, 0x2e, 0x92, 0x1a, 0x66, 0xbf, 0x3e, 0xa8, 0x49, 0xe8, 0xd7, 0x5c, 0xc8, 0xb2, 0x92, 0x5e, 0x95,
+    0xb2, 0x65, 0xda, 0x19, 0xe7, 0xbc, 0x80, 0xe1, 0x32, 0x40, 0xbb, 0x64, 0x4f, 0x14, 0xcf, 0xdf, 0x78, 0x1f, 0x7f, 0x72,
+    0x4d, 0x5a, 0x82, 0x27, 0xb8, 0x57, 0xdc, 0x8a, 0x77, 0xc6, 0x9d, 0xf1, 0x98, 0x5a, 0xe1, 0xa2, 0x6d, 0xfa, 0x23, 0x52,
+    0x20, 0x96, 0x26, 0x55, 0xc3, 0x8b, 0x97, 0xa3, 0x11, 0x8f, 0x63, 0x55, 0x47, 0x81, 0xd8, 0x7d, 0xe1, 0x1e, 0xec, 0xed,
+    0x5b, 0x53, 0xb1, 0xf7, 0xa2, 0x4c, 0x7a, 0x28, 0xc6, 0xd9, 0xed, 0xe0, 0x5a, 0x20, 0xb0, 0x8b, 0x28, 0x9c, 0x44, 0x00,
+    0xd7, 0x60, 0x5b, 0xb1, 0xb6, 0x0a, 0xb0, 0xfd, 0x86, 0x8f, 0xf8, 0x38, 0x37, 0x29, 0xbb, 0xe9, 0xa4, 0xa4, 0x90, 0xd5,
+    0x14, 0x77, 0xd9, 0xd4, 0xf7, 0x3c, 0x3e, 0xb7, 0xfa, 0x6a, 0xde, 0xb8, 0x91, 0xd1, 0x9f, 0x10, 0x51, 0x05, 0x1d, 0x8e,
+    0x46, 0x07, 0xa4, 0xa6, 0xa4, 0x28, 0xc3, 0x5a, 0xb4, 0xf2, 0x7c, 0x21, 0x92, 0xa8, 0x18, 0x5a, 0xc7, 0x0c, 0xe5, 0x9e,
+    0x2b, 0x26, 0x4c, 0x74, 0x67, 0x8a, 0x45, 0x65, 0x06, 0xe8, 0xe5, 0xa9, 0x96, 0x36, 0xd8, 0x55, 0xd0, 0xca, 0x9d, 0x8f,
+    0xf4, 0x22, 0x6b, 0xce, 0xc2, 0xbf, 0x14, 0x14, 0xe7, 0x4b, 0x0c, 0x64, 0xfd, 0x99, 0x3b, 0x81, 0xf2, 0x65, 0x14, 0xd4,
+    0xaa, 0x9e, 0x9b, 0xb8, 0x5d, 0x2a, 0x68, 0xc7, 0xef, 0x27, 0x7f, 0xfc, 0x30, 0x0b, 0x7a, 0xca, 0x0c, 0x7f, 0x3b, 0x6c,
+    0x1e, 0x0f, 0x4f, 0xce, 0xce, 0x1a, 0x5f, 0x3d, 0x3f, 0x81, 0x67, 0x0c, 0x9e, 0xcd, 0xe3, 0x23, 0x67, 0x9a, 0x24, 0x8b,
+    0x6e, 0xbb, 0x7d, 0x77, 0x77, 0xd7, 0xba, 0x7b, 0xde, 0x0a, 0xa3, 0x49, 0x1b, 0xd6, 0x48, 0x07, 0x5b, 0x3b, 0x62, 0x7c,
+    0x47, 0xce, 0xee, 0x9e, 0xc3, 0x04, 0xa9, 0xc4, 0x67, 0xb4, 0xdd, 0xbf, 0x0d, 0x3f, 0x1c, 0x39, 0x28, 0xcc, 0x76, 0xf7,
+    0x18, 0x96, 0x8d, 0xfd, 0x20, 0x38, 0x72, 0x10, 0x37, 0x87, 0xc5, 0x49, 0x14, 0xde, 0x82, 0x8e, 0xfb, 0x6a, 0xf7, 0xb9,
+    0xf8, 0xa7, 0x8a, 0x9a, 0x0a, 0xa0, 0x2e, 0x40, 0xba, 0x8d, 0xdc, 0xc5, 0x91, 0x43, 0x43, 0xb1, 0x8a, 0xff, 0x0c, 0x8b,
+    0x40, 0x95, 0x7f, 0xf5, 0x7c, 0x00, 0x58, 0x2f, 0xc2, 0xe0, 0x1e, 0x9f, 0x88, 0xf5, 0x01, 0xb8, 0x7f, 0xcd, 0xbe, 0x61,
+    0x3b, 0xbb, 0xb0, 0xb6, 0xd8, 0xce, 0x0b, 0xf6, 0x8d, 0xac, 0xd5, 0x56, 0xd5, 0xe4, 0x57, 0x18, 0x09, 0x7c, 0xaa, 0xd6,
+    0x2d, 0x9a, 0x45, 0x1c, 0x08, 0x9a, 0x20, 0x31, 0xe5, 0x47, 0xeb, 0xe9, 0x22, 0x54, 0x33, 0x4c, 0x86, 0x23, 0x88, 0x96,
+    0x03, 0x10, 0x3d, 0x0c, 0x84, 0x10, 0xdb, 0xcf, 0x70, 0x4a, 0xaa, 0x56, 0xa5, 0x20, 0x91, 0xab, 0x5e, 0x99, 0x9c, 0xbb,
+    0x6b, 0x2d, 0x5c, 0x5b, 0x6b, 0x6d, 0x63, 0x4c, 0x0b, 0x1e, 0xea, 0x76, 0x9b, 0xb3, 0xb8, 0xc9, 0x3f, 0x80, 0x41, 0xe7,
+    0x15, 0x71, 0x5a, 0x2b, 0x4e, 0xdc, 0x64, 0x19, 0x37, 0x67, 0xc0, 0xeb, 0xc0, 0x0b, 0xa6, 0x30, 0x82, 0xb1, 0xec, 0x17,
+    0x58, 0x48, 0x3b, 0x05, 0x26, 0xe0, 0x5e, 0xd9, 0x2a, 0xb6, 0x10, 0x9d, 0x85, 0xf3, 0x10, 0x54, 0xd1, 0x88, 0x3a, 0xfe,
+    0x62, 0xec, 0x47, 0xb3, 0x3b, 0xd0, 0x4b, 0xcd, 0xe5, 0x02, 0x78, 0x91, 0x1b, 0x46, 0x69, 0x79, 0xa3, 0x0c, 0xb6, 0x2d,
+    0x7f, 0x3e, 0x0e, 0x4b, 0xc4, 0xd5, 0xc1, 0xf8, 0xf9, 0x98, 0x17, 0x4b, 0xeb, 0x0e, 0x77, 0x51, 0x92, 0x69, 0x17, 0x61,
+    0xe7, 0xa0, 0xf3, 0x62, 0x5c, 0x04, 0x5e, 0xca, 0xb1, 0xe2, 0x1e, 0xbc, 0x3d, 0xee, 0x79, 0x6e, 0x61, 0x0f, 0xa3, 0xe7,
+    0xfc, 0xeb, 0xd1, 0x4d, 0xda, 0xc3, 0xce, 0xfe, 0xfe, 0xc1, 0xee, 0x5e, 0x51, 0x0f, 0x3c, 0x8a, 0xc2, 0x32, 0x31, 0xfd,
+    0xc2, 0x3b, 0x28, 0x81, 0x3f, 0xde, 0x1f, 0x59, 0xf0, 0x0f, 0x76, 0x77, 0x46, 0x02, 0xfe, 0x17, 0x11, 0xcc, 0xba, 0x1b,
+    0xf3, 0xe6, 0x1c, 0x34, 0x65, 0xbc, 0x86, 0x96, 0x77, 0x53, 0x1f, 0x69, 0x8e, 0x5f, 0x40, 0x8b, 0xc0, 0x2c, 0xdc, 0x45,
+    0xee, 0x02, 0x8a, 0xa1, 0x33, 0xfa, 0x08, 0x76, 0x61, 0xc4, 0xdd, 0xdb, 0x26, 0x16, 0xf4, 0x8a, 0xd1, 0x1b, 0x7f, 0x33,
+    0x2e, 0x46, 0xcf, 0xe3, 0x7c, 0x97, 0x7f, 0x6d, 0xba, 0x0d, 0x1d, 0x21, 0x77, 0xb7, 0xd6, 0xae, 0x65, 0x76, 0x16, 0x10,
+    0xd0, 0x7d, 0xef, 0xfa, 0x60, 0x75, 0x83, 0x97, 0x39, 0x72, 0x01, 0x57, 0xa9, 0x41, 0xb7, 0xf4, 0x2f, 0xd6, 0x43, 0xcf,
+    0xb8, 0x39, 0x25, 0x36, 0xfc, 0x76, 0x2b, 0x54, 0x2f, 0xb4, 0x71, 0xc0, 0x61, 0xa0, 0x7f, 0x5e, 0xc6, 0x89, 0x3f, 0xbe,
+    0x6f, 0xca, 0x10, 0x06, 0x38, 0xcd, 0x48, 0xf9, 0xe6, 0x0d, 0xe8, 0x5f, 0x8e, 0x1a, 0x87, 0x96, 0x0d, 0x0d, 0x26, 0x36,
+    0x0d, 0xe8, 0xdc, 0x68, 0x05, 0xbf, 0x23, 0x4c, 0xc0, 0xb2, 0xa8, 0x06, 0xc6, 0x4c, 0x0a, 0x5d, 0x9f, 0xdc, 0x68, 0x76,
+    0xb5, 0xa3, 0x93, 0x01, 0xe1, 0xf1, 0x78, 0x14, 0xf9, 0x0b, 0x73, 0x31, 0xae, 0x71, 0x3c, 0x8d, 0x80, 0x43, 0xfd, 0x21,
+    0xbd, 0x88, 0x85, 0x90, 0xed, 0xe0, 0xc5, 0xa6, 0x0e, 0x44, 0x6d, 0x61, 0x6d, 0xfa, 0x09, 0x90, 0x6d, 0x54, 0x04, 0xdc,
+    0x25, 0x51, 0x12, 0x9b, 0x02, 0x4f, 0xcc, 0x03, 0xfe, 0x6e, 0x7a, 0x7e, 0x24, 0x64, 0x4d, 0x17, 0xbd, 0xcc, 0xe5, 0x0c,
+    0xe8, 0x3f, 0x41, 0x8e, 0x57, 0x33, 0x3c, 0x83, 0x11, 0x28, 0x97, 0x64, 0x57, 0xda, 0xc5, 0x2d, 0xe0, 0x0d, 0x01, 0xfb,
+    0x26, 0x59, 0xe7, 0x38, 0x3f, 0xce, 0xbb, 0x30, 0x64, 0x2e, 0xa2, 0xb0, 0x95, 0x9f, 0x9d, 0x33, 0x01, 0xf3, 0x73, 0x6e,
+    0xf9, 0x55, 0x4f, 0xe9, 0x81, 0x64, 0xe8, 0xb1, 0xce, 0xda, 0x4c, 0xbd, 0x05, 0xbb, 0xc9, 0x76, 0x1e, 0x46, 0xcb, 0x03,
+    0x79, 0x96, 0xf0, 0x87, 0x53, 0x5e, 0x4b, 0xe9, 0xd1, 0xf3, 0x7d, 0xb4, 0x39, 0x1f, 0x3c, 0x13, 0x48, 0x00, 0x21, 0xb7,
+    0x3e, 0x79, 0x1a, 0x6c, 0xca, 0xef, 0x6e, 0xa0, 0xfc, 0xf3, 0x4d, 0x94, 0xcf, 0x90, 0x64, 0x4b, 0xe2, 0x67, 0x5b, 0x6d,
+    0x49, 0x7f, 0x19, 0x31, 0x22, 0xe2, 0xda, 0xc6, 0x01, 0xad, 0xec, 0x54, 0x2a, 0x3e, 0x4a, 0x00, 0xef, 0x2d, 0x3e, 0x14,
+    0x86, 0xb6, 0xf2, 0x8c, 0x5b, 0x10, 0xac, 0x40, 0xec, 0x1e, 0xae, 0x02, 0x72, 0x4a, 0x49, 0x38, 0x03, 0xfb, 0xc2, 0x17,
+    0xc8, 0xe0, 0xb7, 0x6f, 0xbb, 0x17, 0xa8, 0xf6, 0xbe, 0xc1, 0x9f, 0x74, 0xda, 0x67, 0x40, 0x7c, 0xdb, 0xd4, 0x77, 0x83,
+    0x00, 0xa9, 0x13, 0x33, 0xd4, 0xc3, 0x36, 0x96, 0x05, 0x53, 0x85, 0x20, 0xd1, 0xb3, 0x2a, 0x64, 0x13, 0x5c, 0xa4, 0xd1,
+    0xe4, 0xc6, 0xad, 0x75, 0x1a, 0xf4, 0xd3, 0xda, 0xa9, 0xdb, 0x00, 0x5b, 0x5e, 0xe4, 0x4e, 0x00, 0xff, 0x09, 0xc0, 0x0c,
+    0x41, 0xa3, 0xf8, 0xc9, 0x3d, 0xc9, 0x10, 0x89, 0x11, 0x46, 0xb0, 0xc0, 0x32, 0x0d, 0x41, 0xd4, 0xf2, 0xda, 0xae, 0xc7,
+    0x27, 0x45, 0xcd, 0x9b, 0x0a, 0x27, 0x3b, 0xbc, 0xdd, 0xe9, 0x1c, 0xdc, 0xa0, 0x95, 0x64, 0xa1, 0xca, 0x9f, 0x8f, 0x77,
+    0xc7, 0xa9, 0xaf, 0x2b, 0xe5, 0xb0, 0xe7, 0xc6, 0x53, 0x9e, 0x96, 0xca, 0xc9, 0xdb, 0x95, 0x82, 0x93, 0xfa, 0x98, 0x82,
+    0xf9, 0x19, 0xf0, 0x5c, 0x94, 0xd4, 0x12, 0xed, 0x8a, 0xa4, 0x93, 0xc8, 0xbd, 0xc9, 0x84, 0xea, 0x76, 0x4d, 0x85, 0x2c,
+    0xed, 0x65, 0xc5, 0x79, 0xcb, 0x18, 0x31, 0x11, 0xc6, 0x6e, 0x6a, 0xd6, 0x1a, 0xbd, 0xa6, 0xac, 0x6e, 0xf6, 0x70, 0x03,
+    0x54, 0xc3, 0x9a, 0x87, 0x6d, 0xb9, 0x07, 0x70, 0x28, 0xb4, 0x5e, 0xbf, 0x32, 0x5e, 0xce, 0x85, 0x25, 0x1a, 0x4f, 0xc3,
+    0xbb, 0xe1, 0x28, 0x02, 0x05, 0x5d, 0x8b, 0xe9, 0xcf, 0x99, 0x57, 0xa7, 0x21, 0xcc, 0xe3, 0x84, 0x89, 0x92, 0x98, 0x1d,
+    0xb1, 0x5f, 0x1c, 0x15, 0x56, 0xa5, 0x22, 0xe7, 0x5d, 0xaf, 0x22, 0x1f, 0x62, 0x08, 0x71, 0xe0, 0x8e, 0xa6, 0x35, 0x60,
+    0xc6, 0xa3, 0xbe, 0x6e, 0xca, 0x03, 0x68, 0xe5, 0x85, 0xa3, 0xe5, 0x0c, 0x14, 0x7d, 0x6b, 0xc2, 0x93, 0x41, 0xc0, 0xf1,
+    0xe3, 0xb7, 0xf7, 0x67, 0x1e, 0x54, 0x05, 0x52, 0xf8, 0x63, 0x56, 0xe3, 0x41, 0x1d, 0x6a, 0xb6, 0x46, 0x81, 0x1b, 0xc7,
+    0xaf, 0xfc, 0x38, 0x41, 0xf1, 0x59, 0x73, 0x84, 0xcf, 0xe8, 0xe0, 0x44, 0x92, 0x94, 0x4b, 0x51, 0xb9, 0x0c, 0x87, 0x80,
+    0xef, 0x1a, 0xc8, 0x7a, 0x0c, 0x02, 0xbe, 0xd9, 0xaa, 0x6e, 0xc1, 0x30, 0xfa, 0x04, 0x0a, 0x03, 0x7b, 0x98, 0xdd, 0x82,
+    0x14, 0x61, 0xb4, 0x7b, 0x02, 0x3d, 0x55, 0xe5, 0x7e, 0x0a, 0x1b, 0xc9, 0x1d, 0x16, 0x0a, 0xc0, 0x55, 0xc1, 0xfa, 0x29,
+    0x41, 0xc1, 0x59, 0x80, 0xd1, 0xdb, 0xa4, 0xe6, 0x4e, 0xbd, 0x85, 0x0e, 0xc3, 0x89, 0x30, 0x88, 0x00, 0x18, 0x95, 0x52,
+    0x94, 0x47, 0xd3, 0xdf, 0x7d, 0xcf, 0x7f, 0xf6, 0xc7, 0xbe, 0xd8, 0xbf, 0xa9, 0xa5, 0xb4, 0x47, 0xbe, 0x5e, 0x33, 0x50,
+    0xe7, 0x0e, 0x1a, 0x35, 0xb1, 0x92, 0xa3, 0x69, 0x84, 0xdf, 0x4e, 0xc1, 0xe5, 0x85, 0x66, 0x73, 0x7e, 0xc7, 0x5e, 0xca,
+    0xaf, 0x35, 0x2c, 0xd7, 0x95, 0x26, 0x41, 0x78, 0xe3, 0x06, 0xc7, 0xd4, 0xfb, 0x90, 0xec, 0x93, 0xc1, 0xba, 0xa9, 0x72,
+    0x44, 0x7d, 0x69, 0x6d, 0x48, 0x8b, 0x06, 0xbb, 0x1c, 0xf3, 0x04, 0x26, 0xdd, 0x69, 0xbb, 0x0b, 0xbf, 0x2d, 0x4d, 0x91,
+    0x36, 0x0e, 0xa6, 0x89, 0x88, 0x39, 0x0d, 0x0c, 0x9b, 0xf0, 0x64, 0x1a, 0xc2, 0x8a, 0x72, 0x5e, 0x5f, 0x0c, 0x2f, 0x9d,
+    0x06, 0xed, 0x7c, 0x74, 0x35, 0x92, 0x30, 0xb7, 0x95, 0x56, 0x32, 0x05, 0xbe, 0x8b, 0x78, 0xbc, 0x80, 0xd6, 0x1c, 0xd9,
+    0x47, 0x7d, 0x6e, 0xfd, 0x39, 0x0e, 0xe7, 0xb5, 0xba, 0xaa, 0xe2, 0xd1, 0xa8, 0x90, 0xbb, 0x70, 0x56, 0xe9, 0xdb, 0x1f,
+    0xfe, 0xc0, 0xf0, 0xaf, 0x74, 0x36, 0xd8, 0xd1, 0xd1, 0x11, 0x73, 0xfe, 0x65, 0xc9, 0x97, 0xdc, 0x73, 0x14, 0x11, 0xc3,
+    0x80, 0xb7, 0x82, 0x70, 0x52, 0xab, 0x0e, 0x01, 0x2f, 0xf6, 0xb3, 0xff, 0xd2, 0x67, 0xae, 0xa4, 0xba, 0x70, 0x7a, 0xc6,
+    0xcb, 0x20, 0xb8, 0x67, 0xa2, 0x55, 0xab, 0xda, 0x10, 0x00, 0xa5, 0xdb, 0x22, 0x39, 0xa8, 0x88, 0x5c, 0x08, 0xbf, 0xa8,
+    0x3c, 0x33, 0xd9, 0x26, 0x34, 0xf6, 0xeb, 0xaf, 0xcc, 0x40, 0x43, 0x6c, 0xe4, 0x25, 0xd0, 0x2b, 0x3b, 0xa5, 0x1d, 0x3e,
+    0x76, 0xe7, 0x83, 0x48, 0x75, 0x13, 0x10, 0x58, 0x0b, 0xe0, 0xbd, 0x10, 0xb9, 0x6d, 0x0e, 0xab, 0xbd, 0x05, 0x8c, 0x56,
+    0xd8, 0x15, 0xb1, 0xef, 0x39, 0x1a, 0xc2, 0x30, 0xee, 0x8c, 0x7f, 0x8b, 0x16, 0xb4, 0x53, 0xd2, 0x8e, 0x04, 0x41, 0x4b,
+    0x5a, 0x8c, 0xd8, 0x96, 0xc2, 0xd3, 0x50, 0x3b, 0xe6, 0xc9, 0xa5, 0x3f, 0xe3, 0xe1, 0x32, 0xa9, 0x01, 0x17, 0x6a, 0x5a,
+    0x6f, 0x1e, 0x27, 0x10, 0xbe, 0xf6, 0x34, 0x43, 0xad, 0x97, 0x12, 0x36, 0x87, 0x35, 0x85, 0x56, 0x7a, 0xdb, 0xcc, 0x82,
+    0xe3, 0x3c, 0x9c, 0x82, 0x0e, 0x2e, 0xd1, 0x55, 0x83, 0xed, 0x77, 0x3a, 0x1d, 0x52, 0x27, 0x2b, 0x90, 0x52, 0x31, 0x4f,
+    0x85, 0x1b, 0x7a, 0xb4, 0x3f, 0xca, 0xe1, 0x1e, 0x65, 0x18, 0x52, 0xf1, 0x0f, 0xfb, 0x93, 0xcd, 0x01, 0x5d, 0x56, 0x7d,
+    0x09, 0x06, 0x3c, 0xf7, 0x70, 0xcc, 0x8a, 0x2a, 0x82, 0x46, 0xb8, 0x6e, 0x70, 0xa6, 0x15, 0xd3, 0x12, 0xfc, 0xda, 0xda,
+    0xea, 0x5d, 0x60, 0x57, 0x13, 0x8d, 0x4f, 0x67, 0x57, 0x13, 0xda, 0x23, 0x98, 0x8e, 0x9a, 0xff, 0x55, 0xb9, 0x4e, 0xf7,
+    0xde, 0xf2, 0xe7, 0xa3, 0x60, 0x09, 0x2e, 0x5c, 0xcd, 0x11, 0xbd, 0x7e, 0x76, 0x8c, 0x73, 0xa0, 0x19, 0x87, 0xc4, 0xdc,
+    0xc8, 0x45, 0x59, 0xa9, 0x06, 0x98, 0x99, 0xe5, 0x93, 0x70, 0x36, 0x5b, 0xce, 0xfd, 0x11, 0xe9, 0x15, 0x41, 0x46, 0x96,
+    0x44, 0xf7, 0x68, 0xf0, 0xc0, 0xcc, 0xc7, 0x6a, 0x21, 0xb5, 0xaa, 0x9f, 0x3e, 0xc5, 0xdb, 0xf7, 0xf5, 0x0f, 0x06, 0x78,
+    0x2a, 0x06, 0x80, 0xdf, 0x11, 0x4f, 0x96, 0xd1, 0x9c, 0x8d, 0xdd, 0x20, 0xce, 0x2b, 0x7f, 0x21, 0x14, 0x1f, 0xac, 0xfe,
+    0x65, 0x62, 0xc8, 0xe7, 0x68, 0x00, 0x48, 0xd4, 0x84, 0xbd, 0xf4, 0x39, 0x5a, 0x02, 0x02, 0x41, 0x69, 0xd0, 0xfd, 0xbe,
+    0x26, 0xc1, 0xa9, 0x89, 0x8a, 0xb4, 0x2d, 0xc5, 0x3a, 0x4c, 0xf5, 0xe6, 0xdf, 0xa8, 0x09, 0xb0, 0xd5, 0xd0, 0xfe, 0x3f,
+    0xaa, 0x7c, 0x9b, 0xfd, 0xb6, 0xd7, 0xfd, 0xf9, 0x76, 0xff, 0x30, 0x02, 0xfe, 0x9e, 0x8d, 0x00, 0x98, 0x61, 0x54, 0xcc,
+    0xd6, 0xb4, 0xff, 0xd5, 0xac, 0x80, 0xe2, 0xce, 0xfe, 0xc1, 0x02, 0xbf, 0x85, 0x19, 0x90, 0x84, 0x93, 0x49, 0xc0, 0x8f,
+    0x17, 0xfe, 0x0f, 0xfc, 0xfe, 0x27, 0x3f, 0xf6, 0x6f, 0xfc, 0xc0, 0x4f, 0xee, 0x0d, 0x63, 0xc0, 0xa5, 0x47, 0x67, 0x14,
+    0x9f, 0x5c, 0xa3, 0xa9, 0x45, 0x35, 0xd4, 0xcd, 0x46, 0x83, 0x16, 0x66, 0x58, 0x41, 0xab, 0x7c, 0x11, 0xea, 0x49, 0x9d,
+    0x78, 0x05, 0xa2, 0x4b, 0x64, 0x66, 0x81, 0xd0, 0x4a, 0x4b, 0x29, 0x69, 0x85, 0x03, 0x02, 0x6a, 0xeb, 0xe1, 0xc4, 0x8d,
+    0xbc, 0x4b, 0x68, 0x4d, 0x31, 0xa1, 0x77, 0x22, 0x52, 0xa2, 0x24, 0x3c, 0xf7, 0xf0, 0xa9, 0x7a, 0xe2, 0xc6, 0xf7, 0xf3,
+    0x11, 0xd3, 0x63, 0x0c, 0x42, 0x97, 0x1e, 0x9f, 0xf2, 0x31, 0x09, 0x34, 0x18, 0x17, 0x0d, 0x10, 0xac, 0x4f, 0x3d, 0xcc,
+    0x54, 0xfd, 0x33, 0xf7, 0xce, 0xf5, 0xc1, 0x9e, 0x31, 0x4c, 0x0c, 0x0c, 0xe8, 0xc5, 0x6d, 0x2f, 0x6d, 0xee, 0xc8, 0x95,
+    0xf0, 0x4c, 0x5b, 0x0a, 0xe1, 0x2d, 0x41, 0x9c, 0x46, 0xe1, 0x1d, 0xd9, 0x3f, 0x03, 0x5a, 0x5b, 0xd7, 0xdf, 0x5f, 0x5e,
+    0xbe, 0x66, 0x5f, 0x7e, 0xd4, 0xd5, 0xc4, 0x54, 0xad, 0xba, 0xf9, 0xb2, 0x4b, 0x20, 0xc0, 0xea, 0x9a, 0x26, 0x4c, 0x60,
+    0x64, 0x74, 0xa7, 0x91, 0xca, 0x18, 0x26, 0x30, 0xd2, 0x22, 0xe2, 0x18, 0x2d, 0x7b, 0x15, 0xb1, 0xfb, 0x7b, 0x6c, 0xd6,
+    0xa3, 0xd0, 0x53, 0xad, 0xde, 0xb3, 0xcc, 0x13, 0xe7, 0x15, 0x50, 0x09, 0xcc, 0x96, 0x86, 0xd9, 0xbc, 0x15, 0xf0, 0xf9,
+    0x04, 0xb3, 0x7f, 0x1d, 0x24, 0x01, 0xcb, 0x50, 0x60, 0xc5, 0x48, 0xae, 0xb0, 0x1a, 0xad, 0x80, 0x7a, 0x4e, 0xb2, 0x38,
+    0xa9, 0x22, 0xc1, 0x29, 0x60, 0x59, 0x18, 0x5d, 0x47, 0xaa, 0x90, 0xb2, 0x81, 0xe0, 0x5c, 0xa2, 0x08, 0x2b, 0x9a, 0x4f,
+    0x7b, 0xe2, 0x1f, 0x33, 0x9f, 0x29, 0xef, 0xfc, 0x16, 0xd3, 0x39, 0x92, 0xfc, 0x59, 0x32, 0x91, 0x79, 0x46, 0xa6, 0x06,
+    0x6a, 0xfe, 0xf4, 0xb4, 0xbd, 0x3d, 0xc3, 0xda, 0x6b, 0x26, 0x95, 0xb5, 0xdb, 0xec, 0x2d, 0x3d, 0x56, 0x2b, 0x87, 0x56,
+    0x34, 0x13, 0x68, 0x95, 0x4c, 0x39, 0xf5, 0x65, 0x4c, 0xb6, 0x46, 0x46, 0x3c, 0x79, 0xd4, 0x64, 0x67, 0x60, 0x98, 0x93,
+    0x5d, 0xbc, 0x6a, 0x9f, 0x78, 0xa4, 0x2b, 0x53, 0xcc, 0x95, 0x83, 0xd1, 0x1c, 0x93, 0x26, 0x60, 0xae, 0x13, 0x73, 0xd6,
+    0x3e, 0x68, 0x4c, 0x89, 0x6d, 0x9a, 0x7b, 0x34, 0x84, 0x3a, 0x13, 0xf2, 0x56, 0x96, 0x17, 0xf0, 0x36, 0x18, 0xa9, 0xf9,
+    0x52, 0x39, 0x01, 0x24, 0x1d, 0x3b, 0x75, 0xa9, 0x86, 0x34, 0x50, 0xd0, 0x38, 0xf0, 0xfb, 0xfb, 0xcb, 0x1f, 0x5f, 0xb1,
+    0x67, 0x28, 0x3e, 0x0f, 0x17, 0xfd, 0xf3, 0x50, 0xac, 0xa9, 0x84, 0x60, 0x6a, 0x80, 0x87, 0xed, 0x45, 0x5f, 0xb9, 0x1f,
+    0xb9, 0xb6, 0x9b, 0x5b, 0x22, 0xcf, 0x2a, 0xfc, 0x57, 0x05, 0x0b, 0x53, 0x47, 0xdd, 0x47, 0x42, 0xa6, 0x0a, 0x95, 0x49,
+    0xd2, 0x18, 0x0a, 0xce, 0x70, 0xb7, 0xe8, 0x28, 0xa5, 0x66, 0x0b, 0xfc, 0x99, 0xe8, 0x7e, 0x48, 0xfb, 0x07, 0xb8, 0x84,
+    0x7e, 0x41, 0x2b, 0x55, 0x6c, 0x93, 0x51, 0xfe, 0x6d, 0xf5, 0xcb, 0x8f, 0x12, 0x4e, 0xcb, 0xf7, 0x56, 0xd5, 0x77, 0xd7,
+    0xda, 0x59, 0xe4, 0x1f, 0x80, 0xb8, 0x60, 0x18, 0x9c, 0x84, 0x4b, 0x52, 0x86, 0x19, 0xae, 0x69, 0x8d, 0xfd, 0x20, 0xe1,
+    0x11, 0x61, 0x81, 0x28, 0xe0, 0xdf, 0x54, 0xbb, 0xa4, 0x30, 0xeb, 0x92, 0xac, 0x3d, 0xbd, 0x10, 0xe7, 0xc7, 0x9e, 0xc7,
+    0xd2, 0x2a, 0x6e, 0x10, 0x84, 0x77, 0x3f, 0x2e, 0x83, 0xc4, 0x5f, 0x04, 0xe4, 0x3e, 0x64, 0x3a, 0xc6, 0xd9, 0x10, 0xda,
+    0x26, 0x5d, 0xda, 0x52, 0x37, 0x8b, 0x69, 0x2f, 0x84, 0x03, 0xf6, 0xb9, 0x0d, 0xa7, 0x2f, 0xe6, 0xd4, 0x86, 0x71, 0x1c,
+    0x44, 0xdc, 0xf5, 0xee, 0x99, 0xeb, 0xc1, 0x42, 0x64, 0xb5, 0x18, 0x6a, 0x07, 0xe8, 0xa4, 0x40, 0xad, 0xf9, 0x88, 0xd7,
+    0x71, 0x2e, 0x84, 0x2f, 0x40, 0x3b, 0x16, 0x1b, 0xe1, 0x5d, 0x7f, 0xf9, 0xd1, 0xaa, 0xb4, 0xd2, 0xa0, 0x32, 0x0f, 0xa0,
+    0xf5, 0x0e, 0xaa, 0xdd, 0x98, 0x74, 0xae, 0xb3, 0x32, 0x88, 0x7b, 0x4d, 0x69, 0xac, 0x6a, 0x60, 0x38, 0x9d, 0xc4, 0x4a,
+    0xe9, 0xd4, 0xea, 0xc5, 0x31, 0x02, 0xdc, 0x13, 0x2e, 0xd7, 0x47, 0xcd, 0xf1, 0xfc, 0xf7, 0x14, 0x0e, 0x90, 0x35, 0x6d,
+    0x1b, 0xa5, 0x20, 0xad, 0xc4, 0x31, 0xea, 0x82, 0x0d, 0x76, 0x9c, 0x24, 0x91, 0x7f, 0xb3, 0x4c, 0x38, 0x40, 0xb2, 0x58,
+    0x44, 0xca, 0x27, 0x39, 0x9b, 0x46, 0x23, 0x93, 0xa9, 0xaf, 0x2b, 0x87, 0xd0, 0x3f, 0xa3, 0x3e, 0x8f, 0xaa, 0x05, 0x69,
+    0x1d, 0x78, 0x5c, 0xa5, 0xbc, 0x06, 0xa6, 0x75, 0x54, 0xfb, 0x29, 0x2b, 0xe2, 0xf7, 0xd5, 0x61, 0x1b, 0x1a, 0xac, 0x6d,
+    0x66, 0xa4, 0x72, 0x98, 0xad, 0xcd, 0x0c, 0x0f, 0xe0, 0x27, 0x55, 0xbc, 0xf4, 0x4f, 0xed, 0x07, 0x40, 0xf8, 0xcd, 0x7d,
+    0x88, 0x09, 0xae, 0xf6, 0x55, 0xcd, 0x8d, 0x0d, 0x64, 0x40, 0x04, 0x06, 0x6c, 0x8c, 0x87, 0x73, 0x2f, 0x16, 0x3a, 0x53,
+    0x98, 0x72, 0x7f, 0x42, 0x8a, 0x89, 0x5d, 0x67, 0xb1, 0x0c, 0xd1, 0x00, 0xab, 0x2a, 0x88, 0xe6, 0xae, 0x74, 0x95, 0x81,
+    0xdd, 0x3a, 0xe2, 0xd3, 0x30, 0xf0, 0x78, 0x64, 0x2e, 0xd7, 0x51, 0x0a, 0xee, 0x15, 0x6e, 0x34, 0xae, 0xaa, 0xcc, 0xf7,
+    0x74, 0x5b, 0x7b, 0x59, 0xf7, 0x2b, 0xd7, 0x82, 0xd1, 0x2a, 0x87, 0x62, 0xc7, 0x5d, 0xe3, 0x6e, 0xe4, 0x2c, 0x54, 0x59,
+    0x08, 0x46, 0xb5, 0x3f, 0xba, 0xa5, 0x62, 0x5c, 0xe4, 0x2f, 0xa3, 0x70, 0x46, 0x62, 0xda, 0xb1, 0xc0, 0x39, 0xf5, 0x2a,
+    0x68, 0xdc, 0x67, 0x72, 0x25, 0x23, 0x1b, 0xa3, 0x89, 0x7d, 0x54, 0x55, 0xc9, 0x28, 0x68, 0x60, 0x57, 0x25, 0x67, 0xf7,
+    0x2b, 0x7f, 0x64, 0x58, 0x0b, 0x9b, 0x03, 0xf1, 0x44, 0xef, 0x9a, 0x8c, 0xd7, 0x3d, 0x43, 0x48, 0x62, 0x6e, 0xe7, 0xdc,
+    0x3b, 0xc1, 0x04, 0xe9, 0x9a, 0xe6, 0xfd, 0x5e, 0xd6, 0x1b, 0x8f, 0xd3, 0xb8, 0x95, 0xe6, 0x44, 0x5b, 0xc6, 0x39, 0xc5,
+    0xb9, 0x38, 0x4a, 0x4f, 0xc4, 0x86, 0xcb, 0x14, 0x17, 0xdb, 0xfd, 0xe9, 0xa2, 0x4e, 0x0d, 0x08, 0x20, 0xc9, 0xb7, 0xc9,
+    0x7c, 0x6d, 0xaf, 0x06, 0x2d, 0x55, 0x67, 0xa2, 0x15, 0x76, 0x25, 0x3e, 0xe5, 0xbc, 0x91, 0x94, 0x88, 0x44, 0x30, 0xe9,
+    0x9b, 0xac, 0xa4, 0xdf, 0x60, 0x4b, 0x62, 0xec, 0x35, 0x2e, 0x17, 0xee, 0xc7, 0x41, 0x50, 0x73, 0x32, 0xf2, 0xfd, 0x1d,
+    0x22, 0x62, 0xb5, 0x4f, 0x37, 0x6d, 0x49, 0x9c, 0xa4, 0xdb, 0xb6, 0x23, 0xa9, 0x60, 0xa0, 0x03, 0xda, 0x3c, 0x9f, 0xac,
+    0x93, 0x09, 0xf5, 0x52, 0xdd, 0x0a, 0x7a, 0x61, 0xee, 0xd5, 0x3c, 0xa1, 0x97, 0x3c, 0x62, 0x18, 0xad, 0x11, 0xb0, 0x02,
+    0x39, 0x6a, 0xd4, 0x81, 0xdc, 0x7c, 0xd5, 0x4e, 0x52, 0xce, 0xd0, 0xc4, 0x38, 0x07, 0xc2, 0x3d, 0x31, 0xe3, 0x48, 0x9f,
+    0x68, 0x6a, 0x16, 0xc5, 0x24, 0xf1, 0xac, 0x1e, 0x8f, 0xe2, 0x2e, 0x3c, 0x72, 0x24, 0x13, 0x34, 0x11, 0x55, 0x07, 0xaa,
+    0xe0, 0x89, 0x2f, 0xe9, 0x2e, 0xb7, 0xd1, 0x58, 0x74, 0xc0, 0xb7, 0x93, 0x41, 0xcc, 0x7f, 0x1a, 0x5e, 0x9c, 0xc3, 0x7c,
+    0x46, 0x40, 0x59, 0x7f, 0x7c, 0x5f, 0xcb, 0xe8, 0xc7, 0xba, 0x31, 0x81, 0x80, 0x22, 0xe8, 0xa5, 0x72, 0xeb, 0x13, 0x49,
+    0x29, 0xea, 0xa8, 0x9c, 0xcc, 0x6c, 0xf4, 0xd2, 0x41, 0x98, 0x05, 0x01, 0x35, 0xcf, 0x0a, 0x5e, 0x92, 0xff, 0x47, 0x5d,
+    0x14, 0xda, 0xe8, 0x99, 0xb5, 0x54, 0x68, 0x3c, 0x52, 0x94, 0x6e, 0x94, 0xeb, 0x0c, 0xcd, 0x47, 0x89, 0x61, 0x1a, 0x11,
+    0x5d, 0x6d, 0xb6, 0x4a, 0x07, 0x66, 0x84, 0xa1, 0x18, 0xac, 0xb2, 0x4a, 0x2d, 0x83, 0x31, 0x2b, 0x80, 0x14, 0xf7, 0x98,
+    0x29, 0x0a, 0x4f, 0x15, 0xcd, 0x4e, 0xd9, 0x9f, 0xac, 0x29, 0xf6, 0x70, 0x9e, 0xd6, 0x49, 0x07, 0xca, 0x18, 0x29, 0xa0,
+    0xc4, 0x89, 0xed, 0x7d, 0xb1, 0x79, 0x88, 0x41, 0xfb, 0xe5, 0xdc, 0xc3, 0x60, 0x38, 0x29, 0x81, 0xae, 0xd4, 0xb4, 0x1a,
+    0x62, 0x6a, 0x05, 0x2a, 0xeb, 0x4e, 0x4c, 0xa9, 0x61, 0xfd, 0x94, 0x29, 0x18, 0xcb, 0xae, 0xd6, 0x5a, 0xa7, 0x9c, 0x38,
+    0xd7, 0x96, 0xda, 0x10, 0x18, 0x90, 0xff, 0xa4, 0x2c, 0x6b, 0x0d, 0x03, 0xf4, 0xa6, 0xf9, 0xbd, 0xf5, 0xde, 0x0d, 0x96,
+    0xbc, 0x05, 0xab, 0x60, 0x56, 0xab, 0xd7, 0xd7, 0xc4, 0x6e, 0xb6, 0x8c, 0x50, 0x5d, 0xbf, 0xa6, 0x04, 0x5f, 0x46, 0x39,
+    0xa2, 0xcc, 0x65, 0x04, 0x9e, 0x48, 0xb4, 0x46, 0xf3, 0x5d, 0xff, 0x9e, 0xc1, 0xaa, 0xcf, 0x25, 0xe8, 0xd4, 0x60, 0xcf,
+    0x55, 0xc8, 0x29, 0x65, 0x1c, 0x8b, 0x69, 0xca, 0xa6, 0x2d, 0x55, 0x72, 0xe0, 0x6b, 0x13, 0x9f, 0x1e, 0xa1, 0x8c, 0x45,
+    0x96, 0x34, 0x18, 0xb2, 0x21, 0xfd, 0xc6, 0xae, 0xc1, 0x89, 0x8d, 0x0a, 0x5a, 0x6a, 0x5d, 0x66, 0xda, 0x6d, 0x8d, 0x8a,
+    0xcc, 0x54, 0xcb, 0x3a, 0x0c, 0xd2, 0xbd, 0x02, 0xb7, 0x11, 0x35, 0x1e, 0xc8, 0x1a, 0xd0, 0xf6, 0x95, 0x55, 0xce, 0x1d,
+    0x6d, 0x2d, 0x96, 0xf1, 0xb4, 0x26, 0x31, 0x01, 0xdc, 0x4a, 0xb4, 0xc0, 0x6f, 0xc8, 0xff, 0xa3, 0x1c, 0x5c, 0x9b, 0x8c,
+    0x72, 0xd2, 0x50, 0x80, 0xad, 0x0b, 0xf7, 0x7c, 0x72, 0xec, 0x16, 0x67, 0x46, 0x78, 0x2a, 0xa6, 0xd0, 0xff, 0x3d, 0xf7,
+    0x88, 0x3e, 0x43, 0xde, 0xcf, 0x45, 0x1d, 0xac, 0x88, 0xc6, 0xc3, 0xc2, 0x0d, 0xdb, 0x05, 0x19, 0x4a, 0xdc, 0x7c, 0xc7,
+    0x12, 0x9e, 0x69, 0xb4, 0x05, 0x3d, 0x92, 0xe2, 0x95, 0xa1, 0x03, 0x0f, 0x1b, 0x03, 0x07, 0xb1, 0x01, 0x42, 0x06, 0x0d,
+    0x8c, 0x35, 0x2f, 0xec, 0xe4, 0x30, 0x4a, 0x8c, 0x00, 0x4f, 0xab, 0xd5, 0xca, 0xf4, 0xfa, 0xae, 0x85, 0x55, 0x6a, 0x35,
+    0xb7, 0xc1, 0x6e, 0x68, 0x3a, 0xdd, 0x16, 0x2d, 0x5c, 0xd6, 0x64, 0x37, 0xad, 0xf4, 0x2c, 0x26, 0xc2, 0xa2, 0xf3, 0x83,
+    0x1b, 0x3d, 0x4f, 0xac, 0x65, 0x4f, 0x94, 0x41, 0x3f, 0x60, 0x9f, 0x14, 0x21, 0x6d, 0x83, 0xd2, 0xfa, 0xc5, 0xf3, 0xc0,
+    0x1e, 0xff, 0x50, 0x37, 0x8d, 0x51, 0x7f, 0x2b, 0x5f, 0xd7, 0xcf, 0xf9, 0xb9, 0xa6, 0x77, 0x9b, 0x66, 0x90, 0xe2, 0x52,
+    0xc4, 0x14, 0xbc, 0x68, 0xc9, 0x55, 0x31, 0x98, 0xb3, 0xc0, 0xcf, 0x94, 0x2b, 0x7a, 0x86, 0xbd, 0xa3, 0xd5, 0x8b, 0x7f,
+    0xe5, 0xf3, 0x02, 0xdf, 0x36, 0xe3, 0xe4, 0x88, 0x8c, 0x7b, 0xb6, 0xe1, 0xe4, 0x03, 0x2b, 0x3a, 0xf9, 0xa0, 0x7c, 0xe1,
+    0x62, 0x88, 0x65, 0x2d, 0x00, 0xb0, 0x76, 0xdb, 0x8c, 0xf4, 0xcf, 0x6a, 0xff, 0x7f, 0xfe, 0xed, 0xbf, 0xe1, 0xff, 0x61,
+    0x1b, 0x2b, 0x08, 0xc8, 0x74, 0xf3, 0x43, 0x14, 0xce, 0x27, 0xd2, 0x29, 0x56, 0xfe, 0xb4, 0x2c, 0x04, 0x27, 0x30, 0xc2,
+    0x2a, 0x33, 0x37, 0x08, 0xfa, 0x97, 0x24, 0xe6, 0x65, 0x3d, 0x94, 0xf9, 0x2b, 0xf9, 0x59, 0x6e, 0x36, 0x82, 0xa7, 0xca,
+    0xfe, 0xe7, 0x5f, 0xff, 0x8b, 0x9d, 0x48, 0xe1, 0x6f, 0x3d, 0x5d, 0x49, 0xb7, 0x12, 0x40, 0x13, 0xb0, 0x4a, 0xde, 0x4b,
+    0xee, 0x6b, 0x97, 0x53, 0x7b, 0x97, 0x22, 0x57, 0x1b, 0x39, 0xa1, 0xf6, 0xe5, 0x47, 0xa2, 0xfa, 0xaa, 0xae, 0x7d, 0xdf,
+    0x4c, 0x22, 0x77, 0xb5, 0x7f, 0x4a, 0x05, 0x39, 0xd7, 0x31, 0xf5, 0x20, 0x69, 0xc2, 0x40, 0x2e, 0x0e, 0xde, 0x03, 0xb1,
+    0x70, 0xa1, 0x73, 0x98, 0x3b, 0xe0, 0x11, 0xa0, 0x11, 0x48, 0x8a, 0x28, 0x01, 0xb3, 0x4a, 0x90, 0xea, 0x14, 0x4a, 0x86,
+    0x58, 0x52, 0x5f, 0xdb, 0x08, 0x13, 0x86, 0xad, 0x36, 0x17, 0xef, 0x69, 0x2d, 0x94, 0x36, 0x09, 0x17, 0x46, 0xf5, 0x70,
+    0xb1, 0x1e, 0x3a, 0x28, 0x3d, 0x0b, 0xf8, 0x60, 0xee, 0x6d, 0x6a, 0x90, 0x64, 0xf0, 0x19, 0x60, 0xc9, 0xfa, 0x46, 0x60,
+    0x44, 0xbd, 0xe7, 0x56, 0xa3, 0x57, 0x58, 0xa2, 0x56, 0xa9, 0xe9, 0x6a, 0xfb, 0xd2, 0xcd, 0xae, 0x97, 0xf9, 0xe2, 0xd8,
+    0xa2, 0xae, 0xac, 0x50, 0x5a, 0x4f, 0xdc, 0x93, 0x2b, 0x11, 0xb3, 0x4d, 0x40, 0x07, 0xf5, 0xcc, 0x47, 0x6a, 0x39, 0x89,
+    0x07, 0x5a, 0x18, 0x67, 0xa6, 0xa0, 0xc6, 0x51, 0xd0, 0xe5, 0xa0, 0x81, 0x49, 0xe2, 0x46, 0x20, 0x86, 0x7b, 0x95, 0x0c,
+    0xb4, 0x05, 0x9e, 0xdd, 0x3c, 0x83, 0xb5, 0xaf, 0x6a, 0xe4, 0x97, 0x30, 0x7a, 0xba, 0xea, 0x61, 0x26, 0xad, 0x58, 0xe5,
+    0x91, 0x93, 0x37, 0x4c, 0x2d, 0x2f, 0x29, 0x81, 0x1c, 0x46, 0xca, 0xc7, 0x63, 0xf0, 0x9e, 0x8f, 0x31, 0x78, 0xc8, 0xd1,
+    0xf0, 0x71, 0xd0, 0x29, 0x75, 0x72, 0xd5, 0xa0, 0x27, 0xca, 0xa7, 0xa1, 0x9d, 0xb2, 0x36, 0x5e, 0xf2, 0x82, 0xae, 0x8b,
+    0xea, 0x0e, 0x74, 0xa2, 0x10, 0x17, 0x75, 0x6b, 0x77, 0xcf, 0x66, 0x21, 0x31, 0x64, 0x8a, 0x24, 0xb6, 0x16, 0x11, 0xc7,
+    0x49, 0x3b, 0x15, 0xa7, 0x1a, 0xb1, 0x3c, 0x5b, 0x26, 0xcc, 0xb2, 0x0c, 0x16, 0xc8, 0x6b, 0x03, 0x42, 0xd8, 0xc0, 0xb4,
+    0x74, 0x73, 0x31, 0xc3, 0x31, 0x66, 0xff, 0x02, 0x6f, 0x8a, 0x64, 0xdb, 0x73, 0x20, 0x50, 0x29, 0xa7, 0x22, 0xa5, 0xd3,
+    0x3b, 0x59, 0x4d, 0x9b, 0x61, 0x33, 0xd1, 0x53, 0x01, 0x18, 0x95, 0x6f, 0x9d, 0x81, 0x94, 0x83, 0x13, 0x2e, 0x4c, 0x64,
+    0xe3, 0x24, 0x5c, 0xbc, 0x86, 0x32, 0x77, 0x42, 0xb6, 0x9f, 0x80, 0x9d, 0x29, 0x34, 0xad, 0x58, 0xa4, 0x52, 0x39, 0xdf,
+    0x8c, 0x82, 0x30, 0xe6, 0x18, 0xd3, 0x4a, 0x0f, 0x0a, 0x38, 0xf5, 0x42, 0x6e, 0xa2, 0x34, 0x23, 0x93, 0x0d, 0x05, 0xb9,
+    0x24, 0x70, 0x23, 0x57, 0xfe, 0x09, 0x55, 0xad, 0xec, 0x4f, 0x5a, 0xe1, 0x06, 0xe4, 0x5f, 0x4c, 0x4c, 0xde, 0xd9, 0xea,
+    0x34, 0xc6, 0x18, 0x05, 0xb7, 0x70, 0x6d, 0x30, 0x3c, 0x4c, 0x51, 0x58, 0x49, 0xe2, 0xdf, 0x60, 0x9d, 0x86, 0xd9, 0x5d,
+    0x7d, 0x7b, 0x15, 0x8d, 0x0a, 0x40, 0x0c, 0x40, 0x6b, 0xcd, 0x55, 0xe1, 0xbe, 0x92, 0x01, 0x70, 0x8d, 0x21, 0xbf, 0xda,
+    0x8e, 0x85, 0xbd, 0xad, 0xd8, 0x4a, 0x2d, 0x73, 0x6d, 0x3a, 0xe4, 0x63, 0x64, 0xd6, 0xc4, 0xe7, 0xc3, 0x61, 0xa9, 0x55,
+    0xb1, 0x86, 0x67, 0xeb, 0xbd, 0x4a, 0x89, 0x28, 0x2c, 0x14, 0x83, 0xc6, 0x90, 0x0c, 0xed, 0xe7, 0xff, 0xf5, 0xf8, 0x88,
+    0xdc, 0x98, 0x50, 0xe8, 0xce, 0x0c, 0x23, 0xf9, 0x92, 0x83, 0x52, 0xeb, 0x34, 0x9a, 0xd5, 0xae, 0x8f, 0x23, 0xce, 0xee,
+    0xc3, 0x25, 0xb8, 0x16, 0xf2, 0xc3, 0x9d, 0x3b, 0xa7, 0x1c, 0x6d, 0x81, 0x2f, 0x93, 0x91, 0x67, 0x05, 0x53, 0x98, 0x14,
+    0xd5, 0x3f, 0x5d, 0x93, 0xd3, 0x6f, 0x19, 0x9f, 0xd9, 0x8d, 0xd4, 0xb5, 0xfb, 0x46, 0x95, 0x74, 0xdf, 0xe8, 0x99, 0x8a,
+    0xa8, 0xa8, 0x2e, 0xa8, 0xf4, 0xd7, 0x5f, 0x2b, 0xa6, 0x39, 0x92, 0xab, 0x24, 0xcb, 0x55, 0x35, 0x41, 0x8f, 0x5c, 0x2d,
+    0x2a, 0xae, 0xe4, 0x79, 0x34, 0xc7, 0xe6, 0x5e, 0x31, 0x93, 0x7b, 0x92, 0xc5, 0x4b, 0x79, 0xf8, 0x69, 0x43, 0x52, 0x4f,
+    0xe2, 0x2a, 0x8a, 0x89, 0xfb, 0x87, 0xb3, 0xb8, 0x9d, 0xb3, 0x78, 0x25, 0xbc, 0xc5, 0x73, 0x71, 0x65, 0x88, 0x72, 0x18,
+    0xe5, 0x0d, 0x22, 0xb1, 0xb1, 0x48, 0xc5, 0xdd, 0x15, 0x6b, 0x26, 0x35, 0x8e, 0x7d, 0xcf, 0x88, 0x2b, 0x2e, 0x23, 0xbc,
+    0x9c, 0xe6, 0x27, 0x17, 0x19, 0x41, 0x34, 0x16, 0x51, 0x83, 0x9e, 0xbc, 0xc2, 0x20, 0xe3, 0xe3, 0x85, 0x62, 0x7b, 0x8a,
+    0xaa, 0x1c, 0x55, 0xab, 0x7d, 0x21, 0xb9, 0x98, 0xcb, 0x24, 0x2a, 0x87, 0x6d, 0x51, 0xa3, 0xaf, 0xfc, 0x4b, 0x85, 0x22,
+    0x3a, 0x96, 0xea, 0x73, 0xce, 0xa3, 0xcc, 0x75, 0xf5, 0x47, 0xa3, 0x2f, 0xa0, 0x3e, 0x7a, 0x48, 0x1e, 0x7a, 0x97, 0x1a,
+    0x1a, 0xc5, 0x26, 0xcd, 0xce, 0xd2, 0x35, 0xae, 0x7b, 0x51, 0x8b, 0x47, 0x16, 0x98, 0x0e, 0x9c, 0x04, 0x5d, 0xee, 0xc2,
+    0x89, 0x0a, 0x48, 0x27, 0xf1, 0x49, 0x87, 0x52, 0x24, 0xb0, 0x16, 0x92, 0x51, 0x18, 0x96, 0xe2, 0x16, 0xaa, 0xec, 0x13,
+    0x1c, 0xbc, 0x2a, 0x89, 0xa0, 0x88, 0xf5, 0x8f, 0x58, 0x73, 0x1f, 0x46, 0x2b, 0xaa, 0xe3, 0x00, 0x59, 0x6d, 0xf0, 0x61,
+    0xc4, 0x83, 0x00, 0xed, 0x1a, 0x34, 0xe9, 0xd4, 0x4e, 0x6e, 0xae, 0xd9, 0xd7, 0x99, 0x66, 0xdf, 0x85, 0xa1, 0xb7, 0xbe,
+    0xc5, 0x41, 0xa6, 0xc5, 0x4b, 0xd7, 0x8f, 0x74, 0x0b, 0xf3, 0xc1, 0xeb, 0x30, 0xa4, 0x07, 0x26, 0x14, 0x3e, 0x1f, 0x45,
+    0xf7, 0x0b, 0x58, 0x9b, 0x16, 0x8c, 0xff, 0xfd, 0xcf, 0xff, 0xf8, 0x77, 0x47, 0x93, 0xc3, 0xe6, 0x75, 0xaa, 0x66, 0x03,
+    0x41, 0x2a, 0x88, 0x28, 0xb4, 0xe6, 0xb0, 0x3a, 0x9d, 0x93, 0xa4, 0xe6, 0xfa, 0xb6, 0x1b, 0xe5, 0xf6, 0xaa, 0x1b, 0x33,
+    0x2c, 0xd3, 0x5e, 0x54, 0x96, 0xfa, 0xcc, 0x58, 0x0c, 0x11, 0x07, 0xad, 0x19, 0x27, 0xc3, 0x91, 0x3b, 0x57, 0x0b, 0xa2,
+    0xf6, 0xf4, 0x81, 0xf7, 0xc2, 0x34, 0x72, 0x74, 0x0e, 0xe8, 0x20, 0x19, 0x5e, 0x75, 0x38, 0xc7, 0xfd, 0x1a, 0x66, 0xef,
+    0xd7, 0xb0, 0xc2, 0x9c, 0xf1, 0x8f, 0x85, 0x19, 0x44, 0xd2, 0xae, 0xc8, 0x6c, 0xb8, 0x88, 0xd6, 0x3c, 0x8a, 0x4e, 0x75,
+    0x46, 0x79, 0x36, 0xd5, 0x48, 0x3e, 0x34, 0xb3, 0x9a, 0x45, 0xf6, 0x91, 0x48, 0x99, 0xcc, 0xe7, 0x20, 0x51, 0xae, 0x51,
+    0x3d, 0x93, 0xe9, 0x59, 0x9c, 0xc0, 0xb4, 0x1e, 0x84, 0x61, 0x0e, 0xe5, 0xf6, 0x89, 0x56, 0xe5, 0xa9, 0xf0, 0x5b, 0xa5,
+    0xc0, 0x8b, 0x23, 0x44, 0x40, 0xd6, 0x35, 0x99, 0xef, 0xdd, 0x7c, 0xe6, 0xbb, 0x14, 0x7c, 0xc0, 0x6f, 0xc3, 0xad, 0x85,
+    0xdf, 0x53, 0x67, 0xcb, 0xa7, 0xa8, 0x4b, 0xde, 0xc4, 0x53, 0x65, 0x28, 0xa4, 0xc5, 0x99, 0x32, 0x21, 0xbc, 0xf1, 0x48,
+    0x6b, 0x94, 0x04, 0xf7, 0x7f, 0xab, 0x79, 0xf3, 0x0f, 0x1c, 0xe4, 0xe7, 0x9b, 0x41, 0x4f, 0xfb, 0xec, 0x29, 0xbf, 0xfc,
+    0xe1, 0x0f, 0xe6, 0xd7, 0x96, 0x90, 0x3a, 0x5a, 0x49, 0x1d, 0x1e, 0xb1, 0x1d, 0x1c, 0xbe, 0x51, 0x03, 0x4c, 0xd2, 0x38,
+    0x21, 0x11, 0xa5, 0xd4, 0x02, 0xd0, 0xab, 0x2a, 0x06, 0x6c, 0x54, 0x2b, 0xd2, 0x9c, 0xfd, 0xa1, 0x45, 0xbf, 0x86, 0x08,
+    0x5e, 0x12, 0xe9, 0xc0, 0x33, 0x00, 0x9b, 0xda, 0xd4, 0x69, 0x9b, 0x72, 0xfd, 0xaf, 0xd3, 0x8d, 0x51, 0x5a, 0x1d, 0x4c,
+    0xcf, 0x10, 0x06, 0xc2, 0xb2, 0xf3, 0xe7, 0xbc, 0x9d, 0xf3, 0x0f, 0x0b, 0x21, 0x76, 0x63, 0x1e, 0xe1, 0xb9, 0x73, 0xbd,
+    0x84, 0x9d, 0xd5, 0x75, 0x36, 0xd1, 0xff, 0xef, 0x20, 0x7d, 0x7f, 0x55, 0xd9, 0x20, 0x08, 0x36, 0x4f, 0x11, 0xf3, 0xe3,
+    0x78, 0xc9, 0xb3, 0xb3, 0xa2, 0x93, 0xe6, 0x85, 0xb0, 0x2c, 0xc8, 0x9b, 0x97, 0x5b, 0xcb, 0x12, 0x0a, 0x6e, 0x2f, 0x2b,
+    0x2b, 0x84, 0xa6, 0x47, 0x6d, 0x2c, 0x3f, 0xdd, 0x01, 0x9e, 0xeb, 0x5c, 0x87, 0x8a, 0x0f, 0xac, 0x8e, 0x7e, 0xc3, 0xcd,
+    0xc8, 0xc7, 0x51, 0x3f, 0x35, 0x2d, 0xe5, 0xe6, 0x3c, 0x6a, 0x5c, 0x35, 0x1c, 0x6b, 0x1a, 0x74, 0xd0, 0x0f, 0x6f, 0x2e,
+    0x7c, 0x1d, 0x85, 0xa8, 0x2a, 0xb8, 0x27, 0xb0, 0xb3, 0x22, 0x7f, 0x05, 0xcf, 0xd3, 0x35, 0x54, 0xad, 0x8a, 0x4a, 0xf2,
+    0x06, 0x63, 0xf3, 0xd0, 0x9b, 0x48, 0x80, 0x85, 0x3a, 0xd2, 0xf1, 0x57, 0xb0, 0x94, 0xcd, 0x81, 0x7c, 0x82, 0xe2, 0x55,
+    0x77, 0xa6, 0x52, 0xb3, 0x11, 0xc4, 0x50, 0x2a, 0x3c, 0xf6, 0x71, 0xa5, 0x1e, 0x0c, 0x2f, 0x8f, 0x2f, 0xdf, 0x0e, 0xaf,
+    0x5e, 0x5f, 0xbc, 0x7a, 0x75, 0x75, 0x76, 0x7e, 0x39, 0x78, 0xf3, 0xd3, 0x31, 0x8e, 0x1c, 0xcd, 0x7d, 0x4a, 0x57, 0x7d,
+    0xe9, 0x06, 0x01, 0x5e, 0xf8, 0xc0, 0x16, 0x61, 0x10, 0xe0, 0x90, 0x17, 0x3c, 0xf2, 0x43, 0x8f, 0xdd, 0x81, 0x4e, 0x65,
+    0x14, 0x45, 0x1d, 0x86, 0xcb, 0x68, 0x04, 0xba, 0x20, 0x66, 0xcb, 0xb9, 0xce, 0x03, 0x30, 0x92, 0x0f, 0x5f, 0x43, 0x43,
+    0xc4, 0x28, 0xca, 0x07, 0x38, 0x31, 0x53, 0xe4, 0x5e, 0x20, 0x55, 0x1b, 0x4d, 0xdd, 0xf9, 0x84, 0x1b, 0xb9, 0x0a, 0x42,
+    0x61, 0x5b, 0x98, 0x2b, 0xa4, 0xa7, 0x2e, 0x0e, 0xa2, 0x06, 0x92, 0x49, 0x5e, 0x11, 0x16, 0x93, 0x22, 0x79, 0x26, 0x61,
+    0x90, 0x64, 0x94, 0x0f, 0xc0, 0xfd, 0x9f, 0xf1, 0x9a, 0xba, 0x49, 0x0c, 0x93, 0x2e, 0x45, 0x9d, 0xf4, 0x34, 0x84, 0x7c,
+    0x56, 0xd7, 0x5a, 0x1b, 0xaf, 0x96, 0x76, 0x03, 0x4d, 0x2b, 0x12, 0x59, 0xa2, 0xec, 0xaf, 0xe1, 0xb3, 0xc2, 0x58, 0x6a,
+    0x8e, 0x00, 0x0f, 0xd6, 0x07, 0x88, 0x7d, 0xab, 0x7b, 0xf8, 0x5e, 0xb6, 0xfe, 0xb0, 0xb1, 0x59, 0xb7, 0x25, 0xc0, 0x5f,
+    0xf9, 0xf3, 0x2b, 0x7d, 0x2d, 0x62, 0x06, 0x5c, 0x51, 0x15, 0xca, 0xcc, 0x3d, 0xbf, 0x38, 0x1f, 0x38, 0x5b, 0xa7, 0x1b,
+    0x08, 0xb6, 0xa5, 0x2b, 0x53, 0xbe, 0xfc, 0xb8, 0x01, 0x7e, 0x2b, 0xe2, 0x94, 0x8c, 0x57, 0x6b, 0x5f, 0xb5, 0x27, 0x0d,
+    0x30, 0xd9, 0xf1, 0x96, 0x87, 0xf0, 0x55, 0x78, 0xc7, 0xa3, 0x13, 0x37, 0xe6, 0xb5, 0xfa, 0x0a, 0x66, 0xf1, 0xfa, 0xb7,
+    0xb2, 0x3d, 0xd6, 0xad, 0xca, 0x55, 0xea, 0xba, 0x58, 0x63, 0xc2, 0x36, 0x57, 0x72, 0x60, 0xa3, 0x70, 0xb6, 0x10, 0x11,
+    0x82, 0x2c, 0x65, 0x8b, 0x6b, 0xd9, 0xc4, 0x55, 0xdb, 0xa8, 0xf2, 0xa9, 0xe8, 0xff, 0x07, 0x8e, 0x18, 0x6e, 0x01, 0xeb,
+    0x8f, 0xcc, 0x69, 0x3a, 0xf0, 0xbb, 0x1c, 0x3b, 0x69, 0xcf, 0x92, 0x5a, 0x3d, 0xff, 0xe1, 0xfc, 0xe2, 0xe7, 0x73, 0xe8,
+    0x76, 0x73, 0x33, 0x53, 0x1d, 0x9f, 0x5f, 0x5c, 0xfd, 0x38, 0xfc, 0x4e, 0xf1, 0x66, 0x11, 0xb9, 0x28, 0x4e, 0x94, 0x1b,
+    0x42, 0xd6, 0x6e, 0xbe, 0x96, 0xb5, 0x75, 0xcd, 0x1c, 0xab, 0x14, 0x0e, 0x12, 0x0c, 0x22, 0xf1, 0x78, 0x6d, 0x75, 0x69,
+    0xfc, 0x37, 0xd8, 0x8f, 0xf1, 0x64, 0x6d, 0x45, 0xad, 0x5f, 0xe4, 0x78, 0x36, 0x51, 0x8e, 0x3c, 0x81, 0xe1, 0xdb, 0x93,
+    0x93, 0xc1, 0x70, 0x48, 0x33, 0x46, 0x52, 0x4c, 0x18, 0xfc, 0xd0, 0xd7, 0xba, 0x79, 0x32, 0xbd, 0x9e, 0x6d, 0x46, 0x5a,
+    0xb0, 0x2e, 0x56, 0x86, 0x6f, 0x81, 0x4b, 0x82, 0xbc, 0xb3, 0x4d, 0x1d, 0x92, 0x79, 0x77, 0xe7, 0x53, 0x46, 0xd9, 0xe6,
+    0x5e, 0x45, 0x5e, 0x34, 0x70, 0xb9, 0x33, 0x3c, 0xfe, 0x69, 0x70, 0xf5, 0xf3, 0xd9, 0xcb, 0x33, 0xa7, 0x5b, 0xb1, 0x46,
+    0xe8, 0x90, 0xbd, 0x56, 0x90, 0x36, 0xb7, 0xf1, 0x46, 0x0a, 0xe9, 0xb1, 0x93, 0xbc, 0x44, 0x6f, 0x54, 0x1f, 0xf8, 0xc4,
+    0x2f, 0x2d, 0x3f, 0xbe, 0x92, 0x15, 0x05, 0x1a, 0x46, 0xa7, 0xe0, 0xca, 0x5f, 0xe3, 0x66, 0xa9, 0x78, 0x88, 0x20, 0xa5,
+    0xa1, 0x48, 0x0d, 0x75, 0xab, 0x2b, 0xd4, 0xd0, 0x2b, 0xa4, 0x8c, 0x91, 0x61, 0xae, 0xeb, 0xe5, 0x61, 0x3a, 0xec, 0x64,
+    0xca, 0x47, 0xb7, 0x94, 0x46, 0x27, 0x60, 0xa0, 0x97, 0xdf, 0x6a, 0x91, 0x19, 0x40, 0x77, 0x19, 0xf6, 0x4c, 0x62, 0x9c,
+    0x0e, 0x7e, 0x3a, 0x3b, 0x19, 0x5c, 0x9d, 0x5c, 0x9c, 0xbf, 0x3c, 0xfb, 0xce, 0xe9, 0xda, 0xf3, 0xee, 0x94, 0x9e, 0xcf,
+    0xf5, 0x00, 0x1e, 0xcb, 0x43, 0x3b, 0x3b, 0x1f, 0x9e, 0x7d, 0xf7, 0xfd, 0x65, 0x0e, 0xce, 0x39, 0x78, 0xb6, 0xfe, 0x3c,
+    0xa6, 0xab, 0x41, 0x8b, 0x9b, 0x9f, 0x0e, 0x5e, 0x0d, 0x2e, 0xcb, 0x01, 0x9c, 0xc9, 0xc6, 0x32, 0x54, 0x69, 0x34, 0xc7,
+    0xd8, 0xdc, 0x16, 0xf2, 0x3b, 0x05, 0xf7, 0x08, 0xa9, 0x2b, 0x1b, 0xff, 0xa6, 0x4e, 0x9f, 0x31, 0x7e, 0xe0, 0xa8, 0x67,
+    0x5b, 0x9f, 0x72, 0x24, 0x0d, 0xf1, 0xd9, 0x1e, 0x72, 0x64, 0x9b, 0xb5, 0x8d, 0x29, 0x95, 0x06, 0x6f, 0xde, 0x5c, 0xbc,
+    0x31, 0xb4, 0x88, 0xf0, 0x5d, 0xe2, 0x89, 0x3c, 0x46, 0xb1, 0x8d, 0x5c, 0xaa, 0x1e, 0xcf, 0xc1, 0x44, 0xbb, 0x9d, 0x87,
+    0x77, 0xea, 0x18, 0x6b, 0x38, 0xa2, 0x40, 0x18, 0x58, 0x73, 0x3e, 0x38, 0x95, 0x55, 0xd0, 0x12, 0x5b, 0xe9, 0xa1, 0x6a,
+    0xc1, 0x09, 0x6c, 0x29, 0xef, 0xc7, 0xe4, 0xfc, 0xa5, 0x27, 0xad, 0x05, 0x82, 0x4f, 0xe0, 0x49, 0xa4, 0x6a, 0xc1, 0x04,
+    0xfc, 0xfb, 0xa6, 0x31, 0xfe, 0x3d, 0x9c, 0xb9, 0xdd, 0xe9, 0xa4, 0x81, 0xfd, 0x62, 0xeb, 0x28, 0xaf, 0xec, 0xad, 0x20,
+    0xc0, 0x83, 0x88, 0x20, 0x96, 0x64, 0x99, 0x55, 0x6b, 0x0e, 0xab, 0x45, 0x3e, 0x56, 0xfc, 0x33, 0x30, 0x66, 0xcd, 0x31,
+    0x2c, 0x4e, 0x41, 0xc1, 0x55, 0x8a, 0x41, 0x59, 0xff, 0x39, 0x53, 0x1a, 0x97, 0x11, 0x5a, 0x7a, 0xeb, 0x32, 0x6e, 0x33,
+    0xb3, 0x40, 0xe6, 0x9b, 0xb8, 0x97, 0xfa, 0x41, 0x92, 0x47, 0x49, 0xc9, 0xfa, 0xc3, 0x9a, 0x29, 0x16, 0xf9, 0x9c, 0x38,
+    0x24, 0xf5, 0x51, 0xe4, 0x4d, 0x65, 0x96, 0xaf, 0x62, 0x69, 0x5f, 0x4b, 0x1d, 0x0b, 0xe1, 0x81, 0xfe, 0xf1, 0x55, 0x82,
+    0xee, 0x28, 0x92, 0xb2, 0xc8, 0x4f, 0xc5, 0x86, 0xc5, 0xfb, 0x48, 0x29, 0x28, 0xbd, 0xa3, 0x24, 0x0c, 0xf8, 0x02, 0x57,
+    0xb7, 0xac, 0xdb, 0x34, 0xc1, 0x01, 0x1f, 0x6e, 0xe3, 0xaa, 0x51, 0x18, 0x3d, 0x35, 0x17, 0x32, 0xce, 0x9a, 0x09, 0x25,
+    0x3f, 0xe4, 0xac, 0x89, 0x63, 0xd6, 0xce, 0xca, 0xb3, 0x6d, 0xcd, 0x1d, 0x56, 0x33, 0x1f, 0xfa, 0x8b, 0x2b, 0xd7, 0xf3,
+    0xd0, 0xaf, 0x5a, 0xd5, 0xaf, 0x4b, 0x95, 0xc8, 0x36, 0x6e, 0x9f, 0x30, 0x75, 0xb5, 0x11, 0xb8, 0x01, 0xdd, 0xea, 0xb1,
+    0x30, 0xf7, 0xe4, 0xd5, 0x47, 0xca, 0xe2, 0x6b, 0xa1, 0x22, 0xd0, 0x92, 0x60, 0x5d, 0xfb, 0xf3, 0x30, 0x49, 0x2d, 0xbc,
+    0xaa, 0x3c, 0xad, 0x93, 0xf2, 0x96, 0x70, 0xf2, 0xaf, 0xe4, 0x25, 0x38, 0x29, 0x6b, 0x59, 0xe5, 0x06, 0xab, 0x98, 0x11,
+    0x11, 0xc5, 0x2a, 0x76, 0xdd, 0x9e, 0x09, 0x7e, 0x9d, 0x7b, 0xbd, 0x95, 0xaf, 0x57, 0xd9, 0xc2, 0xb6, 0x36, 0x16, 0xf2,
+    0xc9, 0xf1, 0x9b, 0x53, 0xe8, 0xed, 0xd7, 0x5f, 0x2b, 0x0f, 0xf3, 0x38, 0xc8, 0xe5, 0x28, 0x39, 0x86, 0x92, 0x8e, 0x26,
+    0x4c, 0xdc, 0xc2, 0x75, 0x08, 0xe5, 0x08, 0x40, 0x50, 0xe8, 0x22, 0x71, 0x15, 0x61, 0xa0, 0xbc, 0x61, 0x46, 0x31, 0xb2,
+    0xdb, 0xb8, 0x78, 0xa9, 0xe5, 0x89, 0xe6, 0xf8, 0x57, 0xa1, 0x75, 0xc6, 0xf8, 0xe9, 0x42, 0x1d, 0x9f, 0xa2, 0xfe, 0x1d,
+    0xc4, 0xca, 0xb0, 0xe2, 0x45, 0x92, 0x05, 0xce, 0x77, 0x8b, 0xc9, 0xd3, 0x0f, 0x23, 0xb4, 0xf5, 0x19, 0xde, 0x69, 0x1f,
+    0xf1, 0x31, 0xb0, 0xf8, 0xb4, 0xe5, 0xfc, 0x86, 0x51, 0x45, 0x83, 0x9c, 0x18, 0x28, 0x3b, 0x5e, 0xc8, 0x95, 0x40, 0x94,
+    0x34, 0x37, 0xed, 0x14, 0x45, 0x1e, 0x73, 0x87, 0xd3, 0xc5, 0xcd, 0x9f, 0x69, 0x37, 0x12, 0x04, 0xc3, 0x04, 0xca, 0x8d,
+    0xc0, 0x98, 0x98, 0x5f, 0xba, 0xca, 0x22, 0x8d, 0xa8, 0x91, 0xb2, 0xeb, 0x3d, 0x20, 0x30, 0xac, 0x42, 0x7c, 0x06, 0xa2,
+    0xe6, 0x69, 0xa3, 0x22, 0x3e, 0xc9, 0x6d, 0x83, 0x92, 0xda, 0x1e, 0xea, 0xc0, 0x1f, 0x80, 0xab, 0x29, 0x41, 0x99, 0x0b,
+    0x07, 0x1a, 0x0a, 0x39, 0x43, 0xb4, 0x5e, 0x25, 0x1f, 0x3b, 0x04, 0x03, 0xec, 0x0c, 0x73, 0xf2, 0xde, 0xbb, 0x41, 0xcd,
+    0xaa, 0xde, 0x28, 0x0c, 0x62, 0x66, 0xb9, 0x5c, 0x32, 0x8f, 0x9c, 0x4c, 0x0c, 0x5c, 0xc6, 0x1a, 0xb3, 0x67, 0x77, 0xfe,
+    0xdc, 0x0b, 0xef, 0x5a, 0x46, 0x3c, 0x53, 0x1e, 0x75, 0xcc, 0x8d, 0xa5, 0x28, 0x6b, 0x9c, 0xe2, 0x9f, 0xe2, 0x12, 0x31,
+    0x03, 0x82, 0x9c, 0x70, 0x4a, 0x50, 0xa4, 0x25, 0x20, 0x2a, 0x16, 0x64, 0x9f, 0x4a, 0x9e, 0x00, 0x4a, 0xbf, 0x27, 0x76,
+    0xdf, 0x34, 0xd7, 0x74, 0x8a, 0x8e, 0xb2, 0xf4, 0x6a, 0xd4, 0x82, 0x32, 0xf1, 0xea, 0x65, 0xb3, 0xdf, 0xab, 0xfc, 0xa2,
+    0x64, 0x05, 0x48, 0x0d, 0xa5, 0xc5, 0x6d, 0x89, 0x0b, 0x05, 0x52, 0xaa, 0x88, 0x17, 0xb5, 0x39, 0xef, 0x74, 0xa2, 0x82,
+    0x11, 0x3a, 0xfd, 0x58, 0x3a, 0x04, 0x59, 0xc9, 0x1a, 0x81, 0x89, 0xf3, 0x2f, 0xb2, 0xc2, 0x3b, 0x20, 0x53, 0x31, 0xf6,
+    0x36, 0xf2, 0xba, 0xbe, 0x62, 0xb0, 0x94, 0x7c, 0x60, 0xf3, 0x08, 0x36, 0x66, 0xa6, 0x19, 0x2e, 0x1f, 0xd2, 0xd1, 0x74,
+    0x84, 0x21, 0xb6, 0xbf, 0x8c, 0xd9, 0x68, 0x9d, 0xbc, 0xba, 0x18, 0x0e, 0x4e, 0xcd, 0x38, 0xd5, 0x9d, 0x1b, 0xcd, 0x6b,
+    0x8e, 0xd4, 0x04, 0x02, 0xf1, 0x38, 0x01, 0x08, 0x33, 0x46, 0xf9, 0x8e, 0x5e, 0x03, 0x63, 0xec, 0xb4, 0x20, 0x28, 0x00,
+    0x0e, 0x22, 0xa7, 0x60, 0x81, 0x38, 0x82, 0x57, 0x0b, 0xf8, 0x44, 0xeb, 0xc5, 0x92, 0x75, 0x83, 0xe7, 0x78, 0xf4, 0x98,
+    0xc2, 0x05, 0x9f, 0x1b, 0x43, 0xfa, 0x6d, 0x52, 0xa3, 0x1e, 0x6c, 0x87, 0x67, 0xa4, 0xf0, 0xe7, 0xe6, 0xcd, 0xf4, 0x0a,
+    0x92, 0x93, 0x32, 0x96, 0x42, 0x6a, 0x49, 0xd0, 0xba, 0x2f, 0xdd, 0x60, 0x31, 0xee, 0xb2, 0xc0, 0xab, 0x9d, 0x12, 0xe0,
+    0x8a, 0x2b, 0x5f, 0xc4, 0x73, 0x97, 0x73, 0x3a, 0x92, 0x68, 0x6e, 0x55, 0xe0, 0xe3, 0x33, 0xef, 0xa5, 0xcf, 0x03, 0x6f,
+    0xdd, 0xfc, 0x88, 0x6a, 0x6a, 0x46, 0xcc, 0x46, 0xe8, 0x26, 0x18, 0xdf, 0xc5, 0x0e, 0x2e, 0x9d, 0xda, 0xcd, 0x16, 0xea,
+    0xec, 0x40, 0x85, 0x53, 0x6a, 0xa5, 0xcb, 0x72, 0xe0, 0xcd, 0xab, 0x5b, 0x7e, 0x7f, 0x65, 0x3a, 0x31, 0x05, 0x38, 0x8b,
+    0x1b, 0x8e, 0x36, 0xe2, 0x9c, 0xde, 0x92, 0x44, 0x67, 0xb3, 0x8d, 0x46, 0x88, 0xb3, 0xf1, 0x3d, 0xc5, 0x39, 0x57, 0x98,
+    0xe2, 0x9c, 0xc1, 0x2d, 0x87, 0x7b, 0xc4, 0x27, 0x2a, 0xc6, 0x5c, 0x80, 0xb2, 0x78, 0xfa, 0xc6, 0xf5, 0xfc, 0x30, 0x36,
+    0x71, 0xce, 0xa7, 0xab, 0x8a, 0xb7, 0xe5, 0x89, 0xb7, 0x85, 0x8a, 0x56, 0x55, 0x3a, 0xd6, 0x6d, 0x42, 0xd0, 0x12, 0x0e,
+    0xaf, 0x76, 0x0f, 0x53, 0x51, 0x42, 0x5f, 0x8d, 0x3d, 0x74, 0x0b, 0x35, 0xca, 0x90, 0xa1, 0x0a, 0x64, 0x6f, 0x58, 0xc9,
+    0x42, 0xe6, 0xe1, 0x65, 0xac, 0xbb, 0x39, 0xf3, 0x43, 0xd4, 0x73, 0xf4, 0x71, 0xe6, 0xb4, 0x95, 0xc8, 0xc4, 0x49, 0xbf,
+    0x67, 0x09, 0x29, 0x9e, 0x49, 0xfa, 0xad, 0xd9, 0x25, 0xd4, 0xb8, 0xa5, 0xfb, 0x9e, 0x79, 0xfd, 0x73, 0x7a, 0xf1, 0xa3,
+    0x5c, 0x7e, 0xfa, 0x7a, 0x1d, 0xb5, 0x8c, 0x0c, 0x4b, 0x10, 0x6c, 0xcf, 0x29, 0x40, 0x94, 0xaa, 0x12, 0x2c, 0x1f, 0x8a,
+    0x81, 0xb6, 0xb0, 0xb8, 0x15, 0x2f, 0x6f, 0x40, 0x74, 0xd6, 0x76, 0xd2, 0x3d, 0xad, 0x29, 0xf2, 0x47, 0xee, 0x1e, 0xf4,
+    0xd4, 0x46, 0xc6, 0x2a, 0x22, 0x37, 0x21, 0xbd, 0x52, 0x9d, 0xca, 0x32, 0x82, 0x53, 0x3e, 0xca, 0x00, 0x32, 0x6f, 0x29,
+    0xc2, 0x79, 0x10, 0x97, 0xea, 0x88, 0xcb, 0x06, 0xca, 0x8f, 0xa6, 0x61, 0x4d, 0xf5, 0x6e, 0x21, 0x79, 0xe1, 0x80, 0x3c,
+    0x3a, 0x85, 0x57, 0x8e, 0x04, 0xc1, 0x56, 0x50, 0x64, 0xdd, 0x0c, 0x1c, 0xe2, 0x61, 0x0b, 0x13, 0x22, 0x9c, 0x55, 0x52,
+    0x40, 0x79, 0x3a, 0xdd, 0x43, 0xe7, 0xc4, 0x69, 0x87, 0x9c, 0xe2, 0xd5, 0x2f, 0xe5, 0x5b, 0x90, 0x44, 0x3b, 0x6d, 0xfa,
+    0x67, 0x71, 0x24, 0x09, 0x95, 0x29, 0xdb, 0xdc, 0x03, 0x1d, 0x24, 0x29, 0xe8, 0xa1, 0xd0, 0x3a, 0x4a, 0xd9, 0x99, 0x0c,
+    0xea, 0x0d, 0x84, 0x91, 0xb5, 0x9a, 0xca, 0x5b, 0x4f, 0x49, 0x53, 0x4b, 0x01, 0x08, 0xbe, 0x56, 0xdf, 0xb6, 0xc0, 0xd7,
+    0x48, 0xa7, 0x93, 0xef, 0xb0, 0xca, 0x85, 0xe1, 0x0a, 0x2f, 0x4b, 0xeb, 0x95, 0xd6, 0x2c, 0xf0, 0xad, 0x28, 0x0d, 0x47,
+    0x7c, 0xd8, 0x91, 0xe1, 0x30, 0x3d, 0xf8, 0x8b, 0xcb, 0xe3, 0x2b, 0x69, 0x5f, 0xe2, 0x9f, 0x01, 0x1d, 0xf4, 0x3d, 0x3b,
+    0x7d, 0x35, 0xe8, 0xb2, 0x4e, 0xa3, 0x72, 0xf2, 0xfd, 0xe0, 0xe4, 0x87, 0xb3, 0xf3, 0xef, 0xae, 0x7e, 0x1a, 0xbc, 0x19,
+    0x9e, 0x5d, 0x9c, 0x77, 0xd9, 0x4e, 0xa3, 0x72, 0x7a, 0xf1, 0xf3, 0xf9, 0xab, 0x8b, 0xe3, 0x53, 0x28, 0xef, 0xb2, 0xdd,
+    0x46, 0xe5, 0xe7, 0x37, 0x67, 0x97, 0xf4, 0xf9, 0x79, 0xa3, 0x22, 0x7d, 0xbd, 0x2e, 0xdb, 0x6b, 0x54, 0x28, 0xa6, 0x4b,
+    0xfe, 0x77, 0x97, 0xed, 0xab, 0xaf, 0x98, 0xef, 0x76, 0x45, 0x60, 0xbb, 0xec, 0x6b, 0xab, 0x50, 0x81, 0xed, 0xb2, 0x03,
+    0x55, 0x8e, 0xb6, 0x54, 0x97, 0xbd, 0x50, 0x5f, 0xdf, 0xbe, 0x3e, 0x05, 0x0c, 0xaf, 0xbe, 0x1d, 0x7c, 0x77, 0x06, 0xc5,
+    0xdf, 0x64, 0x8a, 0x11, 0x8d, 0x01, 0xbe, 0xe5, 0x22, 0x53, 0x3e, 0x38, 0x07, 0x90, 0x3b, 0x3b, 0xaa, 0xf4, 0xfc, 0xe2,
+    0xea, 0x78, 0x38, 0x1c, 0x5c, 0xe2, 0xab, 0x6e, 0x8c, 0xb2, 0xe1, 0xeb, 0xe3, 0x13, 0x6c, 0xfd, 0x1c, 0xf5, 0x6c, 0x36,
+    0xeb, 0xb1, 0x80, 0x71, 0x6b, 0xb9, 0x54, 0xba, 0x37, 0x69, 0x1a, 0x88, 0x7a, 0xd3, 0x97, 0xca, 0xcf, 0xa2, 0x85, 0x82,
+    0xe1, 0x84, 0x34, 0x07, 0xf8, 0x93, 0x96, 0x35, 0xf0, 0x5c, 0x76, 0x35, 0x66, 0xd6, 0xa2, 0x4a, 0xe0, 0xd5, 0x32, 0xb2,
+    0x28, 0xb3, 0x52, 0x80, 0x06, 0xcb, 0x58, 0x82, 0xdf, 0x3a, 0xb5, 0x72, 0xeb, 0xeb, 0x78, 0xad, 0x1c, 0x44, 0x7d, 0xd3,
+    0x6b, 0x2e, 0x0d, 0xd1, 0x51, 0xb4, 0x95, 0x6e, 0x6e, 0x7a, 0x27, 0xac, 0xb3, 0xd5, 0x15, 0x15, 0xfa, 0x56, 0xd4, 0xb1,
+    0x05, 0x07, 0xbd, 0xbb, 0xdc, 0x95, 0xbd, 0x0f, 0xa0, 0x9c, 0xcc, 0x41, 0x11, 0x33, 0x26, 0x48, 0x34, 0xd4, 0xf7, 0xc0,
+    0xac, 0xb7, 0x55, 0xd5, 0x2b, 0xde, 0x84, 0x19, 0x47, 0x77, 0x29, 0x8a, 0xde, 0xf3, 0x60, 0xea, 0x05, 0xa0, 0xb3, 0xe1,
+    0xb4, 0x82, 0xcc, 0xb2, 0x93, 0x70, 0x09, 0x56, 0x0a, 0xde, 0x19, 0x41, 0x26, 0xac, 0xe4, 0x31, 0x4a, 0x2a, 0x7b, 0x64,
+    0xb6, 0x54, 0x9e, 0x78, 0xca, 0x35, 0xfe, 0xdb, 0xa4, 0x9a, 0x53, 0x74, 0xb5, 0xa9, 0xb7, 0x8c, 0x68, 0xc7, 0x94, 0xf8,
+    0x4c, 0x0e, 0xbe, 0xe5, 0x94, 0xa6, 0x3b, 0xe7, 0xf5, 0xc9, 0x83, 0x16, 0x3e, 0x4d, 0x8d, 0xb5, 0xf0, 0x3f, 0x5d, 0x17,
+    0x3f, 0x91, 0x00, 0xc9, 0x2b, 0xdc, 0x9c, 0xba, 0xcd, 0x09, 0x91, 0x27, 0x92, 0x3b, 0x22, 0xa3, 0xfb, 0xb3, 0x92, 0x3b,
+    0x72, 0xbe, 0x16, 0x62, 0x27, 0xe6, 0x09, 0x04, 0x90, 0x00, 0x58, 0x2c, 0x81, 0x1e, 0x46, 0x7a, 0xb9, 0x9e, 0xfe, 0x46,
+    0x25, 0x17, 0x49, 0x99, 0xc2, 0xd4, 0xd8, 0xac, 0x00, 0x13, 0xb0, 0x9e, 0x46, 0x82, 0x99, 0xcb, 0x2f, 0x23, 0xc8, 0xfe,
+    0x1f, 0x11, 0x7f, 0x9d, 0x00, 0x94, 0x14, 0x2a, 0x97, 0x80, 0x66, 0x9c, 0x1d, 0x96, 0x2a, 0x9e, 0x7d, 0x68, 0xc8, 0xdd,
+    0x04, 0xfc, 0x6c, 0x24, 0x7c, 0xc9, 0xc3, 0x26, 0x3c, 0x8a, 0xa1, 0xdd, 0xfa, 0xf1, 0xc9, 0xba, 0xcd, 0xf7, 0xa2, 0x72,
+    0x2a, 0xce, 0x74, 0x66, 0xe5, 0x56, 0x60, 0xd2, 0xdb, 0xdc, 0x36, 0x02, 0x3a, 0x51, 0x07, 0xd8, 0x1f, 0x08, 0x31, 0x7d,
+    0xfd, 0xbb, 0x63, 0x38, 0x0a, 0x14, 0x8b, 0x3f, 0xc7, 0x37, 0x8d, 0xae, 0x07, 0x67, 0xbd, 0x94, 0x34, 0x05, 0x90, 0xb9,
+    0x0b, 0x66, 0xa8, 0x62, 0x8f, 0x1b, 0x19, 0x22, 0x45, 0x2f, 0x56, 0xb1, 0xa9, 0xa7, 0x56, 0x28, 0x4f, 0xc1, 0xa8, 0x26,
+    0x24, 0x5a, 0x9c, 0x5b, 0x01, 0x21, 0xbe, 0xd4, 0xa1, 0xae, 0x27, 0xd2, 0x70, 0x26, 0x2a, 0xaf, 0xe5, 0xae, 0xe0, 0xc9,
+    0x36, 0x37, 0xbc, 0x48, 0x30, 0xfa, 0x75, 0xd8, 0x05, 0x7c, 0x60, 0x43, 0xfd, 0xd6, 0x7d, 0x10, 0xbc, 0x1b, 0x37, 0x52,
+    0x6f, 0x15, 0x13, 0xab, 0x09, 0x96, 0x98, 0x4c, 0x8d, 0x3e, 0x15, 0x61, 0x23, 0x5b, 0xf0, 0xa8, 0xbd, 0xcf, 0x53, 0xf9,
+    0x8e, 0x81, 0xf4, 0x9b, 0xdc, 0xef, 0xba, 0x82, 0xd5, 0x59, 0x90, 0x35, 0x87, 0x2d, 0x1f, 0x25, 0x35, 0xb6, 0xe9, 0xa0,
+    0x57, 0x59, 0x87, 0xbb, 0x32, 0x16, 0x4c, 0xd4, 0x4b, 0x37, 0x69, 0xc9, 0x17, 0xbc, 0x42, 0x37, 0x54, 0xf8, 0x6b, 0x0e,
+    0x2a, 0x87, 0x2d, 0xda, 0x81, 0xb7, 0xfa, 0xe6, 0xd2, 0x6c, 0xa7, 0x63, 0x9a, 0x0f, 0xb4, 0x50, 0x8a, 0xa3, 0x0f, 0x9b,
+    0x8d, 0x21, 0x6d, 0x15, 0xe8, 0x20, 0x5f, 0x46, 0x10, 0xd6, 0x73, 0xa2, 0x31, 0x43, 0x69, 0x29, 0x56, 0x5b, 0xb2, 0xda,
+    0x95, 0x52, 0x5f, 0x57, 0x52, 0x06, 0x89, 0x94, 0xd5, 0xf6, 0xb1, 0xcc, 0x3c, 0x5c, 0x27, 0xda, 0x80, 0x31, 0xf2, 0x22,
+    0x54, 0x51, 0x44, 0xf5, 0x23, 0xa6, 0xfe, 0x4a, 0x57, 0xc4, 0x56, 0xea, 0x99, 0x2e, 0xd4, 0x9d, 0xaf, 0x7d, 0x28, 0x32,
+    0x7f, 0x01, 0x35, 0x8a, 0x88, 0xe6, 0x7a, 0x2e, 0x19, 0x68, 0x0e, 0x4e, 0xaf, 0xb2, 0x66, 0x50, 0xf9, 0x28, 0xbb, 0x63,
+    0x50, 0x7d, 0x63, 0xa7, 0x92, 0x72, 0x0f, 0xea, 0xc0, 0xb8, 0x6c, 0x53, 0x84, 0x2c, 0x4d, 0x81, 0x5f, 0xcf, 0x28, 0x80,
+    0x92, 0x41, 0xe6, 0xa8, 0xfc, 0xa7, 0x74, 0x06, 0x24, 0x80, 0x2b, 0xf1, 0xb2, 0x6a, 0x9a, 0xde, 0x50, 0x41, 0x65, 0x54,
+    0x08, 0x06, 0x27, 0x5d, 0xa0, 0xd3, 0x33, 0x16, 0x70, 0x56, 0x61, 0xd4, 0x4b, 0x14, 0x49, 0x6e, 0x3c, 0x6b, 0x50, 0x92,
+    0x9b, 0xbb, 0xc6, 0x0d, 0xa3, 0x5b, 0x47, 0xe1, 0x8c, 0x95, 0xf0, 0xac, 0xb4, 0x87, 0x5f, 0x7f, 0xad, 0x64, 0x04, 0x57,
+    0xed, 0x31, 0x8b, 0x7a, 0x4b, 0x61, 0x90, 0x13, 0x22, 0x75, 0x4a, 0x4f, 0x50, 0xd8, 0x09, 0x35, 0x75, 0x35, 0x0a, 0x3d,
+    0x11, 0xf3, 0xce, 0x06, 0xbd, 0x5a, 0x46, 0x48, 0xeb, 0x41, 0xed, 0x64, 0xe8, 0x4b, 0x05, 0x31, 0x37, 0x86, 0x48, 0x0d,
+    0xd2, 0x3d, 0x82, 0x3a, 0x4f, 0x27, 0x2a, 0x1f, 0x46, 0x9d, 0x6c, 0x14, 0xf0, 0xf7, 0x20, 0xed, 0xb3, 0x72, 0x85, 0x03,
+    0x44, 0x78, 0x84, 0x8e, 0xdc, 0xb6, 0x5e, 0x1a, 0xd3, 0xaf, 0x0e, 0xcd, 0xb3, 0xb1, 0xb8, 0xca, 0xd0, 0x3f, 0xe1, 0x5e,
+    0xb5, 0x5e, 0x5f, 0xa7, 0x70, 0x45, 0x9a, 0xbd, 0x5c, 0x94, 0xe9, 0x21, 0xa8, 0x0c, 0x21, 0x4c, 0xcf, 0xe8, 0xcc, 0x0b,
+    0xd4, 0x82, 0x2c, 0x1f, 0xb5, 0x21, 0x9e, 0x33, 0x20, 0xca, 0x9f, 0xa0, 0xd4, 0xae, 0x22, 0xf4, 0x6a, 0x9a, 0x49, 0xb3,
+    0xc6, 0x12, 0xb0, 0x71, 0xb6, 0xf2, 0xb1, 0xca, 0xa7, 0xe3, 0x71, 0x90, 0xb5, 0xc8, 0xb5, 0x8c, 0xc7, 0x14, 0x96, 0x2c,
+    0x28, 0x11, 0xb9, 0x64, 0x41, 0x5a, 0x24, 0x74, 0x14, 0xdf, 0x3c, 0x92, 0x4f, 0xd9, 0x43, 0xf9, 0xd4, 0xe6, 0x80, 0x9c,
+    0xc5, 0x59, 0x2f, 0x33, 0x45, 0xcb, 0xb3, 0x6e, 0xf2, 0xd0, 0xc0, 0xd2, 0xac, 0xe7, 0x8d, 0x4f, 0x09, 0x81, 0x5e, 0x42,
+    0x2c, 0x62, 0x85, 0x0a, 0x77, 0x2d, 0x05, 0x60, 0x3c, 0x9d, 0xd5, 0x57, 0xd7, 0x3d, 0x3b, 0xad, 0xb5, 0x68, 0x88, 0xcf,
+    0x8a, 0x86, 0x28, 0x83, 0xfa, 0xc8, 0x58, 0xa5, 0xc3, 0x4b, 0xcd, 0xa0, 0xad, 0x29, 0x27, 0xc1, 0x7e, 0x92, 0xb1, 0xba,
+    0x66, 0x15, 0xc9, 0x37, 0x51, 0xa4, 0x87, 0x4e, 0x9e, 0x59, 0x27, 0x3c, 0x22, 0x7e, 0x13, 0x86, 0xfa, 0x54, 0xc7, 0x23,
+    0x08, 0xed, 0xe0, 0xcb, 0xba, 0x0b, 0x9b, 0x7f, 0xea, 0xac, 0x3f, 0x2e, 0x34, 0xf7, 0x70, 0xcb, 0x77, 0x25, 0xde, 0x06,
+    0x2d, 0xdf, 0x02, 0x7d, 0xd8, 0xc6, 0x5b, 0xaf, 0xf1, 0x72, 0xbe, 0xd0, 0xbb, 0xb7, 0xef, 0xb3, 0x17, 0xd7, 0x61, 0xe3,
+    0x95, 0x83, 0xd3, 0x1d, 0xba, 0x52, 0x3e, 0x7d, 0xab, 0x71, 0xb5, 0xaf, 0x77, 0x9c, 0xf0, 0x8e, 0xa0, 0x88, 0xc9, 0x37,
+    0x24, 0x03, 0xb4, 0x1d, 0xfb, 0x6e, 0x7c, 0xe3, 0x2a, 0x7a, 0xb1, 0xcd, 0x59, 0x35, 0x1e, 0x14, 0xe5, 0x76, 0xe8, 0x0b,
+    0x00, 0xed, 0x64, 0x88, 0x2a, 0x2b, 0xb8, 0x5c, 0xbe, 0xc7, 0xe4, 0xbb, 0xb2, 0x6f, 0xc2, 0x24, 0x09, 0x67, 0x5d, 0xb6,
+    0xc3, 0x67, 0x3d, 0x66, 0xbc, 0xbc, 0xfd, 0x60, 0x1f, 0x0b, 0x0a, 0xde, 0xc6, 0xce, 0x90, 0xa1, 0x9a, 0x74, 0xc5, 0xa2,
+    0x71, 0xb9, 0xa2, 0x42, 0x7c, 0xba, 0xdb, 0xc7, 0x03, 0x43, 0x30, 0x9a, 0x5d, 0x9b, 0x24, 0x6a, 0x24, 0xc2, 0xf2, 0xc2,
+    0xa1, 0xd0, 0x4b, 0x1a, 0x71, 0x2c, 0xfa, 0x65, 0xcc, 0x78, 0x7d, 0x7e, 0xbc, 0xbc, 0x99, 0xf9, 0x09, 0x6e, 0xd3, 0xd3,
+    0x05, 0x0e, 0xd9, 0x37, 0x3c, 0x67, 0x5e, 0x82, 0x80, 0xad, 0x9a, 0xf8, 0xf2, 0xf1, 0x05, 0xdd, 0xef, 0x28, 0x76, 0xd8,
+    0xc5, 0x3e, 0x3f, 0xa6, 0xcb, 0x8a, 0xfb, 0xfc, 0xc5, 0x27, 0x8c, 0xdc, 0xf8, 0x11, 0xc7, 0x09, 0xdb, 0xfa, 0x82, 0x18,
+    0x9c, 0x6d, 0x7a, 0x56, 0xf8, 0xd6, 0x02, 0xbb, 0x73, 0x71, 0x0d, 0x09, 0x94, 0xe1, 0x6c, 0x8b, 0x37, 0x40, 0x55, 0xfb,
+    0xaf, 0xe5, 0xa7, 0xc3, 0x36, 0x3d, 0xee, 0xdb, 0x6f, 0x2c, 0xd0, 0xf5, 0x24, 0xca, 0xe9, 0x77, 0xc1, 0x33, 0x0a, 0x8a,
+    0xee, 0x7c, 0xa1, 0xba, 0x4e, 0x7c, 0xe8, 0xf3, 0x6c, 0x2c, 0x38, 0x48, 0x9d, 0xda, 0xf6, 0x42, 0x1e, 0xcf, 0x1d, 0xbc,
+    0x82, 0x18, 0x78, 0xd6, 0x65, 0xaa, 0x7d, 0x83, 0xee, 0xa2, 0xc2, 0xf3, 0xe2, 0x74, 0xa5, 0x21, 0x4b, 0xa6, 0x7e, 0xcc,
+    0x6e, 0x02, 0x77, 0x7e, 0xdb, 0xc2, 0x8b, 0x4f, 0xad, 0x21, 0x89, 0x1b, 0x22, 0x53, 0x1f, 0xbe, 0x9a, 0xde, 0x3d, 0x29,
+    0x50, 0x16, 0xd3, 0x03, 0x24, 0x53, 0x6f, 0x3b, 0x2d, 0xb8, 0x55, 0x12, 0xe9, 0xf2, 0x40, 0xb0, 0xe2, 0x8b, 0x18, 0x77,
+    0xd1, 0xc6, 0x71, 0xb5, 0xff, 0x46, 0x94, 0xea, 0xc1, 0xe2, 0x9d, 0x04, 0x65, 0x37, 0x5a, 0x12, 0x17, 0xf2, 0x60, 0x14,
+    0xce, 0x38, 0x06, 0x9b, 0xd3, 0x15, 0xb6, 0x91, 0x27, 0x17, 0x7d, 0xf5, 0xc2, 0x72, 0xa0, 0x91, 0xcb, 0x12, 0x7f, 0x7e,
+    0x8f, 0x2f, 0x8f, 0x48, 0x88, 0x57, 0xf1, 0x0a, 0xed, 0xa9, 0xb8, 0x87, 0x7d, 0xbc, 0x9c, 0x8b, 0x43, 0x32, 0x28, 0xad,
+    0xf1, 0x8e, 0xc8, 0xc8, 0xa3, 0x38, 0x2a, 0xe6, 0x9b, 0x26, 0x53, 0x3c, 0x8d, 0x0a, 0xcb, 0x02, 0x50, 0x6d, 0x89, 0x33,
+    0x67, 0x2c, 0xc4, 0x39, 0x87, 0xf2, 0x43, 0x97, 0x4d, 0x61, 0x7c, 0x20, 0x21, 0x92, 0x64, 0x11, 0x77, 0xdb, 0xed, 0x09,
+    0x00, 0x59, 0xde, 0xb4, 0x00, 0xd5, 0xf6, 0x22, 0x8c, 0x93, 0x69, 0x38, 0x69, 0x83, 0xe9, 0x74, 0x8b, 0x7f, 0x41, 0xc2,
+    0xdd, 0xb4, 0x67, 0x40, 0xaf, 0xf6, 0x9b, 0xc1, 0xf1, 0xe9, 0x8f, 0x83, 0xd6, 0x0c, 0x18, 0x43, 0x5c, 0xdc, 0x76, 0x54,
+    0xbd, 0xa2, 0x09, 0xac, 0xf6, 0x31, 0xc3, 0x6d, 0xc6, 0x0f, 0xdb, 0x6e, 0x1f, 0x47, 0x8a, 0x17, 0x12, 0x4e, 0x5d, 0x3a,
+    0xe3, 0xd6, 0x60, 0x3c, 0x5e, 0xf0, 0x91, 0xef, 0xa2, 0xed, 0xf5, 0xf8, 0xae, 0x13, 0x3e, 0x9a, 0x36, 0x3d, 0x0e, 0xd3,
+    0x16, 0xc4, 0x85, 0x08, 0x60, 0x05, 0x26, 0x2b, 0xb0, 0xb1, 0x1f, 0x10, 0x2e, 0x92, 0xb1, 0xd2, 0xd9, 0x78, 0x0d, 0x1d,
+    0x20, 0x55, 0x8f, 0x5f, 0x9f, 0xd9, 0x67, 0xe6, 0x1e, 0x24, 0x28, 0x8c, 0xd7, 0xb6, 0x96, 0x88, 0x0a, 0xfb, 0x7d, 0xb0,
+    0xd5, 0x2d, 0xd7, 0xab, 0x4c, 0x09, 0x02, 0x1e, 0x9b, 0x10, 0x4a, 0x6a, 0xad, 0x5a, 0xf2, 0x44, 0x56, 0x92, 0x2c, 0x2a,
+    0x3e, 0x6f, 0x23, 0x53, 0x22, 0x09, 0x54, 0x8b, 0x14, 0xbb, 0x26, 0xbe, 0x18, 0xe5, 0xed, 0xb0, 0xf4, 0x31, 0x5f, 0x56,
+    0xfb, 0x83, 0xb7, 0x9f, 0x2a, 0x90, 0x44, 0xda, 0x58, 0xb5, 0x7f, 0x89, 0xd9, 0x8c, 0x67, 0xa7, 0xc5, 0xd2, 0x48, 0xbc,
+    0x3f, 0x45, 0x0c, 0x56, 0x36, 0xa0, 0xc1, 0xaa, 0xcf, 0x33, 0x7f, 0x7e, 0x54, 0x6d, 0xee, 0x58, 0xa3, 0xb6, 0x05, 0xd2,
+    0x25, 0x4a, 0x16, 0xf8, 0x8f, 0xec, 0x36, 0x5f, 0xce, 0x78, 0xe4, 0x06, 0xf0, 0xd9, 0xc5, 0xe4, 0xb2, 0x05, 0x77, 0x23,
+    0x58, 0x51, 0x62, 0x15, 0x70, 0x58, 0x25, 0xe1, 0x98, 0x3e, 0xbe, 0x7d, 0xf3, 0x4a, 0xdc, 0x1d, 0x00, 0x32, 0xca, 0x81,
+    0x05, 0x14, 0x84, 0x21, 0x9d, 0xd0, 0x84, 0x9a, 0x24, 0xdb, 0x72, 0x5c, 0x0b, 0xa0, 0x5a, 0x92, 0x5d, 0x89, 0x75, 0xf3,
+    0x1c, 0x09, 0x56, 0x1c, 0xe6, 0xca, 0x3a, 0x31, 0x9b, 0x82, 0x00, 0x40, 0xcd, 0xcb, 0x3c, 0x37, 0x9e, 0xde, 0x84, 0x2e,
+    0xca, 0xe1, 0x2c, 0x73, 0x6e, 0x43, 0x3e, 0x91, 0xc1, 0x56, 0xed, 0x23, 0xf7, 0xde, 0xf2, 0xfb, 0xcd, 0xe4, 0x93, 0x0d,
+    0x88, 0x7c, 0xaa, 0x71, 0x96, 0x58, 0x27, 0x74, 0x99, 0x17, 0x30, 0xc8, 0xc6, 0x21, 0xc6, 0x3c, 0xc1, 0xdd, 0x9a, 0xb8,
+    0xbd, 0x8c, 0x41, 0x17, 0x03, 0xbc, 0x26, 0x20, 0x11, 0xe7, 0x07, 0x8e, 0x09, 0xc7, 0x12, 0x45, 0x10, 0x40, 0x82, 0x7e,
+    0x92, 0x18, 0x4c, 0xc1, 0x20, 0x02, 0xb0, 0xef, 0x7c, 0x7c, 0x91, 0x2c, 0x06, 0xe8, 0x5d, 0xd0, 0x14, 0x64, 0xef, 0x89,
+    0x5d, 0x39, 0x3a, 0x4b, 0x1a, 0x97, 0x52, 0xe8, 0x61, 0xea, 0xa1, 0x60, 0xb1, 0x97, 0xe9, 0x8a, 0x54, 0x52, 0xa8, 0x37,
+    0xdd, 0xc4, 0xdb, 0x48, 0x06, 0x65, 0x0d, 0x15, 0xbd, 0xd4, 0x4c, 0x88, 0x73, 0xcc, 0x60, 0x23, 0x7e, 0xd2, 0x81, 0x96,
+    0xf4, 0xad, 0x61, 0x74, 0x93, 0xcd, 0xa2, 0x48, 0x79, 0xfc, 0xe8, 0xce, 0x91, 0x6d, 0x1e, 0x8c, 0x47, 0x59, 0xef, 0xe2,
+    0xed, 0x74, 0xa5, 0xdd, 0x65, 0x76, 0x55, 0x37, 0xf6, 0x48, 0x7d, 0xa9, 0xe0, 0xa7, 0x8a, 0xe3, 0x5b, 0x5a, 0xec, 0x44,
+    0x44, 0x48, 0x99, 0x0c, 0x1b, 0x76, 0x99, 0xb8, 0xfb, 0x9a, 0x70, 0xb4, 0xb7, 0x94, 0x80, 0x11, 0xe5, 0xa9, 0x68, 0xc2,
+    0x8f, 0x6e, 0xc0, 0x16, 0x68, 0x2e, 0x32, 0xa4, 0xcd, 0x6d, 0xf4, 0xc0, 0x82, 0xd0, 0x54, 0x2d, 0xe8, 0x28, 0xd7, 0xb2,
+    0xda, 0x3f, 0x6f, 0x1f, 0x5b, 0x5d, 0x3c, 0xd6, 0x44, 0xc8, 0x6e, 0x60, 0xc8, 0x41, 0x90, 0x86, 0x16, 0xa5, 0x71, 0x9e,
+    0xd7, 0xd4, 0x24, 0x95, 0x6d, 0x11, 0x15, 0xdb, 0xc9, 0x64, 0xc4, 0xef, 0xf5, 0xa5, 0x73, 0x24, 0x15, 0x5d, 0x17, 0xa6,
+    0x68, 0x0f, 0x49, 0x04, 0x73, 0x26, 0xf4, 0x81, 0xb1, 0x7d, 0xa5, 0xcd, 0x70, 0xab, 0x14, 0x0c, 0xed, 0x0f, 0x68, 0x26,
+    0x43, 0x93, 0x4f, 0x18, 0x78, 0x7e, 0x43, 0x0a, 0xcc, 0x40, 0x51, 0xa6, 0x99, 0xa7, 0xc4, 0x26, 0xca, 0x0c, 0x5f, 0xfa,
+    0x08, 0x69, 0xb7, 0x6a, 0xf4, 0xd2, 0x2f, 0x48, 0xc2, 0x05, 0x38, 0x05, 0xfb, 0x60, 0xf0, 0x57, 0x35, 0x2f, 0xe4, 0x37,
+    0xb1, 0xaa, 0xf9, 0x89, 0x54, 0x4e, 0x74, 0xd5, 0x6c, 0x92, 0xdf, 0x1d, 0x2a, 0xa7, 0x76, 0x06, 0x51, 0x73, 0x23, 0xa8,
+    0x9a, 0xed, 0x44, 0x14, 0x4a, 0x48, 0xe4, 0x68, 0x82, 0xef, 0xf2, 0x55, 0x2f, 0xf7, 0xae, 0x31, 0x0b, 0x7f, 0x6b, 0xff,
+    0x4c, 0x83, 0xb4, 0x4b, 0xfb, 0x45, 0x4b, 0x55, 0xfe, 0x19, 0x83, 0x1f, 0xcc, 0xa3, 0xfe, 0x6b, 0x1e, 0xe2, 0x6b, 0xf2,
+    0xee, 0xa6, 0x21, 0xc3, 0xb5, 0x0b, 0xb2, 0x14, 0x4d, 0xad, 0x18, 0xef, 0xc3, 0x59, 0x82, 0xaa, 0xbb, 0x41, 0x9b, 0x2f,
+    0x0e, 0xc7, 0x09, 0xad, 0xec, 0x78, 0x4a, 0xbb, 0xf7, 0x33, 0xf7, 0x16, 0x0d, 0x70, 0xee, 0x47, 0x0c, 0x8f, 0x5d, 0x2b,
+    0xbb, 0xb1, 0xc5, 0x9a, 0xec, 0x18, 0x84, 0x38, 0xfb, 0xc1, 0xbd, 0x47, 0x99, 0x48, 0xf0, 0xf1, 0x5d, 0x5f, 0xc2, 0xb3,
+    0xa4, 0xcb, 0xb2, 0xfb, 0xff, 0x07, 0x48, 0x06, 0x75, 0x24, 0x28, 0xa1, 0x00, 0x00
+};
+static const size_t PORTAL_HTML_GZ_LEN = 9294;
+static const char PORTAL_HTML_ETAG[] = "\"88ba0227ea28a029\"";
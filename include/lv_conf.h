@@ -80,7 +80,9 @@
 
 #if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
     /** Size of memory available for `lv_malloc()` in bytes (>= 2kB) */
+    #ifndef LV_MEM_SIZE                   // The native test build passes a larger pool
     #define LV_MEM_SIZE (32 * 1024U)          /**< [bytes] - Migrated from old config (was 32k) */
+    #endif
 
     /** Size of the memory expand for `lv_malloc()` in bytes */
     #define LV_MEM_POOL_EXPAND_SIZE 0         // Default
@@ -166,7 +168,7 @@
 #if LV_USE_DRAW_SW == 1
     /* Selectively disable color format support */
     #define LV_DRAW_SW_SUPPORT_RGB565       1 // Keep enabled for LV_COLOR_DEPTH 16
-    #define LV_DRAW_SW_SUPPORT_RGB565A8     0 // Default
+    #define LV_DRAW_SW_SUPPORT_RGB565A8     1 // Decoded PokeAPI sprites (RGB565 + alpha plane)
     #define LV_DRAW_SW_SUPPORT_RGB888       0 // Default
     #define LV_DRAW_SW_SUPPORT_XRGB8888     0 // Default
     #define LV_DRAW_SW_SUPPORT_ARGB8888     1 // Default
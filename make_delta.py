@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Build a delta firmware patch that turns one app image into another.
+
+The device rebuilds the new image from its running partition plus the patch
+(see src/OtaDeltaPatch.h), so a release only needs to ship the bytes that
+actually changed:
+
+    python make_delta.py old/firmware.bin new/firmware.bin -o firmware-0.1.6.patch
+
+Patches are named after the version they apply to. Every patch is applied
+back to the old image here and compared with the new one before it is
+written, and the size against a full download is printed.
+"""
+import argparse
+import hashlib
+import struct
+import sys
+
+MAGIC = b"DHOP"
+VERSION = 1
+OP_END = 0x00
+OP_COPY = 0x01
+OP_LITERAL = 0x02
+
+BLOCK_SIZE = 64        # Shortest run worth a COPY (an op costs 9 bytes)
+COMPARE_STEP = 4096    # Bytes compared at a time while extending a match
+
+
+def index_blocks(old):
+    """Map each block-aligned chunk of the old image to its first offset."""
+    index = {}
+    for offset in range(0, len(old) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        index.setdefault(old[offset:offset + BLOCK_SIZE], offset)
+    return index
+
+
+def match_forward(old, new, old_pos, new_pos):
+    """Length of the common run starting at old_pos / new_pos."""
+    length = 0
+    limit = min(len(old) - old_pos, len(new) - new_pos)
+    while length + COMPARE_STEP <= limit and \
+            old[old_pos + length:old_pos + length + COMPARE_STEP] == \
+            new[new_pos + length:new_pos + length + COMPARE_STEP]:
+        length += COMPARE_STEP
+    while length < limit and old[old_pos + length] == new[new_pos + length]:
+        length += 1
+    return length
+
+
+def diff(old, new):
+    """Yield ("copy", offset, length) and ("literal", bytes) ops rebuilding new."""
+    index = index_blocks(old)
+    literal_start = 0
+    pos = 0
+    while pos + BLOCK_SIZE <= len(new):
+        old_pos = index.get(new[pos:pos + BLOCK_SIZE])
+        if old_pos is None:
+            pos += 1
+            continue
+
+        # Grow the match backwards into bytes that were about to become literal
+        start, old_start = pos, old_pos
+        while start > literal_start and old_start > 0 and old[old_start - 1] == new[start - 1]:
+            start -= 1
+            old_start -= 1
+        length = (pos - start) + match_forward(old, new, old_pos, pos)
+
+        if start > literal_start:
+            yield ("literal", new[literal_start:start])
+        yield ("copy", old_start, length)
+        pos = start + length
+        literal_start = pos
+
+    if literal_start < len(new):
+        yield ("literal", new[literal_start:])
+
+
+def build_patch(old, new):
+    out = bytearray()
+    out += MAGIC + bytes([VERSION, 0, 0, 0])
+    out += struct.pack("<I", len(old)) + hashlib.sha256(old).digest()
+    out += struct.pack("<I", len(new)) + hashlib.sha256(new).digest()
+    for op in diff(old, new):
+        if op[0] == "copy":
+            out += struct.pack("<BII", OP_COPY, op[1], op[2])
+        else:
+            out += struct.pack("<BI", OP_LITERAL, len(op[1])) + op[1]
+    out.append(OP_END)
+    return bytes(out)
+
+
+def apply_patch(old, patch):
+    """Reference decoder, mirrors OtaDeltaPatch::feed()."""
+    if patch[:4] != MAGIC or patch[4] != VERSION:
+        raise ValueError("not a version %d delta patch" % VERSION)
+    old_size, = struct.unpack_from("<I", patch, 8)
+    new_size, = struct.unpack_from("<I", patch, 44)
+    if old_size != len(old) or hashlib.sha256(old).digest() != patch[12:44]:
+        raise ValueError("patch was made for a different old image")
+
+    new = bytearray()
+    pos = 80
+    while True:
+        op = patch[pos]
+        pos += 1
+        if op == OP_END:
+            break
+        if op == OP_COPY:
+            offset, length = struct.unpack_from("<II", patch, pos)
+            pos += 8
+            if offset + length > old_size:
+                raise ValueError("copy outside the old image")
+            new += old[offset:offset + length]
+        elif op == OP_LITERAL:
+            length, = struct.unpack_from("<I", patch, pos)
+            pos += 4
+            new += patch[pos:pos + length]
+            pos += length
+        else:
+            raise ValueError("unknown opcode 0x%02x" % op)
+
+    if pos != len(patch) or len(new) != new_size or hashlib.sha256(new).digest() != patch[48:80]:
+        raise ValueError("patch does not rebuild the new image")
+    return bytes(new)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a delta OTA patch between two firmware images")
+    parser.add_argument("old", help="firmware.bin the devices are running")
+    parser.add_argument("new", help="firmware.bin being released")
+    parser.add_argument("-o", "--output", required=True, help="patch file to write")
+    args = parser.parse_args()
+
+    with open(args.old, "rb") as f:
+        old = f.read()
+    with open(args.new, "rb") as f:
+        new = f.read()
+
+    patch = build_patch(old, new)
+    try:
+        rebuilt = apply_patch(old, patch)
+    except ValueError as e:
+        print("ERROR: patch self-check failed: %s" % e)
+        return 1
+    if rebuilt != new:
+        print("ERROR: patch self-check failed: output differs")
+        return 1
+
+    with open(args.output, "wb") as f:
+        f.write(patch)
+    print("Patch %s: %d bytes for a %d byte image (%.1f%% of a full download)"
+          % (args.output, len(patch), len(new), 100.0 * len(patch) / len(new)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
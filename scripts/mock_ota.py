@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Stand-in for the firmware download host, for exercising OTA updates offline.
+
+Serves one image file at /firmware.bin with Range support, a bandwidth cap
+and connections that are cut partway through a response:
+
+    python scripts/mock_ota.py --image .pio/build/deskhog/firmware.bin \\
+        --port 8002 --kbps 400 --cut-after 300000 --cuts 2
+
+Every response up to --cuts is closed after --cut-after body bytes, so a
+client has to resume with a Range request to finish. --ignore-range answers
+those with the whole image instead, as some servers do. test_ota_pipeline
+and test_ota_update start their own.
+
+GET /stats returns the counts so far as JSON, including how many body
+bytes were sent, and they are printed on exit.
+"""
+import argparse
+import json
+import re
+import signal
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+RANGE_HEADER = re.compile(r"^bytes=(\d+)-(\d*)$")
+
+
+class ImageServer:
+    """Shapes and cuts the responses."""
+
+    def __init__(self, args):
+        with open(args.image, "rb") as f:
+            self.image = f.read()
+        self.args = args
+        self.lock = threading.Lock()
+        self.cuts_left = args.cuts
+        self.stats = {"requests": 0, "range_requests": 0, "cuts": 0, "bytes_sent": 0, "image_size": len(self.image)}
+
+    def count(self, key, amount=1):
+        with self.lock:
+            self.stats[key] += amount
+
+    def take_cut(self):
+        """Byte count after which this response is cut, or None to send it whole."""
+        with self.lock:
+            if self.args.cut_after <= 0 or self.cuts_left <= 0:
+                return None
+            self.cuts_left -= 1
+            self.stats["cuts"] += 1
+            return self.args.cut_after
+
+
+class Handler(BaseHTTPRequestHandler):
+    server_state = None
+
+    def do_GET(self):
+        state = self.server_state
+        if self.path == "/stats":
+            with state.lock:
+                body = json.dumps(state.stats).encode()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+            return
+        if self.path != "/firmware.bin":
+            self.send_error(404)
+            return
+
+        state.count("requests")
+        if state.args.latency:
+            time.sleep(state.args.latency / 1000.0)
+
+        image = state.image
+        start, end = 0, len(image) - 1
+        status = 200
+        requested = RANGE_HEADER.match(self.headers.get("Range", ""))
+        if requested:
+            state.count("range_requests")
+            if not state.args.ignore_range:
+                start = int(requested.group(1))
+                if requested.group(2):
+                    end = min(int(requested.group(2)), end)
+                if start > end:
+                    self.send_response(416)
+                    self.send_header("Content-Range", "bytes */%d" % len(image))
+                    self.end_headers()
+                    return
+                status = 206
+
+        self.send_response(status)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(end - start + 1))
+        if status == 206:
+            self.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, len(image)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.send_body(image[start:end + 1], state.take_cut())
+        self.close_connection = True
+
+    def send_body(self, body, cut_after):
+        if cut_after is not None:
+            body = body[:cut_after]
+        kbps = self.server_state.args.kbps
+        step = max(1, int(kbps * 1024 / 50)) if kbps else 64 * 1024
+        try:
+            for offset in range(0, len(body), step):
+                piece = body[offset:offset + step]
+                self.wfile.write(piece)
+                self.wfile.flush()
+                self.server_state.count("bytes_sent", len(piece))
+                if kbps:
+                    time.sleep(0.02)
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+
+    def log_message(self, format, *args):
+        if self.server_state.args.verbose:
+            sys.stderr.write("mock_ota: %s\n" % (format % args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve a firmware image with Range support and dropped connections")
+    parser.add_argument("--image", required=True, help="file to serve as /firmware.bin")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=8002, help="port to listen on, 0 for any free one")
+    parser.add_argument("--latency", type=float, default=0, help="ms before each response")
+    parser.add_argument("--kbps", type=float, default=0, help="cap each response at this many KB/s")
+    parser.add_argument("--cut-after", type=int, default=0, help="close a response after this many body bytes")
+    parser.add_argument("--cuts", type=int, default=1, help="how many responses to cut")
+    parser.add_argument("--ignore-range", action="store_true", help="answer Range requests with the whole image")
+    parser.add_argument("-v", "--verbose", action="store_true", help="log every request")
+    args = parser.parse_args()
+
+    Handler.server_state = ImageServer(args)
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    server.daemon_threads = True
+    signal.signal(signal.SIGTERM, lambda signum, frame: threading.Thread(target=server.shutdown).start())
+
+    # The first line is read by the test suites to find the port
+    print("mock_ota: serving on http://%s:%d" % (args.host, server.server_address[1]), flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    server.server_close()
+    print("mock_ota: %s" % json.dumps(Handler.server_state.stats), flush=True)
+
+
+if __name__ == "__main__":
+    main()
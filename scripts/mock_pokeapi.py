@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""Stand-in for PokeAPI and its sprite host, for timing PokedexCard offline.
+
+Serves test/data/pokeapi_species_25.json as every species (renamed to
+pokemon-<id>) and test/data/pokeapi_sprite_25.png as every sprite, with
+injected latency, a bandwidth cap and server errors:
+
+    python scripts/mock_pokeapi.py --port 8001 --latency 300 --jitter 100 \\
+        --kbps 200 --error-rate 0.1
+
+Build the firmware with -DPOKEAPI_HOST=\\"http://<this machine>:8001\\" to
+point a device at it; test_pokeapi_client starts its own. Faults are drawn
+from a seeded generator, so a run with the same options and request order is
+repeatable.
+
+GET /stats returns the counts so far as JSON, including the most requests
+that were in flight at once, and they are printed on exit.
+"""
+import argparse
+import json
+import os
+import random
+import re
+import signal
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DATA_DIR = os.path.join(REPO_ROOT, "test", "data")
+SPECIES_PATH = re.compile(r"^/api/v2/pokemon-species/(\d+)/?$")
+SPRITE_PATH = re.compile(r"^/sprites/pokemon/(\d+)\.png$")
+MAX_POKEMON_ID = 1025
+SERVER_ERRORS = (500, 502, 503)
+
+
+class PokeReplay:
+    """Chooses, shapes and faults the response for each request."""
+
+    def __init__(self, args):
+        with open(os.path.join(DATA_DIR, "pokeapi_species_25.json")) as f:
+            self.species = json.load(f)
+        with open(os.path.join(DATA_DIR, "pokeapi_sprite_25.png"), "rb") as f:
+            self.sprite = f.read()
+        self.args = args
+        self.fail_ids = set(int(i) for i in filter(None, args.fail_ids.split(",")))
+        self.random = random.Random(args.seed)
+        self.lock = threading.Lock()
+        self.in_flight = 0
+        self.stats = {"requests": 0, "species": 0, "sprites": 0, "errors": 0, "not_found": 0,
+                      "max_in_flight": 0, "bytes_sent": 0}
+
+    def count(self, key, amount=1):
+        with self.lock:
+            self.stats[key] += amount
+
+    def begin(self):
+        with self.lock:
+            self.stats["requests"] += 1
+            self.in_flight += 1
+            self.stats["max_in_flight"] = max(self.stats["max_in_flight"], self.in_flight)
+
+    def end(self):
+        with self.lock:
+            self.in_flight -= 1
+
+    def delay_seconds(self):
+        with self.lock:
+            jitter = self.random.uniform(-self.args.jitter, self.args.jitter)
+        return max(0.0, self.args.latency + jitter) / 1000.0
+
+    def fails(self, pokemon_id):
+        with self.lock:
+            return pokemon_id in self.fail_ids or self.random.random() < self.args.error_rate
+
+    def species_body(self, pokemon_id):
+        document = dict(self.species)
+        document["id"] = pokemon_id
+        document["name"] = "pokemon-%d" % pokemon_id
+        return json.dumps(document, separators=(",", ":")).encode()
+
+
+class Handler(BaseHTTPRequestHandler):
+    replay = None
+
+    def do_GET(self):
+        if self.path == "/stats":
+            with self.replay.lock:
+                stats = json.dumps(self.replay.stats).encode()
+            self.send_body(200, "application/json", stats)
+            return
+
+        self.replay.begin()
+        try:
+            self.serve()
+        finally:
+            self.replay.end()
+
+    def serve(self):
+        species = SPECIES_PATH.match(self.path)
+        sprite = SPRITE_PATH.match(self.path)
+        match = species or sprite
+        if not match or not 1 <= int(match.group(1)) <= MAX_POKEMON_ID:
+            self.replay.count("not_found")
+            self.send_body(404, "text/plain", b"Not Found")
+            return
+
+        pokemon_id = int(match.group(1))
+        time.sleep(self.replay.delay_seconds())
+        if self.replay.fails(pokemon_id):
+            self.replay.count("errors")
+            with self.replay.lock:
+                status = self.replay.random.choice(SERVER_ERRORS)
+            self.send_body(status, "text/plain", b"Server error")
+            return
+
+        if species:
+            self.replay.count("species")
+            self.send_body(200, "application/json", self.replay.species_body(pokemon_id),
+                           with_length=not self.replay.args.no_length)
+        else:
+            self.replay.count("sprites")
+            self.send_body(200, "image/png", self.replay.sprite)
+
+    def send_body(self, status, content_type, body, with_length=True):
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        if with_length:
+            self.send_header("Content-Length", str(len(body)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        try:
+            kbps = self.replay.args.kbps
+            step = max(1, int(kbps * 1024 / 20)) if kbps else len(body)
+            for start in range(0, len(body), step):
+                self.wfile.write(body[start:start + step])
+                self.wfile.flush()
+                self.replay.count("bytes_sent", len(body[start:start + step]))
+                if kbps:
+                    time.sleep(0.05)
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+        self.close_connection = True
+
+    def log_message(self, format, *args):
+        if self.replay.args.verbose:
+            sys.stderr.write("mock_pokeapi: %s\n" % (format % args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve PokeAPI species and sprites with injected faults")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=8001, help="port to listen on, 0 for any free one")
+    parser.add_argument("--latency", type=float, default=0, help="ms before each response")
+    parser.add_argument("--jitter", type=float, default=0, help="+/- ms added to the latency at random")
+    parser.add_argument("--kbps", type=float, default=0, help="cap each response at this many KB/s")
+    parser.add_argument("--error-rate", type=float, default=0, help="fraction of requests answered with a 5xx")
+    parser.add_argument("--fail-ids", default="", help="comma-separated Pokemon ids that always get a 5xx")
+    parser.add_argument("--no-length", action="store_true",
+                        help="send species bodies without Content-Length, ended by closing the connection")
+    parser.add_argument("--seed", type=int, default=1, help="seed for latency and fault draws")
+    parser.add_argument("-v", "--verbose", action="store_true", help="log every request")
+    args = parser.parse_args()
+
+    Handler.replay = PokeReplay(args)
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    server.daemon_threads = True
+    signal.signal(signal.SIGTERM, lambda signum, frame: threading.Thread(target=server.shutdown).start())
+
+    # The first line is read by test_pokeapi_client to find the port
+    print("mock_pokeapi: serving on http://%s:%d" % (args.host, server.server_address[1]), flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    server.server_close()
+    print("mock_pokeapi: %s" % json.dumps(Handler.replay.stats), flush=True)
+
+
+if __name__ == "__main__":
+    main()
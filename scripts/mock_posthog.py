@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Stand-in for the PostHog insights API, for exercising PostHogClient offline.
+
+Replays the insight responses in test/data/posthog_insight_*.json with
+injected latency, server errors, empty cached results and cut-off bodies:
+
+    python scripts/mock_posthog.py --port 8000 --latency 150 --jitter 50 \\
+        --error-rate 0.1 --null-first --truncate-rate 0.05
+
+Build the firmware with -DPOSTHOG_API_HOST=\\"http://<this machine>:8000\\" to
+point a device at it; test_posthog_client starts its own. Each insight
+short_id always gets the same fixture, so a card keeps its type across
+requests. Faults are drawn from a seeded generator, so a run with the same
+options and request order is repeatable.
+
+GET /stats returns the counts so far as JSON, and they are printed on exit.
+"""
+import argparse
+import glob
+import json
+import os
+import random
+import signal
+import sys
+import threading
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_FIXTURES = os.path.join(REPO_ROOT, "test", "data", "posthog_insight_*.json")
+SERVER_ERRORS = (500, 502, 503)
+
+
+def compact(document):
+    """Serialize the way the API does; the client looks for "result":null verbatim."""
+    return json.dumps(document, separators=(",", ":")).encode()
+
+
+class InsightReplay:
+    """Chooses, shapes and faults the response for each request."""
+
+    def __init__(self, args):
+        paths = sorted(glob.glob(args.fixtures))
+        if not paths:
+            sys.exit("mock_posthog: no fixtures match %s" % args.fixtures)
+        self.fixtures = []
+        for path in paths:
+            with open(path) as f:
+                document = json.load(f)
+            if args.size:
+                # Pad to roughly the requested size, as a long-range or many-series insight would be
+                padding = args.size - len(compact(document))
+                if padding > 0:
+                    document["results"][0]["description"] = "x" * padding
+            self.fixtures.append(document)
+        self.args = args
+        self.fail_ids = set(filter(None, args.fail_ids.split(",")))
+        self.random = random.Random(args.seed)
+        self.lock = threading.Lock()
+        self.seen_cached = set()
+        self.stats = {"requests": 0, "ok": 0, "errors": 0, "null_results": 0,
+                      "truncated": 0, "bytes_sent": 0}
+
+    def count(self, key, amount=1):
+        with self.lock:
+            self.stats[key] += amount
+
+    def delay_seconds(self):
+        with self.lock:
+            jitter = self.random.uniform(-self.args.jitter, self.args.jitter)
+        return max(0.0, self.args.latency + jitter) / 1000.0
+
+    def roll(self, rate):
+        with self.lock:
+            return self.random.random() < rate
+
+    def body(self, short_id, refresh):
+        """The response body for an insight, or None to answer with a server error."""
+        if short_id in self.fail_ids or self.roll(self.args.error_rate):
+            return None
+
+        document = json.loads(json.dumps(self.fixtures[zlib.crc32(short_id.encode()) % len(self.fixtures)]))
+        insight = document["results"][0]
+        insight["short_id"] = short_id
+
+        # The first cached read of each insight finds nothing computed yet, so the
+        # client has to follow up with refresh=blocking
+        if self.args.null_first and refresh == "force_cache":
+            with self.lock:
+                first = short_id not in self.seen_cached
+                self.seen_cached.add(short_id)
+            if first:
+                insight["result"] = None
+                insight["is_cached"] = False
+                self.count("null_results")
+        return compact(document)
+
+
+class Handler(BaseHTTPRequestHandler):
+    replay = None
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        if url.path == "/stats":
+            with self.replay.lock:
+                stats = compact(self.replay.stats)
+            self.send_body(200, stats)
+            return
+
+        self.replay.count("requests")
+        query = parse_qs(url.query)
+        short_id = query.get("short_id", [""])[0]
+        if not url.path.startswith("/api/projects/") or not url.path.endswith("/insights/") or not short_id:
+            self.send_body(404, compact({"detail": "Not found."}))
+            return
+        if not query.get("personal_api_key", [""])[0]:
+            self.send_body(401, compact({"detail": "Authentication credentials were not provided."}))
+            return
+
+        time.sleep(self.replay.delay_seconds())
+        body = self.replay.body(short_id, query.get("refresh", ["force_cache"])[0])
+        if body is None:
+            self.replay.count("errors")
+            with self.replay.lock:
+                status = self.replay.random.choice(SERVER_ERRORS)
+            self.send_body(status, compact({"detail": "Server error"}))
+            return
+
+        if self.replay.roll(self.replay.args.truncate_rate):
+            # Promise the whole body, send part of it and hang up
+            self.replay.count("truncated")
+            self.send_body(200, body, len(body) // 2)
+            return
+        self.replay.count("ok")
+        self.send_body(200, body)
+
+    def send_body(self, status, body, send_bytes=None):
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        sent = body if send_bytes is None else body[:send_bytes]
+        try:
+            self.wfile.write(sent)
+            self.replay.count("bytes_sent", len(sent))
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+        self.close_connection = True
+
+    def log_message(self, format, *args):
+        if self.replay.args.verbose:
+            sys.stderr.write("mock_posthog: %s\n" % (format % args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay PostHog insight responses with injected faults")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=8000, help="port to listen on, 0 for any free one")
+    parser.add_argument("--fixtures", default=DEFAULT_FIXTURES, help="glob of recorded insight responses")
+    parser.add_argument("--size", type=int, default=0, help="pad each response to about this many bytes")
+    parser.add_argument("--latency", type=float, default=0, help="ms before each response")
+    parser.add_argument("--jitter", type=float, default=0, help="+/- ms added to the latency at random")
+    parser.add_argument("--error-rate", type=float, default=0, help="fraction of requests answered with a 5xx")
+    parser.add_argument("--null-first", action="store_true",
+                        help='answer the first refresh=force_cache request per insight with "result":null')
+    parser.add_argument("--truncate-rate", type=float, default=0,
+                        help="fraction of responses cut off halfway through the body")
+    parser.add_argument("--fail-ids", default="", help="comma-separated short_ids that always get a 5xx")
+    parser.add_argument("--seed", type=int, default=1, help="seed for latency and fault draws")
+    parser.add_argument("-v", "--verbose", action="store_true", help="log every request")
+    args = parser.parse_args()
+
+    Handler.replay = InsightReplay(args)
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    server.daemon_threads = True
+    signal.signal(signal.SIGTERM, lambda signum, frame: threading.Thread(target=server.shutdown).start())
+
+    # The first line is read by test_posthog_client to find the port
+    print("mock_posthog: serving on http://%s:%d" % (args.host, server.server_address[1]), flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    server.server_close()
+    print("mock_posthog: %s" % json.dumps(Handler.replay.stats), flush=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,12 +1,16 @@
 #include "ConfigManager.h"
 #include "SystemController.h"
+#include "ResourceMonitor.h"
 #include <ArduinoJson.h>
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
 
 ConfigManager::ConfigManager() {
-    // Constructor
+    _snapshotMutex = xSemaphoreCreateMutex();
+    _storageMutex = xSemaphoreCreateMutex();
 }
 
-ConfigManager::ConfigManager(EventQueue& eventQueue) {
+ConfigManager::ConfigManager(EventQueue& eventQueue) : ConfigManager() {
     _eventQueue = &eventQueue;
 }
 
@@ -19,36 +23,272 @@ void ConfigManager::begin() {
     _preferences.begin(_namespace, false);
     _insightsPrefs.begin(_insightsNamespace, false);
     _cardPrefs.begin(_cardNamespace, false);
-    
+
+    loadSnapshot();
+
+    // Write back a migrated or damaged card list right away
+    flush();
+
+    ResourceMonitor::createTask(
+        flushTask,
+        "configFlush",
+        FLUSH_TASK_STACK_SIZE,
+        this,
+        1,
+        &_flushTaskHandle,
+        0
+    );
+
     // Check initial API configuration state
     updateApiConfigurationState();
 }
 
+void ConfigManager::loadSnapshot() {
+    Snapshot loaded;
+
+    loaded.hasCredentials = _preferences.getBool(_hasCredentialsKey, false);
+    if (loaded.hasCredentials) {
+        loaded.ssid = _preferences.getString(_ssidKey, "");
+        loaded.password = _preferences.getString(_passwordKey, "");
+
+        WiFiLinkRecord link;
+        if (_preferences.getBytesLength(_linkHintKey) == sizeof(link) &&
+            _preferences.getBytes(_linkHintKey, &link, sizeof(link)) == sizeof(link) &&
+            link.channel != 0) {
+            loaded.hasLinkHint = true;
+            memcpy(loaded.linkBssid, link.bssid, sizeof(link.bssid));
+            loaded.linkChannel = link.channel;
+        }
+    }
+    if (_preferences.isKey(_teamIdKey)) {
+        loaded.teamId = _preferences.getInt(_teamIdKey);
+    }
+    loaded.apiKey = _preferences.getString(_apiKeyKey, "");
+    if (_preferences.isKey(_regionKey)) {
+        loaded.region = _preferences.getString(_regionKey);
+    }
+
+    uint64_t cardsStart = esp_timer_get_time();
+    bool rewriteCards = loadCardRecords(loaded.cardConfigs);
+    uint64_t cardsMicros = esp_timer_get_time() - cardsStart;
+
+    lock();
+    _snapshot = loaded;
+    _dirty = rewriteCards ? DIRTY_CARDS : 0;
+    unlock();
+
+    Serial.printf("ConfigManager: Loaded config (%u cards in %llu us)\n",
+                  (unsigned)loaded.cardConfigs.size(), cardsMicros);
+}
+
+bool ConfigManager::loadCardRecords(std::vector<CardConfig>& configs) {
+    CardIndex index;
+    bool hasIndex = _cardPrefs.getBytesLength("cards_idx") == sizeof(index) &&
+                    _cardPrefs.getBytes("cards_idx", &index, sizeof(index)) == sizeof(index) &&
+                    index.version == CARD_RECORD_VERSION &&
+                    index.crc == cardIndexCrc(index);
+
+    if (!hasIndex) {
+        // Check if the key exists first to avoid error logs
+        if (_cardPrefs.isKey("config_list")) {
+            Serial.println("ConfigManager: Migrating card list from JSON to binary records");
+            if (!decodeLegacyCardConfigs(_cardPrefs.getString("config_list", "[]"), configs)) {
+                // Keep the JSON so a later firmware can still recover it
+                Serial.println("ConfigManager: Legacy card list unreadable, leaving it in place");
+                configs.clear();
+                return false;
+            }
+            _removeLegacyCards = true;
+            return true;
+        }
+        return false;
+    }
+
+    _persistedCardSlots = index.count;
+    bool damaged = false;
+    std::vector<uint8_t> record;
+    for (size_t slot = 0; slot < index.count; slot++) {
+        String key = cardKey(slot);
+        size_t length = _cardPrefs.getBytesLength(key.c_str());
+        record.resize(length);
+        CardConfig config;
+        if (length == 0 ||
+            _cardPrefs.getBytes(key.c_str(), record.data(), length) != length ||
+            !decodeCardRecord(record.data(), length, config)) {
+            Serial.printf("ConfigManager: Card record %u is damaged, dropping it\n", (unsigned)slot);
+            damaged = true;
+            continue;
+        }
+        configs.push_back(config);
+    }
+
+    // Rewrite everything after a damaged record, since the slots have shifted
+    _persistedCards = damaged ? std::vector<CardConfig>() : configs;
+    return damaged;
+}
+
+uint32_t ConfigManager::writeCardRecords(const std::vector<CardConfig>& configs) {
+    uint32_t writes = 0;
+    size_t bytes = 0;
+    std::vector<uint8_t> record;
+
+    for (size_t slot = 0; slot < configs.size(); slot++) {
+        if (slot < _persistedCards.size() && sameCard(configs[slot], _persistedCards[slot])) {
+            continue;
+        }
+        if (!encodeCardRecord(configs[slot], record)) {
+            Serial.printf("ConfigManager: Card %u is too large to store\n", (unsigned)slot);
+            continue;
+        }
+        _cardPrefs.putBytes(cardKey(slot).c_str(), record.data(), record.size());
+        bytes += record.size();
+        writes++;
+    }
+
+    if (configs.size() != _persistedCardSlots || _removeLegacyCards) {
+        CardIndex index = {};
+        index.version = CARD_RECORD_VERSION;
+        index.count = configs.size();
+        index.crc = cardIndexCrc(index);
+        _cardPrefs.putBytes("cards_idx", &index, sizeof(index));
+        writes++;
+
+        for (size_t slot = configs.size(); slot < _persistedCardSlots; slot++) {
+            _cardPrefs.remove(cardKey(slot).c_str());
+            writes++;
+        }
+        _persistedCardSlots = configs.size();
+    }
+
+    // Only drop the old JSON once the binary copy is complete
+    if (_removeLegacyCards) {
+        _cardPrefs.remove("config_list");
+        _removeLegacyCards = false;
+        writes++;
+    }
+
+    _persistedCards = configs;
+    Serial.printf("ConfigManager: Wrote %u card keys (%u record bytes)\n", writes, (unsigned)bytes);
+    return writes;
+}
+
 // Private helper to check and update API configuration state
 void ConfigManager::updateApiConfigurationState() {
-    if (!_preferences.isKey(_teamIdKey) || getTeamId() == NO_TEAM_ID) {
+    if (getTeamId() == NO_TEAM_ID) {
         SystemController::setApiState(ApiState::API_AWAITING_CONFIG);
         return;
     }
-    
-    if (!_preferences.isKey(_apiKeyKey) || getApiKey().isEmpty()) {
+
+    if (getApiKey().isEmpty()) {
         SystemController::setApiState(ApiState::API_AWAITING_CONFIG);
         return;
     }
-    
+
     // Both team ID and API key are set
     SystemController::setApiState(ApiState::API_CONFIGURED);
 }
 
-// Helper method to commit changes to flash
-void ConfigManager::commit() {
-    _preferences.end();
-    _insightsPrefs.end();
-    _cardPrefs.end();
-    
-    _preferences.begin(_namespace, false);
-    _insightsPrefs.begin(_insightsNamespace, false);
-    _cardPrefs.begin(_cardNamespace, false);
+void ConfigManager::markDirty(uint8_t flags) {
+    lock();
+    _dirty |= flags;
+    unlock();
+
+    if (_flushTaskHandle) {
+        xTaskNotifyGive(_flushTaskHandle);
+    } else {
+        flush();
+    }
+}
+
+void ConfigManager::flushTask(void* parameter) {
+    ConfigManager* self = static_cast<ConfigManager*>(parameter);
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Each further change restarts the quiet period, up to WRITE_MAX_DELAY_MS
+        unsigned long firstChange = millis();
+        while (millis() - firstChange < WRITE_MAX_DELAY_MS &&
+               ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WRITE_DEBOUNCE_MS)) > 0) {
+        }
+
+        self->flush();
+    }
+}
+
+void ConfigManager::flush() {
+    xSemaphoreTake(_storageMutex, portMAX_DELAY);
+
+    // Take a consistent copy so getters aren't blocked while flash is written
+    lock();
+    uint8_t dirty = _dirty;
+    Snapshot pending = _snapshot;
+    _dirty = 0;
+    unlock();
+
+    if (dirty == 0) {
+        xSemaphoreGive(_storageMutex);
+        return;
+    }
+
+    unsigned long start = millis();
+    uint32_t writes = 0;
+
+    if (dirty & DIRTY_WIFI) {
+        if (pending.hasCredentials) {
+            _preferences.putString(_ssidKey, pending.ssid);
+            _preferences.putString(_passwordKey, pending.password);
+        } else {
+            _preferences.remove(_ssidKey);
+            _preferences.remove(_passwordKey);
+        }
+        _preferences.putBool(_hasCredentialsKey, pending.hasCredentials);
+        writes += 3;
+    }
+
+    if (dirty & DIRTY_WIFI_LINK) {
+        if (pending.hasLinkHint) {
+            WiFiLinkRecord link;
+            memcpy(link.bssid, pending.linkBssid, sizeof(link.bssid));
+            link.channel = (uint8_t)pending.linkChannel;
+            _preferences.putBytes(_linkHintKey, &link, sizeof(link));
+        } else {
+            _preferences.remove(_linkHintKey);
+        }
+        writes++;
+    }
+
+    if (dirty & DIRTY_TEAM_ID) {
+        if (pending.teamId == NO_TEAM_ID) {
+            _preferences.remove(_teamIdKey);
+        } else {
+            _preferences.putInt(_teamIdKey, pending.teamId);
+        }
+        writes++;
+    }
+
+    if (dirty & DIRTY_API_KEY) {
+        if (pending.apiKey.isEmpty()) {
+            _preferences.remove(_apiKeyKey);
+        } else {
+            _preferences.putString(_apiKeyKey, pending.apiKey);
+        }
+        writes++;
+    }
+
+    if (dirty & DIRTY_REGION) {
+        _preferences.putString(_regionKey, pending.region);
+        writes++;
+    }
+
+    if (dirty & DIRTY_CARDS) {
+        writes += writeCardRecords(pending.cardConfigs);
+    }
+
+    _flashWrites += writes;
+    xSemaphoreGive(_storageMutex);
+
+    Serial.printf("ConfigManager: Flushed %u keys to NVS in %lu ms (%u since boot)\n",
+                  writes, millis() - start, _flashWrites);
 }
 
 bool ConfigManager::saveWiFiCredentials(const String& ssid, const String& password) {
@@ -61,41 +301,47 @@ bool ConfigManager::saveWiFiCredentials(const String& ssid, const String& passwo
     }
 
     // Save credentials
-    _preferences.putString(_ssidKey, ssid);
-    _preferences.putString(_passwordKey, password);
-    _preferences.putBool(_hasCredentialsKey, true);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    // A different network (or password) invalidates the remembered access point
+    bool dropLinkHint = _snapshot.hasLinkHint && (_snapshot.ssid != ssid || _snapshot.password != password);
+    _snapshot.ssid = ssid;
+    _snapshot.password = password;
+    _snapshot.hasCredentials = true;
+    if (dropLinkHint) {
+        _snapshot.hasLinkHint = false;
+    }
+    unlock();
+    markDirty(dropLinkHint ? (DIRTY_WIFI | DIRTY_WIFI_LINK) : DIRTY_WIFI);
+
     // Publish event if event queue is available
     if (_eventQueue != nullptr) {
         _eventQueue->publishEvent(EventType::WIFI_CREDENTIALS_FOUND, "");
     }
-    
+
     return true;
 }
 
 bool ConfigManager::getWiFiCredentials(String& ssid, String& password) {
-    if (!hasWiFiCredentials()) {
-        return false;
+    lock();
+    bool hasCredentials = _snapshot.hasCredentials;
+    if (hasCredentials) {
+        ssid = _snapshot.ssid;
+        password = _snapshot.password;
     }
+    unlock();
 
-    // Retrieve credentials
-    ssid = _preferences.getString(_ssidKey, "");
-    password = _preferences.getString(_passwordKey, "");
-    
-    return true;
+    return hasCredentials;
 }
 
 void ConfigManager::clearWiFiCredentials() {
-    _preferences.remove(_ssidKey);
-    _preferences.remove(_passwordKey);
-    _preferences.putBool(_hasCredentialsKey, false);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    _snapshot.ssid = "";
+    _snapshot.password = "";
+    _snapshot.hasCredentials = false;
+    _snapshot.hasLinkHint = false;
+    unlock();
+    markDirty(DIRTY_WIFI | DIRTY_WIFI_LINK);
+
     // Publish event if event queue is available
     if (_eventQueue != nullptr) {
         _eventQueue->publishEvent(EventType::NEED_WIFI_CREDENTIALS, "");
@@ -103,12 +349,58 @@ void ConfigManager::clearWiFiCredentials() {
 }
 
 bool ConfigManager::hasWiFiCredentials() {
-    return _preferences.getBool(_hasCredentialsKey, false);
+    lock();
+    bool hasCredentials = _snapshot.hasCredentials;
+    unlock();
+    return hasCredentials;
+}
+
+void ConfigManager::saveWiFiLinkHint(const uint8_t* bssid, int32_t channel) {
+    if (bssid == nullptr || channel <= 0 || channel > 255) {
+        return;
+    }
+
+    lock();
+    bool changed = !_snapshot.hasLinkHint || _snapshot.linkChannel != channel ||
+                   memcmp(_snapshot.linkBssid, bssid, sizeof(_snapshot.linkBssid)) != 0;
+    if (changed) {
+        _snapshot.hasLinkHint = true;
+        memcpy(_snapshot.linkBssid, bssid, sizeof(_snapshot.linkBssid));
+        _snapshot.linkChannel = channel;
+    }
+    unlock();
+
+    if (changed) {
+        markDirty(DIRTY_WIFI_LINK);
+    }
+}
+
+bool ConfigManager::getWiFiLinkHint(uint8_t* bssid, int32_t& channel) {
+    lock();
+    bool hasLinkHint = _snapshot.hasCredentials && _snapshot.hasLinkHint;
+    if (hasLinkHint) {
+        memcpy(bssid, _snapshot.linkBssid, sizeof(_snapshot.linkBssid));
+        channel = _snapshot.linkChannel;
+    }
+    unlock();
+
+    return hasLinkHint;
+}
+
+void ConfigManager::clearWiFiLinkHint() {
+    lock();
+    bool hadLinkHint = _snapshot.hasLinkHint;
+    _snapshot.hasLinkHint = false;
+    unlock();
+
+    if (hadLinkHint) {
+        markDirty(DIRTY_WIFI_LINK);
+    }
 }
 
 bool ConfigManager::checkWiFiCredentialsAndPublish() {
     bool hasCredentials = hasWiFiCredentials();
-    
+
     if (_eventQueue != nullptr) {
         if (hasCredentials) {
             _eventQueue->publishEvent(EventType::WIFI_CREDENTIALS_FOUND, "");
@@ -116,49 +408,49 @@ bool ConfigManager::checkWiFiCredentialsAndPublish() {
             _eventQueue->publishEvent(EventType::NEED_WIFI_CREDENTIALS, "");
         }
     }
-    
+
     return hasCredentials;
 }
 
 
 void ConfigManager::setTeamId(int teamId) {
-    _preferences.putInt(_teamIdKey, teamId);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    _snapshot.teamId = teamId;
+    unlock();
+    markDirty(DIRTY_TEAM_ID);
+
     updateApiConfigurationState();
 }
 
 int ConfigManager::getTeamId() {
-    if (!_preferences.isKey(_teamIdKey)) {
-        return NO_TEAM_ID;
-    }
-    return _preferences.getInt(_teamIdKey);
+    lock();
+    int teamId = _snapshot.teamId;
+    unlock();
+    return teamId;
 }
 
 void ConfigManager::setRegion(String region) {
-    _preferences.putString(_regionKey, region);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    _snapshot.region = region;
+    unlock();
+    markDirty(DIRTY_REGION);
+
     updateApiConfigurationState();
 }
 
 String ConfigManager::getRegion() {
-    if (!_preferences.isKey(_regionKey)) {
-        return "us";
-    }
-    return _preferences.getString(_regionKey);
+    lock();
+    String region = _snapshot.region;
+    unlock();
+    return region;
 }
 
 void ConfigManager::clearTeamId() {
-    _preferences.remove(_teamIdKey);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    _snapshot.teamId = NO_TEAM_ID;
+    unlock();
+    markDirty(DIRTY_TEAM_ID);
+
     SystemController::setApiState(ApiState::API_AWAITING_CONFIG);
 }
 
@@ -168,48 +460,155 @@ bool ConfigManager::setApiKey(const String& apiKey) {
         return false;
     }
 
-    _preferences.putString(_apiKeyKey, apiKey);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    _snapshot.apiKey = apiKey;
+    unlock();
+    markDirty(DIRTY_API_KEY);
+
     updateApiConfigurationState();
     return true;
 }
 
 String ConfigManager::getApiKey() {
-    return _preferences.getString(_apiKeyKey, "");
+    lock();
+    String apiKey = _snapshot.apiKey;
+    unlock();
+    return apiKey;
 }
 
 void ConfigManager::clearApiKey() {
-    _preferences.remove(_apiKeyKey);
-    
-    // Commit changes
-    commit();
-    
+    lock();
+    _snapshot.apiKey = "";
+    unlock();
+    markDirty(DIRTY_API_KEY);
+
     SystemController::setApiState(ApiState::API_AWAITING_CONFIG);
 }
 
 std::vector<CardConfig> ConfigManager::getCardConfigs() {
-    std::vector<CardConfig> configs;
-    
-    // Check if the key exists first to avoid error logs
-    if (!_cardPrefs.isKey("config_list")) {
-        return configs; // Return empty vector if no card config stored yet
-    }
-    
-    // Get JSON string from preferences
-    String jsonString = _cardPrefs.getString("config_list", "[]");
-    
-    // Parse JSON
-    DynamicJsonDocument doc(2048);
+    lock();
+    std::vector<CardConfig> configs = _snapshot.cardConfigs;
+    unlock();
+    return configs;
+}
+
+bool ConfigManager::saveCardConfigs(const std::vector<CardConfig>& configs) {
+    lock();
+    _snapshot.cardConfigs = configs;
+    unlock();
+    markDirty(DIRTY_CARDS);
+
+    // Publish event if event queue is available
+    if (_eventQueue != nullptr) {
+        _eventQueue->publishEvent(EventType::CARD_CONFIG_CHANGED, "");
+    }
+
+    return true;
+}
+
+bool ConfigManager::updateCardName(CardType type, const String& config, const String& name) {
+    bool found = false;
+    lock();
+    for (CardConfig& card : _snapshot.cardConfigs) {
+        if (card.type == type && card.config == config) {
+            card.name = name;
+            found = true;
+            break;
+        }
+    }
+    unlock();
+
+    if (found) {
+        markDirty(DIRTY_CARDS);
+    }
+    return found;
+}
+
+bool ConfigManager::encodeCardRecord(const CardConfig& config, std::vector<uint8_t>& out) {
+    if (config.config.length() > UINT16_MAX || config.name.length() > UINT16_MAX) {
+        return false;
+    }
+
+    CardRecordHeader header = {};
+    header.version = CARD_RECORD_VERSION;
+    header.type = static_cast<uint8_t>(config.type);
+    header.order = config.order;
+    header.configLength = config.config.length();
+    header.nameLength = config.name.length();
+
+    out.resize(sizeof(header) + header.configLength + header.nameLength);
+    uint8_t* strings = out.data() + sizeof(header);
+    memcpy(strings, config.config.c_str(), header.configLength);
+    memcpy(strings + header.configLength, config.name.c_str(), header.nameLength);
+
+    // CRC over the whole record with the crc field zeroed
+    memcpy(out.data(), &header, sizeof(header));
+    header.crc = esp_rom_crc32_le(0, out.data(), out.size());
+    memcpy(out.data(), &header, sizeof(header));
+    return true;
+}
+
+bool ConfigManager::decodeCardRecord(const uint8_t* data, size_t length, CardConfig& config) {
+    CardRecordHeader header;
+    if (length < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.version != CARD_RECORD_VERSION ||
+        length != sizeof(header) + header.configLength + header.nameLength) {
+        return false;
+    }
+
+    uint32_t storedCrc = header.crc;
+    header.crc = 0;
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)&header, sizeof(header));
+    crc = esp_rom_crc32_le(crc, data + sizeof(header), length - sizeof(header));
+    if (crc != storedCrc) {
+        return false;
+    }
+    // A type this firmware does not know, e.g. written by a newer one before a downgrade
+    if (header.type > static_cast<uint8_t>(LAST_CARD_TYPE)) {
+        Serial.printf("ConfigManager: Card record has unknown type %u\n", (unsigned)header.type);
+        return false;
+    }
+
+    // Fields are used in place; the strings are the only copies made
+    const char* strings = (const char*)data + sizeof(header);
+    config.type = static_cast<CardType>(header.type);
+    config.order = header.order;
+    config.config = String(strings, header.configLength);
+    config.name = String(strings + header.configLength, header.nameLength);
+    return true;
+}
+
+uint32_t ConfigManager::cardIndexCrc(const CardIndex& index) {
+    return esp_rom_crc32_le(0, (const uint8_t*)&index, offsetof(CardIndex, crc));
+}
+
+bool ConfigManager::sameCard(const CardConfig& a, const CardConfig& b) {
+    return a.type == b.type && a.order == b.order && a.config == b.config && a.name == b.name;
+}
+
+String ConfigManager::cardKey(size_t slot) {
+    return "card_" + String((unsigned)slot);
+}
+
+bool ConfigManager::decodeLegacyCardConfigs(const String& jsonString, std::vector<CardConfig>& configs) {
+    // Every value becomes a slot and every string is copied, so the parsed
+    // list is roughly twice its text; short strings can make it more
+    size_t capacity = jsonString.length() * 2 + 512;
+    DynamicJsonDocument doc(capacity);
     DeserializationError error = deserializeJson(doc, jsonString);
-    
+    if (error == DeserializationError::NoMemory) {
+        doc = DynamicJsonDocument(capacity * 2);
+        error = deserializeJson(doc, jsonString);
+    }
+
     if (error) {
         Serial.printf("Failed to parse card configs JSON: %s\n", error.c_str());
-        return configs; // Return empty vector on parse error
+        return false;
     }
-    
+
     // Convert JSON array to vector of CardConfig
     JsonArray array = doc.as<JsonArray>();
     for (JsonVariant v : array) {
@@ -223,41 +622,6 @@ std::vector<CardConfig> ConfigManager::getCardConfigs() {
             configs.push_back(config);
         }
     }
-    
-    return configs;
-}
 
-bool ConfigManager::saveCardConfigs(const std::vector<CardConfig>& configs) {
-    // Create JSON document
-    DynamicJsonDocument doc(2048);
-    JsonArray array = doc.to<JsonArray>();
-    
-    // Convert vector to JSON array
-    for (const CardConfig& config : configs) {
-        JsonObject obj = array.createNestedObject();
-        obj["type"] = cardTypeToString(config.type);
-        obj["config"] = config.config;
-        obj["order"] = config.order;
-        obj["name"] = config.name;
-    }
-    
-    // Serialize to string
-    String jsonString;
-    if (serializeJson(doc, jsonString) == 0) {
-        Serial.println("Failed to serialize card configs to JSON");
-        return false;
-    }
-    
-    // Save to preferences
-    _cardPrefs.putString("config_list", jsonString);
-    
-    // Commit changes
-    commit();
-    
-    // Publish event if event queue is available
-    if (_eventQueue != nullptr) {
-        _eventQueue->publishEvent(EventType::CARD_CONFIG_CHANGED, "");
-    }
-    
     return true;
-}
\ No newline at end of file
+}
@@ -3,6 +3,9 @@
 #include <Arduino.h>
 #include <Preferences.h>
 #include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 #include "EventQueue.h"
 #include "config/CardConfig.h"
 
@@ -19,10 +22,22 @@
  * 
  * Uses ESP32's non-volatile storage (NVS) through Preferences library
  * with size limits enforced for all stored values.
+ *
+ * Everything is read from NVS once in begin() into an in-memory snapshot,
+ * and getters are served from it. Setters update the snapshot immediately
+ * and mark it dirty; a background task writes dirty values back once
+ * changes stop arriving, so a burst of saves becomes a single flash write.
+ *
+ * Cards are stored as one binary record per card ("card_<n>") plus an index
+ * ("cards_idx") holding the count. Each record carries a format version and
+ * a CRC-32, and only records whose contents changed are rewritten. Older
+ * firmware kept the list as a JSON string ("config_list"); it is migrated
+ * on first boot.
  */
 class ConfigManager {
 public:
     static const int NO_TEAM_ID = -1;  // Sentinel value for no team ID
+    static const uint32_t FLUSH_TASK_STACK_SIZE = 4096;  ///< Bytes for the deferred-write task
 
     /**
      * @brief Default constructor
@@ -37,9 +52,18 @@ public:
 
     /**
      * @brief Initialize the configuration system
+     * 
+     * Loads the snapshot from NVS and starts the background writer.
      */
     void begin();
 
+    /**
+     * @brief Write pending changes to flash now
+     * 
+     * Call before anything that would lose RAM, such as deep sleep.
+     */
+    void flush();
+
     /**
      * @brief Set the event queue for state change notifications
      * @param queue Pointer to the event queue
@@ -73,6 +97,29 @@ public:
      */
     bool hasWiFiCredentials();
 
+    /**
+     * @brief Remember the access point the stored network was last joined on
+     * 
+     * Lets the next connect skip the channel scan. Only written to flash
+     * when it differs from what is stored; cleared when the credentials change.
+     * @param bssid 6-byte BSSID of the access point
+     * @param channel WiFi channel of the access point
+     */
+    void saveWiFiLinkHint(const uint8_t* bssid, int32_t channel);
+
+    /**
+     * @brief Retrieve the access point the stored network was last joined on
+     * @param bssid Buffer of 6 bytes to receive the BSSID
+     * @param channel Reference to store the channel
+     * @return true if a hint is stored
+     */
+    bool getWiFiLinkHint(uint8_t* bssid, int32_t& channel);
+
+    /**
+     * @brief Forget the stored access point, forcing a full scan on the next connect
+     */
+    void clearWiFiLinkHint();
+
     /**
      * @brief Check WiFi credentials and publish status event
      * @return true if credentials exist, false otherwise
@@ -140,6 +187,18 @@ public:
      */
     bool saveCardConfigs(const std::vector<CardConfig>& configs);
 
+    /**
+     * @brief Rename a single card without a full configuration change
+     * 
+     * Only that card's record is rewritten, and no CARD_CONFIG_CHANGED event
+     * is published since the set of cards is unchanged.
+     * @param type Type of the card to rename
+     * @param config Configuration string identifying the card (e.g. insight ID)
+     * @param name New name
+     * @return true if a matching card was found
+     */
+    bool updateCardName(CardType type, const String& config, const String& name);
+
 private:
     
     /**
@@ -153,13 +212,121 @@ private:
     void updateApiConfigurationState();
 
     /**
-     * @brief Ensures preferences changes are persisted to flash
+     * @brief In-memory copy of everything persisted, guarded by _snapshotMutex
+     */
+    struct Snapshot {
+        bool hasCredentials = false;
+        String ssid;
+        String password;
+        bool hasLinkHint = false;
+        uint8_t linkBssid[6] = {};
+        int32_t linkChannel = 0;
+        int teamId = NO_TEAM_ID;
+        String apiKey;
+        String region = "us";
+        std::vector<CardConfig> cardConfigs;
+    };
+
+    /** @brief Groups of keys that need writing back, ORed into _dirty */
+    enum DirtyFlags : uint8_t {
+        DIRTY_WIFI = 1 << 0,
+        DIRTY_TEAM_ID = 1 << 1,
+        DIRTY_API_KEY = 1 << 2,
+        DIRTY_REGION = 1 << 3,
+        DIRTY_CARDS = 1 << 4,
+        DIRTY_WIFI_LINK = 1 << 5
+    };
+
+    /**
+     * @brief Read every key from NVS into the snapshot
+     */
+    void loadSnapshot();
+
+    /**
+     * @brief Record that a group of keys changed and wake the writer
      * 
-     * Closes and reopens both preference namespaces to ensure changes
-     * are written to flash storage. Required after any preference modifications
-     * to ensure changes survive power cycles.
+     * Called after the snapshot has been updated. Before begin() there is
+     * no writer yet, so the change is written immediately.
      */
-    void commit();
+    void markDirty(uint8_t flags);
+
+    /**
+     * @brief Background writer: waits for changes to settle, then flushes
+     */
+    static void flushTask(void* parameter);
+
+    /**
+     * @brief On-flash layout of a card record, followed by the config and name bytes
+     */
+    struct __attribute__((packed)) CardRecordHeader {
+        uint8_t version;          ///< CARD_RECORD_VERSION
+        uint8_t type;             ///< CardType
+        int32_t order;
+        uint16_t configLength;
+        uint16_t nameLength;
+        uint32_t crc;             ///< CRC-32 of this header (with crc = 0) and both strings
+    };
+
+    /**
+     * @brief On-flash layout of the WiFi link hint
+     */
+    struct __attribute__((packed)) WiFiLinkRecord {
+        uint8_t bssid[6];
+        uint8_t channel;
+    };
+
+    /**
+     * @brief On-flash layout of the card index
+     */
+    struct __attribute__((packed)) CardIndex {
+        uint8_t version;          ///< CARD_RECORD_VERSION
+        uint8_t reserved;
+        uint16_t count;           ///< Number of card_<n> records
+        uint32_t crc;             ///< CRC-32 of the fields above
+    };
+
+    /**
+     * @brief Load card records, migrating from JSON if that is all there is
+     * @return true if the stored cards need writing back (migration or damage)
+     */
+    bool loadCardRecords(std::vector<CardConfig>& configs);
+
+    /**
+     * @brief Write records that differ from what is in flash, then the index
+     * @return Number of NVS keys written or removed
+     */
+    uint32_t writeCardRecords(const std::vector<CardConfig>& configs);
+
+    static bool encodeCardRecord(const CardConfig& config, std::vector<uint8_t>& out);
+    static bool decodeCardRecord(const uint8_t* data, size_t length, CardConfig& config);
+    static uint32_t cardIndexCrc(const CardIndex& index);
+    static bool sameCard(const CardConfig& a, const CardConfig& b);
+    static String cardKey(size_t slot);
+
+    /** @brief Legacy JSON card list stored under "config_list" */
+    static bool decodeLegacyCardConfigs(const String& json, std::vector<CardConfig>& configs);
+
+    void lock() { xSemaphoreTake(_snapshotMutex, portMAX_DELAY); }
+    void unlock() { xSemaphoreGive(_snapshotMutex); }
+
+    Snapshot _snapshot;
+    uint8_t _dirty = 0;                        ///< DirtyFlags not yet written to flash
+    SemaphoreHandle_t _snapshotMutex;          ///< Guards _snapshot and _dirty
+    SemaphoreHandle_t _storageMutex;           ///< Serializes writes to the Preferences instances
+    TaskHandle_t _flushTaskHandle = nullptr;
+    uint32_t _flashWrites = 0;                 ///< Keys written since boot, for logging
+
+    // What is currently in flash, owned by whoever holds _storageMutex
+    std::vector<CardConfig> _persistedCards;   ///< Cards as last written or loaded
+    size_t _persistedCardSlots = 0;            ///< card_<n> keys that may exist
+    bool _removeLegacyCards = false;           ///< Delete "config_list" after the next card write
+
+    static const uint8_t CARD_RECORD_VERSION = 1;
+
+    /** @brief Quiet time after the last change before writing */
+    static const uint32_t WRITE_DEBOUNCE_MS = 1000;
+    /** @brief Upper bound on how long a change can wait during a steady stream of saves */
+    static const uint32_t WRITE_MAX_DELAY_MS = 5000;
 
     // Preferences instances for persistent storage
     Preferences _preferences;      ///< Main preferences storage instance
@@ -175,6 +342,7 @@ private:
     const char* _ssidKey = "ssid";                ///< Key for stored WiFi SSID
     const char* _passwordKey = "password";         ///< Key for stored WiFi password
     const char* _hasCredentialsKey = "has_creds"; ///< Key for WiFi credentials presence flag
+    const char* _linkHintKey = "wifi_link";       ///< Key for the last BSSID and channel joined
 
     // Storage keys for API configuration
     const char* _teamIdKey = "team_id";           ///< Key for stored team ID
@@ -1,4 +1,7 @@
 #include "EventQueue.h"
+#include "Metrics.h"
+#include "Trace.h"
+#include "ResourceMonitor.h"
 
 EventQueue::EventQueue(size_t queueSize) : isRunning(false), taskHandle(nullptr) {
     // Create the event queue
@@ -49,6 +52,7 @@ bool EventQueue::publishEvent(const Event& event) {
     if (xQueueSend(eventQueue, &event, 0) == pdPASS) {
         return true;
     }
+    Metrics::eventQueueDrops.add();
     return false;
 }
 
@@ -64,13 +68,14 @@ void EventQueue::begin() {
     if (!isRunning) {
         isRunning = true;
         // Create a task to process events
-        xTaskCreate(
+        ResourceMonitor::createTask(
             eventProcessingTask,
             "EventQueueTask",
-            4096,           // Stack size (adjust as needed)
+            TASK_STACK_SIZE,
             this,           // Task parameter
             tskIDLE_PRIORITY + 1,  // Priority (adjust as needed)
-            &taskHandle     // Task handle
+            &taskHandle,    // Task handle
+            tskNO_AFFINITY
         );
     }
 }
@@ -83,7 +88,7 @@ void EventQueue::end() {
         vTaskDelay(pdMS_TO_TICKS(100));
         
         // Delete the task
-        vTaskDelete(taskHandle);
+        ResourceMonitor::deleteTask(taskHandle);
         taskHandle = nullptr;
     }
 }
@@ -98,6 +103,7 @@ void EventQueue::eventProcessingTask(void* parameter) {
         if (xQueueReceive(self->eventQueue, &event, pdMS_TO_TICKS(100)) == pdPASS) {
             // Process the event by calling all registered callbacks
             if (xSemaphoreTake(self->callbackMutex, portMAX_DELAY) == pdTRUE) {
+                TRACE_SCOPE("event.dispatch");
                 for (const auto& callback : self->eventCallbacks) {
                     callback(event);
                 }
@@ -108,6 +114,7 @@ void EventQueue::eventProcessingTask(void* parameter) {
         vTaskDelay(1);
     }
     
-    // Task cleanup
-    vTaskDelete(NULL);
+    // end() deletes this task; wait for it rather than deleting ourselves
+    // as well, which could free the task twice
+    vTaskSuspend(NULL);
 } 
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "Metrics.h"
+
+Metrics::Metric* Metrics::_head = nullptr;
+Metrics::Metric* Metrics::_tail = nullptr;
+
+// Bucket upper bounds. Fetches are TLS round trips; frames are one 5 ms tick of the UI task.
+static const uint32_t FETCH_BOUNDS_MS[] = { 100, 250, 500, 1000, 2000, 3000, 5000, 10000, 20000 };
+static const uint32_t PARSE_BOUNDS_MS[] = { 1, 5, 10, 25, 50, 100, 250, 500, 1000 };
+static const uint32_t FRAME_BOUNDS_US[] = { 250, 500, 1000, 2000, 5000, 10000, 16667, 33333, 50000, 100000 };
+
+#define BOUNDS(b) b, sizeof(b) / sizeof(b[0])
+
+Metrics::Histogram Metrics::fetchLatencyMs("posthog_fetch_ms", "PostHog insight request time in milliseconds", BOUNDS(FETCH_BOUNDS_MS));
+Metrics::Counter Metrics::fetchErrors("posthog_fetch_errors_total", "PostHog insight requests that failed");
+Metrics::Counter Metrics::fetchRetries("posthog_fetch_retries_total", "PostHog insight requests retried");
+Metrics::Counter Metrics::fetchCacheMisses("posthog_fetch_cache_misses_total", "Empty cached insights refreshed with a blocking request");
+Metrics::Counter Metrics::fetchBytes("posthog_fetch_bytes_total", "PostHog insight response bytes received");
+Metrics::Gauge Metrics::allInsightsLoadMs("posthog_all_insights_load_ms", "Time from the first insight request until all had data or failed");
+Metrics::Histogram Metrics::parseTimeMs("insight_parse_ms", "Insight JSON parse time in milliseconds", BOUNDS(PARSE_BOUNDS_MS));
+
+Metrics::Histogram Metrics::frameTimeUs("ui_frame_us", "UI task pass time in microseconds", BOUNDS(FRAME_BOUNDS_US));
+Metrics::Counter Metrics::uiWakeups("ui_wakeups_total", "UI task passes");
+Metrics::Gauge Metrics::uiQueueDepth("ui_queue_depth", "UI callbacks waiting at the last drain");
+Metrics::Gauge Metrics::uiQueueDepthMax("ui_queue_depth_max", "Most UI callbacks waiting at once");
+Metrics::Counter Metrics::uiQueueDrops("ui_queue_drops_total", "UI callbacks discarded on a full queue");
+Metrics::Counter Metrics::eventQueueDrops("event_queue_drops_total", "Events discarded on a full queue");
+
+Metrics::Histogram Metrics::refreshTimeUs("ui_refresh_us", "LVGL display refresh time in microseconds", BOUNDS(FRAME_BOUNDS_US));
+Metrics::Counter Metrics::invalidatedPixels("ui_invalidated_pixels_total", "Pixels requested for redraw");
+Metrics::GaugeFamily Metrics::renderUpdateUsMax("render_update_us_max", "Longest renderer update in microseconds", "renderer");
+Metrics::GaugeFamily Metrics::renderRefreshUsMax("render_refresh_us_max", "Longest refresh after a renderer update in microseconds", "renderer");
+Metrics::GaugeFamily Metrics::renderInvalidatedPx("render_invalidated_pixels", "Pixels invalidated by the latest renderer update", "renderer");
+Metrics::Gauge Metrics::lvglMemUsed("lvgl_mem_used_bytes", "LVGL heap in use");
+Metrics::Gauge Metrics::lvglMemUsedMax("lvgl_mem_used_max_bytes", "Most LVGL heap in use since boot");
+Metrics::Gauge Metrics::lvglMemFragPct("lvgl_mem_frag_pct", "LVGL heap fragmentation percentage");
+
+Metrics::Gauge Metrics::heapFreeMin("heap_internal_free_min_bytes", "Lowest internal heap free since boot");
+Metrics::Gauge Metrics::heapLargestBlock("heap_internal_largest_block_bytes", "Largest free internal heap block");
+Metrics::Gauge Metrics::psramFreeMin("psram_free_min_bytes", "Lowest PSRAM free since boot");
+Metrics::Gauge Metrics::psramLargestBlock("psram_largest_block_bytes", "Largest free PSRAM block");
+Metrics::GaugeFamily Metrics::taskStackFreeMin("task_stack_free_min_bytes", "Stack high-water mark: bytes never used", "task");
+
+#undef BOUNDS
+
+Metrics::Metric::Metric(const char* name, const char* help, Kind kind)
+    : _name(name), _help(help), _kind(kind), _next(nullptr) {
+    // Append so export follows declaration order
+    if (_tail) {
+        _tail->_next = this;
+    } else {
+        _head = this;
+    }
+    _tail = this;
+}
+
+void Metrics::Gauge::set(int32_t value) {
+    _value.store(value, std::memory_order_relaxed);
+    _set.store(true, std::memory_order_relaxed);
+}
+
+void Metrics::Gauge::lowerTo(int32_t value) {
+    if (!_set.exchange(true, std::memory_order_relaxed)) {
+        _value.store(value, std::memory_order_relaxed);
+        return;
+    }
+    int32_t current = _value.load(std::memory_order_relaxed);
+    while (value < current &&
+           !_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void Metrics::Gauge::raiseTo(int32_t value) {
+    if (!_set.exchange(true, std::memory_order_relaxed)) {
+        _value.store(value, std::memory_order_relaxed);
+        return;
+    }
+    int32_t current = _value.load(std::memory_order_relaxed);
+    while (value > current &&
+           !_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+Metrics::GaugeFamily::GaugeFamily(const char* name, const char* help, const char* labelName)
+    : Metric(name, help, Kind::GAUGE_FAMILY),
+      _labelName(labelName),
+      _seriesCount(0) {
+    for (size_t i = 0; i < MAX_SERIES; i++) {
+        _labels[i] = nullptr;
+        _values[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+int Metrics::GaugeFamily::addSeries(const char* label) {
+    uint32_t index = _seriesCount.load(std::memory_order_relaxed);
+    if (index >= MAX_SERIES) {
+        return -1;
+    }
+    _labels[index] = label;
+    // Publish the label before exporters can see the new series
+    _seriesCount.store(index + 1, std::memory_order_release);
+    return index;
+}
+
+void Metrics::GaugeFamily::set(size_t series, int32_t value) {
+    if (series < MAX_SERIES) {
+        _values[series].store(value, std::memory_order_relaxed);
+    }
+}
+
+Metrics::Histogram::Histogram(const char* name, const char* help, const uint32_t* bounds, size_t boundCount)
+    : Metric(name, help, Kind::HISTOGRAM),
+      _bounds(bounds),
+      _boundCount(boundCount > MAX_BOUNDS ? MAX_BOUNDS : boundCount),
+      _count(0),
+      _sum(0) {
+    for (size_t i = 0; i <= MAX_BOUNDS; i++) {
+        _buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Metrics::Histogram::observe(uint32_t value) {
+    // Bounds are short and ascending; a linear scan beats a binary search here
+    size_t i = 0;
+    while (i < _boundCount && value > _bounds[i]) {
+        i++;
+    }
+    _buckets[i].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    // Wraps like a counter reset on long uptimes, which scrapers already handle
+    _sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+const Metrics::Metric* Metrics::first() {
+    return _head;
+}
+
+void Metrics::writeJson(Print& out) {
+    out.print('{');
+    for (const Metric* m = _head; m; m = m->next()) {
+        if (m != _head) {
+            out.print(',');
+        }
+        out.printf("\"%s\":", m->name());
+
+        switch (m->kind()) {
+            case Kind::COUNTER:
+                out.printf("{\"type\":\"counter\",\"value\":%u}",
+                           (unsigned)static_cast<const Counter*>(m)->value());
+                break;
+
+            case Kind::GAUGE:
+                out.printf("{\"type\":\"gauge\",\"value\":%d}",
+                           (int)static_cast<const Gauge*>(m)->value());
+                break;
+
+            case Kind::GAUGE_FAMILY: {
+                const GaugeFamily* f = static_cast<const GaugeFamily*>(m);
+                out.printf("{\"type\":\"gauge\",\"label\":\"%s\",\"values\":{", f->labelName());
+                size_t series = f->seriesCount();
+                for (size_t i = 0; i < series; i++) {
+                    out.printf("%s\"%s\":%d", i ? "," : "", f->seriesLabel(i), (int)f->value(i));
+                }
+                out.print("}}");
+                break;
+            }
+
+            case Kind::HISTOGRAM: {
+                const Histogram* h = static_cast<const Histogram*>(m);
+                out.printf("{\"type\":\"histogram\",\"count\":%u,\"sum\":%u,\"buckets\":[",
+                           (unsigned)h->count(), (unsigned)h->sum());
+                // Non-cumulative [upper bound, count] pairs; null marks the overflow bucket
+                for (size_t i = 0; i <= h->boundCount(); i++) {
+                    if (i > 0) {
+                        out.print(',');
+                    }
+                    if (i < h->boundCount()) {
+                        out.printf("[%u,%u]", (unsigned)h->bound(i), (unsigned)h->bucketCount(i));
+                    } else {
+                        out.printf("[null,%u]", (unsigned)h->bucketCount(i));
+                    }
+                }
+                out.print("]}");
+                break;
+            }
+        }
+    }
+    out.print('}');
+}
+
+void Metrics::writePrometheus(Print& out) {
+    for (const Metric* m = _head; m; m = m->next()) {
+        out.printf("# HELP %s %s\n", m->name(), m->help());
+
+        switch (m->kind()) {
+            case Kind::COUNTER:
+                out.printf("# TYPE %s counter\n%s %u\n", m->name(), m->name(),
+                           (unsigned)static_cast<const Counter*>(m)->value());
+                break;
+
+            case Kind::GAUGE:
+                out.printf("# TYPE %s gauge\n%s %d\n", m->name(), m->name(),
+                           (int)static_cast<const Gauge*>(m)->value());
+                break;
+
+            case Kind::GAUGE_FAMILY: {
+                const GaugeFamily* f = static_cast<const GaugeFamily*>(m);
+                out.printf("# TYPE %s gauge\n", m->name());
+                size_t series = f->seriesCount();
+                for (size_t i = 0; i < series; i++) {
+                    out.printf("%s{%s=\"%s\"} %d\n", m->name(), f->labelName(), f->seriesLabel(i), (int)f->value(i));
+                }
+                break;
+            }
+
+            case Kind::HISTOGRAM: {
+                const Histogram* h = static_cast<const Histogram*>(m);
+                out.printf("# TYPE %s histogram\n", m->name());
+                uint32_t cumulative = 0;
+                for (size_t i = 0; i < h->boundCount(); i++) {
+                    cumulative += h->bucketCount(i);
+                    out.printf("%s_bucket{le=\"%u\"} %u\n", m->name(), (unsigned)h->bound(i), (unsigned)cumulative);
+                }
+                cumulative += h->bucketCount(h->boundCount());
+                out.printf("%s_bucket{le=\"+Inf\"} %u\n", m->name(), (unsigned)cumulative);
+                out.printf("%s_sum %u\n%s_count %u\n", m->name(), (unsigned)h->sum(), m->name(), (unsigned)cumulative);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @class Metrics
+ * @brief Process-wide counters, gauges and latency histograms
+ *
+ * Every metric is a static member defined in Metrics.cpp, so the full set is
+ * known at boot and nothing is allocated at runtime. Updates are single
+ * relaxed atomic operations and safe from any task or core; readers may see
+ * a histogram's count and buckets from slightly different instants, which is
+ * fine for monitoring.
+ *
+ * The registry is exported through CaptivePortal at /api/metrics as JSON, or
+ * in Prometheus text format with ?format=prometheus. Only Arduino's Print is
+ * needed for export, so the registry also builds off-device.
+ */
+class Metrics {
+public:
+    enum class Kind : uint8_t {
+        COUNTER,
+        GAUGE,
+        GAUGE_FAMILY,
+        HISTOGRAM
+    };
+
+    /**
+     * @brief Common registry entry; metrics link themselves in on construction
+     *
+     * Only construct metrics with static storage duration. Registration is
+     * not locked, and relies on happening during static initialisation.
+     */
+    class Metric {
+    public:
+        Metric(const char* name, const char* help, Kind kind);
+        Metric(const Metric&) = delete;
+        Metric& operator=(const Metric&) = delete;
+
+        const char* name() const { return _name; }
+        const char* help() const { return _help; }
+        Kind kind() const { return _kind; }
+        const Metric* next() const { return _next; }
+
+    private:
+        const char* _name;
+        const char* _help;
+        Kind _kind;
+        Metric* _next;
+    };
+
+    /**
+     * @brief Monotonic event count
+     */
+    class Counter : public Metric {
+    public:
+        Counter(const char* name, const char* help) : Metric(name, help, Kind::COUNTER), _value(0) {}
+
+        void add(uint32_t n = 1) { _value.fetch_add(n, std::memory_order_relaxed); }
+        uint32_t value() const { return _value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint32_t> _value;
+    };
+
+    /**
+     * @brief Point-in-time value; lowerTo()/raiseTo() keep low/high-water marks
+     */
+    class Gauge : public Metric {
+    public:
+        Gauge(const char* name, const char* help) : Metric(name, help, Kind::GAUGE), _value(0), _set(false) {}
+
+        void set(int32_t value);
+        void lowerTo(int32_t value);   ///< Store value if it is below the current one (or the first sample)
+        void raiseTo(int32_t value);   ///< Store value if it is above the current one (or the first sample)
+        int32_t value() const { return _value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int32_t> _value;
+        std::atomic<bool> _set;
+    };
+
+    /**
+     * @brief Gauges sharing one name, told apart by a single label value
+     *
+     * Series are added at runtime (e.g. one per watched task) but never
+     * removed. addSeries() must only be called from one task; set() is safe
+     * from any.
+     */
+    class GaugeFamily : public Metric {
+    public:
+        static const size_t MAX_SERIES = 16;
+
+        GaugeFamily(const char* name, const char* help, const char* labelName);
+
+        /**
+         * @brief Add a series; label must outlive the registry
+         * @return Series index for set(), or -1 when the family is full
+         */
+        int addSeries(const char* label);
+        void set(size_t series, int32_t value);
+
+        const char* labelName() const { return _labelName; }
+        size_t seriesCount() const { return _seriesCount.load(std::memory_order_acquire); }
+        const char* seriesLabel(size_t i) const { return _labels[i]; }
+        int32_t value(size_t i) const { return _values[i].load(std::memory_order_relaxed); }
+
+    private:
+        const char* _labelName;
+        const char* _labels[MAX_SERIES];
+        std::atomic<int32_t> _values[MAX_SERIES];
+        std::atomic<uint32_t> _seriesCount;
+    };
+
+    /**
+     * @brief Fixed-bucket distribution of an unsigned measurement
+     *
+     * Bucket i counts observations <= bounds[i] that did not fit an earlier
+     * bucket; one extra bucket takes everything larger. Export converts to
+     * cumulative counts where the format expects them.
+     */
+    class Histogram : public Metric {
+    public:
+        static const size_t MAX_BOUNDS = 12;
+
+        Histogram(const char* name, const char* help, const uint32_t* bounds, size_t boundCount);
+
+        void observe(uint32_t value);
+
+        size_t boundCount() const { return _boundCount; }
+        uint32_t bound(size_t i) const { return _bounds[i]; }
+        uint32_t bucketCount(size_t i) const { return _buckets[i].load(std::memory_order_relaxed); } ///< i == boundCount() is the overflow bucket
+        uint32_t count() const { return _count.load(std::memory_order_relaxed); }
+        uint32_t sum() const { return _sum.load(std::memory_order_relaxed); }
+
+    private:
+        const uint32_t* _bounds;
+        size_t _boundCount;
+        std::atomic<uint32_t> _buckets[MAX_BOUNDS + 1];
+        std::atomic<uint32_t> _count;
+        std::atomic<uint32_t> _sum;
+    };
+
+    // Network and parsing
+    static Histogram fetchLatencyMs;       ///< PostHog insight HTTP round trip
+    static Counter fetchErrors;            ///< PostHog insight requests that failed
+    static Counter fetchRetries;           ///< Failed insight requests put back on the queue
+    static Counter fetchCacheMisses;       ///< Cached results that were empty, so a blocking refresh followed
+    static Counter fetchBytes;             ///< Insight response bytes received
+    static Gauge allInsightsLoadMs;        ///< From the first request until every requested insight had data or failed
+    static Histogram parseTimeMs;          ///< InsightParser construction (deserializeJson)
+
+    // UI task
+    static Histogram frameTimeUs;          ///< One lvglTask pass: LVGL timers plus the UI queue
+    static Counter uiWakeups;              ///< lvglTask passes; its rate is the UI task's wakeups per second
+    static Gauge uiQueueDepth;             ///< UI callbacks waiting when the queue was last drained
+    static Gauge uiQueueDepthMax;          ///< Most UI callbacks ever waiting at once
+    static Counter uiQueueDrops;           ///< UI callbacks discarded because the queue was full
+    static Counter eventQueueDrops;        ///< Events discarded because the event queue was full
+
+    // Rendering, from RenderProfiler
+    static Histogram refreshTimeUs;        ///< LVGL display refresh (layout, render and flush) that drew something
+    static Counter invalidatedPixels;      ///< Pixels requested for redraw, overlaps counted twice
+    static GaugeFamily renderUpdateUsMax;  ///< Longest UI-thread update, per renderer
+    static GaugeFamily renderRefreshUsMax; ///< Longest refresh that followed an update, per renderer
+    static GaugeFamily renderInvalidatedPx; ///< Pixels invalidated by the latest update and its refresh, per renderer
+    static Gauge lvglMemUsed;              ///< LVGL heap in use at the last sample
+    static Gauge lvglMemUsedMax;           ///< Most LVGL heap ever in use
+    static Gauge lvglMemFragPct;           ///< LVGL heap fragmentation at the last sample
+
+    // Memory, sampled by ResourceMonitor and when the metrics are exported
+    static Gauge heapFreeMin;              ///< Lowest internal heap free since boot
+    static Gauge heapLargestBlock;         ///< Largest internal block free at the last sample
+    static Gauge psramFreeMin;             ///< Lowest PSRAM free since boot
+    static Gauge psramLargestBlock;        ///< Largest PSRAM block free at the last sample
+    static GaugeFamily taskStackFreeMin;   ///< Stack bytes never touched, per watched task
+
+    /**
+     * @brief First registered metric, for walking the registry
+     */
+    static const Metric* first();
+
+    /**
+     * @brief Write every metric as one JSON object keyed by metric name
+     */
+    static void writeJson(Print& out);
+
+    /**
+     * @brief Write every metric in Prometheus text exposition format
+     */
+    static void writePrometheus(Print& out);
+
+private:
+    static Metric* _head;
+    static Metric* _tail;
+};
@@ -0,0 +1,174 @@
+#include "OtaDeltaPatch.h"
+#include "esp_heap_caps.h"
+
+static const uint8_t PATCH_MAGIC[4] = { 'D', 'H', 'O', 'P' };
+
+OtaDeltaPatch::OtaDeltaPatch(SourceReader source, Output output, HeaderHandler onHeader)
+    : _source(source),
+      _output(output),
+      _onHeader(onHeader),
+      _state(State::HEADER),
+      _header{},
+      _fieldSize(HEADER_SIZE),
+      _fieldFilled(0),
+      _literalRemaining(0),
+      _produced(0),
+      _scratch(nullptr),
+      _error("") {
+}
+
+OtaDeltaPatch::~OtaDeltaPatch() {
+    if (_scratch) {
+        heap_caps_free(_scratch);
+    }
+}
+
+bool OtaDeltaPatch::feed(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        switch (_state) {
+            case State::LITERAL_DATA: {
+                // Literal bytes go straight from the network buffer to the output
+                size_t n = min((size_t)_literalRemaining, length);
+                if (!_output(data, n)) {
+                    return fail("Output rejected literal data");
+                }
+                _produced += n;
+                _literalRemaining -= n;
+                data += n;
+                length -= n;
+                if (_literalRemaining == 0) {
+                    expect(State::OPCODE, 1);
+                }
+                break;
+            }
+
+            case State::DONE:
+                return fail("Data after end of patch");
+
+            case State::ERROR:
+                return false;
+
+            default: {
+                size_t n = min(_fieldSize - _fieldFilled, length);
+                memcpy(_field + _fieldFilled, data, n);
+                _fieldFilled += n;
+                data += n;
+                length -= n;
+                if (_fieldFilled == _fieldSize && !onField()) {
+                    return false;
+                }
+                break;
+            }
+        }
+    }
+    return _state != State::ERROR;
+}
+
+void OtaDeltaPatch::expect(State state, size_t fieldSize) {
+    _state = state;
+    _fieldSize = fieldSize;
+    _fieldFilled = 0;
+}
+
+bool OtaDeltaPatch::onField() {
+    switch (_state) {
+        case State::HEADER:
+            if (memcmp(_field, PATCH_MAGIC, sizeof(PATCH_MAGIC)) != 0) {
+                return fail("Not a delta patch");
+            }
+            if (_field[4] != VERSION) {
+                return fail("Unsupported patch version");
+            }
+            _header.oldSize = readU32(_field + 8);
+            memcpy(_header.oldSha256, _field + 12, 32);
+            _header.newSize = readU32(_field + 44);
+            memcpy(_header.newSha256, _field + 48, 32);
+            if (_header.newSize == 0) {
+                return fail("Patch produces an empty image");
+            }
+            if (_onHeader && !_onHeader(_header)) {
+                return fail("Patch does not apply to this device");
+            }
+            expect(State::OPCODE, 1);
+            return true;
+
+        case State::OPCODE:
+            switch (_field[0]) {
+                case OP_COPY:
+                    expect(State::COPY_ARGS, 8);
+                    return true;
+                case OP_LITERAL:
+                    expect(State::LITERAL_LENGTH, 4);
+                    return true;
+                case OP_END:
+                    if (_produced != _header.newSize) {
+                        return fail("Patch ended before the image was complete");
+                    }
+                    _state = State::DONE;
+                    return true;
+                default:
+                    return fail("Unknown patch opcode");
+            }
+
+        case State::COPY_ARGS: {
+            uint32_t offset = readU32(_field);
+            uint32_t length = readU32(_field + 4);
+            if (length == 0 || offset > _header.oldSize || length > _header.oldSize - offset) {
+                return fail("Copy outside the running image");
+            }
+            if (length > _header.newSize - _produced) {
+                return fail("Copy past the end of the new image");
+            }
+            if (!copyFromSource(offset, length)) {
+                return false;
+            }
+            expect(State::OPCODE, 1);
+            return true;
+        }
+
+        case State::LITERAL_LENGTH:
+            _literalRemaining = readU32(_field);
+            if (_literalRemaining == 0 || _literalRemaining > _header.newSize - _produced) {
+                return fail("Literal past the end of the new image");
+            }
+            _state = State::LITERAL_DATA;
+            return true;
+
+        default:
+            return fail("Internal patch state error");
+    }
+}
+
+bool OtaDeltaPatch::copyFromSource(uint32_t offset, uint32_t length) {
+    if (!_scratch) {
+        _scratch = (uint8_t*)heap_caps_malloc(COPY_CHUNK_SIZE, MALLOC_CAP_8BIT);
+        if (!_scratch) {
+            return fail("Out of memory");
+        }
+    }
+
+    while (length > 0) {
+        size_t n = min((size_t)length, (size_t)COPY_CHUNK_SIZE);
+        if (!_source(offset, _scratch, n)) {
+            return fail("Could not read the running image");
+        }
+        if (!_output(_scratch, n)) {
+            return fail("Output rejected copied data");
+        }
+        _produced += n;
+        offset += n;
+        length -= n;
+    }
+    return true;
+}
+
+bool OtaDeltaPatch::fail(const char* message) {
+    Serial.printf("OtaDeltaPatch: %s (at output byte %u)\n", message, _produced);
+    _error = message;
+    _state = State::ERROR;
+    return false;
+}
+
+uint32_t OtaDeltaPatch::readU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
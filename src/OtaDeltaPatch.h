@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+/**
+ * @class OtaDeltaPatch
+ * @brief Streaming decoder for delta firmware patches (see make_delta.py)
+ *
+ * A patch rebuilds the new app image from the running one:
+ *
+ *   Header  "DHOP", u8 version, 3 reserved, u32 oldSize, oldSha256[32],
+ *           u32 newSize, newSha256[32]                  (80 bytes)
+ *   COPY    0x01, u32 srcOffset, u32 length             (bytes from the old image)
+ *   LITERAL 0x02, u32 length, <length bytes>            (bytes carried in the patch)
+ *   END     0x00
+ *
+ * Integers are little-endian. The patch is pushed through feed() as it
+ * arrives from the network, so RAM use is one COPY_CHUNK_SIZE scratch buffer
+ * however large the image is. Output is produced strictly in order.
+ */
+class OtaDeltaPatch {
+public:
+    static const uint8_t VERSION = 1;
+    static const size_t HEADER_SIZE = 80;
+    static const size_t COPY_CHUNK_SIZE = 4096;   ///< Old image bytes read per flash access
+
+    struct Header {
+        uint32_t oldSize;
+        uint8_t oldSha256[32];
+        uint32_t newSize;
+        uint8_t newSha256[32];
+    };
+
+    /**
+     * @brief Reads bytes of the old image; returns false on a read error
+     */
+    using SourceReader = std::function<bool(size_t offset, uint8_t* out, size_t length)>;
+
+    /**
+     * @brief Receives the next bytes of the new image; returns false to stop
+     */
+    using Output = std::function<bool(const uint8_t* data, size_t length)>;
+
+    /**
+     * @brief Called once the header is parsed; returns false to reject the patch
+     */
+    using HeaderHandler = std::function<bool(const Header& header)>;
+
+    OtaDeltaPatch(SourceReader source, Output output, HeaderHandler onHeader);
+    ~OtaDeltaPatch();
+
+    /**
+     * @brief Consume the next bytes of the patch
+     * @return false once the patch is malformed or a callback failed
+     */
+    bool feed(const uint8_t* data, size_t length);
+
+    bool isComplete() const { return _state == State::DONE; }
+    bool hasError() const { return _state == State::ERROR; }
+    const char* error() const { return _error; }
+    size_t bytesProduced() const { return _produced; }
+    const Header& header() const { return _header; }
+
+private:
+    enum class State {
+        HEADER,
+        OPCODE,
+        COPY_ARGS,
+        LITERAL_LENGTH,
+        LITERAL_DATA,
+        DONE,
+        ERROR
+    };
+
+    enum Opcode : uint8_t {
+        OP_END = 0x00,
+        OP_COPY = 0x01,
+        OP_LITERAL = 0x02
+    };
+
+    void expect(State state, size_t fieldSize);
+    bool onField();
+    bool copyFromSource(uint32_t offset, uint32_t length);
+    bool fail(const char* message);
+    static uint32_t readU32(const uint8_t* p);
+
+    SourceReader _source;
+    Output _output;
+    HeaderHandler _onHeader;
+
+    State _state;
+    Header _header;
+    uint8_t _field[HEADER_SIZE];   ///< Collects a fixed-size field split across feed() calls
+    size_t _fieldSize;
+    size_t _fieldFilled;
+    uint32_t _literalRemaining;
+    size_t _produced;
+    uint8_t* _scratch;
+    const char* _error;
+};
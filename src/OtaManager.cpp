@@ -5,6 +5,12 @@
 #include "esp_task_wdt.h"
 #include <WiFi.h> // For WiFi.status() and WL_CONNECTED
 #include "esp_ota_ops.h" // Needed for esp_ota_get_running_partition()
+#include "OtaPipeline.h"
+#include "OtaDeltaPatch.h"
+#include "mbedtls/sha256.h"
+#include "esp_timer.h"
+#include "hardware/LedStatus.h"
+#include "ResourceMonitor.h"
 
 // For heap_caps_malloc and esp_ptr_external_ram, ensure correct include if not already covered by Arduino.h/ESP-IDF basics
 // #include "esp_heap_caps.h" // Already in OtaManager.h but good to be mindful
@@ -69,12 +75,41 @@ struct PsramAllocator {
 };
 #endif
 
+// Firmware download tuning
+static const unsigned long OTA_READ_IDLE_TIMEOUT_MS = 30000;  // Give up if the socket stalls this long
+static const unsigned long OTA_PROGRESS_INTERVAL_MS = 1000;   // Minimum time between progress updates
+static const int OTA_MAX_RESUMES = 5;                          // Reconnect attempts before giving up
+static const unsigned long OTA_RESUME_DELAY_MS = 2000;         // Pause before each reconnect attempt
+static const unsigned long OTA_RESUME_WIFI_TIMEOUT_MS = 60000; // How long to wait for WiFi to come back
+static const size_t OTA_VERIFY_CHUNK_SIZE = 4096;
+static const size_t OTA_DEFERRED_HEADER_BYTES = 16;            // Update writes the first block last, in end()
+static const size_t OTA_PATCH_READ_SIZE = 1024;                // Patch bytes decoded per socket read
+
 // Structure to pass parameters to the update task
 struct UpdateTaskParams {
     OtaManager* otaManagerInstance;
     char* downloadUrl;
+    char* patchUrl;            // NULL when there is no delta patch to try
+    bool hasExpectedSha256;
+    uint8_t expectedSha256[32];
 };
 
+// Parse a 64 character hex SHA-256 digest
+static bool parseSha256Hex(const String& hex, uint8_t out[32]) {
+    if (hex.length() != 64) {
+        return false;
+    }
+    for (int i = 0; i < 32; i++) {
+        char byteHex[3] = { hex[i * 2], hex[i * 2 + 1], '\0' };
+        char* end = nullptr;
+        out[i] = (uint8_t)strtoul(byteHex, &end, 16);
+        if (end != byteHex + 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Constructor
 OtaManager::OtaManager(const String& currentVersion, const String& repoOwner, const String& repoName)
     : _currentVersion(currentVersion),
@@ -115,7 +150,9 @@ bool OtaManager::checkForUpdate() {
             _lastCheckResult.updateAvailable = false;
             _lastCheckResult.availableVersion = "";
             _lastCheckResult.downloadUrl = "";
+            _lastCheckResult.patchUrl = "";
             _lastCheckResult.releaseNotes = "";
+            _statusVersion++;
             // Log this initial state change (moved from _setUpdateStatus for this specific case)
             Serial.printf("OtaManager Status: [%d] %s (%d%%)\n", static_cast<int>(_currentStatus.status), _currentStatus.message.c_str(), _currentStatus.progress);
             xSemaphoreGive(_dataMutex);
@@ -130,10 +167,10 @@ bool OtaManager::checkForUpdate() {
 
     // Create a task to handle the update check. 
     // The task will be responsible for NTP sync and then the actual check.
-    if (xTaskCreatePinnedToCore(
+    if (ResourceMonitor::createTask(
             _checkUpdateTaskRunner,   /* Task function */
             "otaCheckTask",         /* Name of task */
-            8192,                   /* Stack size of task */
+            CHECK_TASK_STACK_SIZE,  /* Stack size of task */
             this,                   /* Parameter of the task */
             1,                      /* Priority of the task */
             &_checkTaskHandle,      /* Task handle to keep track of the task */
@@ -143,13 +180,14 @@ bool OtaManager::checkForUpdate() {
         if (_dataMutex) xSemaphoreTake(_dataMutex, portMAX_DELAY);
         _setUpdateStatus(UpdateStatus::State::IDLE, "Failed to start check task.");
         _lastCheckResult.error = "Failed to start check task.";
+        _statusVersion++;
         if (_dataMutex) xSemaphoreGive(_dataMutex);
         return false;
     }
     return true;
 }
 
-bool OtaManager::beginUpdate(const String& downloadUrl) {
+bool OtaManager::beginUpdate(const String& downloadUrl, const String& expectedSha256, const String& patchUrl) {
     Serial.printf("OtaManager: [beginUpdate] Entered. Download URL: %s\n", downloadUrl.c_str());
 
     if (downloadUrl.isEmpty()) {
@@ -215,13 +253,26 @@ bool OtaManager::beginUpdate(const String& downloadUrl) {
     }
     taskParams->otaManagerInstance = this;
     taskParams->downloadUrl = urlCopy;
+    taskParams->patchUrl = patchUrl.isEmpty() ? nullptr : strdup(patchUrl.c_str()); // Optional, so no error if this fails
+    taskParams->hasExpectedSha256 = !expectedSha256.isEmpty();
+    if (taskParams->hasExpectedSha256 && !parseSha256Hex(expectedSha256, taskParams->expectedSha256)) {
+        Serial.printf("OtaManager: [beginUpdate] Error: Malformed SHA-256 digest '%s'.\n", expectedSha256.c_str());
+        free(urlCopy);
+        free(taskParams->patchUrl);
+        free(taskParams);
+        _setUpdateStatus(UpdateStatus::State::ERROR_VERIFY, "Published firmware digest is malformed.");
+        return false;
+    }
+    if (!taskParams->hasExpectedSha256) {
+        Serial.println("OtaManager: [beginUpdate] Warning: No published SHA-256; image will not be verified.");
+    }
     Serial.printf("OtaManager: [beginUpdate] taskParams allocated at %p. otaManagerInstance: %p, downloadUrl (copied): %p -> %s\n", (void*)taskParams, (void*)taskParams->otaManagerInstance, (void*)taskParams->downloadUrl, taskParams->downloadUrl);
 
     Serial.println("OtaManager: [beginUpdate] About to call xTaskCreatePinnedToCore for _updateTaskRunner.");
-    BaseType_t taskCreateResult = xTaskCreatePinnedToCore(
+    BaseType_t taskCreateResult = ResourceMonitor::createTask(
             _updateTaskRunner,      /* Task function */
             "otaUpdateTask",        /* Name of task */
-            12288,                  /* Stack size of task (increased for HTTPS and flashing) */
+            UPDATE_TASK_STACK_SIZE, /* Stack size of task (increased for HTTPS and flashing) */
             (void*)taskParams,      /* Parameter of the task (pass the new struct) */
             2,                      /* Priority of the task (higher than check) */
             &_updateTaskHandle,     /* Task handle */
@@ -233,6 +284,7 @@ bool OtaManager::beginUpdate(const String& downloadUrl) {
     if (taskCreateResult != pdPASS) {
         Serial.println("OtaManager: [beginUpdate] Error: Failed to create update task.");
         free(taskParams->downloadUrl); // Free the copied URL
+        free(taskParams->patchUrl);
         Serial.println("OtaManager: [beginUpdate] Freed taskParams->downloadUrl due to task creation failure.");
         free(taskParams);              // Free the params struct
         Serial.println("OtaManager: [beginUpdate] Freed taskParams struct due to task creation failure.");
@@ -299,6 +351,15 @@ void OtaManager::process() {
 }
 
 // Private helper methods
+void OtaManager::_restart() {
+    if (_beforeRestart) {
+        Serial.println("OtaManager: Running pre-restart hook.");
+        _beforeRestart();
+    }
+    delay(1000); // Give a moment for serial message to get out
+    ESP.restart();
+}
+
 void OtaManager::_setUpdateStatus(UpdateStatus::State state, const String& message, int progress) {
     Serial.printf("OtaManager: [_setUpdateStatus] Entered. Requested State: %d, Msg: %s, Prog: %d\n", static_cast<int>(state), message.c_str(), progress);
 
@@ -324,6 +385,7 @@ void OtaManager::_setUpdateStatus(UpdateStatus::State state, const String& messa
                 actualProgressForLogging = _currentStatus.progress; // Log existing progress
                 Serial.printf("OtaManager: [_setUpdateStatus] _currentStatus.progress unchanged, remains %d\n", _currentStatus.progress);
             }
+            _statusVersion++;
             xSemaphoreGive(_dataMutex);
             Serial.println("OtaManager: [_setUpdateStatus] dataMutex given.");
         } else {
@@ -344,6 +406,25 @@ void OtaManager::_setUpdateStatus(UpdateStatus::State state, const String& messa
     // Perform logging after mutex has been released
     Serial.printf("OtaManager Status: [%d] %s (%d%%) (Logged from _setUpdateStatus after mutex release)\n", 
                   static_cast<int>(localState), localMessage.c_str(), actualProgressForLogging);
+
+    // Mirror the update on the status LED
+    switch (localState) {
+        case UpdateStatus::State::DOWNLOADING:
+        case UpdateStatus::State::WRITING:
+        case UpdateStatus::State::SUCCESS:
+            LedStatus::setOtaProgress(actualProgressForLogging);
+            LedStatus::set(LedStatus::OTA, true);
+            break;
+        case UpdateStatus::State::IDLE:
+        case UpdateStatus::State::CHECKING_VERSION:
+        case UpdateStatus::State::MUTEX_BUSY:
+            LedStatus::set(LedStatus::OTA, false);
+            break;
+        default: // ERROR_*
+            LedStatus::set(LedStatus::OTA, false);
+            LedStatus::signalError();
+            break;
+    }
     Serial.println("OtaManager: [_setUpdateStatus] Exiting.");
 }
 
@@ -358,6 +439,7 @@ String OtaManager::_performHttpsRequest(const char* url, const char* rootCa) {
         Serial.println("OtaManager: WiFi not connected for HTTPS request.");
         if (_dataMutex) xSemaphoreTake(_dataMutex, portMAX_DELAY);
         _lastCheckResult.error = "WiFi not connected.";
+        _statusVersion++;
         if (_dataMutex) xSemaphoreGive(_dataMutex);
         _setUpdateStatus(UpdateStatus::State::ERROR_WIFI, "WiFi not connected");
         return "";
@@ -376,12 +458,14 @@ String OtaManager::_performHttpsRequest(const char* url, const char* rootCa) {
             Serial.printf("OtaManager: HTTPS GET failed, error: %s\n", http.errorToString(httpCode).c_str());
             if (_dataMutex) xSemaphoreTake(_dataMutex, portMAX_DELAY);
             _lastCheckResult.error = "HTTP error: " + String(httpCode);
+            _statusVersion++;
             if (_dataMutex) xSemaphoreGive(_dataMutex);
         }
     } else {
         Serial.printf("OtaManager: HTTPS GET failed, error: %s\n", http.errorToString(httpCode).c_str());
          if (_dataMutex) xSemaphoreTake(_dataMutex, portMAX_DELAY);
         _lastCheckResult.error = "HTTP connection failed: " + http.errorToString(httpCode);
+        _statusVersion++;
         if (_dataMutex) xSemaphoreGive(_dataMutex);
     }
 
@@ -435,11 +519,22 @@ UpdateInfo OtaManager::_parseGithubApiResponse(const String& jsonPayload) {
             info.updateAvailable = true;
             Serial.printf("OtaManager: Update available. Current: %s, Available: %s\n", _currentVersion.c_str(), info.availableVersion.c_str());
 
+            // Releases may carry delta patches from earlier versions, named after the version they apply to
+            String patchAssetName = "firmware-" + current + ".patch";
+
             JsonArray assets = latestRelease["assets"].as<JsonArray>();
             for (JsonObject asset : assets) {
-                if (String(asset["name"].as<String>()) == _firmwareAssetName) {
+                String assetName = asset["name"].as<String>();
+                if (assetName == _firmwareAssetName) {
                     info.downloadUrl = asset["browser_download_url"].as<String>();
-                    break;
+                    // GitHub publishes asset digests as "sha256:<hex>"
+                    const char* digest = asset["digest"];
+                    if (digest && strncmp(digest, "sha256:", 7) == 0) {
+                        info.sha256 = String(digest + 7);
+                    }
+                } else if (assetName == patchAssetName) {
+                    info.patchUrl = asset["browser_download_url"].as<String>();
+                    Serial.printf("OtaManager: Delta patch available: %s\n", patchAssetName.c_str());
                 }
             }
             if (info.downloadUrl.isEmpty()) {
@@ -509,6 +604,7 @@ void OtaManager::_checkUpdateTaskRunner(void* pvParameters) {
                 self->_currentStatus.status = ntpErrorState;
                 self->_currentStatus.message = ntpErrorMessage;
                 self->_lastCheckResult.error = ntpErrorMessage;
+                self->_statusVersion++;
                 self->_checkTaskHandle = NULL; // Mark task as complete (failed)
                 xSemaphoreGive(self->_dataMutex);
                 Serial.printf("OtaManager Status Update (NTP Fail in _checkUpdateTaskRunner): [%d] %s\n", 
@@ -519,7 +615,7 @@ void OtaManager::_checkUpdateTaskRunner(void* pvParameters) {
             }
         }
         esp_task_wdt_delete(NULL);
-        vTaskDelete(NULL);
+        ResourceMonitor::deleteTask(NULL);
         return; // Essential to exit the task here
     }
 
@@ -591,6 +687,7 @@ void OtaManager::_checkUpdateTaskRunner(void* pvParameters) {
             if (newOtaProgress != -1) { // Keep this progress update logic consistent
                 self->_currentStatus.progress = newOtaProgress;
             }
+            self->_statusVersion++;
             
             self->_checkTaskHandle = NULL; // Mark task as complete
             xSemaphoreGive(self->_dataMutex);
@@ -606,7 +703,7 @@ void OtaManager::_checkUpdateTaskRunner(void* pvParameters) {
     }
     
     esp_task_wdt_delete(NULL); // Remove current task from WDT
-    vTaskDelete(NULL);
+    ResourceMonitor::deleteTask(NULL);
 }
 
 void OtaManager::_updateTaskRunner(void* pvParameters) {
@@ -616,7 +713,7 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
     if (!params) {
         Serial.println("OtaManager: [_updateTaskRunner] CRITICAL ERROR: pvParameters is NULL. Task cannot proceed.");
         // Cannot call self->_setUpdateStatus as self is unknown. Log and delete task.
-        vTaskDelete(NULL);
+        ResourceMonitor::deleteTask(NULL);
         return;
     }
     Serial.printf("OtaManager: [_updateTaskRunner] pvParameters (params struct) address: %p\n", (void*)params);
@@ -626,8 +723,9 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
         Serial.println("OtaManager: [_updateTaskRunner] CRITICAL ERROR: params->otaManagerInstance is NULL. Task cannot proceed.");
         // Cannot call self->_setUpdateStatus. Log, free what we can, and delete task.
         if(params->downloadUrl) free(params->downloadUrl);
+        free(params->patchUrl);
         free(params);
-        vTaskDelete(NULL);
+        ResourceMonitor::deleteTask(NULL);
         return;
     }
     Serial.printf("OtaManager: [_updateTaskRunner] self (OtaManager instance) address: %p\n", (void*)self);
@@ -637,13 +735,18 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
         Serial.println("OtaManager: [_updateTaskRunner] CRITICAL ERROR: params->downloadUrl is NULL. Task cannot proceed.");
         self->_setUpdateStatus(UpdateStatus::State::ERROR_INTERNAL, "Task started with NULL download URL");
         // self is valid here, so we can use _setUpdateStatus if needed, though probably implies bigger issues.
+        free(params->patchUrl);
         free(params); // Free the params struct itself
-        vTaskDelete(NULL);
+        ResourceMonitor::deleteTask(NULL);
         return;
     }
     Serial.printf("OtaManager: [_updateTaskRunner] downloadUrlCStr_task (from params) address: %p, Content: %s\n", (void*)downloadUrlCStr_task, downloadUrlCStr_task);
 
     String downloadUrl = String(downloadUrlCStr_task);
+    String patchUrl = params->patchUrl ? String(params->patchUrl) : String();
+    bool hasExpectedSha256 = params->hasExpectedSha256;
+    uint8_t expectedSha256[32];
+    memcpy(expectedSha256, params->expectedSha256, sizeof(expectedSha256));
     Serial.printf("OtaManager: [_updateTaskRunner] downloadUrl (String object created): %s\n", downloadUrl.c_str());
     
     // Free the passed parameters now that we have copied/used them
@@ -652,6 +755,7 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
     Serial.printf("OtaManager: [_updateTaskRunner] Freeing params->downloadUrl (%p)\n", (void*)params->downloadUrl);
     free(params->downloadUrl); 
     params->downloadUrl = nullptr; // Good practice after free
+    free(params->patchUrl);
     Serial.printf("OtaManager: [_updateTaskRunner] Freeing params struct (%p)\n", (void*)params);
     free(params);
     params = nullptr; // Good practice
@@ -684,10 +788,21 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
              self->_updateTaskHandle = NULL; // Attempt to clear handle anyway
         }
         esp_task_wdt_delete(NULL);
-        vTaskDelete(NULL);
+        ResourceMonitor::deleteTask(NULL);
         return;
     }
     
+    // A patch is much smaller than the image; anything wrong with it falls back to the full download
+    if (!patchUrl.isEmpty()) {
+        if (self->_applyDeltaUpdate(patchUrl, hasExpectedSha256 ? expectedSha256 : nullptr)) {
+            self->_setUpdateStatus(UpdateStatus::State::SUCCESS, "Update successful! Rebooting...", 100);
+            Serial.println("OtaManager: [_updateTaskRunner] Delta update successful. Rebooting...");
+            self->_restart();
+        }
+        Serial.println("OtaManager: [_updateTaskRunner] Delta update not applied, downloading the full image.");
+        self->_setUpdateStatus(UpdateStatus::State::DOWNLOADING, "Downloading firmware...", 0);
+    }
+
     // Use the CA certificate for the HTTPS connection
     Serial.println("OtaManager: [_updateTaskRunner] Calling http.begin() with URL and Root CA.");
     http.begin(downloadUrl, self->_githubApiRootCa); 
@@ -761,7 +876,7 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
                 }
                 http.end();
                 esp_task_wdt_delete(NULL);
-                vTaskDelete(NULL);
+                ResourceMonitor::deleteTask(NULL);
                 return; // Essential to exit the task here
             }
             
@@ -774,87 +889,185 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
 
             WiFiClient* stream = http.getStreamPtr();
             Serial.println("OtaManager: [_updateTaskRunner] Got stream pointer.");
-            size_t written = 0;
-            uint8_t buff[1460] = {0}; // TCP MSS typical size
+
+            // Running hash of every byte handed to flash, checked against the published
+            // digest without a second pass. Together with the byte count it is also all
+            // that's needed to resume after a dropped connection.
+            mbedtls_sha256_context imageHash;
+            mbedtls_sha256_init(&imageHash);
+            mbedtls_sha256_starts(&imageHash, 0);
+            uint8_t imageHeader[OTA_DEFERRED_HEADER_BYTES];
+            size_t hashed = 0;
+            uint64_t hashMicros = 0;
+
+            // Socket reads fill one PSRAM buffer while the writer task flashes the other
+            OtaPipeline pipeline([&](const uint8_t* data, size_t length) {
+                size_t written = Update.write(const_cast<uint8_t*>(data), length);
+                if (hashed < OTA_DEFERRED_HEADER_BYTES) {
+                    size_t headerBytes = min(written, OTA_DEFERRED_HEADER_BYTES - hashed);
+                    memcpy(imageHeader + hashed, data, headerBytes);
+                }
+                uint64_t hashStart = esp_timer_get_time();
+                mbedtls_sha256_update(&imageHash, data, written);
+                hashMicros += esp_timer_get_time() - hashStart;
+                hashed += written;
+                return written;
+            });
+            if (!pipeline.begin()) {
+                self->_setUpdateStatus(UpdateStatus::State::ERROR_UPDATE_BEGIN, "Could not allocate OTA buffers.");
+                Update.abort();
+                http.end();
+                if (self->_dataMutex && xSemaphoreTake(self->_dataMutex, portMAX_DELAY) == pdTRUE) {
+                    self->_updateTaskHandle = NULL;
+                    xSemaphoreGive(self->_dataMutex);
+                } else {
+                    self->_updateTaskHandle = NULL;
+                }
+                esp_task_wdt_delete(NULL);
+                ResourceMonitor::deleteTask(NULL);
+                return;
+            }
+
+            size_t received = 0;      // Image bytes handed to the pipeline; where a resume starts
+            size_t transferred = 0;   // Bytes pulled off the network, including any sent twice
+            int resumes = 0;
+            uint8_t* buffer = nullptr;
+            size_t filled = 0;
+            bool readError = false;
+            int lastProgress = 0;
             unsigned long lastProgressUpdate = millis();
+            unsigned long lastDataTime = millis();
+            unsigned long downloadStart = millis();
 
             Serial.println("OtaManager: [_updateTaskRunner] Entering firmware write loop.");
-            while (http.connected() && (written < totalSize)) {
-                esp_task_wdt_reset(); // Reset WDT periodically during download/write
-                Serial.printf("OtaManager: [_updateTaskRunner] Loop Start: http.connected(): %d, stream->available(): %d, written: %d / %d\n", http.connected(), stream->available(), written, totalSize);
-                size_t len = stream->available();
-                if (len > 0) {
-                    int c = stream->readBytes(buff, ((len > sizeof(buff)) ? sizeof(buff) : len));
-                    Serial.printf("OtaManager: [_updateTaskRunner] stream->readBytes read %d bytes.\n", c);
-                    if (c > 0) { // Only call Update.write if bytes were actually read
-                        size_t bytes_written_by_update = Update.write(buff, c);
-                        if (bytes_written_by_update != c) {
-                            Serial.printf("OtaManager: [_updateTaskRunner] Update.write() failed. Expected to write %d, actually wrote %d.\n", c, bytes_written_by_update);
-                            // Capture error immediately after the failed write
-                            uint8_t update_error_code = Update.getError(); // Get the error code
-                            const char* update_error_cstr = Update.errorString(); // Get the error string (no argument)
-                            Serial.printf("OtaManager: [_updateTaskRunner] Update Error (captured immediately): %s (%d)\n", update_error_cstr, update_error_code);
-                            
-                            self->_setUpdateStatus(UpdateStatus::State::ERROR_UPDATE_WRITE, "Firmware write error: " + String(update_error_cstr));
-                            if (self->_dataMutex) { 
-                                if (xSemaphoreTake(self->_dataMutex, portMAX_DELAY) == pdTRUE) {
-                                    self->_updateTaskHandle = NULL;
-                                    xSemaphoreGive(self->_dataMutex);
-                                } else {
-                                    Serial.println("ERROR: _updateTaskRunner (Write Error) failed to take mutex!");
-                                    self->_updateTaskHandle = NULL;
-                                }
-                            } else {
-                                Serial.println("ERROR: _updateTaskRunner (Write Error) _dataMutex is NULL!");
-                                self->_updateTaskHandle = NULL;
-                            }
-                            Update.abort();
-                            Serial.println("OtaManager: [_updateTaskRunner] Called Update.abort() after write error.");
-                            http.end();
-                            Serial.println("OtaManager: [_updateTaskRunner] Called http.end() after write error.");
-                            esp_task_wdt_delete(NULL);
-                            vTaskDelete(NULL);
-                            Serial.println("OtaManager: [_updateTaskRunner] Task deleted after write error.");
-                            return;
+            while (true) {
+                while (received < totalSize && !pipeline.failed()) {
+                    esp_task_wdt_reset(); // Reset WDT periodically during download/write
+
+                    if (!buffer) {
+                        // Both buffers busy means flash is the bottleneck; wait for one back
+                        buffer = pipeline.acquireBuffer(pdMS_TO_TICKS(1000));
+                        filled = 0;
+                        if (!buffer) {
+                            continue;
                         }
-                        written += bytes_written_by_update; // Use actual bytes written
-                    } else if (c < 0) { // readBytes can return -1 on error/timeout for some stream types
-                        Serial.println("OtaManager: [_updateTaskRunner] stream->readBytes returned a negative value, indicating an error.");
-                        // Treat as a download error
-                        self->_setUpdateStatus(UpdateStatus::State::ERROR_HTTP_DOWNLOAD, "Stream read error during download");
-                         if (self->_dataMutex) { 
-                            if (xSemaphoreTake(self->_dataMutex, portMAX_DELAY) == pdTRUE) {
-                                self->_updateTaskHandle = NULL;
-                                xSemaphoreGive(self->_dataMutex);
-                            } else {
-                                Serial.println("ERROR: _updateTaskRunner (Stream Read Error) failed to take mutex!");
-                                self->_updateTaskHandle = NULL;
-                            }
-                        } else {
-                            Serial.println("ERROR: _updateTaskRunner (Stream Read Error) _dataMutex is NULL!");
-                            self->_updateTaskHandle = NULL;
+                    }
+
+                    size_t len = stream->available();
+                    if (len == 0) {
+                        if (!http.connected()) {
+                            break;
+                        }
+                        if (millis() - lastDataTime > OTA_READ_IDLE_TIMEOUT_MS) {
+                            Serial.printf("OtaManager: [_updateTaskRunner] No data for %lu ms.\n", OTA_READ_IDLE_TIMEOUT_MS);
+                            break;
                         }
-                        Update.abort();
-                        http.end();
-                        esp_task_wdt_delete(NULL);
-                        vTaskDelete(NULL);
-                        return;
-                    } // If c == 0, it means no data was available right now, loop will continue based on http.connected()
-                    
-                    int progress = (int)(((float)written / totalSize) * 100);
-                    // Update progress not too frequently to avoid flooding serial/logs
-                    if (progress > self->_currentStatus.progress && (millis() - lastProgressUpdate > 1000 || progress == 100)) {
+                        vTaskDelay(1); // Yield until more data arrives instead of spinning
+                        continue;
+                    }
+
+                    size_t toRead = OtaPipeline::BUFFER_SIZE - filled;
+                    if (toRead > len) toRead = len;
+                    if (toRead > totalSize - received) toRead = totalSize - received;
+
+                    int c = stream->read(buffer + filled, toRead);
+                    if (c < 0) {
+                        Serial.println("OtaManager: [_updateTaskRunner] stream->read returned a negative value, indicating an error.");
+                        readError = true;
+                        break;
+                    }
+                    filled += c;
+                    received += c;
+                    transferred += c;
+                    lastDataTime = millis();
+
+                    // Hand over full buffers, and the tail of the image
+                    if (filled == OtaPipeline::BUFFER_SIZE || received == totalSize) {
+                        pipeline.submit(buffer, filled);
+                        buffer = nullptr;
+                    }
+
+                    // Report progress at most once a second, based on what reached flash
+                    int progress = (int)(((float)pipeline.bytesCommitted() / totalSize) * 100);
+                    if (progress > lastProgress && millis() - lastProgressUpdate > OTA_PROGRESS_INTERVAL_MS) {
                         self->_setUpdateStatus(UpdateStatus::State::WRITING, "Writing firmware...", progress);
+                        lastProgress = progress;
                         lastProgressUpdate = millis();
                     }
                 }
-                delay(1); // Small delay to allow other tasks and prevent tight loop if stream is slow
+
+                if (received >= totalSize || pipeline.failed() || readError) {
+                    break;
+                }
+
+                // Connection dropped mid-image: keep what we have and ask for the rest
+                if (buffer) {
+                    if (filled > 0) {
+                        pipeline.submit(buffer, filled);
+                    } else {
+                        pipeline.release(buffer);
+                    }
+                    buffer = nullptr;
+                }
+                http.end();
+
+                stream = nullptr;
+                while (!stream && resumes < OTA_MAX_RESUMES) {
+                    resumes++;
+                    Serial.printf("OtaManager: [_updateTaskRunner] Connection lost at %u / %d bytes, resume %d/%d.\n",
+                                  received, totalSize, resumes, OTA_MAX_RESUMES);
+                    self->_setUpdateStatus(UpdateStatus::State::DOWNLOADING, "Connection lost, resuming download...");
+                    vTaskDelay(pdMS_TO_TICKS(OTA_RESUME_DELAY_MS));
+                    if (_waitForWiFi(OTA_RESUME_WIFI_TIMEOUT_MS)) {
+                        stream = self->_resumeDownload(http, downloadUrl, received, transferred);
+                    }
+                }
+                if (!stream) {
+                    break;
+                }
+                self->_setUpdateStatus(UpdateStatus::State::WRITING, "Writing firmware...");
+                lastDataTime = millis();
             }
 
-            if (written != totalSize) {
+            // Wait for the last buffer to reach flash; erasing a sector can take a while
+            bool flashed = pipeline.finish(pdMS_TO_TICKS(30000));
+            size_t written = pipeline.bytesCommitted();
+            unsigned long elapsed = millis() - downloadStart;
+            Serial.printf("OtaManager: [_updateTaskRunner] Wrote %u / %d bytes in %lu ms (%lu KB/s).\n",
+                          written, totalSize, elapsed, elapsed > 0 ? (unsigned long)(written / elapsed) : 0UL);
+            Serial.printf("OtaManager: [_updateTaskRunner] Transferred %u bytes for a %d byte image (%d resumes).\n",
+                          transferred, totalSize, resumes);
+
+            uint8_t imageDigest[32];
+            mbedtls_sha256_finish(&imageHash, imageDigest);
+            mbedtls_sha256_free(&imageHash);
+            if (hashed > 0) {
+                Serial.printf("OtaManager: [_updateTaskRunner] SHA-256 took %llu ms (%llu us per MB).\n",
+                              hashMicros / 1000, hashMicros * 1048576ULL / hashed);
+            }
+
+            if (!flashed) {
+                uint8_t update_error_code = Update.getError();
+                const char* update_error_cstr = Update.errorString();
+                Serial.printf("OtaManager: [_updateTaskRunner] Update Error: %s (%d)\n", update_error_cstr, update_error_code);
+                self->_setUpdateStatus(UpdateStatus::State::ERROR_UPDATE_WRITE, "Firmware write error: " + String(update_error_cstr));
+                Update.abort();
+            } else if (readError) {
+                self->_setUpdateStatus(UpdateStatus::State::ERROR_HTTP_DOWNLOAD, "Stream read error during download");
+                Update.abort();
+            } else if (written != totalSize) {
                 Serial.printf("OtaManager: [_updateTaskRunner] Update failed. Bytes written: %d / %d\n", written, totalSize);
                 self->_setUpdateStatus(UpdateStatus::State::ERROR_HTTP_DOWNLOAD, "Download incomplete.");
                 Update.abort();
+            } else if (hasExpectedSha256 && memcmp(imageDigest, expectedSha256, sizeof(imageDigest)) != 0) {
+                // Abort before Update.end() so the running firmware stays the boot partition
+                Serial.println("OtaManager: [_updateTaskRunner] SHA-256 mismatch, discarding image.");
+                self->_setUpdateStatus(UpdateStatus::State::ERROR_VERIFY, "Firmware failed SHA-256 verification.");
+                Update.abort();
+            } else if (resumes > 0 && !self->_verifyFlashedImage(written, imageHeader, imageDigest)) {
+                // A resumed download must line up exactly with what was already flashed
+                self->_setUpdateStatus(UpdateStatus::State::ERROR_UPDATE_END, "Flashed image does not match download.");
+                Update.abort();
             } else if (!Update.end(true)) { // true to set the boot partition
                 Serial.printf("OtaManager: [_updateTaskRunner] Error occurred during Update.end(): %u\n", Update.getError());
                 self->_setUpdateStatus(UpdateStatus::State::ERROR_UPDATE_END, "Finalizing update error: " + String(Update.errorString()));
@@ -862,8 +1075,7 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
             } else {
                 self->_setUpdateStatus(UpdateStatus::State::SUCCESS, "Update successful! Rebooting...", 100);
                 Serial.println("OtaManager: [_updateTaskRunner] Update successful. Rebooting...");
-                delay(1000); // Give a moment for serial message to get out
-                ESP.restart();
+                self->_restart();
             }
         } else {
             Serial.printf("OtaManager: [_updateTaskRunner] HTTP GET completed with code %d, but not HTTP_CODE_OK. Error: %s\n", httpCode, http.errorToString(httpCode).c_str());
@@ -879,17 +1091,12 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
     // If we reach here and haven't rebooted, it means an error occurred after starting or during HTTP connection.
     // Ensure task handle is cleared if not already done by an error path.
     // Also set status to IDLE if it was an in-progress state that failed silently.
+    bool endedSilently = false;
     if (self->_dataMutex) { // Check if mutex is valid before taking
         if (xSemaphoreTake(self->_dataMutex, portMAX_DELAY) == pdTRUE) {
-            if (self->_currentStatus.status != UpdateStatus::State::SUCCESS) { 
-                // If it was in progress but failed and didn't set a specific error state above
-                if(self->_currentStatus.status == UpdateStatus::State::DOWNLOADING || self->_currentStatus.status == UpdateStatus::State::WRITING || 
-                   self->_currentStatus.status == UpdateStatus::State::ERROR_HTTP_DOWNLOAD || // if previously set to this by this task
-                   self->_currentStatus.status == UpdateStatus::State::ERROR_UPDATE_WRITE || // if previously set to this by this task
-                   self->_currentStatus.status == UpdateStatus::State::ERROR_NO_SPACE) { // if previously set to this
-                     self->_setUpdateStatus(UpdateStatus::State::IDLE, "Update failed or ended prematurely"); 
-                }
-            }
+            // Specific error states set above are left in place so the portal can show them
+            endedSilently = self->_currentStatus.status == UpdateStatus::State::DOWNLOADING ||
+                            self->_currentStatus.status == UpdateStatus::State::WRITING;
             self->_updateTaskHandle = NULL;
             xSemaphoreGive(self->_dataMutex);
         } else {
@@ -900,7 +1107,308 @@ void OtaManager::_updateTaskRunner(void* pvParameters) {
         Serial.println("ERROR: _updateTaskRunner (End Task) _dataMutex is NULL!");
         self->_updateTaskHandle = NULL; // Attempt to clear handle anyway
     }
+    if (endedSilently) {
+        // _setUpdateStatus takes the mutex itself, so only call it once released
+        self->_setUpdateStatus(UpdateStatus::State::IDLE, "Update failed or ended prematurely");
+    }
 
     esp_task_wdt_delete(NULL); // Remove current task from WDT
-    vTaskDelete(NULL);
+    ResourceMonitor::deleteTask(NULL);
+}
+
+bool OtaManager::_waitForWiFi(unsigned long timeoutMs) {
+    unsigned long start = millis();
+    while (WiFi.status() != WL_CONNECTED) {
+        if (millis() - start > timeoutMs) {
+            Serial.println("OtaManager: [_waitForWiFi] WiFi did not come back.");
+            return false;
+        }
+        esp_task_wdt_reset();
+        vTaskDelay(pdMS_TO_TICKS(500));
+    }
+    return true;
+}
+
+WiFiClient* OtaManager::_resumeDownload(HTTPClient& http, const String& url, size_t offset, size_t& transferred) {
+    const char* headerKeys[] = { "Content-Range" };
+
+    http.begin(url, _githubApiRootCa);
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    http.setConnectTimeout(10000);
+    http.setTimeout(180000);
+    http.addHeader("Range", "bytes=" + String(offset) + "-");
+    http.collectHeaders(headerKeys, 1);
+
+    int httpCode = http.GET();
+    Serial.printf("OtaManager: [_resumeDownload] Range request from %u returned %d\n", offset, httpCode);
+
+    if (httpCode == HTTP_CODE_PARTIAL_CONTENT) {
+        // "bytes <start>-<end>/<total>"
+        String contentRange = http.header("Content-Range");
+        int dash = contentRange.indexOf('-');
+        long start = (contentRange.startsWith("bytes ") && dash > 6) ? contentRange.substring(6, dash).toInt() : -1;
+        if (start == (long)offset) {
+            return http.getStreamPtr();
+        }
+        Serial.printf("OtaManager: [_resumeDownload] Unexpected Content-Range '%s'\n", contentRange.c_str());
+    } else if (httpCode == HTTP_CODE_OK) {
+        // Server ignored the range: skip what is already flashed
+        WiFiClient* stream = http.getStreamPtr();
+        uint8_t discard[512];
+        size_t skipped = 0;
+        unsigned long lastDataTime = millis();
+        while (skipped < offset && millis() - lastDataTime < OTA_READ_IDLE_TIMEOUT_MS) {
+            esp_task_wdt_reset();
+            size_t toRead = min(sizeof(discard), offset - skipped);
+            int c = stream->read(discard, toRead);
+            if (c > 0) {
+                skipped += c;
+                transferred += c;
+                lastDataTime = millis();
+            } else if (!http.connected()) {
+                break;
+            } else {
+                vTaskDelay(1);
+            }
+        }
+        if (skipped == offset) {
+            return stream;
+        }
+    }
+
+    http.end();
+    return nullptr;
+}
+
+bool OtaManager::_verifyFlashedImage(size_t size, const uint8_t* header, const uint8_t expectedDigest[32]) {
+    const esp_partition_t* partition = esp_ota_get_next_update_partition(NULL);
+    uint8_t* chunk = (uint8_t*)malloc(OTA_VERIFY_CHUNK_SIZE);
+    if (!partition || !chunk) {
+        free(chunk);
+        return false;
+    }
+
+    // Read back what is in flash. The first bytes are still held by Update
+    // until end(), so hash the copy taken on the way in for those.
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+
+    size_t headerBytes = min(size, OTA_DEFERRED_HEADER_BYTES);
+    mbedtls_sha256_update(&ctx, header, headerBytes);
+
+    bool readOk = true;
+    for (size_t offset = headerBytes; offset < size; ) {
+        size_t length = min(OTA_VERIFY_CHUNK_SIZE, size - offset);
+        if (esp_partition_read(partition, offset, chunk, length) != ESP_OK) {
+            readOk = false;
+            break;
+        }
+        mbedtls_sha256_update(&ctx, chunk, length);
+        offset += length;
+        esp_task_wdt_reset();
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&ctx, digest);
+    mbedtls_sha256_free(&ctx);
+    free(chunk);
+
+    bool match = readOk && memcmp(digest, expectedDigest, sizeof(digest)) == 0;
+    Serial.printf("OtaManager: [_verifyFlashedImage] %u bytes read back: %s\n", size, match ? "match" : "MISMATCH");
+    return match;
+}
+
+bool OtaManager::_applyDeltaUpdate(const String& patchUrl, const uint8_t* expectedSha256) {
+    Serial.printf("OtaManager: [_applyDeltaUpdate] Trying delta patch: %s\n", patchUrl.c_str());
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    if (!running) {
+        return false;
+    }
+
+    HTTPClient http;
+    http.begin(patchUrl, _githubApiRootCa);
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    http.setConnectTimeout(10000);
+    http.setTimeout(180000);
+
+    int httpCode = http.GET();
+    int patchSize = http.getSize();
+    if (httpCode != HTTP_CODE_OK || patchSize <= 0) {
+        Serial.printf("OtaManager: [_applyDeltaUpdate] Patch download failed: %d\n", httpCode);
+        http.end();
+        return false;
+    }
+    _setUpdateStatus(UpdateStatus::State::DOWNLOADING, "Downloading patch...", 0);
+
+    mbedtls_sha256_context imageHash;
+    mbedtls_sha256_init(&imageHash);
+    mbedtls_sha256_starts(&imageHash, 0);
+
+    OtaPipeline pipeline([&](const uint8_t* data, size_t length) {
+        size_t written = Update.write(const_cast<uint8_t*>(data), length);
+        mbedtls_sha256_update(&imageHash, data, written);
+        return written;
+    });
+
+    uint8_t* buffer = nullptr;
+    size_t filled = 0;
+    bool updateStarted = false;
+
+    OtaDeltaPatch patch(
+        // COPY ops read the running image straight from its partition
+        [running](size_t offset, uint8_t* out, size_t length) {
+            return esp_partition_read(running, offset, out, length) == ESP_OK;
+        },
+        // Rebuilt image bytes are packed into pipeline buffers like a normal download
+        [&](const uint8_t* data, size_t length) {
+            while (length > 0) {
+                if (!buffer) {
+                    buffer = pipeline.acquireBuffer(pdMS_TO_TICKS(OTA_READ_IDLE_TIMEOUT_MS));
+                    filled = 0;
+                    if (!buffer) {
+                        return false;
+                    }
+                }
+                size_t n = min(length, OtaPipeline::BUFFER_SIZE - filled);
+                memcpy(buffer + filled, data, n);
+                filled += n;
+                data += n;
+                length -= n;
+                if (filled == OtaPipeline::BUFFER_SIZE) {
+                    pipeline.submit(buffer, filled);
+                    buffer = nullptr;
+                }
+            }
+            return !pipeline.failed();
+        },
+        [&](const OtaDeltaPatch::Header& header) {
+            if (expectedSha256 && memcmp(header.newSha256, expectedSha256, 32) != 0) {
+                Serial.println("OtaManager: [_applyDeltaUpdate] Patch targets a different image than the release.");
+                return false;
+            }
+            if (header.oldSize > running->size || !_runningImageMatches(header.oldSize, header.oldSha256)) {
+                Serial.println("OtaManager: [_applyDeltaUpdate] Patch was made for a different running image.");
+                return false;
+            }
+            if (!pipeline.begin() || !Update.begin(header.newSize, U_FLASH)) {
+                Serial.printf("OtaManager: [_applyDeltaUpdate] Could not start update: %s\n", Update.errorString());
+                return false;
+            }
+            updateStarted = true;
+            _setUpdateStatus(UpdateStatus::State::WRITING, "Applying patch...", 0);
+            return true;
+        });
+
+    WiFiClient* stream = http.getStreamPtr();
+    uint8_t chunk[OTA_PATCH_READ_SIZE];
+    size_t transferred = 0;
+    int lastProgress = 0;
+    unsigned long lastProgressUpdate = millis();
+    unsigned long lastDataTime = millis();
+    unsigned long start = millis();
+
+    while (transferred < (size_t)patchSize && !patch.hasError()) {
+        esp_task_wdt_reset();
+
+        size_t len = stream->available();
+        if (len == 0) {
+            // No resume for patches: a dropped connection falls back to the full image
+            if (!http.connected() || millis() - lastDataTime > OTA_READ_IDLE_TIMEOUT_MS) {
+                break;
+            }
+            vTaskDelay(1);
+            continue;
+        }
+
+        int c = stream->read(chunk, min(len, sizeof(chunk)));
+        if (c <= 0) {
+            break;
+        }
+        transferred += c;
+        lastDataTime = millis();
+        patch.feed(chunk, c);
+
+        if (updateStarted) {
+            int progress = (int)(((float)patch.bytesProduced() / patch.header().newSize) * 100);
+            if (progress > lastProgress && millis() - lastProgressUpdate > OTA_PROGRESS_INTERVAL_MS) {
+                _setUpdateStatus(UpdateStatus::State::WRITING, "Applying patch...", progress);
+                lastProgress = progress;
+                lastProgressUpdate = millis();
+            }
+        }
+    }
+    http.end();
+
+    if (buffer) {
+        if (filled > 0 && patch.isComplete()) {
+            pipeline.submit(buffer, filled);
+        } else {
+            pipeline.release(buffer);
+        }
+        buffer = nullptr;
+    }
+    bool flashed = pipeline.finish(pdMS_TO_TICKS(30000));
+
+    uint8_t imageDigest[32];
+    mbedtls_sha256_finish(&imageHash, imageDigest);
+    mbedtls_sha256_free(&imageHash);
+
+    const OtaDeltaPatch::Header& header = patch.header();
+    Serial.printf("OtaManager: [_applyDeltaUpdate] Transferred %u patch bytes for a %u byte image in %lu ms.\n",
+                  transferred, header.newSize, millis() - start);
+
+    bool applied = false;
+    if (!updateStarted) {
+        // Rejected before anything was written
+    } else if (!patch.isComplete() || !flashed || pipeline.bytesCommitted() != header.newSize) {
+        Serial.printf("OtaManager: [_applyDeltaUpdate] Patch incomplete: %s\n", patch.hasError() ? patch.error() : "connection lost");
+    } else if (memcmp(imageDigest, header.newSha256, sizeof(imageDigest)) != 0) {
+        Serial.println("OtaManager: [_applyDeltaUpdate] Rebuilt image failed SHA-256 verification.");
+    } else if (!Update.end(true)) {
+        Serial.printf("OtaManager: [_applyDeltaUpdate] Update.end() failed: %s\n", Update.errorString());
+    } else {
+        applied = true;
+    }
+
+    if (updateStarted && !applied) {
+        Update.abort();
+    }
+    return applied;
+}
+
+bool OtaManager::_runningImageMatches(size_t size, const uint8_t expectedDigest[32]) {
+    const esp_partition_t* partition = esp_ota_get_running_partition();
+    uint8_t* chunk = (uint8_t*)malloc(OTA_VERIFY_CHUNK_SIZE);
+    if (!partition || !chunk) {
+        free(chunk);
+        return false;
+    }
+
+    unsigned long start = millis();
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+
+    bool readOk = true;
+    for (size_t offset = 0; offset < size; ) {
+        size_t length = min(OTA_VERIFY_CHUNK_SIZE, size - offset);
+        if (esp_partition_read(partition, offset, chunk, length) != ESP_OK) {
+            readOk = false;
+            break;
+        }
+        mbedtls_sha256_update(&ctx, chunk, length);
+        offset += length;
+        esp_task_wdt_reset();
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&ctx, digest);
+    mbedtls_sha256_free(&ctx);
+    free(chunk);
+
+    bool match = readOk && memcmp(digest, expectedDigest, sizeof(digest)) == 0;
+    Serial.printf("OtaManager: [_runningImageMatches] Hashed %u bytes of %s in %lu ms: %s\n",
+                  size, partition->label, millis() - start, match ? "match" : "MISMATCH");
+    return match;
 }
@@ -4,6 +4,8 @@
 #include <ArduinoJson.h> // For potential JSON parsing within the manager
 #include <HTTPClient.h>     // Required for making HTTP requests
 #include "esp_heap_caps.h"   // For heap_caps_malloc_extmem_enable
+#include <functional>
+#include <atomic>
 
 // FreeRTOS for task management
 #include "freertos/FreeRTOS.h"
@@ -23,6 +25,8 @@ struct UpdateInfo {
     String availableVersion = "";
     String downloadUrl = "";
     String releaseNotes = ""; // Optional
+    String sha256 = ""; // Hex digest of the firmware asset, from the release metadata (empty if not published)
+    String patchUrl = ""; // Delta patch from the running version to this release (empty if not published)
     String error = ""; // Store error messages
 };
 
@@ -44,7 +48,8 @@ struct UpdateStatus {
         ERROR_NO_ASSET,
         ERROR_NO_SPACE,
         MUTEX_BUSY,      // New state: OTA manager mutex was contended
-        ERROR_INTERNAL   // New state: Internal error (e.g. mutex not initialized)
+        ERROR_INTERNAL,  // New state: Internal error (e.g. mutex not initialized)
+        ERROR_VERIFY     // Downloaded image did not match the published SHA-256
     };
 
     State status = State::IDLE;
@@ -54,6 +59,9 @@ struct UpdateStatus {
 
 class OtaManager {
 public:
+    static const uint32_t CHECK_TASK_STACK_SIZE = 8192;    ///< Bytes for the update check task (TLS)
+    static const uint32_t UPDATE_TASK_STACK_SIZE = 12288;  ///< Bytes for the update task (TLS and flashing)
+
     /**
      * @brief Constructor
      * @param currentVersion The firmware version currently running.
@@ -74,9 +82,13 @@ public:
      * This function initiates the download and flashing process.
      * It should ideally run asynchronously (e.g., in a task) and update status internally.
      * @param downloadUrl The direct HTTPS URL to the firmware .bin file.
+     * @param expectedSha256 Hex SHA-256 of the image (UpdateInfo::sha256). The image is
+     *        hashed while it is written and only activated if it matches. Empty skips the check.
+     * @param patchUrl Optional delta patch (UpdateInfo::patchUrl). It is tried first and the
+     *        full image at downloadUrl is used if the patch is missing, stale or fails.
      * @return true if the update process was successfully initiated, false otherwise (e.g., update already in progress, invalid URL).
      */
-    bool beginUpdate(const String& downloadUrl);
+    bool beginUpdate(const String& downloadUrl, const String& expectedSha256 = "", const String& patchUrl = "");
 
     /**
      * @brief Get the current status of the OTA process.
@@ -87,6 +99,12 @@ public:
 
     UpdateInfo getLastCheckResult(); // Added to retrieve the result of the last check
 
+    /**
+     * @brief Counter bumped whenever the status or last check result changes
+     * Lets pollers such as the portal skip rebuilding unchanged OTA state.
+     */
+    uint32_t getStatusVersion() const { return _statusVersion.load(); }
+
     /**
       * @brief Process loop for the OtaManager.
       * Should be called periodically to handle asynchronous operations like download/write.
@@ -94,6 +112,13 @@ public:
       */
     void process(); // Optional, depending on async approach
 
+    /**
+     * @brief Register work that must finish before a successful update reboots the device
+     * @param hook Called from the update task just before ESP.restart(), e.g. to flush
+     *        deferred configuration writes
+     */
+    void setBeforeRestart(std::function<void()> hook) { _beforeRestart = hook; }
+
 private:
     String _currentVersion;
     String _repoOwner;
@@ -156,8 +181,10 @@ private:
     TaskHandle_t _checkTaskHandle;
     TaskHandle_t _updateTaskHandle;
     bool _timeSynced = false;
+    std::function<void()> _beforeRestart;
 
     SemaphoreHandle_t _dataMutex; // Mutex for _currentStatus and _lastCheckResult
+    std::atomic<uint32_t> _statusVersion{0}; // Bumped with each write to _currentStatus or _lastCheckResult
 
     // Static task runners
     static void _checkUpdateTaskRunner(void* pvParameters);
@@ -165,9 +192,19 @@ private:
 
     // Private helper method prototypes
     void _setUpdateStatus(UpdateStatus::State state, const String& message, int progress = -1);
+    void _restart();
     String _performHttpsRequest(const char* url, const char* rootCa);
     UpdateInfo _parseGithubApiResponse(const String& jsonPayload);
     bool _ensureTimeSynced(); // Added for NTP
 
+    // Resuming interrupted downloads
+    static bool _waitForWiFi(unsigned long timeoutMs);
+    WiFiClient* _resumeDownload(HTTPClient& http, const String& url, size_t offset, size_t& transferred);
+    bool _verifyFlashedImage(size_t size, const uint8_t* header, const uint8_t expectedDigest[32]);
+
+    // Delta updates: rebuild the new image from the running one plus a patch
+    bool _applyDeltaUpdate(const String& patchUrl, const uint8_t* expectedSha256);
+    bool _runningImageMatches(size_t size, const uint8_t expectedDigest[32]);
+
     // void _performUpdate(String url); // Function to run in a task
 }; 
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include "OtaPipeline.h"
+#include "esp_heap_caps.h"
+#include "ResourceMonitor.h"
+
+OtaPipeline::OtaPipeline(Sink sink)
+    : _sink(sink),
+      _freeQueue(nullptr),
+      _filledQueue(nullptr),
+      _writerDone(nullptr),
+      _writerTask(nullptr),
+      _failed(false),
+      _committed(0) {
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        _buffers[i] = nullptr;
+    }
+}
+
+OtaPipeline::~OtaPipeline() {
+    stopWriter(pdMS_TO_TICKS(5000));
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        if (_buffers[i]) {
+            heap_caps_free(_buffers[i]);
+            _buffers[i] = nullptr;
+        }
+    }
+    if (_freeQueue) vQueueDelete(_freeQueue);
+    if (_filledQueue) vQueueDelete(_filledQueue);
+    if (_writerDone) vSemaphoreDelete(_writerDone);
+}
+
+bool OtaPipeline::begin() {
+    _freeQueue = xQueueCreate(BUFFER_COUNT, sizeof(uint8_t));
+    // One extra slot so the stop marker always fits
+    _filledQueue = xQueueCreate(BUFFER_COUNT + 1, sizeof(Chunk));
+    _writerDone = xSemaphoreCreateBinary();
+    if (!_freeQueue || !_filledQueue || !_writerDone) {
+        Serial.println("OtaPipeline: Failed to create queues.");
+        return false;
+    }
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        _buffers[i] = (uint8_t*)heap_caps_malloc(BUFFER_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!_buffers[i]) {
+            // No PSRAM: internal RAM still beats stalling the socket
+            _buffers[i] = (uint8_t*)heap_caps_malloc(BUFFER_SIZE, MALLOC_CAP_8BIT);
+        }
+        if (!_buffers[i]) {
+            Serial.printf("OtaPipeline: Failed to allocate %u byte buffer.\n", (unsigned)BUFFER_SIZE);
+            return false;
+        }
+        uint8_t index = i;
+        xQueueSend(_freeQueue, &index, 0);
+    }
+
+    if (ResourceMonitor::createTask(
+            writerTask,
+            "otaFlashTask",
+            WRITER_TASK_STACK_SIZE,
+            this,
+            1,              // Mostly blocked on flash; let the UI preempt it
+            &_writerTask,
+            1               // Opposite core to the network stack
+        ) != pdPASS) {
+        Serial.println("OtaPipeline: Failed to create writer task.");
+        _writerTask = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+uint8_t* OtaPipeline::acquireBuffer(TickType_t timeout) {
+    uint8_t index;
+    if (xQueueReceive(_freeQueue, &index, timeout) != pdPASS) {
+        return nullptr;
+    }
+    return _buffers[index];
+}
+
+bool OtaPipeline::submit(uint8_t* buffer, size_t length) {
+    int index = indexOf(buffer);
+    if (index < 0 || length == 0 || length > BUFFER_SIZE) {
+        return false;
+    }
+
+    Chunk chunk = { (uint8_t)index, (uint32_t)length };
+    // Never blocks: there are only BUFFER_COUNT buffers to submit
+    return xQueueSend(_filledQueue, &chunk, portMAX_DELAY) == pdPASS;
+}
+
+void OtaPipeline::release(uint8_t* buffer) {
+    int index = indexOf(buffer);
+    if (index >= 0) {
+        uint8_t freeIndex = index;
+        xQueueSend(_freeQueue, &freeIndex, 0);
+    }
+}
+
+bool OtaPipeline::finish(TickType_t timeout) {
+    stopWriter(timeout);
+    return !_failed;
+}
+
+void OtaPipeline::stopWriter(TickType_t timeout) {
+    if (!_writerTask) {
+        return;
+    }
+
+    Chunk stop = { 0, 0 };
+    xQueueSend(_filledQueue, &stop, portMAX_DELAY);
+    if (xSemaphoreTake(_writerDone, timeout) != pdTRUE) {
+        // Deleting the task mid-write would leave Update with a half-written
+        // sector. Have it skip what is still queued, and wait for the write in
+        // progress to return before the caller calls Update.abort().
+        Serial.println("OtaPipeline: Writer did not drain in time, aborting.");
+        _failed = true;
+        xSemaphoreTake(_writerDone, portMAX_DELAY);
+        Serial.println("OtaPipeline: Writer stopped.");
+    }
+    _writerTask = nullptr;
+}
+
+int OtaPipeline::indexOf(const uint8_t* buffer) const {
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        if (_buffers[i] == buffer) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void OtaPipeline::writerTask(void* parameter) {
+    static_cast<OtaPipeline*>(parameter)->runWriter();
+    ResourceMonitor::deleteTask(NULL);
+}
+
+void OtaPipeline::runWriter() {
+    Chunk chunk;
+    while (xQueueReceive(_filledQueue, &chunk, portMAX_DELAY) == pdPASS && chunk.length > 0) {
+        if (!_failed) {
+            size_t written = _sink(_buffers[chunk.index], chunk.length);
+            if (written != chunk.length) {
+                Serial.printf("OtaPipeline: Sink accepted %u of %u bytes.\n", (unsigned)written, (unsigned)chunk.length);
+                _failed = true;
+            } else {
+                _committed += written;
+            }
+        }
+        xQueueSend(_freeQueue, &chunk.index, portMAX_DELAY);
+    }
+    xSemaphoreGive(_writerDone);
+}
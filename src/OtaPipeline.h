@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include <freertos/semphr.h>
+
+/**
+ * @class OtaPipeline
+ * @brief Double-buffered hand-off between a network reader and a flash writer
+ *
+ * The reader fills large PSRAM buffers and submits them; a dedicated writer
+ * task passes each one to the sink (Update.write on device) and hands the
+ * buffer back. While one buffer is being committed to flash the next one is
+ * filling from the socket, so receive and erase/write overlap.
+ *
+ * Buffers are handed over in order, so the sink sees the image sequentially.
+ * After the sink fails once, later buffers are returned without being written.
+ */
+class OtaPipeline {
+public:
+    /**
+     * @brief Consumes one buffer; returns the number of bytes accepted
+     */
+    using Sink = std::function<size_t(const uint8_t* data, size_t length)>;
+
+    static const size_t BUFFER_COUNT = 2;           ///< One filling, one writing
+    static const size_t BUFFER_SIZE = 32 * 1024;    ///< Multiple of the 4 KB flash sector
+    static const uint32_t WRITER_TASK_STACK_SIZE = 4096;  ///< Bytes for the flash writer task
+
+    /**
+     * @brief Constructor
+     * @param sink Called from the writer task for every submitted buffer
+     */
+    explicit OtaPipeline(Sink sink);
+    ~OtaPipeline();
+
+    /**
+     * @brief Allocate the buffers and start the writer task
+     * @return false if memory or the task could not be obtained
+     */
+    bool begin();
+
+    /**
+     * @brief Get an empty buffer of BUFFER_SIZE bytes to fill
+     * @param timeout How long to wait for the writer to return one
+     * @return Buffer, or nullptr on timeout
+     */
+    uint8_t* acquireBuffer(TickType_t timeout);
+
+    /**
+     * @brief Queue a filled buffer (from acquireBuffer) for writing
+     * @param buffer Buffer to write
+     * @param length Bytes used, at most BUFFER_SIZE
+     */
+    bool submit(uint8_t* buffer, size_t length);
+
+    /**
+     * @brief Give back an acquired buffer without writing it
+     */
+    void release(uint8_t* buffer);
+
+    /**
+     * @brief Wait for all submitted buffers to be written and stop the writer
+     *
+     * If the writer has not drained by the timeout, buffers still queued are
+     * dropped and this waits for the write in progress to return, so the sink
+     * is idle by the time it returns false.
+     * @param timeout How long to wait for the writer to drain
+     * @return true if every buffer was written in full
+     */
+    bool finish(TickType_t timeout);
+
+    bool failed() const { return _failed; }
+    size_t bytesCommitted() const { return _committed; }
+
+private:
+    struct Chunk {
+        uint8_t index;
+        uint32_t length;   ///< 0 tells the writer to stop
+    };
+
+    static void writerTask(void* parameter);
+    void runWriter();
+    void stopWriter(TickType_t timeout);
+    int indexOf(const uint8_t* buffer) const;
+
+    Sink _sink;
+    uint8_t* _buffers[BUFFER_COUNT];
+    QueueHandle_t _freeQueue;     ///< Indexes of buffers ready to fill
+    QueueHandle_t _filledQueue;   ///< Chunks waiting to be written
+    SemaphoreHandle_t _writerDone;
+    TaskHandle_t _writerTask;
+    std::atomic<bool> _failed;
+    std::atomic<size_t> _committed;
+};
@@ -0,0 +1,229 @@
+#include "ResourceMonitor.h"
+#include "Metrics.h"
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+ResourceMonitor::RegisteredTask ResourceMonitor::_registered[MAX_TASKS];
+size_t ResourceMonitor::_registeredCount = 0;
+
+ResourceMonitor::ResourceMonitor()
+    : _taskCount(0),
+      _heap{},
+      _heapWarned(false),
+      _taskHandle(nullptr) {
+}
+
+void ResourceMonitor::watchTask(const char* name, uint32_t stackSize) {
+    if (_taskCount >= MAX_TASKS) {
+        Serial.printf("ResourceMonitor: Too many tasks, not watching %s\n", name);
+        return;
+    }
+    TaskSample& task = _tasks[_taskCount++];
+    task.name = name;
+    task.stackSize = stackSize;
+    task.freeMin = -1;
+    task.warned = false;
+    task.series = Metrics::taskStackFreeMin.addSeries(name);
+}
+
+uint32_t ResourceMonitor::suggestStackSize(const TaskSample& task) {
+    if (task.freeMin < 0) {
+        return 0;
+    }
+    uint32_t used = task.stackSize - (uint32_t)task.freeMin;
+    uint32_t headroom = used / 4;
+    if (headroom < 512) {
+        headroom = 512;
+    }
+    return ((used + headroom + 511) / 512) * 512;
+}
+
+void ResourceMonitor::printReport(Print& out) const {
+    formatReport(out, _tasks, _taskCount, _heap);
+}
+
+void ResourceMonitor::formatReport(Print& out, const TaskSample* tasks, size_t count, const HeapSample& heap) {
+    out.println("ResourceMonitor: task              stack   peak   free  suggest");
+    for (size_t i = 0; i < count; i++) {
+        const TaskSample& task = tasks[i];
+        if (task.freeMin < 0) {
+            out.printf("ResourceMonitor: %-16s %6u      -      -        -  (not seen)\n",
+                       task.name, (unsigned)task.stackSize);
+            continue;
+        }
+        uint32_t suggested = suggestStackSize(task);
+        out.printf("ResourceMonitor: %-16s %6u %6u %6d %8u%s\n",
+                   task.name, (unsigned)task.stackSize,
+                   (unsigned)(task.stackSize - task.freeMin), (int)task.freeMin,
+                   (unsigned)suggested,
+                   (uint32_t)task.freeMin < STACK_WARN_BYTES ? "  LOW" :
+                   suggested < task.stackSize ? "  oversized" : "");
+    }
+    out.printf("ResourceMonitor: internal heap free %u, min %u, largest block %u\n",
+               (unsigned)heap.internalFree, (unsigned)heap.internalFreeMin, (unsigned)heap.internalLargest);
+    out.printf("ResourceMonitor: PSRAM free %u, min %u, largest block %u\n",
+               (unsigned)heap.psramFree, (unsigned)heap.psramFreeMin, (unsigned)heap.psramLargest);
+}
+
+SemaphoreHandle_t ResourceMonitor::registryMutex() {
+    // Created on first use; the first tasks are started from setup() before any of them run
+    static SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+    return mutex;
+}
+
+TaskHandle_t ResourceMonitor::findRegistered(const char* name) {
+    for (size_t i = _registeredCount; i > 0; i--) {
+        if (strncmp(_registered[i - 1].name, name, TASK_NAME_LEN) == 0) {
+            return _registered[i - 1].handle;
+        }
+    }
+    return nullptr;
+}
+
+void ResourceMonitor::startTask(void* parameter) {
+    TaskStart start = *static_cast<TaskStart*>(parameter);
+    delete static_cast<TaskStart*>(parameter);
+
+    // Wait until createTask() has registered us, so the caller's handle is
+    // read before the task body can change it or delete itself
+    xSemaphoreTake(registryMutex(), portMAX_DELAY);
+    xSemaphoreGive(registryMutex());
+
+    start.function(start.parameter);
+}
+
+BaseType_t ResourceMonitor::createTask(TaskFunction_t function, const char* name, uint32_t stackSize,
+                                       void* parameter, UBaseType_t priority, TaskHandle_t* handle,
+                                       BaseType_t core) {
+    TaskStart* start = new TaskStart{ function, parameter };
+    // Callers' handles are filled in before the task first runs, as with xTaskCreate
+    TaskHandle_t local = nullptr;
+    TaskHandle_t* out = handle ? handle : &local;
+
+    xSemaphoreTake(registryMutex(), portMAX_DELAY);
+    BaseType_t result = xTaskCreatePinnedToCore(startTask, name, stackSize, start, priority, out, core);
+    if (result == pdPASS) {
+        if (_registeredCount < MAX_TASKS) {
+            RegisteredTask& task = _registered[_registeredCount++];
+            strncpy(task.name, name, TASK_NAME_LEN - 1);
+            task.name[TASK_NAME_LEN - 1] = '\0';
+            task.handle = *out;
+        } else {
+            Serial.printf("ResourceMonitor: Registry full, not sampling %s\n", name);
+        }
+    } else {
+        delete start;
+    }
+    xSemaphoreGive(registryMutex());
+    return result;
+}
+
+void ResourceMonitor::deleteTask(TaskHandle_t handle) {
+    TaskHandle_t target = handle ? handle : xTaskGetCurrentTaskHandle();
+    xSemaphoreTake(registryMutex(), portMAX_DELAY);
+    for (size_t i = 0; i < _registeredCount; i++) {
+        if (_registered[i].handle == target) {
+            // Keep creation order, so findRegistered() prefers the newest of a name
+            for (size_t j = i + 1; j < _registeredCount; j++) {
+                _registered[j - 1] = _registered[j];
+            }
+            _registeredCount--;
+            break;
+        }
+    }
+    xSemaphoreGive(registryMutex());
+
+    vTaskDelete(handle);
+}
+
+bool ResourceMonitor::isRegistered(const char* name) {
+    xSemaphoreTake(registryMutex(), portMAX_DELAY);
+    bool found = findRegistered(name) != nullptr;
+    xSemaphoreGive(registryMutex());
+    return found;
+}
+
+#ifdef ESP_PLATFORM
+
+void ResourceMonitor::begin() {
+    if (_taskHandle) {
+        return;
+    }
+    watchTask("resMonitor", MONITOR_STACK_SIZE);
+
+    createTask(
+        monitorTask,
+        "resMonitor",
+        MONITOR_STACK_SIZE,
+        this,
+        1,
+        &_taskHandle,
+        0
+    );
+}
+
+void ResourceMonitor::sample() {
+    for (size_t i = 0; i < _taskCount; i++) {
+        TaskSample& task = _tasks[i];
+
+        // Held while the stack is read, so the task cannot be deleted under us
+        xSemaphoreTake(registryMutex(), portMAX_DELAY);
+        TaskHandle_t handle = findRegistered(task.name);
+        // ESP-IDF measures stacks in bytes, not words
+        int32_t free = handle ? (int32_t)uxTaskGetStackHighWaterMark(handle) : -1;
+        xSemaphoreGive(registryMutex());
+        if (free < 0) {
+            continue; // Not running right now
+        }
+
+        if (task.freeMin < 0 || free < task.freeMin) {
+            task.freeMin = free;
+            Metrics::taskStackFreeMin.set(task.series, free);
+        }
+
+        if (!task.warned && (uint32_t)task.freeMin < STACK_WARN_BYTES) {
+            task.warned = true;
+            Serial.printf("ResourceMonitor: WARNING %s has come within %d bytes of its %u byte stack\n",
+                          task.name, (int)task.freeMin, (unsigned)task.stackSize);
+        }
+    }
+
+    _heap.internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    _heap.internalFreeMin = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    _heap.internalLargest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    _heap.psramFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    _heap.psramFreeMin = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+    _heap.psramLargest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+
+    Metrics::heapFreeMin.lowerTo(_heap.internalFreeMin);
+    Metrics::heapLargestBlock.set(_heap.internalLargest);
+    Metrics::psramFreeMin.lowerTo(_heap.psramFreeMin);
+    Metrics::psramLargestBlock.set(_heap.psramLargest);
+
+    if (!_heapWarned && _heap.internalFreeMin < HEAP_WARN_BYTES) {
+        _heapWarned = true;
+        Serial.printf("ResourceMonitor: WARNING internal heap has dropped to %u bytes free (largest block %u)\n",
+                      (unsigned)_heap.internalFreeMin, (unsigned)_heap.internalLargest);
+    }
+}
+
+void ResourceMonitor::monitorTask(void* parameter) {
+    ResourceMonitor* self = static_cast<ResourceMonitor*>(parameter);
+    uint32_t nextReport = millis() + FIRST_REPORT_MS;
+
+    while (1) {
+        self->sample();
+
+        if ((int32_t)(millis() - nextReport) >= 0) {
+            self->printReport(Serial);
+            nextReport = millis() + REPORT_INTERVAL_MS;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(SAMPLE_INTERVAL_MS));
+    }
+}
+
+#endif
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+/**
+ * @class ResourceMonitor
+ * @brief Samples task stack high-water marks and heap minimums in the background
+ *
+ * Tasks are watched by name together with the stack size they were created
+ * with, since FreeRTOS does not keep the latter. Tasks are created and
+ * deleted through createTask()/deleteTask(), which keep a registry of live
+ * handles; the monitor samples only registered tasks, under the registry
+ * lock, so it never reads the stack of a task that is being deleted. Tasks
+ * that are not running when a sample is taken (OTA workers, for instance)
+ * are simply skipped.
+ *
+ * Every sample feeds Metrics (task_stack_free_min_bytes, heap and PSRAM
+ * gauges) and logs a warning the first time a task's untouched stack or the
+ * internal heap drops below its threshold. A right-sizing report suggesting
+ * stack sizes from the observed peaks is logged a minute after boot and
+ * periodically after that.
+ */
+class ResourceMonitor {
+public:
+    static const size_t MAX_TASKS = 16;
+    static const uint32_t SAMPLE_INTERVAL_MS = 5000;
+    static const uint32_t FIRST_REPORT_MS = 60000;      ///< Let startup, WiFi and the first fetches run first
+    static const uint32_t REPORT_INTERVAL_MS = 600000;
+    static const uint32_t STACK_WARN_BYTES = 512;       ///< Warn when a task has ever come this close to overflowing
+    static const uint32_t HEAP_WARN_BYTES = 16384;      ///< Warn when internal heap has dropped this low
+    static const uint32_t MONITOR_STACK_SIZE = 3072;
+    static const size_t TASK_NAME_LEN = 16;             ///< configMAX_TASK_NAME_LEN on the ESP32
+
+    struct TaskSample {
+        const char* name;
+        uint32_t stackSize;     ///< Bytes the task was created with
+        int32_t freeMin;        ///< Lowest free stack seen, or -1 if never seen running
+        bool warned;
+        int series;             ///< Index in Metrics::taskStackFreeMin
+    };
+
+    struct HeapSample {
+        uint32_t internalFree;
+        uint32_t internalFreeMin;
+        uint32_t internalLargest;
+        uint32_t psramFree;
+        uint32_t psramFreeMin;
+        uint32_t psramLargest;
+    };
+
+    ResourceMonitor();
+
+    /**
+     * @brief Watch a task; call before begin()
+     * @param name Task name as passed to xTaskCreate (must stay valid)
+     * @param stackSize Stack size in bytes it was created with
+     */
+    void watchTask(const char* name, uint32_t stackSize);
+
+    /**
+     * @brief Start the sampling task (which watches itself)
+     */
+    void begin();
+
+    /**
+     * @brief Take one sample now, update Metrics and log any new warnings
+     */
+    void sample();
+
+    /**
+     * @brief Log the right-sizing report from the samples so far
+     */
+    void printReport(Print& out) const;
+
+    /**
+     * @brief Format a right-sizing report; independent of FreeRTOS
+     */
+    static void formatReport(Print& out, const TaskSample* tasks, size_t count, const HeapSample& heap);
+
+    /**
+     * @brief Stack size to suggest for a task given its peak usage
+     * @return Peak plus 25% (at least 512 bytes) headroom, rounded up to 512;
+     *         0 when the task was never seen
+     */
+    static uint32_t suggestStackSize(const TaskSample& task);
+
+    /**
+     * @brief xTaskCreatePinnedToCore() that also registers the task for sampling
+     *
+     * The registry lock is held across creation and the new task waits for
+     * it before running function, so a task that finishes at once cannot
+     * deregister before it has been registered.
+     * @return pdPASS if the task was created
+     */
+    static BaseType_t createTask(TaskFunction_t function, const char* name, uint32_t stackSize,
+                                 void* parameter, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+
+    /**
+     * @brief Deregister a task, then vTaskDelete() it
+     * @param handle Task to delete, or NULL for the calling task
+     */
+    static void deleteTask(TaskHandle_t handle);
+
+    /**
+     * @brief Whether a live task with this name was created through createTask()
+     */
+    static bool isRegistered(const char* name);
+
+private:
+    struct RegisteredTask {
+        char name[TASK_NAME_LEN];
+        TaskHandle_t handle;
+    };
+
+    struct TaskStart {
+        TaskFunction_t function;
+        void* parameter;
+    };
+
+    static void monitorTask(void* parameter);
+    static void startTask(void* parameter);   ///< Entry point of every createTask() task
+
+    static SemaphoreHandle_t registryMutex();
+    static TaskHandle_t findRegistered(const char* name);   ///< Newest match; call with the registry lock held
+
+    static RegisteredTask _registered[MAX_TASKS];
+    static size_t _registeredCount;
+
+    TaskSample _tasks[MAX_TASKS];
+    size_t _taskCount;
+    HeapSample _heap;
+    bool _heapWarned;
+    TaskHandle_t _taskHandle;
+};
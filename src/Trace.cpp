@@ -0,0 +1,206 @@
+#include "Trace.h"
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+Trace::Record* Trace::_buffer = nullptr;
+uint32_t Trace::_mask = 0;
+std::atomic<uint32_t> Trace::_next(0);
+std::atomic<bool> Trace::_enabled(false);
+std::atomic<uint32_t> Trace::_exporters(0);
+
+bool Trace::begin(size_t capacity) {
+    if (_buffer) {
+        return true;
+    }
+
+    // Power-of-two size so a slot is a mask rather than a division
+    size_t slots = 1;
+    while (slots * 2 <= capacity) {
+        slots *= 2;
+    }
+
+    // Zeroed, so slots that were never written have a sequence tag of 0 and are skipped
+#ifdef ESP_PLATFORM
+    _buffer = (Record*)heap_caps_calloc(slots, sizeof(Record), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+    _buffer = (Record*)calloc(slots, sizeof(Record));
+#endif
+    if (!_buffer) {
+        Serial.printf("Trace: Failed to allocate %u events.\n", (unsigned)slots);
+        return false;
+    }
+
+    _mask = slots - 1;
+    _next.store(0, std::memory_order_relaxed);
+    _enabled.store(true, std::memory_order_relaxed);
+    Serial.printf("Trace: Recording up to %u events.\n", (unsigned)slots);
+    return true;
+}
+
+void Trace::record(const char* name, char phase) {
+    if (!_buffer || !_enabled.load(std::memory_order_relaxed) ||
+        _exporters.load(std::memory_order_relaxed) != 0) {
+        return;
+    }
+
+    uint32_t index = _next.fetch_add(1, std::memory_order_relaxed);
+    Record& r = _buffer[index & _mask];
+    // Invalidate the slot before touching its fields, so a reader never takes
+    // a half-written record for the one it replaces
+    r.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    r.timestampUs = micros();
+    r.name = name;
+    r.phase = phase;
+#ifdef ESP_PLATFORM
+    r.core = xPortGetCoreID();
+    // The TCB name array is longer than TASK_NAME_LEN, so a fixed copy stays in bounds
+    memcpy(r.task, pcTaskGetName(NULL), TASK_NAME_LEN);
+#else
+    r.core = 0;
+    strncpy(r.task, "host", TASK_NAME_LEN);
+#endif
+    r.sequence.store(index + 1, std::memory_order_release);
+}
+
+Trace::Exporter::Exporter()
+    : _stage(Stage::HEADER),
+      _first(0),
+      _end(0),
+      _cursor(0),
+      _eventCount(0),
+      _threadCursor(0),
+      _lastTimestamp(0),
+      _timestampBase(0),
+      _taskCount(0),
+      _lineLen(0),
+      _linePos(0) {
+    _exporters.fetch_add(1, std::memory_order_relaxed);
+
+    _end = _next.load(std::memory_order_relaxed);
+    uint32_t capacity = _buffer ? _mask + 1 : 0;
+    _first = (_end > capacity) ? _end - capacity : 0;
+    _cursor = _first;
+}
+
+Trace::Exporter::~Exporter() {
+    _exporters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool Trace::Exporter::readRecord(uint32_t index, Record& out) {
+    const Record& r = _buffer[index & _mask];
+    if (r.sequence.load(std::memory_order_acquire) != index + 1) {
+        return false;
+    }
+    out.timestampUs = r.timestampUs;
+    out.name = r.name;
+    memcpy(out.task, r.task, TASK_NAME_LEN);
+    out.core = r.core;
+    out.phase = r.phase;
+    // A writer that started on this slot meanwhile has cleared the tag
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return r.sequence.load(std::memory_order_relaxed) == index + 1 && out.name != nullptr;
+}
+
+size_t Trace::Exporter::read(uint8_t* buf, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        if (_linePos == _lineLen) {
+            if (!nextLine()) {
+                break;
+            }
+        }
+        size_t n = _lineLen - _linePos;
+        if (n > maxLen - written) {
+            n = maxLen - written;
+        }
+        memcpy(buf + written, _line + _linePos, n);
+        _linePos += n;
+        written += n;
+    }
+    return written;
+}
+
+bool Trace::Exporter::nextLine() {
+    int len = 0;
+    switch (_stage) {
+        case Stage::HEADER:
+            len = snprintf(_line, LINE_SIZE, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+            _stage = Stage::EVENTS;
+            break;
+
+        case Stage::EVENTS: {
+            Record r;
+            while (_cursor != _end && !readRecord(_cursor, r)) {
+                _cursor++;   // Never written, or still being written
+            }
+            if (_cursor == _end) {
+                _stage = Stage::THREADS;
+                return nextLine();
+            }
+
+            // Unwrap micros(); events are in claim order, so a large step back is a wrap
+            if (_eventCount > 0 && r.timestampUs < _lastTimestamp &&
+                _lastTimestamp - r.timestampUs > 0x80000000UL) {
+                _timestampBase += 0x100000000ULL;
+            }
+            _lastTimestamp = r.timestampUs;
+
+            len = snprintf(_line, LINE_SIZE,
+                           "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":0,\"tid\":%u,\"args\":{\"core\":%u}}\n",
+                           _eventCount == 0 ? "" : ",",
+                           r.name, r.phase,
+                           (unsigned long long)(_timestampBase + r.timestampUs),
+                           (unsigned)taskId(r.task), (unsigned)r.core);
+            _cursor++;
+            _eventCount++;
+            break;
+        }
+
+        case Stage::THREADS:
+            if (_threadCursor == _taskCount) {
+                _stage = Stage::FOOTER;
+                return nextLine();
+            }
+            // Name each tid after its task; metadata may follow the events it describes
+            len = snprintf(_line, LINE_SIZE,
+                           "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}\n",
+                           (_threadCursor == 0 && _eventCount == 0) ? "" : ",",
+                           (unsigned)_threadCursor, _tasks[_threadCursor]);
+            _threadCursor++;
+            break;
+
+        case Stage::FOOTER:
+            len = snprintf(_line, LINE_SIZE, "]}\n");
+            _stage = Stage::DONE;
+            break;
+
+        case Stage::DONE:
+            return false;
+    }
+
+    _lineLen = (len < 0) ? 0 : ((size_t)len >= LINE_SIZE ? LINE_SIZE - 1 : (size_t)len);
+    _linePos = 0;
+    return true;
+}
+
+uint32_t Trace::Exporter::taskId(const char* task) {
+    char name[TASK_NAME_LEN + 1];
+    memcpy(name, task, TASK_NAME_LEN);
+    name[TASK_NAME_LEN] = '\0';
+
+    for (uint32_t i = 0; i < _taskCount; i++) {
+        if (strcmp(_tasks[i], name) == 0) {
+            return i;
+        }
+    }
+    if (_taskCount == MAX_TASKS) {
+        return MAX_TASKS - 1; // Out of ids; lump the rest into the last one
+    }
+    memcpy(_tasks[_taskCount], name, sizeof(name));
+    return _taskCount++;
+}
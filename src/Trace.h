@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+// Build with -DTRACE_ENABLED=0 to compile every TRACE_SCOPE out
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+/**
+ * @class Trace
+ * @brief Fixed-size ring of begin/end events for finding UI stalls
+ *
+ * TRACE_SCOPE("name") records a begin event now and an end event when the
+ * scope exits, each with a microsecond timestamp, the core and the running
+ * task's name. Recording claims a slot with one atomic add and fills in 24
+ * bytes, with no locks or allocation. Once the ring is full the oldest events
+ * are overwritten, so a dump always covers the most recent activity.
+ *
+ * Each record's sequence tag is cleared before its fields are written and set
+ * to the claimed index + 1 afterwards, with release ordering. The exporter
+ * checks the tag before and after copying a record and skips any that were
+ * never written or were being rewritten.
+ *
+ * Names must be string literals (only the pointer is stored). Nothing is
+ * recorded until begin() has allocated the ring.
+ *
+ * Exporter renders the ring as Chrome trace-event JSON, which loads in
+ * chrome://tracing or ui.perfetto.dev. CaptivePortal serves it at /api/trace.
+ */
+class Trace {
+public:
+    static const size_t DEFAULT_CAPACITY = 8192;   ///< Events kept (192KB of PSRAM)
+    static const size_t TASK_NAME_LEN = 8;         ///< Task name bytes kept per event
+
+    struct Record {
+        std::atomic<uint32_t> sequence;   ///< Claimed index + 1 once written; 0 while unwritten or being rewritten
+        uint32_t timestampUs;
+        const char* name;
+        char task[TASK_NAME_LEN];   ///< Not NUL-terminated when the name fills it
+        uint8_t core;
+        char phase;                 ///< 'B' or 'E'
+    };
+
+    /**
+     * @brief Allocate the ring (in PSRAM when available) and start recording
+     * @param capacity Events to keep, rounded down to a power of two
+     * @return false if the buffer could not be allocated
+     */
+    static bool begin(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Record one event; no-op before begin(), while disabled or while an exporter exists
+     */
+    static void record(const char* name, char phase);
+
+    static void setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+    static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Records a begin event on construction and an end event on destruction
+     */
+    class Scope {
+    public:
+        explicit Scope(const char* name) : _name(name) { record(name, 'B'); }
+        ~Scope() { record(_name, 'E'); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* _name;
+    };
+
+    /**
+     * @brief Streams the ring as Chrome trace-event JSON in caller-sized pieces
+     *
+     * Recording is paused while any exporter exists so the snapshot stays
+     * consistent, and resumes when the last one is destroyed. Events from
+     * writers that were mid-record when recording paused are skipped if
+     * they have not finished by the time the exporter reaches them.
+     */
+    class Exporter {
+    public:
+        Exporter();
+        ~Exporter();
+        Exporter(const Exporter&) = delete;
+        Exporter& operator=(const Exporter&) = delete;
+
+        /**
+         * @brief Copy up to maxLen bytes of JSON into buf
+         * @return Bytes written; 0 once the document is complete
+         */
+        size_t read(uint8_t* buf, size_t maxLen);
+
+    private:
+        static const size_t MAX_TASKS = 24;
+        static const size_t LINE_SIZE = 192;
+
+        enum class Stage : uint8_t {
+            HEADER,
+            EVENTS,
+            THREADS,
+            FOOTER,
+            DONE
+        };
+
+        bool nextLine();
+        bool readRecord(uint32_t index, Record& out);
+        uint32_t taskId(const char* task);
+
+        Stage _stage;
+        uint32_t _first;            ///< Sequence number of the oldest event
+        uint32_t _end;              ///< One past the newest event
+        uint32_t _cursor;
+        uint32_t _eventCount;       ///< Events written so far
+        uint32_t _threadCursor;
+        uint32_t _lastTimestamp;
+        uint64_t _timestampBase;    ///< Accumulated micros() wraps
+        char _tasks[MAX_TASKS][TASK_NAME_LEN + 1];
+        uint32_t _taskCount;
+        char _line[LINE_SIZE];
+        size_t _lineLen;
+        size_t _linePos;
+    };
+
+private:
+    static Record* _buffer;
+    static uint32_t _mask;
+    static std::atomic<uint32_t> _next;
+    static std::atomic<bool> _enabled;
+    static std::atomic<uint32_t> _exporters;   ///< Exporters alive; recording is paused while non-zero
+};
+
+#if TRACE_ENABLED
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(_trace_scope_, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#endif
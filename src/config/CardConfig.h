@@ -15,9 +15,12 @@ enum class CardType {
     QUESTION,     ///< Question trivia card
     PADDLE,       ///< Paddle game card
     POKEDEX       ///< Pokemon Pokedex card with PokeAPI fetching
-    // New card types can be added here
+    // New card types can be added here; move LAST_CARD_TYPE along with them
 };
 
+/// Highest CardType value, for checking types read back from storage
+constexpr CardType LAST_CARD_TYPE = CardType::POKEDEX;
+
 /**
  * @brief Represents an instance of a configured card
  * 
@@ -2,17 +2,21 @@
 #include "Arduino.h" // For random, etc.
 #include "Style.h"   // For Style::loudNoisesFont()
 
+// Logical bird_y 0 sits this far down the screen (bird centre)
+static const int BIRD_Y_VISUAL_OFFSET = (FB_SCREEN_HEIGHT / 2) - (BIRD_SIZE / 2);
+
 FlappyBirdGame::FlappyBirdGame()
-    : main_container(nullptr), bird_obj(nullptr), 
+    : main_container(nullptr), bird_drawn_area{0, 0, -1, -1},
       start_message_label(nullptr), game_over_message_label(nullptr), score_label(nullptr),
-      bird_y(BIRD_SIZE / 2), bird_velocity(0.0f), 
-      current_game_state(GameState::PRE_GAME), score(0) {
+      displayed_score(-1),
+      bird_y(intToFixed(BIRD_SIZE / 2)), bird_y_previous(intToFixed(BIRD_SIZE / 2)), bird_velocity(0),
+      flap_requested(false), current_game_state(GameState::PRE_GAME), score(0),
+      frames_rendered(0), pixels_invalidated(0), draw_calls(0), draw_time_us(0) {
     Serial.println("[FlappyBird] Constructor called"); // DEBUG
     for (int i = 0; i < PIPE_COUNT; ++i) {
-        // pipes[i].top_asterisk_obj = nullptr;     // Old label pointer
-        // pipes[i].bottom_asterisk_obj = nullptr;  // Old label pointer
-        pipes[i].top_pipe_obj = nullptr;     // Initialize new member
-        pipes[i].bottom_pipe_obj = nullptr;  // Initialize new member
+        pipes[i].drawn_area = {0, 0, -1, -1};
+        pipes[i].x_position = 0;
+        pipes[i].x_previous = 0;
         pipes[i].scored = false;
     }
 }
@@ -39,24 +43,20 @@ void FlappyBirdGame::setup(lv_obj_t* parent_screen) {
         lv_obj_set_style_bg_grad_color(main_container, lv_color_hex(0x4B0082), LV_PART_MAIN); // Dark Indigo (bottom)
         lv_obj_set_style_bg_opa(main_container, LV_OPA_COVER, LV_PART_MAIN); // Ensure opaque background
         lv_obj_clear_flag(main_container, LV_OBJ_FLAG_SCROLLABLE);
+        // Bird and pipes are drawn after the background, under the labels
+        lv_obj_add_event_cb(main_container, draw_event_cb, LV_EVENT_DRAW_MAIN, this);
     }
 
-    if (!bird_obj) { 
-        Serial.println("[FlappyBird] Creating bird_obj as square"); // DEBUG
-        bird_obj = lv_obj_create(main_container); 
-        
-        lv_obj_set_size(bird_obj, BIRD_SIZE, BIRD_SIZE);
-        lv_obj_set_style_bg_color(bird_obj, lv_color_hex(0xFF4500), LV_PART_MAIN); // Vibrant Orange-Red bird
-        lv_obj_set_style_radius(bird_obj, LV_RADIUS_CIRCLE, LV_PART_MAIN); 
-        lv_obj_set_style_border_width(bird_obj, 1, LV_PART_MAIN); // 1px border
-        lv_obj_set_style_border_color(bird_obj, lv_color_black(), LV_PART_MAIN); // Black border
-        
-        lv_obj_align(bird_obj, LV_ALIGN_CENTER, BIRD_X_POSITION - FB_SCREEN_WIDTH/2 , 0); 
-    }
-    bird_y = BIRD_SIZE / 2;
-    bird_velocity = 0.0f;
-    lv_obj_set_y(bird_obj, bird_y - BIRD_SIZE / 2);
-    Serial.printf("[FlappyBird] Bird initialized: logical_bird_y_center=%d, velocity=%.2f\n", bird_y, bird_velocity); // DEBUG
+    bird_y = intToFixed(BIRD_SIZE / 2);
+    bird_y_previous = bird_y;
+    bird_velocity = 0;
+    flap_requested = false;
+    bird_drawn_area = bird_area(fixedToInt(bird_y));
+    frames_rendered = 0;
+    pixels_invalidated = 0;
+    draw_calls = 0;
+    draw_time_us = 0;
+    Serial.printf("[FlappyBird] Bird initialized: logical_bird_y_center=%d\n", (int)fixedToInt(bird_y)); // DEBUG
 
     reset_and_initialize_pipes();
 
@@ -101,44 +101,24 @@ void FlappyBirdGame::setup(lv_obj_t* parent_screen) {
         lv_obj_set_style_shadow_opa(score_label, LV_OPA_50, LV_PART_MAIN | LV_STATE_DEFAULT);
     }
     lv_label_set_text_fmt(score_label, "Score: %d", score);
+    displayed_score = score;
     lv_obj_clear_flag(score_label, LV_OBJ_FLAG_HIDDEN); 
+
+    // Everything moved back to its start position
+    lv_obj_invalidate(main_container);
 }
 
 void FlappyBirdGame::reset_and_initialize_pipes() {
     Serial.println("[FlappyBird] reset_and_initialize_pipes() called"); // DEBUG
     srand(time(NULL)); 
     for (int i = 0; i < PIPE_COUNT; ++i) {
-        pipes[i].x_position = FB_SCREEN_WIDTH + (i * HORIZONTAL_SPACING_BETWEEN_PIPES);
+        pipes[i].x_position = intToFixed(FB_SCREEN_WIDTH + (i * HORIZONTAL_SPACING_BETWEEN_PIPES));
+        pipes[i].x_previous = pipes[i].x_position;
         int available_height_for_gap = FB_SCREEN_HEIGHT - (2 * MIN_PIPE_HEIGHT) - PIPE_GAP_HEIGHT;
         if(available_height_for_gap < 0) available_height_for_gap = 0;
         pipes[i].gap_y_top = MIN_PIPE_HEIGHT + (rand() % (available_height_for_gap + 1));
         pipes[i].scored = false;
-
-        // Create Top Pipe Rectangle
-        if (!pipes[i].top_pipe_obj) {
-            pipes[i].top_pipe_obj = lv_obj_create(main_container);
-            lv_obj_remove_style_all(pipes[i].top_pipe_obj); 
-            lv_obj_set_style_bg_color(pipes[i].top_pipe_obj, lv_color_hex(0x008000), LV_PART_MAIN); // Green
-            lv_obj_set_style_bg_opa(pipes[i].top_pipe_obj, LV_OPA_COVER, LV_PART_MAIN);
-            lv_obj_set_style_border_width(pipes[i].top_pipe_obj, 1, LV_PART_MAIN); // 1px border
-            lv_obj_set_style_border_color(pipes[i].top_pipe_obj, lv_color_black(), LV_PART_MAIN); // Black border
-        }
-        lv_obj_set_size(pipes[i].top_pipe_obj, PIPE_WIDTH, pipes[i].gap_y_top);
-        lv_obj_set_pos(pipes[i].top_pipe_obj, (int)pipes[i].x_position, 0);
-
-        // Create Bottom Pipe Rectangle
-        if (!pipes[i].bottom_pipe_obj) {
-            pipes[i].bottom_pipe_obj = lv_obj_create(main_container);
-            lv_obj_remove_style_all(pipes[i].bottom_pipe_obj);
-            lv_obj_set_style_bg_color(pipes[i].bottom_pipe_obj, lv_color_hex(0x008000), LV_PART_MAIN); // Green
-            lv_obj_set_style_bg_opa(pipes[i].bottom_pipe_obj, LV_OPA_COVER, LV_PART_MAIN);
-            lv_obj_set_style_border_width(pipes[i].bottom_pipe_obj, 1, LV_PART_MAIN); // 1px border
-            lv_obj_set_style_border_color(pipes[i].bottom_pipe_obj, lv_color_black(), LV_PART_MAIN); // Black border
-        }
-        int bottom_pipe_y = pipes[i].gap_y_top + PIPE_GAP_HEIGHT;
-        int bottom_pipe_height = FB_SCREEN_HEIGHT - bottom_pipe_y;
-        lv_obj_set_size(pipes[i].bottom_pipe_obj, PIPE_WIDTH, bottom_pipe_height);
-        lv_obj_set_pos(pipes[i].bottom_pipe_obj, (int)pipes[i].x_position, bottom_pipe_y);
+        pipes[i].drawn_area = pipe_column_area(fixedToInt(pipes[i].x_position));
     }
 }
 
@@ -152,15 +132,26 @@ void FlappyBirdGame::loop() {
                 if (start_message_label) {
                     lv_obj_add_flag(start_message_label, LV_OBJ_FLAG_HIDDEN);
                 }
-                bird_y = BIRD_SIZE / 2;
-                bird_velocity = 0.0f;
+                bird_y = intToFixed(BIRD_SIZE / 2);
+                bird_y_previous = bird_y;
+                bird_velocity = 0;
+                flap_requested = false;
             }
+            // Nothing moves until the game starts; don't let that time pile up
+            game_loop.reset(millis());
             break;
 
         case GameState::ACTIVE:
             handle_input();      
-            update_game_state(); 
+            // Run the ticks that are due, however long this frame took
+            for (uint32_t steps = game_loop.advance(millis());
+                 steps > 0 && current_game_state == GameState::ACTIVE; steps--) {
+                update_game_state();
+            }
             render();            
+            if (current_game_state == GameState::GAME_OVER) {
+                log_render_stats();
+            }
             break;
 
         case GameState::GAME_OVER:
@@ -176,30 +167,38 @@ void FlappyBirdGame::handle_input() {
     if (current_game_state != GameState::ACTIVE) return;
     if (Input::isCenterPressed()) {
         Serial.println("[FlappyBird] Flap! (Center pressed in ACTIVE state)"); // DEBUG
-        bird_velocity = -1.59375f;
+        flap_requested = true;
     }
 }
 
 void FlappyBirdGame::update_game_state() {
     if (current_game_state != GameState::ACTIVE) return;
 
-    bird_velocity += 0.0204f;
-    bird_y += (int)bird_velocity;
+    // Remember where things start this tick, for render interpolation
+    bird_y_previous = bird_y;
+    for (int i = 0; i < PIPE_COUNT; ++i) {
+        pipes[i].x_previous = pipes[i].x_position;
+    }
 
-    const int Y_VISUAL_OFFSET = (FB_SCREEN_HEIGHT / 2) - (BIRD_SIZE / 2);
+    if (flap_requested) {
+        bird_velocity = BIRD_FLAP_VELOCITY;
+        flap_requested = false;
+    }
+    bird_velocity += BIRD_GRAVITY;
+    bird_y += bird_velocity;
 
     // Calculate visual bird edges
-    int visual_bird_center_y = bird_y + Y_VISUAL_OFFSET;
+    int visual_bird_center_y = fixedToInt(bird_y) + BIRD_Y_VISUAL_OFFSET;
     int visual_bird_top_edge = visual_bird_center_y - BIRD_SIZE / 2;
     int visual_bird_bottom_edge = visual_bird_center_y + BIRD_SIZE / 2;
 
     // Clamp bird's visual position to prevent going off the top of the screen before collision check
     if (visual_bird_top_edge < 0) {
-        bird_y = -Y_VISUAL_OFFSET + (BIRD_SIZE / 2); // Adjust logical bird_y so visual top is 0
+        bird_y = intToFixed(-BIRD_Y_VISUAL_OFFSET + (BIRD_SIZE / 2)); // Adjust logical bird_y so visual top is 0
         bird_velocity = 0;      
         Serial.println("[FlappyBird] Bird visually clamped to top screen edge.");
         // Recalculate visual edges after clamping for immediate collision check integrity
-        visual_bird_center_y = bird_y + Y_VISUAL_OFFSET;
+        visual_bird_center_y = fixedToInt(bird_y) + BIRD_Y_VISUAL_OFFSET;
         visual_bird_top_edge = visual_bird_center_y - BIRD_SIZE / 2;
         visual_bird_bottom_edge = visual_bird_center_y + BIRD_SIZE / 2;
     }
@@ -257,8 +256,8 @@ void FlappyBirdGame::update_game_state() {
         int bird_left = BIRD_X_POSITION - BIRD_SIZE / 2; 
         int bird_right = BIRD_X_POSITION + BIRD_SIZE / 2;
         
-        int pipe_left = (int)pipes[i].x_position;
-        int pipe_right = (int)pipes[i].x_position + PIPE_WIDTH;
+        int pipe_left = fixedToInt(pipes[i].x_position);
+        int pipe_right = pipe_left + PIPE_WIDTH;
         int top_pipe_visual_bottom_edge = pipes[i].gap_y_top; 
         int bottom_pipe_visual_top_edge = pipes[i].gap_y_top + PIPE_GAP_HEIGHT; 
 
@@ -292,68 +291,175 @@ void FlappyBirdGame::update_game_state() {
             Serial.printf("[FlappyBird] Pipe %d scored! Score: %d\n", i, score); 
         }
 
-        if (pipes[i].x_position + PIPE_WIDTH < 0) {
-            float max_x = 0;
+        if (pipes[i].x_position + intToFixed(PIPE_WIDTH) < 0) {
+            fixed_t max_x = 0;
             for(int j=0; j < PIPE_COUNT; ++j) {
                 if (j == i) continue;
                 if (pipes[j].x_position > max_x) max_x = pipes[j].x_position;
             }
-            pipes[i].x_position = max_x + HORIZONTAL_SPACING_BETWEEN_PIPES;
+            pipes[i].x_position = max_x + intToFixed(HORIZONTAL_SPACING_BETWEEN_PIPES);
+            pipes[i].x_previous = pipes[i].x_position; // Wrapped around, don't slide back across the screen
 
             int available_height_for_gap = FB_SCREEN_HEIGHT - (2 * MIN_PIPE_HEIGHT) - PIPE_GAP_HEIGHT;
             if(available_height_for_gap < 0) available_height_for_gap = 0;
             pipes[i].gap_y_top = MIN_PIPE_HEIGHT + (rand() % (available_height_for_gap + 1));
             pipes[i].scored = false;
-
-            if (pipes[i].top_pipe_obj) {
-                 lv_obj_set_size(pipes[i].top_pipe_obj, PIPE_WIDTH, pipes[i].gap_y_top);
-                 lv_obj_set_pos(pipes[i].top_pipe_obj, (int)pipes[i].x_position, 0); 
-            }
-             if (pipes[i].bottom_pipe_obj) {
-                 int bottom_pipe_y = pipes[i].gap_y_top + PIPE_GAP_HEIGHT;
-                 int bottom_pipe_height = FB_SCREEN_HEIGHT - bottom_pipe_y;
-                 lv_obj_set_size(pipes[i].bottom_pipe_obj, PIPE_WIDTH, bottom_pipe_height);
-                 lv_obj_set_pos(pipes[i].bottom_pipe_obj, (int)pipes[i].x_position, bottom_pipe_y);
-             }
+            // The new gap is picked up by render() moving the column off-screen right
         }
     }
 }
 
 void FlappyBirdGame::render() {
     // Serial.println("[FlappyBird] render() called"); // DEBUG - Very noisy
-    if (bird_obj) {
-        lv_obj_set_y(bird_obj, bird_y - BIRD_SIZE / 2);
-    }
+    if (!main_container) return;
+
+    // Draw between the last two simulated ticks so motion stays smooth at any frame rate
+    fixed_t alpha = game_loop.alpha();
+    frames_rendered++;
+
+    move_sprite(bird_drawn_area, bird_area(fixedToInt(lerpFixed(bird_y_previous, bird_y, alpha))));
 
     for (int i = 0; i < PIPE_COUNT; ++i) {
-        if (pipes[i].top_pipe_obj) {
-            lv_obj_set_x(pipes[i].top_pipe_obj, (int)pipes[i].x_position);
-        }
-        if (pipes[i].bottom_pipe_obj) {
-            lv_obj_set_x(pipes[i].bottom_pipe_obj, (int)pipes[i].x_position);
-        }
+        int pipe_x = fixedToInt(lerpFixed(pipes[i].x_previous, pipes[i].x_position, alpha));
+        move_sprite(pipes[i].drawn_area, pipe_column_area(pipe_x));
     }
 
-    if (score_label) {
+    if (score_label && score != displayed_score) {
         lv_label_set_text_fmt(score_label, "Score: %d", score);
+        displayed_score = score;
     }
 }
 
+lv_area_t FlappyBirdGame::bird_area(int bird_y_px) const {
+    lv_area_t area;
+    area.x1 = BIRD_X_POSITION - BIRD_SIZE / 2;
+    area.y1 = bird_y_px + BIRD_Y_VISUAL_OFFSET - BIRD_SIZE / 2;
+    area.x2 = area.x1 + BIRD_SIZE - 1;
+    area.y2 = area.y1 + BIRD_SIZE - 1;
+    return area;
+}
+
+lv_area_t FlappyBirdGame::pipe_column_area(int pipe_x) const {
+    // Top and bottom pipe share a column; the gap between them is repainted
+    // with it, which costs less than tracking the two rectangles separately
+    lv_area_t area;
+    area.x1 = pipe_x;
+    area.y1 = 0;
+    area.x2 = pipe_x + PIPE_WIDTH - 1;
+    area.y2 = FB_SCREEN_HEIGHT - 1;
+    return area;
+}
+
+void FlappyBirdGame::move_sprite(lv_area_t& drawn, const lv_area_t& next) {
+    if (drawn.x1 == next.x1 && drawn.y1 == next.y1 &&
+        drawn.x2 == next.x2 && drawn.y2 == next.y2) {
+        return; // Hasn't moved a whole pixel, nothing to redraw
+    }
+
+    // A sprite that moved by less than its own size is one dirty rectangle
+    // covering both positions; otherwise old and new are redrawn separately
+    bool overlaps = drawn.x1 <= next.x2 && next.x1 <= drawn.x2 &&
+                    drawn.y1 <= next.y2 && next.y1 <= drawn.y2;
+    if (overlaps) {
+        lv_area_t joined;
+        joined.x1 = LV_MIN(drawn.x1, next.x1);
+        joined.y1 = LV_MIN(drawn.y1, next.y1);
+        joined.x2 = LV_MAX(drawn.x2, next.x2);
+        joined.y2 = LV_MAX(drawn.y2, next.y2);
+        invalidate_area(joined);
+    } else {
+        invalidate_area(drawn);
+        invalidate_area(next);
+    }
+    drawn = next;
+}
+
+void FlappyBirdGame::invalidate_area(const lv_area_t& area) {
+    // Clip to the playfield so pipes entering or leaving don't count off-screen pixels
+    lv_area_t screen_area;
+    screen_area.x1 = LV_MAX(area.x1, 0);
+    screen_area.y1 = LV_MAX(area.y1, 0);
+    screen_area.x2 = LV_MIN(area.x2, FB_SCREEN_WIDTH - 1);
+    screen_area.y2 = LV_MIN(area.y2, FB_SCREEN_HEIGHT - 1);
+    if (screen_area.x1 > screen_area.x2 || screen_area.y1 > screen_area.y2) {
+        return;
+    }
+
+    lv_area_t container_coords;
+    lv_obj_get_coords(main_container, &container_coords);
+    pixels_invalidated += lv_area_get_size(&screen_area);
+    lv_area_move(&screen_area, container_coords.x1, container_coords.y1);
+    lv_obj_invalidate_area(main_container, &screen_area);
+}
+
+void FlappyBirdGame::draw_event_cb(lv_event_t* e) {
+    FlappyBirdGame* game = static_cast<FlappyBirdGame*>(lv_event_get_user_data(e));
+    if (game) {
+        game->draw_playfield(lv_event_get_layer(e));
+    }
+}
+
+void FlappyBirdGame::draw_playfield(lv_layer_t* layer) {
+    uint32_t start_us = micros();
+
+    lv_area_t container_coords;
+    lv_obj_get_coords(main_container, &container_coords);
+
+    lv_draw_rect_dsc_t pipe_dsc;
+    lv_draw_rect_dsc_init(&pipe_dsc);
+    pipe_dsc.bg_color = lv_color_hex(0x008000); // Green
+    pipe_dsc.bg_opa = LV_OPA_COVER;
+    pipe_dsc.border_width = 1;
+    pipe_dsc.border_color = lv_color_black();
+    pipe_dsc.border_opa = LV_OPA_COVER;
+
+    for (int i = 0; i < PIPE_COUNT; ++i) {
+        const lv_area_t& column = pipes[i].drawn_area;
+        if (column.x2 < 0 || column.x1 >= FB_SCREEN_WIDTH) continue;
+
+        lv_area_t top_pipe = {column.x1, 0, column.x2, pipes[i].gap_y_top - 1};
+        lv_area_move(&top_pipe, container_coords.x1, container_coords.y1);
+        lv_draw_rect(layer, &pipe_dsc, &top_pipe);
+
+        lv_area_t bottom_pipe = {column.x1, pipes[i].gap_y_top + PIPE_GAP_HEIGHT, column.x2, FB_SCREEN_HEIGHT - 1};
+        lv_area_move(&bottom_pipe, container_coords.x1, container_coords.y1);
+        lv_draw_rect(layer, &pipe_dsc, &bottom_pipe);
+    }
+
+    lv_draw_rect_dsc_t bird_dsc;
+    lv_draw_rect_dsc_init(&bird_dsc);
+    bird_dsc.bg_color = lv_color_hex(0xFF4500); // Vibrant Orange-Red bird
+    bird_dsc.bg_opa = LV_OPA_COVER;
+    bird_dsc.radius = LV_RADIUS_CIRCLE;
+    bird_dsc.border_width = 1;
+    bird_dsc.border_color = lv_color_black();
+    bird_dsc.border_opa = LV_OPA_COVER;
+
+    lv_area_t bird = bird_drawn_area;
+    lv_area_move(&bird, container_coords.x1, container_coords.y1);
+    lv_draw_rect(layer, &bird_dsc, &bird);
+
+    draw_calls++;
+    draw_time_us += micros() - start_us;
+}
+
+void FlappyBirdGame::log_render_stats() {
+    if (frames_rendered == 0) return;
+    const uint32_t full_frame = FB_SCREEN_WIDTH * FB_SCREEN_HEIGHT;
+    uint32_t avg_pixels = pixels_invalidated / frames_rendered;
+    Serial.printf("[FlappyBird] Render: %u frames, avg %u px invalidated/frame (%u%% of screen), %u draws, avg %u us/draw\n",
+                  frames_rendered, avg_pixels, avg_pixels * 100 / full_frame,
+                  draw_calls, draw_calls ? (uint32_t)(draw_time_us / draw_calls) : 0);
+}
+
 void FlappyBirdGame::cleanup() {
     Serial.println("[FlappyBird] cleanup() called"); // DEBUG
     if (main_container) {
-        lv_obj_del(main_container); // This deletes children too (bird, pipes, labels)
+        lv_obj_del(main_container); // This deletes children too (labels)
         main_container = nullptr;
-        bird_obj = nullptr; 
         start_message_label = nullptr;
         game_over_message_label = nullptr;
         score_label = nullptr;
-        for (int i = 0; i < PIPE_COUNT; ++i) {
-            // pipes[i].top_asterisk_obj = nullptr;     // Old
-            // pipes[i].bottom_asterisk_obj = nullptr;  // Old
-            pipes[i].top_pipe_obj = nullptr;     // Null out new members
-            pipes[i].bottom_pipe_obj = nullptr;  // Null out new members
-        }
     }
 }
 
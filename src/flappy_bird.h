@@ -3,6 +3,7 @@
 
 #include "lvgl.h"
 #include "hardware/Input.h" // For button inputs
+#include "game/GameLoop.h"     // Fixed-timestep clock and fixed-point helpers
 
 // Basic game constants
 const int FB_SCREEN_WIDTH = 240;
@@ -16,7 +17,14 @@ const int PIPE_WIDTH = 20;
 const int PIPE_GAP_HEIGHT = 75; // Vertical opening for the bird
 const int MIN_PIPE_HEIGHT = 15; // Minimum height for top or bottom pipe part
 const int HORIZONTAL_SPACING_BETWEEN_PIPES = FB_SCREEN_WIDTH / 2 + PIPE_WIDTH / 2; // Roughly half screen apart
-const float PIPE_MOVE_SPEED = 0.215625f;
+
+// Motion per GameLoop tick, in fixed-point pixels, from the per-pass values it was tuned at
+const fixed_t PIPE_MOVE_SPEED = floatToFixed(0.215625f) * TUNED_PASSES_PER_TICK;
+const fixed_t BIRD_GRAVITY = floatToFixed(0.0204f) * TUNED_PASSES_PER_TICK * TUNED_PASSES_PER_TICK; // Added to the bird's velocity every tick
+// Velocity set by a flap. The old game flapped at -1.59375 but truncated the
+// velocity to whole pixels each pass, so a flap rose 29 px; -1.1 rises the same
+// without truncation.
+const fixed_t BIRD_FLAP_VELOCITY = floatToFixed(-1.1f) * TUNED_PASSES_PER_TICK;
 
 enum class GameState {
     PRE_GAME,
@@ -25,11 +33,9 @@ enum class GameState {
 };
 
 struct PipePair {
-    // lv_obj_t* top_asterisk_obj;    // LVGL label for the top asterisk
-    // lv_obj_t* bottom_asterisk_obj; // LVGL label for the bottom asterisk
-    lv_obj_t* top_pipe_obj;     // LVGL object for the top pipe rectangle
-    lv_obj_t* bottom_pipe_obj;  // LVGL object for the bottom pipe rectangle
-    float x_position;           
+    lv_area_t drawn_area;       // Full-height column as last drawn, relative to main_container
+    fixed_t x_position;         // Left edge
+    fixed_t x_previous;         // Left edge at the start of the last tick, for interpolation
     int gap_y_top;              
     bool scored;                
 };
@@ -43,27 +49,49 @@ public:
     void loop();                     // Main game logic tick, called when this card is active
     void cleanup();                  // Cleans up LVGL objects
     lv_obj_t* get_main_container();   // Returns the root LVGL object for this game/card
+    bool is_animating() const { return current_game_state == GameState::ACTIVE; } // Needs loop() every frame
 
 private:
     void handle_input();
-    void update_game_state();
+    void update_game_state(); // One GameLoop tick of simulation
     void render();
     void reset_and_initialize_pipes(); // New private method
 
+    // The bird and pipes are not LVGL objects: they are drawn straight into
+    // main_container's layer from its draw event, and render() invalidates
+    // only the areas a sprite left or moved into.
+    static void draw_event_cb(lv_event_t* e);
+    void draw_playfield(lv_layer_t* layer);
+    lv_area_t bird_area(int bird_y_px) const;
+    lv_area_t pipe_column_area(int pipe_x) const;
+    void move_sprite(lv_area_t& drawn, const lv_area_t& next);
+    void invalidate_area(const lv_area_t& area);
+    void log_render_stats();
+
     lv_obj_t* main_container; // The root object for this game, to be added to CardNavigationStack
-    lv_obj_t* bird_obj;
+    lv_area_t bird_drawn_area; // Bird as last drawn, relative to main_container
     // Add other game elements like pipes, score label, etc.
     lv_obj_t* start_message_label;     // Label for "Press to Start"
     lv_obj_t* game_over_message_label; // Label for "Game Over"
     lv_obj_t* score_label;             // For displaying the score
+    int displayed_score;               // Score currently shown, so the label is only touched on change
 
     // Game state variables
-    int bird_y;
-    float bird_velocity;
+    fixed_t bird_y;
+    fixed_t bird_y_previous;   // bird_y at the start of the last tick, for interpolation
+    fixed_t bird_velocity;
+    bool flap_requested;       // Latched by handle_input(), applied on the next tick
     GameState current_game_state;
     int score;
+    GameLoop game_loop;
 
     PipePair pipes[PIPE_COUNT];
+
+    // Render cost of the current game, logged at game over
+    uint32_t frames_rendered;
+    uint64_t pixels_invalidated;
+    uint32_t draw_calls;
+    uint64_t draw_time_us;
 };
 
 #endif // FLAPPY_BIRD_H 
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "game/GameLoop.h"
+
+GameLoop::GameLoop(uint32_t tick_ms) :
+    _tick_ms(tick_ms > 0 ? tick_ms : DEFAULT_TICK_MS),
+    _last_ms(0),
+    _accumulator_ms(0),
+    _ticks(0),
+    _started(false) {
+}
+
+void GameLoop::reset(uint32_t now_ms) {
+    _last_ms = now_ms;
+    _accumulator_ms = 0;
+    _started = true;
+}
+
+uint32_t GameLoop::advance(uint32_t now_ms) {
+    if (!_started) {
+        reset(now_ms);
+        return 0;
+    }
+
+    _accumulator_ms += now_ms - _last_ms; // Unsigned, so millis() wraparound is fine
+    _last_ms = now_ms;
+
+    uint32_t steps = _accumulator_ms / _tick_ms;
+    if (steps > MAX_CATCH_UP_TICKS) {
+        steps = MAX_CATCH_UP_TICKS;
+    }
+    // Keep only the partial tick; anything beyond the catch-up limit is dropped
+    _accumulator_ms %= _tick_ms;
+    _ticks += steps;
+    return steps;
+}
+
+fixed_t GameLoop::alpha() const {
+    return (fixed_t)(((uint64_t)_accumulator_ms << FIXED_SHIFT) / _tick_ms);
+}
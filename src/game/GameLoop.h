@@ -0,0 +1,78 @@
+#ifndef GAME_LOOP_H
+#define GAME_LOOP_H
+
+#include <cstdint>
+
+// Q16.16 fixed-point value used for game positions and velocities.
+// Whole pixels in the top 16 bits, sub-pixel motion in the bottom 16.
+typedef int32_t fixed_t;
+
+static constexpr int FIXED_SHIFT = 16;
+static constexpr fixed_t FIXED_ONE = 1 << FIXED_SHIFT;
+
+constexpr fixed_t intToFixed(int32_t value) {
+    return value * FIXED_ONE;
+}
+
+constexpr fixed_t floatToFixed(float value) {
+    return (fixed_t)(value * FIXED_ONE + (value >= 0 ? 0.5f : -0.5f));
+}
+
+// Whole pixels, rounding towards negative infinity
+constexpr int32_t fixedToInt(fixed_t value) {
+    return value >> FIXED_SHIFT;
+}
+
+// Value between prev and cur for an interpolation factor in [0, FIXED_ONE)
+inline fixed_t lerpFixed(fixed_t prev, fixed_t cur, fixed_t alpha) {
+    return prev + (fixed_t)(((int64_t)(cur - prev) * alpha) >> FIXED_SHIFT);
+}
+
+// Fixed-timestep clock for the games.
+//
+// Cards are updated from the LVGL task at whatever rate LVGL frames and UI
+// queue draining allow, so a game that moves things once per update runs at
+// a speed that depends on load. Instead, each frame a game asks advance()
+// how many fixed ticks of simulation are due, runs exactly that many, and
+// draws positions interpolated between the last two ticks using alpha().
+// The same sequence of ticks and inputs then gives the same game whatever
+// the frame rate.
+class GameLoop {
+public:
+    static constexpr uint32_t DEFAULT_TICK_MS = 10;      // 100 Hz simulation
+    static constexpr uint32_t MAX_CATCH_UP_TICKS = 5;    // Most ticks run in one frame
+
+    explicit GameLoop(uint32_t tick_ms = DEFAULT_TICK_MS);
+
+    // Restart the clock at now_ms without running any ticks. Use while the
+    // game is paused or idle so the time spent there isn't simulated later.
+    void reset(uint32_t now_ms);
+
+    // Add the time since the last call and return how many ticks to run now.
+    // After a long stall (card hidden, slow frame) at most MAX_CATCH_UP_TICKS
+    // are returned and the rest of the backlog is dropped.
+    uint32_t advance(uint32_t now_ms);
+
+    // How far into the next tick the clock is, in [0, FIXED_ONE), for
+    // interpolating between the previous and current simulated positions
+    fixed_t alpha() const;
+
+    uint32_t tickMs() const { return _tick_ms; }
+    uint32_t ticks() const { return _ticks; }   // Ticks run since construction
+
+private:
+    uint32_t _tick_ms;
+    uint32_t _last_ms;
+    uint32_t _accumulator_ms;
+    uint32_t _ticks;
+    bool _started;
+};
+
+// Before GameLoop the games moved once per pass of the LVGL task, which sleeps
+// 5 ms between passes, and their speeds were tuned at that rate. A speed tuned
+// per pass times TUNED_PASSES_PER_TICK covers the same pixels per second at
+// DEFAULT_TICK_MS; an acceleration scales by its square.
+static constexpr uint32_t TUNED_PASS_MS = 5;
+static constexpr int32_t TUNED_PASSES_PER_TICK = GameLoop::DEFAULT_TICK_MS / TUNED_PASS_MS;
+
+#endif // GAME_LOOP_H
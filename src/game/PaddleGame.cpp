@@ -1,16 +1,15 @@
 #include "game/PaddleGame.h"
 #include <cstdlib> // For abs(), potentially rand() later if needed
-#include "Arduino.h" // For millis()
 
 PaddleGame::PaddleGame(int16_t play_area_width, int16_t play_area_height) : 
     _current_state(GameState::StartScreen),
     _player_score(0),
     _ai_score(0),
+    _serve_delay_ticks(0),
+    _player_serves_next(false),
     _play_area_width(play_area_width),
     _play_area_height(play_area_height),
-    _player_paddle_velocity_y(0),
-    _serve_delay_start_time(0),
-    _player_serves_next(false) {
+    _player_paddle_velocity_y(0) {
     reset();
 }
 
@@ -23,13 +22,15 @@ void PaddleGame::reset() {
     _ai_score = 0;
 
     // Player paddle (left side, centered vertically)
-    _player_paddle_coords.x = 5;
-    _player_paddle_coords.y = (_play_area_height / 2) - (PADDLE_HEIGHT / 2);
+    _player_paddle_pos.x = intToFixed(5);
+    _player_paddle_pos.y = intToFixed((_play_area_height / 2) - (PADDLE_HEIGHT / 2));
+    _player_paddle_prev = _player_paddle_pos;
     _player_paddle_velocity_y = 0;
 
     // AI paddle (right side, centered vertically)
-    _ai_paddle_coords.x = _play_area_width - (PADDLE_WIDTH * 2);
-    _ai_paddle_coords.y = (_play_area_height / 2) - (PADDLE_HEIGHT / 2);
+    _ai_paddle_pos.x = intToFixed(_play_area_width - (PADDLE_WIDTH * 2));
+    _ai_paddle_pos.y = intToFixed((_play_area_height / 2) - (PADDLE_HEIGHT / 2));
+    _ai_paddle_prev = _ai_paddle_pos;
 
     // Determine who serves. For a full game reset, player serves.
     // This value might be immediately used if going into ServeDelay.
@@ -37,15 +38,20 @@ void PaddleGame::reset() {
     resetBall(_player_serves_next); // This positions ball and sets its velocity to 0,0
                                   // and stores who will serve.
 
-    // Transition to ServeDelay state and record start time.
+    // Transition to ServeDelay state and start counting down to the serve.
     // This is the key change for ensuring consistent serve behavior.
+    startServeDelay();
+}
+
+void PaddleGame::startServeDelay() {
     setState(GameState::ServeDelay);
-    _serve_delay_start_time = millis();
+    _serve_delay_ticks = SERVE_DELAY_TICKS;
 }
 
 void PaddleGame::resetBall(bool player_will_serve) {
-    _ball_coords.x = _play_area_width / 2 - BALL_DIAMETER / 2;
-    _ball_coords.y = _play_area_height / 2 - BALL_DIAMETER / 2;
+    _ball_pos.x = intToFixed(_play_area_width / 2 - BALL_DIAMETER / 2);
+    _ball_pos.y = intToFixed(_play_area_height / 2 - BALL_DIAMETER / 2);
+    _ball_prev = _ball_pos; // Jump straight to the centre rather than sliding there
 
     // Velocities are set to 0 here. Actual serving velocity is applied after ServeDelay.
     _ball_velocity.x = 0;
@@ -70,16 +76,24 @@ int PaddleGame::getAiScore() const {
     return _ai_score;
 }
 
+Coordinates PaddleGame::interpolate(const FixedCoordinates& previous, const FixedCoordinates& current) const {
+    fixed_t alpha = _loop.alpha();
+    Coordinates coords;
+    coords.x = (int16_t)fixedToInt(lerpFixed(previous.x, current.x, alpha));
+    coords.y = (int16_t)fixedToInt(lerpFixed(previous.y, current.y, alpha));
+    return coords;
+}
+
 Coordinates PaddleGame::getPlayerPaddleCoordinates() const {
-    return _player_paddle_coords;
+    return interpolate(_player_paddle_prev, _player_paddle_pos);
 }
 
 Coordinates PaddleGame::getAiPaddleCoordinates() const {
-    return _ai_paddle_coords;
+    return interpolate(_ai_paddle_prev, _ai_paddle_pos);
 }
 
 Coordinates PaddleGame::getBallCoordinates() const {
-    return _ball_coords;
+    return interpolate(_ball_prev, _ball_pos);
 }
 
 void PaddleGame::movePlayerPaddle(bool move_up, bool start_moving) {
@@ -94,131 +108,158 @@ void PaddleGame::movePlayerPaddle(bool move_up, bool start_moving) {
     }
 }
 
-void PaddleGame::update() {
+void PaddleGame::update(uint32_t now_ms) {
+    if (_current_state != GameState::Playing && _current_state != GameState::ServeDelay) {
+        // Paused or not started: keep the clock current so no backlog builds up
+        _loop.reset(now_ms);
+        return;
+    }
+
+    for (uint32_t steps = _loop.advance(now_ms); steps > 0; steps--) {
+        step();
+        if (_current_state == GameState::GameOver) {
+            break; // Further ticks would only move the interpolation origin
+        }
+    }
+}
+
+void PaddleGame::step() {
+    // Remember where everything starts this tick, for render interpolation
+    _player_paddle_prev = _player_paddle_pos;
+    _ai_paddle_prev = _ai_paddle_pos;
+    _ball_prev = _ball_pos;
+
     // Handle ServeDelay state: wait for delay then serve ball
     if (_current_state == GameState::ServeDelay) {
-        if (millis() - _serve_delay_start_time >= SERVE_DELAY_DURATION_MS) {
-            if (_player_serves_next) {
-                _ball_velocity.x = INITIAL_BALL_SPEED_X;
-            } else {
-                _ball_velocity.x = -INITIAL_BALL_SPEED_X;
-            }
-            
-            // Set initial Y velocity
-            _ball_velocity.y = INITIAL_BALL_SPEED_Y / 2; // Will be 1 if INITIAL_BALL_SPEED_Y is 2
-            if (rand() % 2 == 0) { // Randomize Y direction
-                _ball_velocity.y *= -1;
-            }
-            // Failsafe: if INITIAL_BALL_SPEED_Y was 0 or 1, ensure ball moves vertically.
-            if (_ball_velocity.y == 0 && INITIAL_BALL_SPEED_Y >= 0) { 
-                _ball_velocity.y = 1; 
-            }
-
-            setState(GameState::Playing);
+        if (_serve_delay_ticks > 0) {
+            _serve_delay_ticks--;
+            return;
+        }
+
+        if (_player_serves_next) {
+            _ball_velocity.x = INITIAL_BALL_SPEED_X;
+        } else {
+            _ball_velocity.x = -INITIAL_BALL_SPEED_X;
         }
-        return; // Don't do other updates during ServeDelay beyond checking time
+        
+        // Set initial Y velocity
+        _ball_velocity.y = INITIAL_BALL_SPEED_Y / 2; // Half the full vertical speed to start
+        if (rand() % 2 == 0) { // Randomize Y direction
+            _ball_velocity.y *= -1;
+        }
+        // Failsafe: if INITIAL_BALL_SPEED_Y was 0, ensure ball moves vertically.
+        if (_ball_velocity.y == 0 && INITIAL_BALL_SPEED_Y >= 0) { 
+            _ball_velocity.y = FIXED_ONE * TUNED_PASSES_PER_TICK; 
+        }
+
+        setState(GameState::Playing);
+        return; // Don't do other updates during ServeDelay beyond counting down
     }
 
     if (_current_state != GameState::Playing) {
         return; // Do nothing if not in Playing, Paused, StartScreen, GameOver
     }
 
+    const fixed_t paddle_width = intToFixed(PADDLE_WIDTH);
+    const fixed_t paddle_height = intToFixed(PADDLE_HEIGHT);
+    const fixed_t ball_diameter = intToFixed(BALL_DIAMETER);
+    const fixed_t play_area_width = intToFixed(_play_area_width);
+    const fixed_t play_area_height = intToFixed(_play_area_height);
+
     // --- Player Paddle Movement ---
-    _player_paddle_coords.y += _player_paddle_velocity_y;
+    _player_paddle_pos.y += _player_paddle_velocity_y;
 
     // Boundary checks for player paddle
-    if (_player_paddle_coords.y < 0) {
-        _player_paddle_coords.y = 0;
+    if (_player_paddle_pos.y < 0) {
+        _player_paddle_pos.y = 0;
     }
-    if (_player_paddle_coords.y > _play_area_height - PADDLE_HEIGHT) {
-        _player_paddle_coords.y = _play_area_height - PADDLE_HEIGHT;
+    if (_player_paddle_pos.y > play_area_height - paddle_height) {
+        _player_paddle_pos.y = play_area_height - paddle_height;
     }
 
     // --- Ball Movement ---
-    _ball_coords.x += _ball_velocity.x;
-    _ball_coords.y += _ball_velocity.y;
+    _ball_pos.x += _ball_velocity.x;
+    _ball_pos.y += _ball_velocity.y;
 
     // --- Basic Ball Collision with Top/Bottom Walls ---
-    if (_ball_coords.y <= 0) {
-        _ball_coords.y = 0;
+    if (_ball_pos.y <= 0) {
+        _ball_pos.y = 0;
         _ball_velocity.y = -_ball_velocity.y; // Reverse Y direction
-    } else if (_ball_coords.y >= _play_area_height - BALL_DIAMETER) {
-        _ball_coords.y = _play_area_height - BALL_DIAMETER;
+    } else if (_ball_pos.y >= play_area_height - ball_diameter) {
+        _ball_pos.y = play_area_height - ball_diameter;
         _ball_velocity.y = -_ball_velocity.y; // Reverse Y direction
     }
 
     // --- Scoring (Ball goes off Left/Right Edges) ---
     // Player scores if ball goes past AI (right edge)
-    if (_ball_coords.x >= _play_area_width - BALL_DIAMETER) {
+    if (_ball_pos.x >= play_area_width - ball_diameter) {
         _player_score++;
         if (_player_score >= 5) { // Example win condition
              setState(GameState::GameOver);
         } else {
             _player_serves_next = false; // AI serves next
             resetBall(_player_serves_next);
-            setState(GameState::ServeDelay);
-            _serve_delay_start_time = millis();
+            startServeDelay();
         }
     }
     // AI scores if ball goes past Player (left edge)
-    else if (_ball_coords.x <= 0) {
+    else if (_ball_pos.x <= 0) {
         _ai_score++;
         if (_ai_score >= 5) { // Example win condition
             setState(GameState::GameOver);
         } else {
             _player_serves_next = false; // AI serves next
             resetBall(_player_serves_next);
-            setState(GameState::ServeDelay);
-            _serve_delay_start_time = millis();
+            startServeDelay();
         }
     }
 
     // --- AI Paddle Movement (Simple: try to follow the ball) ---
     // A more sophisticated AI would predict ball movement, have reaction times, etc.
-    int16_t ai_paddle_center = _ai_paddle_coords.y + PADDLE_HEIGHT / 2;
-    int16_t ball_center = _ball_coords.y + BALL_DIAMETER / 2;
+    fixed_t ai_paddle_center = _ai_paddle_pos.y + paddle_height / 2;
+    fixed_t ball_center = _ball_pos.y + ball_diameter / 2;
 
     // AI only moves if the ball is significantly off-center
     if (ball_center > ai_paddle_center + AI_REACTION_THRESHOLD) {
-        _ai_paddle_coords.y += AI_PADDLE_SPEED; // Move down
+        _ai_paddle_pos.y += AI_PADDLE_SPEED; // Move down
     } else if (ball_center < ai_paddle_center - AI_REACTION_THRESHOLD) {
-        _ai_paddle_coords.y -= AI_PADDLE_SPEED; // Move up
+        _ai_paddle_pos.y -= AI_PADDLE_SPEED; // Move up
     }
 
     // Boundary checks for AI paddle
-    if (_ai_paddle_coords.y < 0) {
-        _ai_paddle_coords.y = 0;
+    if (_ai_paddle_pos.y < 0) {
+        _ai_paddle_pos.y = 0;
     }
-    if (_ai_paddle_coords.y > _play_area_height - PADDLE_HEIGHT) {
-        _ai_paddle_coords.y = _play_area_height - PADDLE_HEIGHT;
+    if (_ai_paddle_pos.y > play_area_height - paddle_height) {
+        _ai_paddle_pos.y = play_area_height - paddle_height;
     }
 
 
     // --- Ball Collision with Paddles (Simplified AABB check) ---
     // Player Paddle Collision
     bool player_collided = 
-        _ball_coords.x < _player_paddle_coords.x + PADDLE_WIDTH &&
-        _ball_coords.x + BALL_DIAMETER > _player_paddle_coords.x &&
-        _ball_coords.y < _player_paddle_coords.y + PADDLE_HEIGHT &&
-        _ball_coords.y + BALL_DIAMETER > _player_paddle_coords.y;
+        _ball_pos.x < _player_paddle_pos.x + paddle_width &&
+        _ball_pos.x + ball_diameter > _player_paddle_pos.x &&
+        _ball_pos.y < _player_paddle_pos.y + paddle_height &&
+        _ball_pos.y + ball_diameter > _player_paddle_pos.y;
 
     if (player_collided && _ball_velocity.x < 0) { // Check if ball is moving towards player
-        _ball_coords.x = _player_paddle_coords.x + PADDLE_WIDTH; // Nudge ball out of paddle
+        _ball_pos.x = _player_paddle_pos.x + paddle_width; // Nudge ball out of paddle
         _ball_velocity.x = -_ball_velocity.x; // Reverse X direction
         // Optional: Modify Y velocity based on where it hit the paddle
-        // int16_t hit_pos = (_ball_coords.y + BALL_DIAMETER / 2) - (_player_paddle_coords.y + PADDLE_HEIGHT / 2);
+        // fixed_t hit_pos = (_ball_pos.y + ball_diameter / 2) - (_player_paddle_pos.y + paddle_height / 2);
         // _ball_velocity.y = hit_pos / (PADDLE_HEIGHT / 4); // Example: more Y speed if hit near edge
     }
 
     // AI Paddle Collision
     bool ai_collided = 
-        _ball_coords.x < _ai_paddle_coords.x + PADDLE_WIDTH &&
-        _ball_coords.x + BALL_DIAMETER > _ai_paddle_coords.x &&
-        _ball_coords.y < _ai_paddle_coords.y + PADDLE_HEIGHT &&
-        _ball_coords.y + BALL_DIAMETER > _ai_paddle_coords.y;
+        _ball_pos.x < _ai_paddle_pos.x + paddle_width &&
+        _ball_pos.x + ball_diameter > _ai_paddle_pos.x &&
+        _ball_pos.y < _ai_paddle_pos.y + paddle_height &&
+        _ball_pos.y + ball_diameter > _ai_paddle_pos.y;
 
     if (ai_collided && _ball_velocity.x > 0) { // Check if ball is moving towards AI
-        _ball_coords.x = _ai_paddle_coords.x - BALL_DIAMETER; // Nudge ball out
+        _ball_pos.x = _ai_paddle_pos.x - ball_diameter; // Nudge ball out
         _ball_velocity.x = -_ball_velocity.x; // Reverse X direction
     }
 }
@@ -2,6 +2,7 @@
 #define PADDLE_GAME_H
 
 #include <cstdint> // For int16_t etc.
+#include "game/GameLoop.h"
 
 // A simple struct for 2D coordinates
 struct Coordinates {
@@ -14,7 +15,11 @@ public:
     PaddleGame(int16_t play_area_width, int16_t play_area_height);
     ~PaddleGame();
 
-    void update();
+    // Run the simulation ticks due at now_ms (see GameLoop). Call every frame;
+    // outside Playing/ServeDelay it just keeps the clock from building a backlog.
+    void update(uint32_t now_ms);
+    // Advance the simulation by exactly one GameLoop tick
+    void step();
     void reset();
 
     // Placeholder for game states
@@ -42,6 +47,7 @@ public:
     int getPlayerScore() const;
     int getAiScore() const;
 
+    // Positions for drawing, interpolated between the last two ticks
     Coordinates getPlayerPaddleCoordinates() const;
     Coordinates getAiPaddleCoordinates() const;
     Coordinates getBallCoordinates() const;
@@ -56,34 +62,49 @@ public:
     static constexpr int16_t BALL_DIAMETER = 5;  // Was 4
 
 private:
+    // Position or velocity in fixed-point pixels
+    struct FixedCoordinates {
+        fixed_t x;
+        fixed_t y;
+    };
+
     void resetBall(bool player_will_serve); // Renamed parameter for clarity
+    void startServeDelay();
+    Coordinates interpolate(const FixedCoordinates& previous, const FixedCoordinates& current) const;
 
     GameState _current_state;
     int _player_score;
     int _ai_score;
 
-    uint32_t _serve_delay_start_time; // When the serve delay began
+    uint32_t _serve_delay_ticks;    // Ticks left before the ball is served
     bool _player_serves_next;       // True if player serves after delay, false if AI
 
     int16_t _play_area_width;
     int16_t _play_area_height;
 
-    Coordinates _player_paddle_coords;
-    int16_t _player_paddle_velocity_y; // Current speed and direction of player paddle
+    GameLoop _loop;
+
+    // Current positions, and where they were at the start of the last tick
+    FixedCoordinates _player_paddle_pos;
+    FixedCoordinates _player_paddle_prev;
+    fixed_t _player_paddle_velocity_y; // Current speed and direction of player paddle
 
-    Coordinates _ai_paddle_coords;
-    // AI paddle movement will be calculated in update()
+    FixedCoordinates _ai_paddle_pos;
+    FixedCoordinates _ai_paddle_prev;
+    // AI paddle movement will be calculated in step()
 
-    Coordinates _ball_coords;
-    Coordinates _ball_velocity; // x and y components of ball's velocity
+    FixedCoordinates _ball_pos;
+    FixedCoordinates _ball_prev;
+    FixedCoordinates _ball_velocity; // x and y components of ball's velocity
 
-    // Speeds (pixels per update cycle, can be tuned)
-    static constexpr int16_t INITIAL_PADDLE_SPEED = 3;
-    static constexpr int16_t AI_PADDLE_SPEED = 1;          // AI moves slowly
-    static constexpr int16_t AI_REACTION_THRESHOLD = 20; // Massively increased. AI reacts extremely late.
-    static constexpr int16_t INITIAL_BALL_SPEED_X = 1;
-    static constexpr int16_t INITIAL_BALL_SPEED_Y = 2;
+    // Speeds (pixels per GameLoop tick, can be tuned), from the per-pass values they were tuned at
+    static constexpr fixed_t INITIAL_PADDLE_SPEED = intToFixed(3) * TUNED_PASSES_PER_TICK;
+    static constexpr fixed_t AI_PADDLE_SPEED = intToFixed(1) * TUNED_PASSES_PER_TICK;          // AI moves slowly
+    static constexpr fixed_t AI_REACTION_THRESHOLD = intToFixed(20); // Massively increased. AI reacts extremely late.
+    static constexpr fixed_t INITIAL_BALL_SPEED_X = intToFixed(1) * TUNED_PASSES_PER_TICK;
+    static constexpr fixed_t INITIAL_BALL_SPEED_Y = intToFixed(2) * TUNED_PASSES_PER_TICK;
     static constexpr uint32_t SERVE_DELAY_DURATION_MS = 1500; // 1.5 second delay before serve
+    static constexpr uint32_t SERVE_DELAY_TICKS = SERVE_DELAY_DURATION_MS / GameLoop::DEFAULT_TICK_MS;
 };
 
 #endif // PADDLE_GAME_H 
\ No newline at end of file
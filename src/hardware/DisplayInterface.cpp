@@ -1,4 +1,5 @@
 #include "DisplayInterface.h"
+#include "Trace.h"
 
 // A pointer to the instance for use in static callbacks
 static DisplayInterface* instance = nullptr;
@@ -94,6 +95,7 @@ void DisplayInterface::begin() {
     
     // Initialize LVGL
     lv_init();
+    lv_tick_set_cb(_tick_get);
     
     // Initialize and register display for LVGL v9
     _display = lv_display_create(_screen_width, _screen_height);
@@ -123,19 +125,27 @@ Adafruit_ST7789* DisplayInterface::getDisplay() {
     return _tft;
 }
 
-void DisplayInterface::handleLVGLTasks() {
+uint32_t DisplayInterface::handleLVGLTasks() {
+    uint32_t until_next = 1;
     if (takeMutex()) {
-        lv_timer_handler();
+        TRACE_SCOPE("lvgl.timers");
+        until_next = lv_timer_handler();
         giveMutex();
     }
+    return until_next;
 }
 
-void DisplayInterface::tickTask(void* arg) {
-    (void)arg;  // Silence unused parameter warning
-    while (1) {
-        lv_tick_inc(10);
-        vTaskDelay(pdMS_TO_TICKS(10));
+uint32_t DisplayInterface::timeUntilNextLVGLTimer() {
+    uint32_t until_next = 1;
+    if (takeMutex()) {
+        until_next = lv_timer_get_time_until_next();
+        giveMutex();
     }
+    return until_next;
+}
+
+uint32_t DisplayInterface::_tick_get() {
+    return millis();
 }
 
 bool DisplayInterface::takeMutex(TickType_t timeout) {
@@ -156,6 +166,7 @@ SemaphoreHandle_t* DisplayInterface::getMutexPtr() {
 }
 
 void DisplayInterface::_disp_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    TRACE_SCOPE("display.flush");
     if (instance && instance->_tft) {
         uint32_t w = (area->x2 - area->x1 + 1);
         uint32_t h = (area->y2 - area->y1 + 1);
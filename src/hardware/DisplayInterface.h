@@ -55,15 +55,20 @@ public:
     
     /**
      * @brief Process LVGL tasks (should be called regularly)
+     * 
+     * @return Milliseconds until LVGL next has timer work, LV_NO_TIMER_READY
+     *         if it has none, or 1 if the mutex was busy
      */
-    void handleLVGLTasks();
-    
+    uint32_t handleLVGLTasks();
+
     /**
-     * @brief FreeRTOS task for LVGL tick handling
-     * 
-     * @param arg Task argument (not used)
+     * @brief Time until LVGL next has timer work, without running any
+     *
+     * For after UI updates made since handleLVGLTasks(), which may have
+     * started animations or invalidated areas that are due sooner.
+     * @return As handleLVGLTasks()
      */
-    static void tickTask(void* arg);
+    uint32_t timeUntilNextLVGLTimer();
     
     /**
      * @brief Acquire the LVGL mutex
@@ -116,6 +121,16 @@ private:
      * @param px_map Pixel data
      */
     static void _disp_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+
+    /**
+     * @brief LVGL tick source
+     * 
+     * LVGL reads the time when it needs it, so no task has to wake up
+     * just to advance a tick counter.
+     * 
+     * @return Milliseconds since boot
+     */
+    static uint32_t _tick_get();
     
     // Prevent copying
     DisplayInterface(const DisplayInterface&) = delete;
@@ -0,0 +1,153 @@
+#include "hardware/LedStatus.h"
+
+std::atomic<uint32_t> LedStatus::_flags(0);
+std::atomic<uint32_t> LedStatus::_errorUntil(0);
+std::atomic<bool> LedStatus::_errorActive(false);
+std::atomic<uint8_t> LedStatus::_otaProgress(0);
+std::atomic<TaskHandle_t> LedStatus::_listener(nullptr);
+
+// First quarter of a sine wave, round(127 * sin(i * 2pi / 256)) for i = 0..64
+static const int8_t SINE_QUARTER[65] = {
+      0,   3,   6,   9,  12,  16,  19,  22,  25,  28,  31,  34,  37,
+     40,  43,  46,  49,  51,  54,  57,  60,  63,  65,  68,  71,  73,
+     76,  78,  81,  83,  85,  88,  90,  92,  94,  96,  98, 100, 102,
+    104, 106, 107, 109, 111, 112, 113, 115, 116, 117, 118, 120, 121,
+    122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127, 127,
+};
+
+static const uint8_t BREATH_MIN_LEVEL = 12;     // 5% floor so the pixel never goes fully dark
+static const int BREATH_VARIANCE = 51;          // +/-20% per-channel drift
+
+static uint8_t clampLevel(int value, int minimum) {
+    if (value < minimum) {
+        return minimum;
+    }
+    return value > 255 ? 255 : value;
+}
+
+int8_t LedStatus::sin8(uint8_t angle) {
+    uint8_t index = angle & 0x3F;
+    int8_t value;
+    switch (angle >> 6) {
+        case 0:  value = SINE_QUARTER[index]; break;
+        case 1:  value = SINE_QUARTER[64 - index]; break;
+        case 2:  value = -SINE_QUARTER[index]; break;
+        default: value = -SINE_QUARTER[64 - index]; break;
+    }
+    return value;
+}
+
+LedColor LedStatus::frameAt(LedPattern pattern, uint32_t elapsedMs, uint8_t progress, uint32_t* nextMs) {
+    uint32_t step = elapsedMs / PULSE_STEP_MS;
+    uint32_t untilStep = PULSE_STEP_MS - elapsedMs % PULSE_STEP_MS;
+
+    switch (pattern) {
+        case LedPattern::IDLE: {
+            // One table step per keyframe; each channel drifts at a slightly different rate
+            uint8_t angle = step * (256 * PULSE_STEP_MS / BREATH_PERIOD_MS);
+            int level = sin8(angle) + 127;
+            *nextMs = untilStep;
+            return {
+                clampLevel(level + sin8(step * 11 / 10) * BREATH_VARIANCE / 127, BREATH_MIN_LEVEL),
+                clampLevel(level + sin8(step * 9 / 10) * BREATH_VARIANCE / 127, BREATH_MIN_LEVEL),
+                clampLevel(level + sin8(step * 12 / 10) * BREATH_VARIANCE / 127, BREATH_MIN_LEVEL)
+            };
+        }
+
+        case LedPattern::FETCHING: {
+            uint8_t angle = step * (256 * PULSE_STEP_MS / FETCH_PERIOD_MS);
+            uint8_t level = clampLevel(sin8(angle) + 127, 8);
+            *nextMs = untilStep;
+            return { 0, (uint8_t)(level / 4), level };
+        }
+
+        case LedPattern::WIFI_LOST: {
+            bool on = (elapsedMs / WIFI_BLINK_MS) % 2 == 0;
+            *nextMs = WIFI_BLINK_MS - elapsedMs % WIFI_BLINK_MS;
+            return on ? LedColor{ 160, 64, 0 } : LedColor{ 0, 0, 0 };
+        }
+
+        case LedPattern::ERROR: {
+            bool on = (elapsedMs / ERROR_BLINK_MS) % 2 == 0;
+            *nextMs = ERROR_BLINK_MS - elapsedMs % ERROR_BLINK_MS;
+            return on ? LedColor{ 255, 0, 0 } : LedColor{ 0, 0, 0 };
+        }
+
+        case LedPattern::OTA: {
+            if (progress > 100) {
+                progress = 100;
+            }
+            uint8_t level = 32 + progress * 223 / 100;
+            *nextMs = FOREVER;
+            return { (uint8_t)(level / 2), 0, level };
+        }
+    }
+
+    *nextMs = FOREVER;
+    return { 0, 0, 0 };
+}
+
+void LedStatus::set(Flag flag, bool active) {
+    uint32_t previous = active
+        ? _flags.fetch_or(flag, std::memory_order_relaxed)
+        : _flags.fetch_and(~(uint32_t)flag, std::memory_order_relaxed);
+    if (((previous & flag) != 0) != active) {
+        notify();
+    }
+}
+
+void LedStatus::signalError() {
+    _errorUntil.store(millis() + ERROR_HOLD_MS, std::memory_order_relaxed);
+    _errorActive.store(true, std::memory_order_relaxed);
+    notify();
+}
+
+void LedStatus::setOtaProgress(int percent) {
+    if (percent < 0) {
+        percent = 0;
+    } else if (percent > 100) {
+        percent = 100;
+    }
+    if (_otaProgress.exchange(percent, std::memory_order_relaxed) != percent) {
+        notify();
+    }
+}
+
+void LedStatus::setListener(TaskHandle_t task) {
+    _listener.store(task, std::memory_order_relaxed);
+}
+
+LedPattern LedStatus::current(uint32_t now, uint32_t* holdMs) {
+    *holdMs = FOREVER;
+    uint32_t flags = _flags.load(std::memory_order_relaxed);
+
+    if (flags & OTA) {
+        return LedPattern::OTA;
+    }
+
+    if (_errorActive.load(std::memory_order_relaxed)) {
+        int32_t remaining = (int32_t)(_errorUntil.load(std::memory_order_relaxed) - now);
+        if (remaining > 0) {
+            *holdMs = remaining;
+            return LedPattern::ERROR;
+        }
+        _errorActive.store(false, std::memory_order_relaxed);
+    }
+
+    if (flags & WIFI_LOST) {
+        return LedPattern::WIFI_LOST;
+    }
+    if (flags & FETCHING) {
+        return LedPattern::FETCHING;
+    }
+    return LedPattern::IDLE;
+}
+
+void LedStatus::notify() {
+#ifdef ESP_PLATFORM
+    TaskHandle_t listener = _listener.load(std::memory_order_relaxed);
+    if (listener) {
+        xTaskNotifyGive(listener);
+    }
+#endif
+}
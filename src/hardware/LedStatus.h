@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @struct LedColor
+ * @brief One RGB value for the status pixel
+ */
+struct LedColor {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    bool operator==(const LedColor& other) const { return r == other.r && g == other.g && b == other.b; }
+    bool operator!=(const LedColor& other) const { return !(*this == other); }
+};
+
+/**
+ * @enum LedPattern
+ * @brief What the status pixel is showing, lowest priority first
+ */
+enum class LedPattern : uint8_t {
+    IDLE,       ///< Slow white breathing with a slight color drift
+    FETCHING,   ///< Quick blue pulse while an insight request is in flight
+    WIFI_LOST,  ///< Slow amber blink while WiFi is disconnected
+    ERROR,      ///< Fast red blink for a few seconds after a failure
+    OTA         ///< Steady purple, brighter as the update progresses
+};
+
+/**
+ * @class LedStatus
+ * @brief Device status for the NeoPixel and the patterns that show it
+ *
+ * Any task can raise or clear a status; the highest-priority one that is
+ * active picks the pattern. Setters only touch atomics and wake the listener
+ * task, so they are cheap enough to call from network and OTA code.
+ *
+ * frameAt() computes a pattern's color from an 8-bit fixed-point sine table
+ * and reports how long that color holds, so the LED task can sleep until the
+ * next keyframe instead of polling. It has no hardware dependencies.
+ */
+class LedStatus {
+public:
+    static const uint32_t FOREVER = UINT32_MAX;            ///< Frame holds until the status changes
+    static const uint32_t PULSE_STEP_MS = 32;              ///< Keyframe spacing for the smooth patterns
+    static const uint32_t BREATH_PERIOD_MS = 8192;         ///< Matches the old float breathing speed
+    static const uint32_t FETCH_PERIOD_MS = 1024;
+    static const uint32_t WIFI_BLINK_MS = 1000;
+    static const uint32_t ERROR_BLINK_MS = 150;
+    static const uint32_t ERROR_HOLD_MS = 3000;            ///< How long an error stays on the LED
+
+    enum Flag : uint32_t {
+        FETCHING = 1 << 0,
+        WIFI_LOST = 1 << 1,
+        OTA = 1 << 2
+    };
+
+    /**
+     * @brief Raise or clear a status flag
+     */
+    static void set(Flag flag, bool active);
+
+    /**
+     * @brief Show the error pattern for ERROR_HOLD_MS from now
+     */
+    static void signalError();
+
+    /**
+     * @brief Record OTA progress (0-100) for the OTA pattern's brightness
+     */
+    static void setOtaProgress(int percent);
+
+    /**
+     * @brief Task to notify whenever the status changes
+     */
+    static void setListener(TaskHandle_t task);
+
+    /**
+     * @brief Resolve the pattern to show now
+     * @param now millis()
+     * @param holdMs Set to the ms until the result can change on its own
+     *        (an error expiring), or FOREVER
+     */
+    static LedPattern current(uint32_t now, uint32_t* holdMs);
+
+    static uint8_t otaProgress() { return _otaProgress.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Color of a pattern a given time after it started
+     * @param pattern Pattern to render
+     * @param elapsedMs Time since the pattern started
+     * @param progress OTA progress 0-100, used by LedPattern::OTA only
+     * @param nextMs Set to the ms until the color next changes, or FOREVER
+     */
+    static LedColor frameAt(LedPattern pattern, uint32_t elapsedMs, uint8_t progress, uint32_t* nextMs);
+
+    /**
+     * @brief Sine of an 8-bit angle (256 steps per turn) in Q7, -127..127
+     */
+    static int8_t sin8(uint8_t angle);
+
+private:
+    static void notify();
+
+    static std::atomic<uint32_t> _flags;
+    static std::atomic<uint32_t> _errorUntil;
+    static std::atomic<bool> _errorActive;
+    static std::atomic<uint8_t> _otaProgress;
+    static std::atomic<TaskHandle_t> _listener;
+};
@@ -1,11 +1,12 @@
 #include "hardware/NeoPixelController.h"
-#include <Arduino.h> // For pinMode, digitalWrite, delay, PI, sin, constrain, millis
+#include <Arduino.h> // For pinMode, digitalWrite, delay, millis
 // FastLED.h is included via NeoPixelController.h
 
 NeoPixelController::NeoPixelController()
     // No explicit member initializer for leds array or FastLED controller here
-    : lastUpdate(0),
-      breathPhase(0.0f) {
+    : _pattern(LedPattern::IDLE),
+      _patternStart(0),
+      _shown{0, 0, 0} {
 }
 
 void NeoPixelController::begin() {
@@ -28,35 +29,22 @@ void NeoPixelController::begin() {
     FastLED.show();
 }
 
-void NeoPixelController::update() {
-    unsigned long currentTime = millis();
-    if (currentTime - lastUpdate < UPDATE_INTERVAL_MS) {
-        return;
+uint32_t NeoPixelController::update() {
+    uint32_t now = millis();
+    uint32_t holdMs;
+    LedPattern pattern = LedStatus::current(now, &holdMs);
+    if (pattern != _pattern) {
+        _pattern = pattern;
+        _patternStart = now;
     }
-    
-    lastUpdate = currentTime;
-    
-    breathPhase += BREATH_SPEED;
-    if (breathPhase >= BREATH_CYCLE) {
-        breathPhase -= BREATH_CYCLE;
+
+    uint32_t nextMs;
+    LedColor color = LedStatus::frameAt(_pattern, now - _patternStart, LedStatus::otaProgress(), &nextMs);
+    if (color != _shown) {
+        _shown = color;
+        leds[0] = CRGB(color.r, color.g, color.b); // Set pixel color using FastLED
+        FastLED.show(); // Update the strip
     }
-    
-    float brightness = (sin(breathPhase) + 1.0f) * 0.5f;
-    
-    float redVar = sin(breathPhase * 1.1f) * COLOR_VARIANCE;
-    float greenVar = sin(breathPhase * 0.9f) * COLOR_VARIANCE;
-    float blueVar = sin(breathPhase * 1.2f) * COLOR_VARIANCE;
-    
-    float red = (brightness + redVar);
-    float green = (brightness + greenVar);
-    float blue = (brightness + blueVar);
-    
-    const uint8_t MIN_VALUE = static_cast<uint8_t>(255.0f * 0.05f);
-    
-    uint8_t finalRed = constrain(static_cast<long>(red * 255), MIN_VALUE, 255);
-    uint8_t finalGreen = constrain(static_cast<long>(green * 255), MIN_VALUE, 255);
-    uint8_t finalBlue = constrain(static_cast<long>(blue * 255), MIN_VALUE, 255);
-    
-    leds[0] = CRGB(finalRed, finalGreen, finalBlue); // Set pixel color using FastLED
-    FastLED.show(); // Update the strip
-} 
\ No newline at end of file
+
+    return holdMs < nextMs ? holdMs : nextMs;
+}
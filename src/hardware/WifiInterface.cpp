@@ -117,12 +117,59 @@ bool WiFiInterface::connectToStoredNetwork(unsigned long timeout) {
         _ui->updateConnectionStatus("Connecting");
     }
     
-    // Start connection attempt
-    WiFi.begin(_ssid.c_str(), _password.c_str());
+    // Start connection attempt, skipping the scan if we know where the AP is
+    uint8_t bssid[6];
+    int32_t channel;
+    _fastConnectFailed = false;
+    if (_configManager.getWiFiLinkHint(bssid, channel)) {
+        Serial.printf("WiFiInterface: Fast connect to %02X:%02X:%02X:%02X:%02X:%02X on channel %d\n",
+                      bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5], channel);
+        _connectPhase = ConnectPhase::FAST;
+        _stationLockedToAp = true;
+        WiFi.begin(_ssid.c_str(), _password.c_str(), channel, bssid);
+    } else {
+        _connectPhase = ConnectPhase::FULL;
+        _stationLockedToAp = false;
+        WiFi.begin(_ssid.c_str(), _password.c_str());
+    }
     
     return true;
 }
 
+void WiFiInterface::fallBackToFullConnect() {
+    Serial.printf("WiFiInterface: Fast connect failed after %lu ms, falling back to full connect\n",
+                  millis() - _connectionStartTime);
+    // Set before disconnecting so the resulting event isn't taken as another failure
+    _connectPhase = ConnectPhase::FULL;
+    // The AP has moved or gone; don't spend the fast timeout on it next time
+    _configManager.clearWiFiLinkHint();
+    _stationLockedToAp = false;
+    WiFi.disconnect();
+    WiFi.begin(_ssid.c_str(), _password.c_str());
+}
+
+void WiFiInterface::onConnectionEstablished() {
+    if (_connectPhase == ConnectPhase::NONE) {
+        return; // Driver auto-reconnect, not one of our attempts
+    }
+
+    _lastConnectTime = millis() - _connectionStartTime;
+    _lastConnectWasFast = _connectPhase == ConnectPhase::FAST;
+    _connectPhase = ConnectPhase::NONE;
+    Serial.printf("WiFiInterface: Connected in %lu ms (%s connect)\n",
+                  _lastConnectTime, _lastConnectWasFast ? "fast" : "full");
+
+    _configManager.saveWiFiLinkHint(WiFi.BSSID(), WiFi.channel());
+}
+
+unsigned long WiFiInterface::getLastConnectTime() const {
+    return _lastConnectTime;
+}
+
+bool WiFiInterface::lastConnectWasFast() const {
+    return _lastConnectWasFast;
+}
+
 void WiFiInterface::startAccessPoint() {
     WiFi.mode(WIFI_AP);
     
@@ -192,8 +239,14 @@ void WiFiInterface::process() {
     if (_state == WiFiState::CONNECTING) {
         unsigned long now = millis();
         
+        if (_connectPhase == ConnectPhase::FAST &&
+            (_fastConnectFailed || now - _connectionStartTime >= FAST_CONNECT_TIMEOUT_MS)) {
+            fallBackToFullConnect();
+        }
+        
         if (now - _connectionStartTime >= _connectionTimeout) {
             Serial.println("WiFi connection timeout");
+            _connectPhase = ConnectPhase::NONE;
             WiFi.disconnect();
             updateState(WiFiState::DISCONNECTED);
             
@@ -282,6 +335,7 @@ void WiFiInterface::onWiFiEvent(WiFiEvent_t event) {
         case ARDUINO_EVENT_WIFI_STA_GOT_IP:
             Serial.print("WiFi connected, IP address: ");
             Serial.println(WiFi.localIP());
+            _instance->onConnectionEstablished();
             if (_instance->_ui) {
                 _instance->_ui->updateConnectionStatus("Connected");
                 _instance->_ui->updateIPAddress(WiFi.localIP().toString());
@@ -296,12 +350,24 @@ void WiFiInterface::onWiFiEvent(WiFiEvent_t event) {
             
         case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
             Serial.println("WiFi disconnected");
+            if (_instance->_connectPhase == ConnectPhase::FAST) {
+                // Remembered AP refused us or isn't there; process() falls back
+                _instance->_fastConnectFailed = true;
+            }
             if (_instance->_state == WiFiState::CONNECTED) {
                 _instance->updateState(WiFiState::DISCONNECTED);
                 
                 if (_instance->_ui) {
                     _instance->_ui->updateConnectionStatus("Disconnected");
                 }
+
+                if (_instance->_stationLockedToAp) {
+                    // The driver's own reconnect would only retry the AP and channel
+                    // the fast connect pinned; rejoin by SSID so roaming still works
+                    Serial.println("WiFiInterface: Rejoining by SSID after a fast connect");
+                    _instance->_stationLockedToAp = false;
+                    WiFi.begin(_instance->_ssid.c_str(), _instance->_password.c_str());
+                }
             }
             break;
             
@@ -311,51 +377,72 @@ void WiFiInterface::onWiFiEvent(WiFiEvent_t event) {
 }
 
 // New method implementations for network scanning
-void WiFiInterface::scanNetworks() {
-    Serial.println("WiFiInterface: Starting WiFi scan...");
-    // WiFi.scanNetworks will return the number of networks found, or -1 for failure, -2 if scan is already in progress.
-    // Using a blocking scan here.
-    // The true parameter for show_hidden is often useful.
-    _lastScanResultCount = WiFi.scanNetworks(/*async=*/false, /*show_hidden=*/true);
-    
-    if (_lastScanResultCount == WIFI_SCAN_FAILED) { // WIFI_SCAN_FAILED is typically -1
-        Serial.println("WiFiInterface: Scan failed to start or failed during execution.");
-    } else if (_lastScanResultCount == WIFI_SCAN_RUNNING) { // WIFI_SCAN_RUNNING is typically -2
-        Serial.println("WiFiInterface: Scan already in progress (should not happen with blocking scan, but good to check).");
-        // If this happens with a blocking scan, it's unexpected. You might not want to overwrite _lastScanResultCount.
-    } else if (_lastScanResultCount == 0) {
-        Serial.println("WiFiInterface: Scan complete. No networks found.");
-    } else {
-        Serial.printf("WiFiInterface: Scan complete. %d networks found.\n", _lastScanResultCount);
+bool WiFiInterface::startScan() {
+    if (_scanning) {
+        return true;
+    }
+    // Hidden networks are left out: they could not be picked from the list anyway
+    if (WiFi.scanNetworks(/*async=*/true, /*show_hidden=*/false) == WIFI_SCAN_FAILED) {
+        Serial.println("WiFiInterface: Scan failed to start.");
+        return false;
     }
+    _scanning = true;
+    _scanStartTime = millis();
+    Serial.println("WiFiInterface: Scan started.");
+    return true;
 }
 
-std::vector<WiFiInterface::NetworkInfo> WiFiInterface::getScannedNetworks() const {
-    std::vector<WiFiInterface::NetworkInfo> networks;
-    if (_lastScanResultCount <= 0) { // No networks found or scan hasn't run/failed
-        Serial.println("WiFiInterface::getScannedNetworks: No scan results to return.");
-        return networks; // Return empty vector
+bool WiFiInterface::updateScan() {
+    if (!_scanning) {
+        return false;
+    }
+
+    int16_t count = WiFi.scanComplete();
+    if (count == WIFI_SCAN_RUNNING) {
+        if (millis() - _scanStartTime > SCAN_TIMEOUT_MS) {
+            Serial.println("WiFiInterface: Scan timed out.");
+            WiFi.scanDelete();
+            _scanning = false;
+        }
+        return false;
     }
 
-    networks.reserve(_lastScanResultCount); // Pre-allocate memory for efficiency
+    _scanning = false;
+    if (count < 0) {
+        Serial.println("WiFiInterface: Scan failed.");
+        WiFi.scanDelete();
+        return false;
+    }
 
-    for (int16_t i = 0; i < _lastScanResultCount; ++i) {
-        WiFiInterface::NetworkInfo net; // Explicitly scope NetworkInfo
+    std::vector<NetworkInfo> results;
+    results.reserve(count);
+    for (int16_t i = 0; i < count; ++i) {
+        NetworkInfo net;
         net.ssid = WiFi.SSID(i);
         net.rssi = WiFi.RSSI(i);
         net.encryptionType = WiFi.encryptionType(i); // This is wifi_auth_mode_t
-        // Example of how you might get other info if added to struct:
-        // net.channel = WiFi.channel(i);
-        // net.isHidden = WiFi.isHidden(i); // Note: isHidden() might not be standard on all ESP WiFi libraries
-        networks.push_back(net);
+        net.lastSeen = 0;
+        results.push_back(net);
     }
-    // It's often good practice to delete the scan results to free memory if they are not needed again soon.
-    // However, if another part of the UI might refresh the list without an immediate rescan, you might not delete.
-    // WiFi.scanDelete(); 
-    // If you do delete, you should probably reset _lastScanResultCount:
-    // const_cast<WiFiInterface*>(this)->_lastScanResultCount = 0; // Reset if scan results are deleted.
+    // The driver's copy is no longer needed once the results are in the cache
+    WiFi.scanDelete();
+
+    _lastScanTime = millis();
+    mergeScanResults(_networkCache, results, _lastScanTime);
+    Serial.printf("WiFiInterface: Scan complete. %d networks found, %u cached.\n", count, _networkCache.size());
+    return true;
+}
 
-    return networks;
+bool WiFiInterface::isScanning() const {
+    return _scanning;
+}
+
+unsigned long WiFiInterface::getLastScanTime() const {
+    return _lastScanTime;
+}
+
+std::vector<WiFiInterface::NetworkInfo> WiFiInterface::getScannedNetworks() const {
+    return _networkCache;
 }
 
 // Implementation for getCurrentSsid
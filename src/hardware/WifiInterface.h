@@ -32,6 +32,7 @@ public:
         String ssid;
         int32_t rssi;
         uint8_t encryptionType; // Corresponds to wifi_auth_mode_t like WIFI_AUTH_OPEN
+        unsigned long lastSeen; // millis() of the scan that last reported this network
         // bool isHidden; // Optional
         // int32_t channel; // Optional
     };
@@ -42,9 +43,19 @@ public:
     // Initialize the WiFi manager
     void begin();
 
-    // Connect to WiFi using stored credentials
+    // Connect to WiFi using stored credentials. If the access point it was
+    // last joined on is known, that BSSID and channel are tried first without
+    // a scan; after FAST_CONNECT_TIMEOUT_MS or a failure it falls back to a
+    // full connect within the same overall timeout.
     bool connectToStoredNetwork(unsigned long timeout = 30000);
 
+    // Time from connectToStoredNetwork() to an IP address for the last
+    // successful connect (0 if none yet), and whether the fast path made it
+    unsigned long getLastConnectTime() const;
+    bool lastConnectWasFast() const;
+
+    static const unsigned long FAST_CONNECT_TIMEOUT_MS = 4000;
+
     // Start access point mode for provisioning
     void startAccessPoint();
 
@@ -87,9 +98,23 @@ public:
     // Handle WiFi credential events
     void handleWiFiCredentialEvent(const Event& event);
 
-    // New methods for network scanning
-    void scanNetworks(); // Initiates a WiFi scan
-    std::vector<NetworkInfo> getScannedNetworks() const; // Gets the results of the last scan
+    // Network scanning. startScan() puts the radio in async scan mode and
+    // returns at once; updateScan() must then be called periodically from the
+    // same task and merges finished results into the network cache.
+    bool startScan(); // false if the scan could not be started
+    bool updateScan(); // true when a finished scan was merged into the cache
+    bool isScanning() const;
+    unsigned long getLastScanTime() const; // millis() of the last merged scan, 0 if none
+    std::vector<NetworkInfo> getScannedNetworks() const; // Cached networks, strongest first
+
+    // Merge one scan into the cache: one entry per SSID at its strongest
+    // reported RSSI, entries unseen for NETWORK_CACHE_MAX_AGE_MS dropped,
+    // sorted by RSSI and capped at MAX_CACHED_NETWORKS
+    static void mergeScanResults(std::vector<NetworkInfo>& cache, const std::vector<NetworkInfo>& results, unsigned long now);
+
+    static const unsigned long SCAN_TIMEOUT_MS = 15000;
+    static const unsigned long NETWORK_CACHE_MAX_AGE_MS = 60000;
+    static const size_t MAX_CACHED_NETWORKS = 20;
 
 private:
     // Config manager reference
@@ -125,8 +150,25 @@ private:
     // Timeout for connection attempt
     unsigned long _connectionTimeout;
 
-    // Variable to store the number of networks found by the last scan
-    int16_t _lastScanResultCount = -1; 
+    // Which connect the current attempt is making
+    enum class ConnectPhase {
+        NONE,  // No attempt in progress
+        FAST,  // Joining the remembered BSSID/channel directly
+        FULL   // Plain WiFi.begin() with a channel scan
+    };
+    ConnectPhase _connectPhase = ConnectPhase::NONE;
+    volatile bool _fastConnectFailed = false; // Set from the WiFi event task
+    bool _stationLockedToAp = false;          // Station config still holds the fast connect's BSSID/channel
+
+    // Connect time instrumentation
+    unsigned long _lastConnectTime = 0;
+    bool _lastConnectWasFast = false;
+
+    // Scan state and merged results
+    bool _scanning = false;
+    unsigned long _scanStartTime = 0;
+    unsigned long _lastScanTime = 0;
+    std::vector<NetworkInfo> _networkCache;
     
     // Flag to indicate we are connecting after portal submission
     bool _attemptingNewConnectionAfterPortal = false;
@@ -140,4 +182,10 @@ private:
     
     // Update WiFi state and publish event
     void updateState(WiFiState newState);
+
+    // Abandon a fast connect and start a full one
+    void fallBackToFullConnect();
+
+    // Record connect time and remember the access point once an IP is assigned
+    void onConnectionEstablished();
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "hardware/WifiInterface.h"
+#include <algorithm>
+
+// Kept apart from the radio code in WifiInterface.cpp so the host tests can
+// link it on its own
+
+void WiFiInterface::mergeScanResults(std::vector<NetworkInfo>& cache, const std::vector<NetworkInfo>& results, unsigned long now) {
+    for (const NetworkInfo& result : results) {
+        if (result.ssid.isEmpty()) {
+            continue;
+        }
+
+        auto existing = std::find_if(cache.begin(), cache.end(), [&](const NetworkInfo& net) {
+            return net.ssid == result.ssid;
+        });
+        if (existing == cache.end()) {
+            NetworkInfo net = result;
+            net.lastSeen = now;
+            cache.push_back(net);
+        } else if (existing->lastSeen != now || result.rssi > existing->rssi) {
+            // The first sighting in a scan replaces the old reading; further
+            // access points with the same SSID can only raise it
+            existing->rssi = result.rssi;
+            existing->encryptionType = result.encryptionType;
+            existing->lastSeen = now;
+        }
+    }
+
+    cache.erase(std::remove_if(cache.begin(), cache.end(), [&](const NetworkInfo& net) {
+        return now - net.lastSeen > NETWORK_CACHE_MAX_AGE_MS;
+    }), cache.end());
+
+    std::stable_sort(cache.begin(), cache.end(), [](const NetworkInfo& a, const NetworkInfo& b) {
+        return a.rssi > b.rssi;
+    });
+    if (cache.size() > MAX_CACHED_NETWORKS) {
+        cache.resize(MAX_CACHED_NETWORKS);
+    }
+}
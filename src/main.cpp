@@ -34,9 +34,16 @@
 #include "EventQueue.h"
 #include "esp_partition.h" // Include for partition functions
 #include "OtaManager.h"
+#include "OtaPipeline.h"
 #include <esp_sleep.h> // Added for deep sleep functionality
 #include <esp_pm.h> // Added for power management
 #include "network/PokeAPIClient.h"
+#include "Metrics.h"
+#include "Trace.h"
+#include "ResourceMonitor.h"
+#include "ui/RenderProfiler.h"
+#include "ui/UiPacer.h"
+#include <atomic>
 #include <cstring>
 
 // Display dimensions
@@ -46,6 +53,13 @@
 // LVGL display buffer size
 #define LVGL_BUFFER_ROWS 135  // Full screen height
 
+// Task stack sizes in bytes (ResourceMonitor reports how much each really uses)
+#define WIFI_TASK_STACK 8192
+#define PORTAL_TASK_STACK 8192
+#define INSIGHT_TASK_STACK 8192
+#define LVGL_TASK_STACK 8192
+#define NEOPIXEL_TASK_STACK 2048
+
 // Button configuration
 #define NUM_BUTTONS 3
 const uint8_t BUTTON_PINS[NUM_BUTTONS] = {
@@ -68,6 +82,7 @@ EventQueue* eventQueue; // Add global EventQueue
 NeoPixelController* neoPixelController;  // Renamed from neoPixelManager
 OtaManager* otaManager;
 PokeAPIClient* pokeAPIClient;
+ResourceMonitor* resourceMonitor;
 
 // Task handles
 TaskHandle_t wifiTask;
@@ -78,65 +93,12 @@ TaskHandle_t neoPixelTask;
 // WiFi connection timeout in milliseconds
 #define WIFI_TIMEOUT 30000
 
-// Queue for PokeAPI requests
-QueueHandle_t pokeAPIQueue = nullptr;
-
-// WiFi task that handles WiFi operations and network requests
+// WiFi task that handles WiFi housekeeping (PokeAPI requests run on their own workers)
 void wifiTaskFunction(void* parameter) {
-    // Create a queue for PokeAPI requests
-    pokeAPIQueue = xQueueCreate(10, sizeof(Event));
-    
-    // Subscribe to PokeAPI events and forward them to our local queue
-    eventQueue->subscribe([](const Event& event) {
-        if (event.type == EventType::POKEAPI_FETCH_REQUEST || 
-            event.type == EventType::POKEAPI_FETCH_SPRITE) {
-            // Forward to our local queue instead of processing directly
-            xQueueSend(pokeAPIQueue, &event, 0);
-        }
-    });
-    
-    Event pokeEvent;
-    
     while (1) {
         // Process WiFi events
         wifiInterface->process();
         
-        // Check for PokeAPI requests in our queue (processed in WiFi task context with proper stack)
-        if (xQueueReceive(pokeAPIQueue, &pokeEvent, 0) == pdPASS) {
-            switch (pokeEvent.type) {
-                case EventType::POKEAPI_FETCH_REQUEST:
-                    Serial.printf("[WiFi Task] Processing PokeAPI fetch request for ID %d\n", pokeEvent.intData);
-                    if (pokeAPIClient && wifiInterface->isConnected()) {
-                        pokeAPIClient->processFetchRequest(pokeEvent.intData);
-                    } else {
-                        Serial.println("[WiFi Task] Cannot fetch Pokemon - WiFi not connected or client not initialized");
-                        Event errorEvent;
-                        errorEvent.type = EventType::POKEAPI_ERROR;
-                        strncpy(errorEvent.stringData, "WiFi not connected", sizeof(errorEvent.stringData) - 1);
-                        errorEvent.stringData[sizeof(errorEvent.stringData) - 1] = '\0';
-                        eventQueue->publishEvent(errorEvent);
-                    }
-                    break;
-                    
-                case EventType::POKEAPI_FETCH_SPRITE:
-                    Serial.printf("[WiFi Task] Processing sprite fetch request for ID %d\n", pokeEvent.intData);
-                    if (pokeAPIClient && wifiInterface->isConnected()) {
-                        pokeAPIClient->processSpriteRequest(pokeEvent.intData);
-                    } else {
-                        Serial.println("[WiFi Task] Cannot fetch sprite - WiFi not connected or client not initialized");
-                        Event errorEvent;
-                        errorEvent.type = EventType::POKEAPI_ERROR;
-                        strncpy(errorEvent.stringData, "WiFi not connected", sizeof(errorEvent.stringData) - 1);
-                        errorEvent.stringData[sizeof(errorEvent.stringData) - 1] = '\0';
-                        eventQueue->publishEvent(errorEvent);
-                    }
-                    break;
-                    
-                default:
-                    break;
-            }
-        }
-        
         // Delay to prevent hogging CPU
         vTaskDelay(pdMS_TO_TICKS(10));
     }
@@ -159,10 +121,32 @@ void insightTaskFunction(void* parameter) {
     }
 }
 
+// Set by a button's level interrupt, taken by the UI task at its next pass
+static std::atomic<bool> buttonInterrupted(false);
+
+// The buttons' light-sleep wakeup level doubles as an interrupt, so a press
+// wakes the UI task at once instead of at its next poll. A level interrupt
+// keeps firing while the button is held, so the handler masks its pin until
+// the UI task sees the button let go.
+static void IRAM_ATTR onButtonLevel(void* arg) {
+    gpio_intr_disable((gpio_num_t)(uintptr_t)arg);
+    buttonInterrupted.store(true);
+    CardController::wakeUIFromISR();
+}
+
+// Unmask the interrupt of every button that is no longer held
+static void rearmButtonInterrupts() {
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        int pressedLevel = BUTTON_PINS[i] == Input::BUTTON_DOWN ? LOW : HIGH;
+        if (digitalRead(BUTTON_PINS[i]) != pressedLevel) {
+            gpio_intr_enable((gpio_num_t)BUTTON_PINS[i]);
+        }
+    }
+}
+
 // LVGL handler task that includes button polling - added here to consolidate UI operations
 void lvglHandlerTask(void* parameter) {
-    TickType_t lastButtonCheck = xTaskGetTickCount();
-    const TickType_t buttonCheckInterval = pdMS_TO_TICKS(50); // Check buttons every 50ms
+    UiPacer pacer(millis());
     
     static unsigned long powerOffPressStartTime = 0;
     // static bool upPressedState = false; // Unused
@@ -170,19 +154,23 @@ void lvglHandlerTask(void* parameter) {
 
     while (1) {
         // Handle LVGL tasks
+        uint32_t frameStart = micros();
         displayInterface->handleLVGLTasks();
 
-        cardController->processUIQueue();
+        bool animating = cardController->processUIQueue();
+        Metrics::frameTimeUs.observe(micros() - frameStart);
+        Metrics::uiWakeups.add();
         
-        // Poll buttons at regular intervals
-        TickType_t currentTime = xTaskGetTickCount();
-        if ((currentTime - lastButtonCheck) >= buttonCheckInterval) {
-            lastButtonCheck = currentTime;
-            
+        // Poll buttons at regular intervals, more slowly once nobody is using
+        // them, and straight away when a button interrupt woke us
+        if (pacer.pollDue(millis(), buttonInterrupted.exchange(false))) {
             // Update all buttons first
             for (int i = 0; i < NUM_BUTTONS; i++) {
-                buttons[i].update();
+                if (buttons[i].update()) {
+                    pacer.buttonActivity(millis());
+                }
             }
+            rearmButtonInterrupts();
 
             // Get current state of UP and DOWN buttons
             // BUTTON_UP is pressed when HIGH (INPUT_PULLDOWN)
@@ -199,6 +187,7 @@ void lvglHandlerTask(void* parameter) {
                         // Optional: Turn off display backlight or other peripherals before sleep
                         // displayInterface->setBacklight(0); // Example if such a function exists
 			esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+                        configManager->flush(); // Config writes are deferred; don't lose them
                         esp_deep_sleep_start();
                     }
                 }
@@ -224,15 +213,22 @@ void lvglHandlerTask(void* parameter) {
             }
         }
         
-        vTaskDelay(pdMS_TO_TICKS(5));
+        // Sleep until the next thing that needs this task. Asked only now,
+        // since UI updates and button presses above may have started
+        // animations or invalidated the screen since the timers last ran.
+        uint32_t wait = pacer.waitMs(millis(), animating, displayInterface->timeUntilNextLVGLTimer());
+        cardController->waitForUIWork(pdMS_TO_TICKS(wait));
     }
 }
 
 // NeoPixel update task
 void neoPixelTaskFunction(void* parameter) {
+    LedStatus::setListener(xTaskGetCurrentTaskHandle());
     while (1) {
-        neoPixelController->update();
-        vTaskDelay(pdMS_TO_TICKS(5));  // Small delay to prevent task starvation
+        uint32_t wait = neoPixelController->update();
+        // Sleep until the next keyframe; a status change wakes us early.
+        // The extra tick keeps us from waking just short of the keyframe.
+        ulTaskNotifyTake(pdTRUE, wait == LedStatus::FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(wait) + 1);
     }
 }
 
@@ -248,6 +244,8 @@ void setup() {
         
         // Set memory allocation preference to PSRAM
         heap_caps_malloc_extmem_enable(4096);
+
+        Trace::begin();
     } else {
         Serial.println("PSRAM initialization failed!");
         while(1); // Stop here if PSRAM init fails
@@ -303,6 +301,9 @@ void setup() {
     // Initialize NeoPixel controller
     neoPixelController = new NeoPixelController();
     neoPixelController->begin();
+    SystemController::onStateChange([](const ControllerState& state) {
+        LedStatus::set(LedStatus::WIFI_LOST, state.wifi_state == WifiState::DISCONNECTED);
+    });
     
     // Initialize config manager with event queue
     configManager = new ConfigManager(*eventQueue);
@@ -317,6 +318,7 @@ void setup() {
         TFT_CS, TFT_DC, TFT_RST, TFT_BACKLITE
     );
     displayInterface->begin();
+    RenderProfiler::attach(lv_display_get_default());
     
     // Initialize WiFi manager with event queue
     wifiInterface = new WiFiInterface(*configManager, *eventQueue);
@@ -324,6 +326,7 @@ void setup() {
     
     // Initialize PokeAPI client
     pokeAPIClient = new PokeAPIClient(*eventQueue);
+    pokeAPIClient->begin();
     
     // Initialize buttons
     Input::configureButtons();
@@ -334,6 +337,13 @@ void setup() {
     gpio_wakeup_enable((gpio_num_t)Input::BUTTON_CENTER, GPIO_INTR_HIGH_LEVEL);
     esp_sleep_enable_gpio_wakeup();
     Serial.println("GPIO wakeup configured for buttons");
+
+    // The same levels wake the UI task when a button is pressed
+    gpio_install_isr_service(0); // May already be installed by the Arduino core
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        gpio_isr_handler_add((gpio_num_t)BUTTON_PINS[i], onButtonLevel, (void*)(uintptr_t)BUTTON_PINS[i]);
+        gpio_intr_enable((gpio_num_t)BUTTON_PINS[i]);
+    }
     
     // Create and initialize card controller
     cardController = new CardController(
@@ -351,16 +361,19 @@ void setup() {
     
     // Initialize OtaManager
     otaManager = new OtaManager(CURRENT_FIRMWARE_VERSION, "PostHog", "DeskHog");
+    otaManager->setBeforeRestart([]() {
+        configManager->flush(); // Config writes are deferred; don't lose them
+    });
     
     // Initialize captive portal
     captivePortal = new CaptivePortal(*configManager, *wifiInterface, *eventQueue, *otaManager, *cardController);
     captivePortal->begin();
     
-    // Create task for WiFi operations (needs more stack for HTTPS)
-    xTaskCreatePinnedToCore(
+    // Create task for WiFi operations (HTTPS now happens on the PokeAPI workers)
+    ResourceMonitor::createTask(
         wifiTaskFunction,
         "wifiTask",
-        16384,  // Increased stack size for HTTPS operations
+        WIFI_TASK_STACK,
         NULL,
         1,
         &wifiTask,
@@ -368,10 +381,10 @@ void setup() {
     );
     
     // Create task for captive portal
-    xTaskCreatePinnedToCore(
+    ResourceMonitor::createTask(
         portalTaskFunction,
         "portalTask",
-        8192,
+        PORTAL_TASK_STACK,
         NULL,
         1,
         &portalTask,
@@ -379,32 +392,21 @@ void setup() {
     );
     
     // Create task for insight processing
-    xTaskCreatePinnedToCore(
+    ResourceMonitor::createTask(
         insightTaskFunction,
         "insightTask",
-        8192,
+        INSIGHT_TASK_STACK,
         NULL,
         1,
         &insightTask,
         0
     );
     
-    // Create LVGL tick task
-    xTaskCreatePinnedToCore(
-        DisplayInterface::tickTask,
-        "lv_tick_task",
-        2048,
-        NULL,
-        1,
-        NULL,
-        1
-    );
-    
     // Create LVGL handler task (now includes button polling)
-    xTaskCreatePinnedToCore(
+    ResourceMonitor::createTask(
         lvglHandlerTask,
         "lvglTask",
-        8192,
+        LVGL_TASK_STACK,
         NULL,
         2,
         NULL,
@@ -412,16 +414,33 @@ void setup() {
     );
     
     // Create NeoPixel task
-    xTaskCreatePinnedToCore(
+    ResourceMonitor::createTask(
         neoPixelTaskFunction,
         "neoPixelTask",
-        2048,
+        NEOPIXEL_TASK_STACK,
         NULL,
         1,
         &neoPixelTask,
         0
     );
     
+    // Sample stack and heap watermarks in the background
+    resourceMonitor = new ResourceMonitor();
+    resourceMonitor->watchTask("wifiTask", WIFI_TASK_STACK);
+    resourceMonitor->watchTask("portalTask", PORTAL_TASK_STACK);
+    resourceMonitor->watchTask("insightTask", INSIGHT_TASK_STACK);
+    resourceMonitor->watchTask("lvglTask", LVGL_TASK_STACK);
+    resourceMonitor->watchTask("neoPixelTask", NEOPIXEL_TASK_STACK);
+    // Created inside their components
+    resourceMonitor->watchTask("EventQueueTask", EventQueue::TASK_STACK_SIZE);
+    resourceMonitor->watchTask("configFlush", ConfigManager::FLUSH_TASK_STACK_SIZE);
+    resourceMonitor->watchTask("otaCheckTask", OtaManager::CHECK_TASK_STACK_SIZE);
+    resourceMonitor->watchTask("otaUpdateTask", OtaManager::UPDATE_TASK_STACK_SIZE);
+    resourceMonitor->watchTask("otaFlashTask", OtaPipeline::WRITER_TASK_STACK_SIZE);
+    resourceMonitor->watchTask("poke_species", PokeAPIClient::LANE_STACK_SIZE);
+    resourceMonitor->watchTask("poke_sprite", PokeAPIClient::LANE_STACK_SIZE);
+    resourceMonitor->begin();
+
     // Check if we have WiFi credentials and publish the appropriate event
     configManager->checkWiFiCredentialsAndPublish();
 
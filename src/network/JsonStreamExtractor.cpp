@@ -0,0 +1,367 @@
+#include "network/JsonStreamExtractor.h"
+#include <cstring>
+
+JsonStreamExtractor::JsonStreamExtractor() {
+    reset();
+}
+
+void JsonStreamExtractor::reset() {
+    _state = State::VALUE;
+    _stopped = false;
+    _bytesConsumed = 0;
+    _depth = 0;
+    _pathLength = 0;
+    _pathOverflow = false;
+    _path[0] = '\0';
+    _valueLength = 0;
+    _value[0] = '\0';
+    _inKey = false;
+    _escape = 0;
+    _unicode = 0;
+    _highSurrogate = 0;
+}
+
+bool JsonStreamExtractor::feed(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (!step((char)data[i])) {
+            _bytesConsumed += i + 1;
+            return false;
+        }
+    }
+    _bytesConsumed += length;
+    return true;
+}
+
+size_t JsonStreamExtractor::parseStream(Stream& stream, int contentLength, unsigned long idleTimeoutMs,
+                                        ConnectionCheck isConnected) {
+    uint8_t chunk[READ_CHUNK_SIZE];
+    size_t total = 0;
+    unsigned long lastDataTime = millis();
+
+    while (contentLength < 0 || total < (size_t)contentLength) {
+        int available = stream.available();
+        if (available <= 0) {
+            // Without a Content-Length the end of the body is the server closing
+            if (isConnected && !isConnected()) {
+                Serial.printf("[JsonStream] Connection closed after %u bytes\n", (unsigned)total);
+                break;
+            }
+            if (millis() - lastDataTime > idleTimeoutMs) {
+                Serial.printf("[JsonStream] No data for %lu ms after %u bytes, giving up\n",
+                              idleTimeoutMs, (unsigned)total);
+                break;
+            }
+            delay(1);
+            continue;
+        }
+
+        size_t toRead = (size_t)available < sizeof(chunk) ? (size_t)available : sizeof(chunk);
+        if (contentLength >= 0 && toRead > (size_t)contentLength - total) {
+            toRead = (size_t)contentLength - total;
+        }
+
+        size_t bytesRead = stream.readBytes(chunk, toRead);
+        if (bytesRead == 0) {
+            continue;
+        }
+        total += bytesRead;
+        lastDataTime = millis();
+
+        if (!feed(chunk, bytesRead)) {
+            break;
+        }
+    }
+
+    if (hasError()) {
+        Serial.printf("[JsonStream] Malformed JSON near byte %u\n", (unsigned)_bytesConsumed);
+    }
+
+    return total;
+}
+
+bool JsonStreamExtractor::step(char c) {
+    bool isWhitespace = (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+
+    switch (_state) {
+        case State::VALUE_OR_END:
+            if (c == ']') {
+                return closeContainer(true);
+            }
+            // Fall through - anything else must be the first element
+        case State::VALUE:
+            if (isWhitespace) break;
+            if (c == '{') return openContainer(false);
+            if (c == '[') return openContainer(true);
+            if (c == '"') {
+                _inKey = false;
+                _valueLength = 0;
+                _state = State::STRING;
+            } else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+                _valueLength = 0;
+                appendValue(c);
+                _state = State::LITERAL;
+            } else {
+                _state = State::ERROR;
+            }
+            break;
+
+        case State::KEY_OR_END:
+            if (c == '}') {
+                return closeContainer(false);
+            }
+            // Fall through - anything else must be the first key
+        case State::KEY:
+            if (isWhitespace) break;
+            if (c == '"') {
+                beginKey();
+                _state = State::STRING;
+            } else {
+                _state = State::ERROR;
+            }
+            break;
+
+        case State::COLON:
+            if (isWhitespace) break;
+            _state = (c == ':') ? State::VALUE : State::ERROR;
+            break;
+
+        case State::STRING:
+            return stringChar(c);
+
+        case State::LITERAL:
+            if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                c == '-' || c == '+' || c == '.') {
+                appendValue(c);
+                break;
+            }
+            if (!finishLiteral()) {
+                return false;
+            }
+            // The terminating character belongs to the enclosing container
+            return step(c);
+
+        case State::AFTER_VALUE:
+            if (isWhitespace) break;
+            if (c == ',') {
+                _state = _stack[_depth - 1].isArray ? State::VALUE : State::KEY;
+            } else if (c == ']') {
+                return closeContainer(true);
+            } else if (c == '}') {
+                return closeContainer(false);
+            } else {
+                _state = State::ERROR;
+            }
+            break;
+
+        case State::DONE:
+        case State::ERROR:
+            return false;
+    }
+
+    return _state != State::ERROR;
+}
+
+bool JsonStreamExtractor::stringChar(char c) {
+    if (_escape == 0) {
+        if (c == '\\') {
+            _escape = 1;
+        } else if (c == '"') {
+            _highSurrogate = 0;
+            if (_inKey) {
+                _state = State::COLON;
+                return true;
+            }
+            if (!emitValue(ValueType::STRING)) {
+                return false;
+            }
+            return finishValue();
+        } else {
+            appendStringChar(c);
+        }
+        return true;
+    }
+
+    if (_escape == 1) {
+        _escape = 0;
+        switch (c) {
+            case '"':
+            case '\\':
+            case '/': appendStringChar(c); break;
+            case 'b': appendStringChar('\b'); break;
+            case 'f': appendStringChar('\f'); break;
+            case 'n': appendStringChar('\n'); break;
+            case 'r': appendStringChar('\r'); break;
+            case 't': appendStringChar('\t'); break;
+            case 'u':
+                _escape = 2;
+                _unicode = 0;
+                break;
+            default:
+                _state = State::ERROR;
+                return false;
+        }
+        return true;
+    }
+
+    // Reading the four hex digits of a \u escape
+    uint8_t digit;
+    if (c >= '0' && c <= '9') digit = c - '0';
+    else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+    else {
+        _state = State::ERROR;
+        return false;
+    }
+
+    _unicode = (_unicode << 4) | digit;
+    if (++_escape < 6) {
+        return true;
+    }
+    _escape = 0;
+
+    if (_unicode >= 0xD800 && _unicode < 0xDC00) {
+        _highSurrogate = _unicode;
+    } else if (_unicode >= 0xDC00 && _unicode < 0xE000) {
+        if (_highSurrogate) {
+            appendCodepoint(0x10000 + ((_highSurrogate - 0xD800) << 10) + (_unicode - 0xDC00));
+            _highSurrogate = 0;
+        } else {
+            appendCodepoint(0xFFFD);
+        }
+    } else {
+        appendCodepoint(_unicode);
+    }
+    return true;
+}
+
+bool JsonStreamExtractor::openContainer(bool isArray) {
+    if (_depth >= MAX_DEPTH) {
+        _state = State::ERROR;
+        return false;
+    }
+
+    Frame& frame = _stack[_depth++];
+    frame.isArray = isArray;
+    frame.pathOverflow = _pathOverflow;
+    frame.pathBase = _pathLength;
+
+    if (isArray) {
+        appendPath('[');
+        appendPath(']');
+        _state = State::VALUE_OR_END;
+    } else {
+        _state = State::KEY_OR_END;
+    }
+    return true;
+}
+
+bool JsonStreamExtractor::closeContainer(bool isArray) {
+    if (_depth == 0 || _stack[_depth - 1].isArray != isArray) {
+        _state = State::ERROR;
+        return false;
+    }
+
+    const Frame& frame = _stack[--_depth];
+    _pathLength = frame.pathBase;
+    _pathOverflow = frame.pathOverflow;
+
+    if (!isArray && _objectEndHandler && !_pathOverflow) {
+        _path[_pathLength] = '\0';
+        if (!_objectEndHandler(_path)) {
+            _stopped = true;
+            return false;
+        }
+    }
+
+    return finishValue();
+}
+
+void JsonStreamExtractor::beginKey() {
+    const Frame& frame = _stack[_depth - 1];
+    _pathLength = frame.pathBase;
+    _pathOverflow = frame.pathOverflow;
+    if (_pathLength > 0) {
+        appendPath('.');
+    }
+    _inKey = true;
+}
+
+void JsonStreamExtractor::appendPath(char c) {
+    if (_pathLength < MAX_PATH_LENGTH - 1) {
+        _path[_pathLength++] = c;
+    } else {
+        _pathOverflow = true;
+    }
+}
+
+void JsonStreamExtractor::appendValue(char c) {
+    if (_valueLength < MAX_VALUE_LENGTH - 1) {
+        _value[_valueLength++] = c;
+    }
+}
+
+void JsonStreamExtractor::appendStringChar(char c) {
+    if (_inKey) {
+        appendPath(c);
+    } else {
+        appendValue(c);
+    }
+}
+
+void JsonStreamExtractor::appendCodepoint(uint32_t codepoint) {
+    if (codepoint < 0x80) {
+        appendStringChar((char)codepoint);
+    } else if (codepoint < 0x800) {
+        appendStringChar((char)(0xC0 | (codepoint >> 6)));
+        appendStringChar((char)(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+        appendStringChar((char)(0xE0 | (codepoint >> 12)));
+        appendStringChar((char)(0x80 | ((codepoint >> 6) & 0x3F)));
+        appendStringChar((char)(0x80 | (codepoint & 0x3F)));
+    } else {
+        appendStringChar((char)(0xF0 | (codepoint >> 18)));
+        appendStringChar((char)(0x80 | ((codepoint >> 12) & 0x3F)));
+        appendStringChar((char)(0x80 | ((codepoint >> 6) & 0x3F)));
+        appendStringChar((char)(0x80 | (codepoint & 0x3F)));
+    }
+}
+
+bool JsonStreamExtractor::finishLiteral() {
+    _value[_valueLength] = '\0';
+
+    ValueType type;
+    if (strcmp(_value, "true") == 0 || strcmp(_value, "false") == 0) {
+        type = ValueType::BOOLEAN;
+    } else if (strcmp(_value, "null") == 0) {
+        type = ValueType::NULL_VALUE;
+    } else if (_value[0] == '-' || (_value[0] >= '0' && _value[0] <= '9')) {
+        type = ValueType::NUMBER;
+    } else {
+        _state = State::ERROR;
+        return false;
+    }
+
+    if (!emitValue(type)) {
+        return false;
+    }
+    return finishValue();
+}
+
+bool JsonStreamExtractor::finishValue() {
+    _state = (_depth == 0) ? State::DONE : State::AFTER_VALUE;
+    return _state != State::DONE;
+}
+
+bool JsonStreamExtractor::emitValue(ValueType type) {
+    if (!_valueHandler || _pathOverflow) {
+        return true;
+    }
+
+    _value[_valueLength] = '\0';
+    _path[_pathLength] = '\0';
+    if (!_valueHandler(_path, _value, type)) {
+        _stopped = true;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+/**
+ * @class JsonStreamExtractor
+ * @brief Single-pass, fixed-memory JSON scanner for pulling a few fields out of large responses
+ *
+ * Bytes are fed in as they arrive from the network. The extractor tracks the
+ * key path of the current position and reports scalar values and object ends
+ * to the caller, who decides what to keep. Array elements appear as "[]" in
+ * paths, so the language name of any flavor text entry is reported as
+ * "flavor_text_entries[].language.name".
+ *
+ * Memory use does not depend on the document size: nesting depth, path length
+ * and captured values are bounded by the constants below. String values longer
+ * than MAX_VALUE_LENGTH are truncated, and values under paths longer than
+ * MAX_PATH_LENGTH are skipped rather than reported under a wrong path.
+ */
+class JsonStreamExtractor {
+public:
+    /**
+     * @enum ValueType
+     * @brief Kind of scalar value being reported
+     */
+    enum class ValueType {
+        STRING,      ///< Unescaped UTF-8 string
+        NUMBER,      ///< Number, reported as its literal text
+        BOOLEAN,     ///< "true" or "false"
+        NULL_VALUE   ///< "null"
+    };
+
+    /**
+     * @brief Called for every scalar value
+     * @return false to stop parsing
+     */
+    using ValueHandler = std::function<bool(const char* path, const char* value, ValueType type)>;
+
+    /**
+     * @brief Called when an object closes, with the path of the object itself
+     * @return false to stop parsing
+     */
+    using ObjectEndHandler = std::function<bool(const char* path)>;
+
+    /**
+     * @brief Reports whether the connection behind a stream is still open
+     */
+    using ConnectionCheck = std::function<bool()>;
+
+    static const size_t MAX_DEPTH = 16;          ///< Deepest nesting accepted
+    static const size_t MAX_PATH_LENGTH = 128;   ///< Longest key path tracked
+    static const size_t MAX_VALUE_LENGTH = 256;  ///< Largest value captured, including terminator
+    static const size_t READ_CHUNK_SIZE = 512;   ///< Bytes pulled from a stream per read
+
+    JsonStreamExtractor();
+
+    /**
+     * @brief Register the scalar value handler
+     */
+    void onValue(ValueHandler handler) { _valueHandler = handler; }
+
+    /**
+     * @brief Register the object end handler
+     */
+    void onObjectEnd(ObjectEndHandler handler) { _objectEndHandler = handler; }
+
+    /**
+     * @brief Reset parser state so a new document can be fed (handlers are kept)
+     */
+    void reset();
+
+    /**
+     * @brief Feed the next slice of the document
+     * @param data Bytes to parse
+     * @param length Number of bytes
+     * @return true if more input is wanted, false once the document is complete,
+     *         a handler asked to stop, or the input is malformed
+     */
+    bool feed(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Read and parse a document from a stream until it is finished
+     * @param stream Source stream (e.g. HTTPClient::getStreamPtr())
+     * @param contentLength Expected body size, or -1 if unknown
+     * @param idleTimeoutMs Give up after this long without receiving data
+     * @param isConnected Optional; once it returns false and nothing is left to
+     *        read, stop without waiting out the idle timeout
+     * @return Number of bytes consumed from the stream
+     *
+     * Only reads what is already available, so it never blocks waiting for a
+     * full chunk and stops as soon as the root value closes.
+     */
+    size_t parseStream(Stream& stream, int contentLength, unsigned long idleTimeoutMs,
+                       ConnectionCheck isConnected = nullptr);
+
+    bool isComplete() const { return _state == State::DONE; }
+    bool isStopped() const { return _stopped; }
+    bool hasError() const { return _state == State::ERROR; }
+    size_t bytesConsumed() const { return _bytesConsumed; }
+
+private:
+    enum class State {
+        VALUE,          ///< Expecting a value
+        VALUE_OR_END,   ///< Expecting a value or ']' right after '['
+        KEY_OR_END,     ///< Expecting a key or '}' right after '{'
+        KEY,            ///< Expecting a key after ','
+        COLON,          ///< Expecting ':' after a key
+        STRING,         ///< Inside a key or string value
+        LITERAL,        ///< Inside a number, true, false or null
+        AFTER_VALUE,    ///< Expecting ',' or a closing bracket
+        DONE,
+        ERROR
+    };
+
+    struct Frame {
+        bool isArray;      ///< Array or object
+        bool pathOverflow; ///< Path was already truncated when the container opened
+        uint16_t pathBase; ///< Path length when the container opened
+    };
+
+    bool step(char c);
+    bool openContainer(bool isArray);
+    bool closeContainer(bool isArray);
+    void beginKey();
+    void appendPath(char c);
+    void appendValue(char c);
+    void appendStringChar(char c);
+    void appendCodepoint(uint32_t codepoint);
+    bool stringChar(char c);
+    bool finishLiteral();
+    bool finishValue();
+    bool emitValue(ValueType type);
+
+    ValueHandler _valueHandler;
+    ObjectEndHandler _objectEndHandler;
+
+    State _state;
+    bool _stopped;
+    size_t _bytesConsumed;
+
+    Frame _stack[MAX_DEPTH];
+    size_t _depth;
+
+    char _path[MAX_PATH_LENGTH];
+    size_t _pathLength;
+    bool _pathOverflow;
+
+    char _value[MAX_VALUE_LENGTH];
+    size_t _valueLength;
+
+    // String decoding
+    bool _inKey;
+    uint8_t _escape;          ///< 0 = none, 1 = after '\', 2-5 = reading \u hex digits
+    uint32_t _unicode;        ///< \u code unit being assembled
+    uint32_t _highSurrogate;  ///< Pending UTF-16 high surrogate, or 0
+};
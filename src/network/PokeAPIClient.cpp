@@ -1,306 +1,378 @@
 // PokeAPIClient.cpp
 #include "network/PokeAPIClient.h"
-#include <ArduinoJson.h>
-#include <HTTPClient.h>
+#include "network/JsonStreamExtractor.h"
+#include "ResourceMonitor.h"
+#include <WiFi.h>
 #include <cstring>
+#include <new>
 
-PokeAPIClient::PokeAPIClient(EventQueue& eventQueue) : _eventQueue(eventQueue) {
-    // Configure SSL client to skip certificate verification for now
-    _secureClient.setInsecure();
+#ifdef POKEAPI_HOST
+static String speciesUrl(int id) { return String(POKEAPI_HOST) + "/api/v2/pokemon-species/" + String(id); }
+static String spriteUrl(int id) { return String(POKEAPI_HOST) + "/sprites/pokemon/" + String(id) + ".png"; }
+#else
+static String speciesUrl(int id) { return "https://pokeapi.co/api/v2/pokemon-species/" + String(id); }
+// Use direct sprite URL to avoid extra API calls
+static String spriteUrl(int id) {
+    return "https://raw.githubusercontent.com/PokeAPI/sprites/master/sprites/pokemon/" + String(id) + ".png";
+}
+#endif
+
+PokeAPIClient::PokeAPIClient(EventQueue& eventQueue)
+    : _eventQueue(eventQueue)
+    , _prefetchGeneration(0) {
+    _speciesLane.kind = LaneKind::SPECIES;
+    _speciesLane.name = "species";
+    _spriteLane.kind = LaneKind::SPRITE;
+    _spriteLane.name = "sprite";
+    
+    for (Lane* lane : {&_speciesLane, &_spriteLane}) {
+        lane->client = this;
+        lane->queue = nullptr;
+        lane->task = nullptr;
+        // Configure SSL client to skip certificate verification for now
+        lane->secureClient.setInsecure();
+    }
 }
 
 PokeAPIClient::~PokeAPIClient() {
-    // Destructor
+    for (Lane* lane : {&_speciesLane, &_spriteLane}) {
+        if (lane->task) {
+            ResourceMonitor::deleteTask(lane->task);
+            lane->task = nullptr;
+        }
+        if (lane->queue) {
+            vQueueDelete(lane->queue);
+            lane->queue = nullptr;
+        }
+    }
 }
 
-void PokeAPIClient::processFetchRequest(int pokemonId) {
-    Serial.printf("[PokeAPI] Starting fetch for Pokemon #%d\n", pokemonId);
+bool PokeAPIClient::begin() {
+    for (Lane* lane : {&_speciesLane, &_spriteLane}) {
+        lane->queue = xQueueCreate(LANE_QUEUE_LENGTH, sizeof(Job));
+        if (!lane->queue) {
+            Serial.printf("[PokeAPI] Failed to create %s queue\n", lane->name);
+            return false;
+        }
+        
+        char taskName[16];
+        snprintf(taskName, sizeof(taskName), "poke_%s", lane->name);
+        if (ResourceMonitor::createTask(
+                laneTask,
+                taskName,
+                LANE_STACK_SIZE,
+                lane,
+                1,
+                &lane->task,
+                0
+            ) != pdPASS) {
+            Serial.printf("[PokeAPI] Failed to create %s worker\n", lane->name);
+            return false;
+        }
+    }
     
-    // First fetch species data for name and description
-    String name = "";
-    String description = "";
+    _eventQueue.subscribe([this](const Event& event) {
+        switch (event.type) {
+            case EventType::POKEAPI_FETCH_REQUEST:
+                // Both lanes start together; the card pairs the results by id
+                requestSpecies(event.intData);
+                requestSprite(event.intData);
+                break;
+            case EventType::POKEAPI_FETCH_SPRITE:
+                requestSprite(event.intData);
+                break;
+            case EventType::POKEAPI_PREFETCH_REQUEST:
+                requestPrefetch(event.intData);
+                break;
+            case EventType::POKEAPI_PREFETCH_CANCEL:
+                cancelPrefetch();
+                break;
+            default:
+                break;
+        }
+    });
     
-    if (fetchSpeciesData(pokemonId, name, description)) {
-        Serial.printf("[PokeAPI] Sending event: name='%s', desc='%s'\n", name.c_str(), description.c_str());
-        // Send data ready event
-        Event event;
-        event.type = EventType::POKEAPI_DATA_READY;
-        event.intData = pokemonId;
-        strncpy(event.stringData, name.c_str(), sizeof(event.stringData) - 1);
-        event.stringData[sizeof(event.stringData) - 1] = '\0';
-        strncpy(event.stringData2, description.c_str(), sizeof(event.stringData2) - 1);
-        event.stringData2[sizeof(event.stringData2) - 1] = '\0';
-        _eventQueue.publishEvent(event);
-    } else {
-        // Send error event
-        Event event;
-        event.type = EventType::POKEAPI_ERROR;
-        strncpy(event.stringData, "Failed to fetch Pokemon data", sizeof(event.stringData) - 1);
-        event.stringData[sizeof(event.stringData) - 1] = '\0';
-        _eventQueue.publishEvent(event);
-    }
+    return true;
+}
+
+bool PokeAPIClient::requestSpecies(int pokemonId) {
+    return enqueue(_speciesLane, pokemonId, false);
+}
+
+bool PokeAPIClient::requestSprite(int pokemonId) {
+    return enqueue(_spriteLane, pokemonId, false);
+}
+
+bool PokeAPIClient::requestPrefetch(int pokemonId) {
+    bool queued = enqueue(_speciesLane, pokemonId, true);
+    return enqueue(_spriteLane, pokemonId, true) && queued;
+}
+
+void PokeAPIClient::cancelPrefetch() {
+    // Queued and waiting prefetch jobs carry the old generation and are dropped
+    _prefetchGeneration++;
 }
 
-void PokeAPIClient::processSpriteRequest(int pokemonId) {
-    Serial.printf("[PokeAPI] Fetching sprite for Pokemon #%d\n", pokemonId);
+bool PokeAPIClient::enqueue(Lane& lane, int pokemonId, bool prefetch) {
+    Job job;
+    job.pokemonId = pokemonId;
+    job.prefetch = prefetch;
+    job.generation = _prefetchGeneration;
+    job.attempt = 0;
+    job.retryAt = 0;
+    job.queuedAt = millis();
     
-    size_t size = 0;
-    uint8_t* pngData = fetchSpriteData(pokemonId, size);
+    if (!lane.queue || xQueueSend(lane.queue, &job, 0) != pdPASS) {
+        Serial.printf("[PokeAPI] %s queue full, dropping #%d\n", lane.name, pokemonId);
+        if (!prefetch) {
+            publishError(pokemonId, "PokeAPI busy");
+        }
+        return false;
+    }
+    return true;
+}
+
+WiFiClient& PokeAPIClient::clientFor(Lane& lane, const String& url) {
+    if (url.startsWith("https://")) {
+        return lane.secureClient;
+    }
+    return lane.plainClient;
+}
+
+void PokeAPIClient::laneTask(void* parameter) {
+    Lane* lane = static_cast<Lane*>(parameter);
+    lane->client->runLane(*lane);
+}
+
+void PokeAPIClient::runLane(Lane& lane) {
+    Job waiting[MAX_WAITING_JOBS];
+    size_t waitingCount = 0;
     
-    if (pngData && size > 0) {
-        Serial.printf("[PokeAPI] Got sprite: %d bytes\n", size);
+    while (true) {
+        // Sleep until a new job arrives or the earliest retry falls due
+        unsigned long now = millis();
+        TickType_t wait = portMAX_DELAY;
+        for (size_t i = 0; i < waitingCount; i++) {
+            long remaining = (long)(waiting[i].retryAt - now);
+            TickType_t ticks = remaining > 0 ? pdMS_TO_TICKS(remaining) : 0;
+            if (ticks < wait) {
+                wait = ticks;
+            }
+        }
+        
+        if (waitingCount < MAX_WAITING_JOBS) {
+            Job incoming;
+            while (waitingCount < MAX_WAITING_JOBS &&
+                   xQueueReceive(lane.queue, &incoming, wait) == pdPASS) {
+                waiting[waitingCount++] = incoming;
+                wait = 0;  // Drain anything else already queued
+            }
+        } else if (wait > 0) {
+            // Full of jobs backing off; new ones stay in the queue until a slot frees
+            vTaskDelay(wait);
+        }
+        
+        // Drop cancelled prefetches, then pick a due job, foreground first
+        now = millis();
+        uint32_t generation = _prefetchGeneration;
+        int next = -1;
+        for (size_t i = 0; i < waitingCount; ) {
+            if (waiting[i].prefetch && waiting[i].generation != generation) {
+                Serial.printf("[PokeAPI] Dropping cancelled %s prefetch of #%d\n", lane.name, waiting[i].pokemonId);
+                waiting[i] = waiting[--waitingCount];
+                continue;
+            }
+            bool due = (long)(waiting[i].retryAt - now) <= 0;
+            if (due && (next < 0 || (waiting[next].prefetch && !waiting[i].prefetch))) {
+                next = i;
+            }
+            i++;
+        }
+        
+        if (next < 0) {
+            continue;
+        }
+        
+        Job& job = waiting[next];
+        job.attempt++;
+        Outcome outcome = attempt(lane, job);
+        
+        if (outcome == Outcome::RETRY && job.attempt < MAX_ATTEMPTS) {
+            // Back off without blocking the lane; other jobs can run meanwhile
+            unsigned long backoff = RETRY_BASE_DELAY_MS << (job.attempt - 1);
+            job.retryAt = millis() + backoff;
+            Serial.printf("[PokeAPI] Retrying %s #%d in %lums (attempt %d/%d)\n",
+                          lane.name, job.pokemonId, backoff, job.attempt + 1, MAX_ATTEMPTS);
+            continue;
+        }
+        
+        if (outcome == Outcome::NO_WIFI) {
+            publishError(job.pokemonId, "WiFi not connected");
+        } else if (outcome != Outcome::SUCCESS) {
+            publishError(job.pokemonId, lane.kind == LaneKind::SPECIES ?
+                         "Failed to fetch Pokemon data" : "Failed to fetch sprite");
+        }
         
-        // Send sprite ready event
-        Event event;
-        event.type = EventType::POKEAPI_SPRITE_READY;
-        event.intData = pokemonId;
-        event.byteData = pngData;
-        event.byteDataSize = size;
-        _eventQueue.publishEvent(event);
+        waiting[next] = waiting[--waitingCount];
+    }
+}
+
+PokeAPIClient::Outcome PokeAPIClient::attempt(Lane& lane, const Job& job) {
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.printf("[PokeAPI] Cannot fetch %s for #%d - WiFi not connected\n", lane.name, job.pokemonId);
+        return Outcome::NO_WIFI;
+    }
+    
+    Serial.printf("[PokeAPI] Fetching %s for Pokemon #%d%s\n", lane.name, job.pokemonId,
+                  job.prefetch ? " (prefetch)" : "");
+    
+    Event event;
+    event.intData = job.pokemonId;
+    Outcome outcome;
+    
+    if (lane.kind == LaneKind::SPECIES) {
+        String name = "";
+        String description = "";
+        outcome = fetchSpeciesData(lane, job.pokemonId, name, description);
+        if (outcome == Outcome::SUCCESS) {
+            event.type = EventType::POKEAPI_DATA_READY;
+            strncpy(event.stringData, name.c_str(), sizeof(event.stringData) - 1);
+            event.stringData[sizeof(event.stringData) - 1] = '\0';
+            strncpy(event.stringData2, description.c_str(), sizeof(event.stringData2) - 1);
+            event.stringData2[sizeof(event.stringData2) - 1] = '\0';
+        }
     } else {
-        // Send error event
-        Event event;
-        event.type = EventType::POKEAPI_ERROR;
-        strncpy(event.stringData, "Failed to fetch sprite", sizeof(event.stringData) - 1);
-        event.stringData[sizeof(event.stringData) - 1] = '\0';
-        _eventQueue.publishEvent(event);
+        uint8_t* pngData = nullptr;
+        size_t size = 0;
+        outcome = fetchSpriteData(lane, job.pokemonId, pngData, size);
+        if (outcome == Outcome::SUCCESS) {
+            event.type = EventType::POKEAPI_SPRITE_READY;
+            event.byteData = pngData;
+            event.byteDataSize = size;
+        }
+    }
+    
+    if (outcome == Outcome::SUCCESS) {
+        Serial.printf("[PokeAPI] %s #%d ready %lu ms after request\n", lane.name, job.pokemonId,
+                      millis() - job.queuedAt);
+        if (!_eventQueue.publishEvent(event) && event.byteData) {
+            delete[] event.byteData;
+        }
     }
+    
+    return outcome;
 }
 
-bool PokeAPIClient::fetchSpeciesData(int id, String& name, String& description) {
-    String url = "https://pokeapi.co/api/v2/pokemon-species/" + String(id);
+void PokeAPIClient::publishError(int pokemonId, const char* message) {
+    Event event;
+    event.type = EventType::POKEAPI_ERROR;
+    event.intData = pokemonId;
+    strncpy(event.stringData, message, sizeof(event.stringData) - 1);
+    event.stringData[sizeof(event.stringData) - 1] = '\0';
+    _eventQueue.publishEvent(event);
+}
+
+PokeAPIClient::Outcome PokeAPIClient::fetchSpeciesData(Lane& lane, int id, String& name, String& description) {
+    String url = speciesUrl(id);
     Serial.printf("[PokeAPI] Fetching species from: %s\n", url.c_str());
     
-    // Retry logic with exponential backoff
-    const int maxRetries = 3;
-    int retryDelay = 1000; // Start with 1 second
+    HTTPClient& http = lane.http;
+    http.begin(clientFor(lane, url), url);
+    http.setTimeout(15000); // 15 second timeout
+    http.useHTTP10(true); // Avoid chunked transfer encoding so the raw stream is plain JSON
+    http.addHeader("User-Agent", "DeskHog/1.0");
+    
+    int httpCode = http.GET();
+    
+    if (httpCode == 200) {
+        // Stream the body through the extractor instead of buffering it
+        unsigned long parseStart = millis();
+        int contentLength = http.getSize();
+        bool parsed = parseSpeciesStream(http.getStreamPtr(), contentLength,
+                                         [&http]() { return http.connected(); }, name, description);
+        Serial.printf("[PokeAPI] Species parse time: %lu ms\n", millis() - parseStart);
+        
+        http.end();
+        
+        if (parsed) {
+            Serial.printf("[PokeAPI] fetchSpeciesData returning: name='%s', desc='%s'\n", 
+                          name.c_str(), description.c_str());
+            return Outcome::SUCCESS;
+        }
+        return Outcome::RETRY;
+    }
+    
+    if (httpCode > 0) {
+        Serial.printf("[PokeAPI] HTTP error: %d\n", httpCode);
+        http.end();
+        
+        // Don't retry on 404 or other client errors
+        return (httpCode >= 400 && httpCode < 500) ? Outcome::FAILED : Outcome::RETRY;
+    }
+    
+    Serial.printf("[PokeAPI] Connection error: %s\n", http.errorToString(httpCode).c_str());
+    http.end();
+    return Outcome::RETRY;
+}
+
+bool PokeAPIClient::parseSpeciesStream(Stream* stream, int contentLength,
+                                       JsonStreamExtractor::ConnectionCheck isConnected,
+                                       String& name, String& description) {
     bool foundName = false;
     bool foundDescription = false;
     
-    for (int attempt = 0; attempt < maxRetries; attempt++) {
-        if (attempt > 0) {
-            Serial.printf("[PokeAPI] Retry attempt %d/%d after %dms delay\n", 
-                         attempt + 1, maxRetries, retryDelay);
-            delay(retryDelay);
-            retryDelay *= 2; // Exponential backoff
+    // Flavor text arrives before its language tag, so hold the current entry's
+    // text until the entry closes and we know whether it is English
+    char candidateText[JsonStreamExtractor::MAX_VALUE_LENGTH];
+    candidateText[0] = '\0';
+    bool candidateIsEnglish = false;
+    
+    JsonStreamExtractor extractor;
+    extractor.onValue([&](const char* path, const char* value, JsonStreamExtractor::ValueType type) {
+        if (type != JsonStreamExtractor::ValueType::STRING) {
+            return true;
         }
         
-        _http.begin(_secureClient, url);
-        _http.setTimeout(15000); // 15 second timeout
-        _http.addHeader("User-Agent", "DeskHog/1.0");
-        
-        int httpCode = _http.GET();
+        if (!foundName && strcmp(path, "name") == 0) {
+            name = value;
+            foundName = true;
+            Serial.printf("[PokeAPI] Found Pokemon name: %s\n", name.c_str());
+        } else if (!foundDescription && strcmp(path, "flavor_text_entries[].flavor_text") == 0) {
+            strlcpy(candidateText, value, sizeof(candidateText));
+        } else if (!foundDescription && strcmp(path, "flavor_text_entries[].language.name") == 0) {
+            candidateIsEnglish = (strcmp(value, "en") == 0);
+        }
         
-        if (httpCode == 200) {
-            // Parse JSON stream to extract name and description
-            Stream* stream = _http.getStreamPtr();
-            String buffer = "";
-            
-            while (stream->available() && (!foundName || !foundDescription)) {
-                char c = stream->read();
-                buffer += c;
-                
-                // Keep buffer size limited
-                if (buffer.length() > 2000) {
-                    buffer = buffer.substring(1000);
-                }
-                
-                // Look for the root-level name field (not nested in other objects)
-                // The root name appears after "is_mythical" field in the JSON structure
-                if (!foundName && buffer.indexOf("\"is_mythical\":") != -1) {
-                    // We found is_mythical, now look for the next "name" field
-                    buffer = "";
-                    while (stream->available() && !foundName) {
-                        c = stream->read();
-                        buffer += c;
-                        
-                        // Look for the name field that comes after is_mythical
-                        int nameIndex = buffer.indexOf("\"name\":\"");
-                        if (nameIndex != -1) {
-                            // Extract Pokemon name
-                            String tempName = "";
-                            int startIdx = nameIndex + 8; // Skip past "name":"
-                            
-                            // Read until we find the closing quote
-                            for (int i = startIdx; i < buffer.length(); i++) {
-                                if (buffer[i] == '"' && (i == startIdx || buffer[i-1] != '\\')) {
-                                    foundName = true;
-                                    break;
-                                }
-                                tempName += buffer[i];
-                            }
-                            
-                            // Continue reading if we haven't found the closing quote
-                            while (stream->available() && !foundName) {
-                                c = stream->read();
-                                if (c == '"') {
-                                    foundName = true;
-                                    break;
-                                }
-                                tempName += c;
-                            }
-                            
-                            if (foundName) {
-                                name = tempName;
-                                Serial.printf("[PokeAPI] Found Pokemon name: %s\n", name.c_str());
-                            }
-                        }
-                    }
-                }
-                
-                // Look for English flavor text
-                if (!foundDescription && buffer.indexOf("\"flavor_text_entries\"") != -1) {
-                    Serial.println("[PokeAPI] Found flavor_text_entries array");
-                    buffer = "";
-                    
-                    // Keep reading and looking for English entries
-                    while (stream->available() && !foundDescription) {
-                        c = stream->read();
-                        buffer += c;
-                        
-                        if (buffer.length() > 2000) {
-                            // Keep the last 1000 chars to avoid missing patterns at boundaries
-                            buffer = buffer.substring(1000);
-                        }
-                        
-                        // Look for pattern: "language":{"name":"en" first, then backtrack to find flavor_text
-                        int langIndex = buffer.indexOf("\"language\":{\"name\":\"en\"");
-                        if (langIndex == -1) {
-                            langIndex = buffer.indexOf("\"language\": {\"name\": \"en\"");
-                        }
-                        
-                        if (langIndex != -1) {
-                            // Found English language tag! Now find the associated flavor_text
-                            // It could be before or after the language tag within the same object
-                            
-                            // First, find the boundaries of this flavor_text_entry object
-                            // Look backwards for the opening brace
-                            int objectStart = -1;
-                            int braceCount = 0;
-                            for (int i = langIndex - 1; i >= 0; i--) {
-                                if (buffer[i] == '}') braceCount++;
-                                else if (buffer[i] == '{') {
-                                    if (braceCount == 0) {
-                                        objectStart = i;
-                                        break;
-                                    }
-                                    braceCount--;
-                                }
-                            }
-                            
-                            // Now look for flavor_text within this object's boundaries
-                            if (objectStart != -1) {
-                                // Extract the object substring to search within
-                                String objectStr = buffer.substring(objectStart);
-                                
-                                // Find the end of this object
-                                int objectEnd = -1;
-                                braceCount = 1;
-                                for (int i = 1; i < objectStr.length(); i++) {
-                                    if (objectStr[i] == '{') braceCount++;
-                                    else if (objectStr[i] == '}') {
-                                        braceCount--;
-                                        if (braceCount == 0) {
-                                            objectEnd = i;
-                                            break;
-                                        }
-                                    }
-                                }
-                                
-                                // If we need more data to complete the object, read it
-                                while (stream->available() && objectEnd == -1) {
-                                    char ch = stream->read();
-                                    objectStr += ch;
-                                    buffer += ch;
-                                    
-                                    if (ch == '{') braceCount++;
-                                    else if (ch == '}') {
-                                        braceCount--;
-                                        if (braceCount == 0) {
-                                            objectEnd = objectStr.length() - 1;
-                                            break;
-                                        }
-                                    }
-                                }
-                                
-                                // Now find flavor_text within this object
-                                int flavorIndex = objectStr.indexOf("\"flavor_text\":\"");
-                                if (flavorIndex != -1 && (objectEnd == -1 || flavorIndex < objectEnd)) {
-                                    // Extract the flavor text
-                                    int startIdx = flavorIndex + 15;
-                                    String tempDesc = "";
-                                    
-                                    for (int i = startIdx; i < objectStr.length(); i++) {
-                                        if (objectStr[i] == '"' && (i == startIdx || objectStr[i-1] != '\\')) {
-                                            break;
-                                        }
-                                        if (objectStr[i] == '\\' && i + 1 < objectStr.length()) {
-                                            i++; // Skip the backslash
-                                            if (objectStr[i] == 'n' || objectStr[i] == 'f') {
-                                                tempDesc += ' ';
-                                            } else if (objectStr[i] == '"') {
-                                                tempDesc += '"';
-                                            } else if (objectStr[i] == '\\') {
-                                                tempDesc += '\\';
-                                            } else {
-                                                tempDesc += objectStr[i];
-                                            }
-                                        } else if (objectStr[i] != '\\') {
-                                            tempDesc += objectStr[i];
-                                        }
-                                    }
-                                    
-                                    description = cleanFlavorText(tempDesc);
-                                    foundDescription = true;
-                                    Serial.printf("[PokeAPI] Found English description: %s\n", description.c_str());
-                                    
-                                    // Clear buffer after the found entry to avoid re-processing
-                                    buffer = buffer.substring(objectStart + objectEnd + 1);
-                                }
-                            }
-                            
-                            // If we found English but no flavor_text in the same object, 
-                            // clear this entry from buffer and continue searching
-                            if (!foundDescription) {
-                                buffer = buffer.substring(langIndex + 20);
-                            }
-                        }
-                    }
-                }
+        return !(foundName && foundDescription);
+    });
+    extractor.onObjectEnd([&](const char* path) {
+        if (!foundDescription && strcmp(path, "flavor_text_entries[]") == 0) {
+            if (candidateIsEnglish && candidateText[0] != '\0') {
+                description = cleanFlavorText(String(candidateText));
+                foundDescription = true;
+                Serial.printf("[PokeAPI] Found English description: %s\n", description.c_str());
             }
-            
-            _http.end();
-            
-            if (foundName && foundDescription) {
-                Serial.printf("[PokeAPI] fetchSpeciesData returning: name='%s', desc='%s'\n", 
-                              name.c_str(), description.c_str());
-                return true; // Success
-            }
-        } else if (httpCode > 0) {
-            Serial.printf("[PokeAPI] HTTP error: %d\n", httpCode);
-            _http.end();
-            
-            // Don't retry on 404 or other client errors
-            if (httpCode >= 400 && httpCode < 500) {
-                return false;
-            }
-        } else {
-            Serial.printf("[PokeAPI] Connection error: %s\n", _http.errorToString(httpCode).c_str());
-            _http.end();
+            candidateText[0] = '\0';
+            candidateIsEnglish = false;
         }
-    }
+        
+        return !(foundName && foundDescription);
+    });
+    
+    size_t bytesRead = extractor.parseStream(*stream, contentLength, 5000, isConnected);
+    Serial.printf("[PokeAPI] Scanned %u bytes of species JSON\n", (unsigned)bytesRead);
     
-    return false; // Failed after all retries
+    return foundName && foundDescription;
 }
 
 String PokeAPIClient::cleanFlavorText(const String& raw) {
     String clean = raw;
     
-    // Remove any remaining escape sequences
-    clean.replace("\\n", " ");
-    clean.replace("\\f", " ");
-    clean.replace("\\r", " ");
-    clean.replace("\\t", " ");
+    // Flavor text uses line and page breaks (\n, \f) for the original game layout
+    clean.replace('\n', ' ');
+    clean.replace('\f', ' ');
+    clean.replace('\r', ' ');
+    clean.replace('\t', ' ');
     
     // Clean up multiple spaces
     while (clean.indexOf("  ") != -1) {
@@ -312,83 +384,67 @@ String PokeAPIClient::cleanFlavorText(const String& raw) {
     return clean;
 }
 
-uint8_t* PokeAPIClient::fetchSpriteData(int id, size_t& size) {
-    // Use direct sprite URL to avoid extra API calls
-    String url = "https://raw.githubusercontent.com/PokeAPI/sprites/master/sprites/pokemon/" 
-                 + String(id) + ".png";
+PokeAPIClient::Outcome PokeAPIClient::fetchSpriteData(Lane& lane, int id, uint8_t*& data, size_t& size) {
+    String url = spriteUrl(id);
     
     Serial.printf("[PokeAPI] Fetching sprite from: %s\n", url.c_str());
     
-    // Retry logic with exponential backoff
-    const int maxRetries = 3;
-    int retryDelay = 1000; // Start with 1 second
+    data = nullptr;
+    size = 0;
+    
+    HTTPClient& http = lane.http;
+    http.begin(clientFor(lane, url), url);
+    http.setTimeout(10000); // 10 second timeout for images
+    http.addHeader("User-Agent", "DeskHog/1.0");
+    
+    int httpCode = http.GET();
     
-    for (int attempt = 0; attempt < maxRetries; attempt++) {
-        if (attempt > 0) {
-            Serial.printf("[PokeAPI] Retry attempt %d/%d after %dms delay\n", 
-                         attempt + 1, maxRetries, retryDelay);
-            delay(retryDelay);
-            retryDelay *= 2; // Exponential backoff
+    if (httpCode == 200) {
+        int len = http.getSize();
+        
+        if (len <= 0 || len >= 10000) { // Sanity check - sprites should be 1-5KB
+            Serial.printf("[PokeAPI] Invalid sprite size: %d\n", len);
+            http.end();
+            // Retry on network issues, not on an invalid size
+            return (len <= 0) ? Outcome::RETRY : Outcome::FAILED;
         }
         
-        _http.begin(_secureClient, url);
-        _http.setTimeout(10000); // 10 second timeout for images
-        _http.addHeader("User-Agent", "DeskHog/1.0");
+        Serial.printf("[PokeAPI] Sprite size: %d bytes\n", len);
         
-        int httpCode = _http.GET();
+        // Allocate buffer for PNG
+        uint8_t* pngData = new (std::nothrow) uint8_t[len];
+        if (!pngData) {
+            Serial.println("[PokeAPI] Failed to allocate memory for sprite");
+            http.end();
+            return Outcome::RETRY;
+        }
         
-        if (httpCode == 200) {
-            int len = _http.getSize();
-            
-            if (len > 0 && len < 10000) { // Sanity check - sprites should be 1-5KB
-                Serial.printf("[PokeAPI] Sprite size: %d bytes\n", len);
-                
-                // Allocate buffer for PNG
-                uint8_t* pngData = new uint8_t[len];
-                if (!pngData) {
-                    Serial.println("[PokeAPI] Failed to allocate memory for sprite");
-                    _http.end();
-                    size = 0;
-                    continue; // Try again on next iteration
-                }
-                
-                // Read PNG data
-                Stream* stream = _http.getStreamPtr();
-                size_t bytesRead = stream->readBytes(pngData, len);
-                
-                _http.end();
-                
-                if (bytesRead == len) {
-                    size = len;
-                    return pngData; // Success!
-                } else {
-                    Serial.printf("[PokeAPI] Read mismatch: expected %d, got %d\n", len, bytesRead);
-                    delete[] pngData;
-                }
-            } else {
-                Serial.printf("[PokeAPI] Invalid sprite size: %d\n", len);
-                _http.end();
-                
-                if (len <= 0) {
-                    continue; // Retry on network issues
-                } else {
-                    break; // Don't retry on invalid size
-                }
-            }
-        } else if (httpCode > 0) {
-            Serial.printf("[PokeAPI] HTTP error fetching sprite: %d\n", httpCode);
-            _http.end();
-            
-            // Don't retry on 404 or other client errors
-            if (httpCode >= 400 && httpCode < 500) {
-                break;
-            }
-        } else {
-            Serial.printf("[PokeAPI] Connection error: %s\n", _http.errorToString(httpCode).c_str());
-            _http.end();
+        // Read PNG data
+        Stream* stream = http.getStreamPtr();
+        size_t bytesRead = stream->readBytes(pngData, len);
+        
+        http.end();
+        
+        if (bytesRead == (size_t)len) {
+            data = pngData;
+            size = len;
+            return Outcome::SUCCESS;
         }
+        
+        Serial.printf("[PokeAPI] Read mismatch: expected %d, got %u\n", len, (unsigned)bytesRead);
+        delete[] pngData;
+        return Outcome::RETRY;
     }
     
-    size = 0;
-    return nullptr; // Failed after all retries
-}
\ No newline at end of file
+    if (httpCode > 0) {
+        Serial.printf("[PokeAPI] HTTP error fetching sprite: %d\n", httpCode);
+        http.end();
+        
+        // Don't retry on 404 or other client errors
+        return (httpCode >= 400 && httpCode < 500) ? Outcome::FAILED : Outcome::RETRY;
+    }
+    
+    Serial.printf("[PokeAPI] Connection error: %s\n", http.errorToString(httpCode).c_str());
+    http.end();
+    return Outcome::RETRY;
+}
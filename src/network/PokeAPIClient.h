@@ -3,33 +3,101 @@
 #include <Arduino.h>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
+#include <atomic>
 #include "EventQueue.h"
+#include "network/JsonStreamExtractor.h"
 
+// Build with -DPOKEAPI_HOST=\"http://192.168.1.20:8001\" to fetch species
+// data and sprites from one other server (such as scripts/mock_pokeapi.py,
+// for timing the card) instead of pokeapi.co and GitHub
+
+// Fetches Pokemon species data and sprites on two worker tasks ("lanes"),
+// one per host, so both requests for a Pokemon are in flight at the same
+// time. Results are published on the event queue as POKEAPI_DATA_READY,
+// POKEAPI_SPRITE_READY or POKEAPI_ERROR, tagged with the Pokemon id.
+//
+// Failed attempts are retried with exponential backoff. A job waiting on its
+// backoff timer does not block the lane: the worker keeps taking new jobs and
+// runs whichever is due first.
 class PokeAPIClient {
 public:
+    static const uint32_t LANE_STACK_SIZE = 12288; // TLS handshake needs a deep stack
+
     PokeAPIClient(EventQueue& eventQueue);
     ~PokeAPIClient();
-    
-    // Process a fetch request from the event queue
-    void processFetchRequest(int pokemonId);
-    
-    // Process sprite fetch request
-    void processSpriteRequest(int pokemonId);
-    
+
+    // Create the lane workers and subscribe to PokeAPI request events
+    bool begin();
+
+    // Queue work (safe from any task)
+    bool requestSpecies(int pokemonId);
+    bool requestSprite(int pokemonId);
+
+    // Background fetch of species and sprite for the next Pokemon. Served
+    // after any foreground request that is due, and dropped by cancelPrefetch().
+    bool requestPrefetch(int pokemonId);
+    void cancelPrefetch();
+
 private:
+    struct Job {
+        int pokemonId;
+        bool prefetch;
+        uint32_t generation;     // _prefetchGeneration when queued (prefetch only)
+        uint8_t attempt;         // Attempts made so far
+        unsigned long retryAt;   // millis() when the next attempt may start
+        unsigned long queuedAt;  // For latency logging
+    };
+
+    enum class Outcome {
+        SUCCESS,
+        RETRY,     // Transient failure, try again after backoff
+        FAILED,    // Permanent failure, don't retry
+        NO_WIFI    // Not connected, fail without retrying
+    };
+
+    enum class LaneKind {
+        SPECIES,
+        SPRITE
+    };
+
+    struct Lane {
+        LaneKind kind;
+        const char* name;
+        PokeAPIClient* client;
+        QueueHandle_t queue;
+        TaskHandle_t task;
+        HTTPClient http;
+        WiFiClientSecure secureClient;
+        WiFiClient plainClient;   // For an http:// POKEAPI_HOST
+    };
+
+    static const int LANE_QUEUE_LENGTH = 6;
+    static const size_t MAX_WAITING_JOBS = 6;     // Jobs a lane holds while they wait for a retry
+    static const uint8_t MAX_ATTEMPTS = 3;
+    static const unsigned long RETRY_BASE_DELAY_MS = 1000;  // Doubles on each retry
+
     EventQueue& _eventQueue;
-    HTTPClient _http;
-    WiFiClientSecure _secureClient;
-    
-    // Fetch species data (name and description)
-    bool fetchSpeciesData(int id, String& name, String& description);
-    
-    // Fetch sprite PNG data
-    uint8_t* fetchSpriteData(int id, size_t& size);
-    
-    // Parse species JSON stream to extract name and flavor text
-    void parseSpeciesStream(Stream* stream, String& name, String& description);
-    
+    std::atomic<uint32_t> _prefetchGeneration;
+    Lane _speciesLane;
+    Lane _spriteLane;
+
+    bool enqueue(Lane& lane, int pokemonId, bool prefetch);
+    static WiFiClient& clientFor(Lane& lane, const String& url);
+    static void laneTask(void* parameter);
+    void runLane(Lane& lane);
+    Outcome attempt(Lane& lane, const Job& job);
+    void publishError(int pokemonId, const char* message);
+
+    // Single attempt at fetching species data (name and description)
+    Outcome fetchSpeciesData(Lane& lane, int id, String& name, String& description);
+
+    // Single attempt at fetching sprite PNG data
+    Outcome fetchSpriteData(Lane& lane, int id, uint8_t*& data, size_t& size);
+
+    // Parse species JSON stream to extract name and first English flavor text
+    bool parseSpeciesStream(Stream* stream, int contentLength, JsonStreamExtractor::ConnectionCheck isConnected,
+                            String& name, String& description);
+
     // Helper to clean up flavor text (remove newlines, etc)
     String cleanFlavorText(const String& text);
-};
\ No newline at end of file
+};
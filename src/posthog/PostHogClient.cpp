@@ -1,11 +1,16 @@
 #include "PostHogClient.h"
 #include "../ConfigManager.h"
+#include "Metrics.h"
+#include "Trace.h"
+#include "hardware/LedStatus.h"
 
 
 
 PostHogClient::PostHogClient(ConfigManager& config, EventQueue& eventQueue) 
     : _config(config)
     , _eventQueue(eventQueue)
+    , load_start(0)
+    , _loadMutex(xSemaphoreCreateMutex())
     , has_active_request(false)
     , last_refresh_check(0) {
     // Configure secure client for HTTPS
@@ -21,7 +26,18 @@ PostHogClient::PostHogClient(ConfigManager& config, EventQueue& eventQueue)
 }
 
 String PostHogClient::buildBaseUrl() const {
+#ifdef POSTHOG_API_HOST
+    return String(POSTHOG_API_HOST) + "/api/projects/";
+#else
     return "https://" + _config.getRegion() + ".posthog.com/api/projects/";
+#endif
+}
+
+WiFiClient& PostHogClient::clientFor(const String& url) {
+    if (url.startsWith("https://")) {
+        return _secureClient;
+    }
+    return _plainClient;
 }
 
 void PostHogClient::requestInsightData(const String& insight_id, bool forceRefresh) {
@@ -34,7 +50,30 @@ void PostHogClient::requestInsightData(const String& insight_id, bool forceRefre
     request_queue.push(request);
     
     // Add to our set of known insights for future refreshes
-    requested_insights.insert(insight_id);
+    if (requested_insights.insert(insight_id).second) {
+        xSemaphoreTake(_loadMutex, portMAX_DELAY);
+        if (unloaded_insights.empty()) {
+            load_start = millis();
+        }
+        unloaded_insights.insert(insight_id);
+        xSemaphoreGive(_loadMutex);
+    }
+}
+
+void PostHogClient::retainInsights(const std::set<String>& insight_ids) {
+    // Called from the task rebuilding the cards while the insight task settles
+    // loads, so collect under the lock; settleInsight() takes it again
+    std::vector<String> removed;
+    xSemaphoreTake(_loadMutex, portMAX_DELAY);
+    for (const String& insight_id : unloaded_insights) {
+        if (insight_ids.find(insight_id) == insight_ids.end()) {
+            removed.push_back(insight_id);
+        }
+    }
+    xSemaphoreGive(_loadMutex);
+    for (const String& insight_id : removed) {
+        settleInsight(insight_id);
+    }
 }
 
 bool PostHogClient::isReady() const {
@@ -87,6 +126,7 @@ void PostHogClient::processQueue() {
         if (request.retry_count < MAX_RETRIES) {
             // Update retry count and push back to end of queue
             request.retry_count++;
+            Metrics::fetchRetries.add();
             Serial.printf("Request for insight %s failed, retrying (%d/%d)...\n", 
                           request.insight_id.c_str(), request.retry_count, MAX_RETRIES);
             
@@ -101,6 +141,7 @@ void PostHogClient::processQueue() {
             Serial.printf("Max retries reached for insight %s, dropping request\n", 
                          request.insight_id.c_str());
             request_queue.pop();
+            settleInsight(request.insight_id);
         }
     }
 }
@@ -157,8 +198,11 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
         return false;
     }
 
+    TRACE_SCOPE("posthog.fetch");
     unsigned long start_time = millis();
+    unsigned long request_start = start_time;
     has_active_request = true;
+    LedStatus::set(LedStatus::FETCHING, true);
     
     bool success = false;
     bool needsRefresh = false;
@@ -168,7 +212,7 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
         String url = buildInsightUrl(insight_id, "blocking");
         Serial.printf("Force refreshing insight %s\n", insight_id.c_str());
         
-        _http.begin(_secureClient, url);
+        _http.begin(clientFor(url), url);
         int httpCode = _http.GET();
         
         if (httpCode == HTTP_CODE_OK) {
@@ -176,30 +220,32 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
             Serial.printf("Force refresh network time for %s: %lu ms\n", insight_id.c_str(), network_time);
             
             // Get content length for allocation
-            size_t contentLength = _http.getSize();
+            int contentLength = _http.getSize();
             
             // Pre-allocate in PSRAM if content is large
             if (contentLength > 8192) { // 8KB threshold
                 response = String();
                 response.reserve(contentLength);
-                Serial.printf("Pre-allocated %u bytes in PSRAM for force refresh response\n", contentLength);
+                Serial.printf("Pre-allocated %d bytes in PSRAM for force refresh response\n", contentLength);
             }
             
             response = _http.getString();
-            success = true;
+            Metrics::fetchBytes.add(response.length());
+            success = bodyComplete(insight_id, response, contentLength);
         } else {
             Serial.printf("HTTP GET (force refresh) failed for %s, error: %d\n", insight_id.c_str(), httpCode);
         }
         
         _http.end();
         has_active_request = false;
+        recordFetch(success, request_start);
         return success;
     }
     
     // Normal flow: First, try to get cached data
     String url = buildInsightUrl(insight_id, "force_cache");
     
-    _http.begin(_secureClient, url);
+    _http.begin(clientFor(url), url);
     int httpCode = _http.GET();
     
     if (httpCode == HTTP_CODE_OK) {
@@ -209,22 +255,25 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
         start_time = millis();
         
         // Get content length for allocation
-        size_t contentLength = _http.getSize();
+        int contentLength = _http.getSize();
         
         // Pre-allocate in PSRAM if content is large
         if (contentLength > 8192) { // 8KB threshold
             // Force allocation in PSRAM for large responses
             response = String();
             response.reserve(contentLength);
-            Serial.printf("Pre-allocated %u bytes in PSRAM for large response\n", contentLength);
+            Serial.printf("Pre-allocated %d bytes in PSRAM for large response\n", contentLength);
         }
         
         response = _http.getString();
+        Metrics::fetchBytes.add(response.length());
         unsigned long string_time = millis() - start_time;
         Serial.printf("Response processing time: %lu ms (size: %u bytes)\n", string_time, response.length());
         
         // Quick check if we need to refresh (look for null result)
-        if (response.indexOf("\"result\":null") >= 0 || 
+        if (!bodyComplete(insight_id, response, contentLength)) {
+            // success stays false, so the queue retries it
+        } else if (response.indexOf("\"result\":null") >= 0 || 
             response.indexOf("\"result\":[]") >= 0) {
             needsRefresh = true;
         } else {
@@ -240,10 +289,11 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
     
     // If we need to refresh, make a second request with blocking
     if (needsRefresh) {
+        Metrics::fetchCacheMisses.add();
         url = buildInsightUrl(insight_id, "blocking");
         
         unsigned long refresh_start = millis();
-        _http.begin(_secureClient, url);
+        _http.begin(clientFor(url), url);
         httpCode = _http.GET();
         
         if (httpCode == HTTP_CODE_OK) {
@@ -253,21 +303,22 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
             refresh_start = millis();
             
             // Get content length for allocation
-            size_t contentLength = _http.getSize();
+            int contentLength = _http.getSize();
             
             // Pre-allocate in PSRAM if content is large
             if (contentLength > 8192) { // 8KB threshold
                 // Force allocation in PSRAM for large responses
                 response = String();
                 response.reserve(contentLength);
-                Serial.printf("Pre-allocated %u bytes in PSRAM for refresh response\n", contentLength);
+                Serial.printf("Pre-allocated %d bytes in PSRAM for refresh response\n", contentLength);
             }
             
             response = _http.getString();
+            Metrics::fetchBytes.add(response.length());
             unsigned long refresh_string = millis() - refresh_start;
             Serial.printf("Refresh string time: %lu ms (size: %u bytes)\n", refresh_string, response.length());
             
-            success = true;
+            success = bodyComplete(insight_id, response, contentLength);
         } else {
             // Handle HTTP errors
             Serial.print("HTTP GET (blocking) failed, error: ");
@@ -278,9 +329,30 @@ bool PostHogClient::fetchInsight(const String& insight_id, String& response, boo
     }
     
     has_active_request = false;
+    recordFetch(success, request_start);
     return success;
 }
 
+bool PostHogClient::bodyComplete(const String& insight_id, const String& response, int contentLength) {
+    // getString() returns what arrived when the connection drops mid-body
+    if (contentLength >= 0 && response.length() < (size_t)contentLength) {
+        Serial.printf("Response for insight %s cut off at %u of %d bytes\n",
+                      insight_id.c_str(), response.length(), contentLength);
+        return false;
+    }
+    return true;
+}
+
+void PostHogClient::recordFetch(bool success, unsigned long start_time) {
+    LedStatus::set(LedStatus::FETCHING, false);
+    if (success) {
+        Metrics::fetchLatencyMs.observe(millis() - start_time);
+    } else {
+        Metrics::fetchErrors.add();
+        LedStatus::signalError();
+    }
+}
+
 void PostHogClient::publishInsightDataEvent(const String& insight_id, const String& response) {
     // Check if response is empty or invalid
     if (response.length() == 0) {
@@ -290,7 +362,21 @@ void PostHogClient::publishInsightDataEvent(const String& insight_id, const Stri
     
     // Publish the event with the raw JSON response
     _eventQueue.publishEvent(EventType::INSIGHT_DATA_RECEIVED, insight_id, response);
+
+    settleInsight(insight_id);
     
     // Log for debugging
     Serial.printf("Published raw JSON data for %s\n", insight_id.c_str());
+}
+
+void PostHogClient::settleInsight(const String& insight_id) {
+    xSemaphoreTake(_loadMutex, portMAX_DELAY);
+    bool allSettled = unloaded_insights.erase(insight_id) && unloaded_insights.empty();
+    unsigned long elapsed = millis() - load_start;
+    xSemaphoreGive(_loadMutex);
+
+    if (allSettled) {
+        Metrics::allInsightsLoadMs.set(elapsed);
+        Serial.printf("All insights loaded or failed in %lu ms\n", elapsed);
+    }
 } 
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <HTTPClient.h>
 #include <WiFi.h>
 #include <WiFiClientSecure.h>
+#include <freertos/semphr.h>
 #include <queue>
 #include <vector>
 #include <set>
@@ -13,6 +14,10 @@
 #include "EventQueue.h"
 #include "parsers/InsightParser.h"
 
+// Build with -DPOSTHOG_API_HOST=\"http://192.168.1.20:8000\" to send insight
+// requests to another server (a self-hosted instance, or a local stand-in for
+// timing the client) instead of https://<region>.posthog.com
+
 /**
  * @class PostHogClient
  * @brief Client for fetching PostHog insight data
@@ -48,6 +53,16 @@ public:
      * Will be processed in FIFO order.
      */
     void requestInsightData(const String& insight_id, bool forceRefresh = false);
+
+    /**
+     * @brief Stop waiting for insights that no longer have a card
+     * 
+     * @param insight_ids IDs of the insight cards that remain
+     * 
+     * Call after cards are rebuilt, so a removed card that never loaded does
+     * not hold back the all-insights-loaded time.
+     */
+    void retainInsights(const std::set<String>& insight_ids);
     
     /**
      * @brief Check if client is ready for operation
@@ -85,8 +100,12 @@ private:
     // Request tracking
     std::set<String> requested_insights;  ///< All known insight IDs
     std::queue<QueuedRequest> request_queue; ///< Queue of pending requests
+    std::set<String> unloaded_insights;    ///< Requested insights not yet loaded, failed for good or removed
+    unsigned long load_start;              ///< millis() when unloaded_insights last became non-empty
+    SemaphoreHandle_t _loadMutex;          ///< Guards unloaded_insights and load_start; card rebuilds change them from other tasks
     bool has_active_request;               ///< Request in progress flag
     WiFiClientSecure _secureClient;        ///< Secure WiFi client for HTTPS
+    WiFiClient _plainClient;               ///< Plain client for http:// API hosts
     HTTPClient _http;                      ///< HTTP client instance
     unsigned long last_refresh_check;       ///< Last refresh timestamp
     
@@ -99,10 +118,15 @@ private:
 
 
         /**
-     * @brief Build Base API URL based on project region
+     * @brief Build Base API URL based on project region, or POSTHOG_API_HOST
      */
     String buildBaseUrl() const;
 
+    /**
+     * @brief Transport for a URL: TLS for https://, plain TCP otherwise
+     */
+    WiFiClient& clientFor(const String& url);
+
     /**
      * @brief Handle system state changes
      * @param state New system state
@@ -132,6 +156,31 @@ private:
      * @return true if fetch was successful
      */
     bool fetchInsight(const String& insight_id, String& response, bool forceRefresh = false);
+
+    /**
+     * @brief Check a body read with getString() against its Content-Length
+     * 
+     * @param insight_id Insight the response is for, for the log
+     * @param response Body as read
+     * @param contentLength getSize(), or -1 when the server sent none
+     * @return false if the connection closed before the whole body arrived
+     */
+    static bool bodyComplete(const String& insight_id, const String& response, int contentLength);
+
+    /**
+     * @brief Record a finished fetch in Metrics
+     * 
+     * @param success Whether the fetch produced a response
+     * @param start_time millis() when the first request was started
+     */
+    void recordFetch(bool success, unsigned long start_time);
+
+    /**
+     * @brief Stop waiting for an insight; record the load time once none are left
+     * 
+     * @param insight_id Insight that loaded, ran out of retries or lost its card
+     */
+    void settleInsight(const String& insight_id);
     
     /**
      * @brief Build insight API URL
@@ -4,10 +4,15 @@
 #include "EventQueue.h"
 #include "OtaManager.h" // Required for OtaManager interaction
 #include "ui/CardController.h" // Required for CardController interaction
+#include "SystemController.h"
+#include "Metrics.h"
+#include "Trace.h"
 #include "html_portal.h"  // For portal HTML
 #include <ArduinoJson.h>  // For JSON responses
 #include <pgmspace.h> // For PROGMEM
+#include "esp_heap_caps.h" // For heap low-water marks
 #include <vector> // For std::vector (action queue)
+#include <memory> // For the trace exporter shared with its response
 
 // Max size for the action queue
 const size_t MAX_ACTION_QUEUE_SIZE = 5; // Define a reasonable limit
@@ -22,6 +27,21 @@ struct QueuedAction { // Defined globally in this .cpp file
 // Forward declaration if QueuedAction is used before full definition within the class
 // struct QueuedAction; // Not strictly needed if defined before first use or within class scope directly
 
+// Sections of the status document, each pushed as its own event when it changes
+static const char* const STATUS_SECTIONS[] = { "portal", "wifi", "device_config", "ota", "system" };
+enum StatusSection : size_t { STATUS_PORTAL, STATUS_WIFI, STATUS_DEVICE_CONFIG, STATUS_OTA, STATUS_SYSTEM };
+#define STATUS_BIT(section) (1u << (section))
+
+// Status sections an action changes besides "portal"
+static uint32_t actionStatusSections(PortalAction action) {
+    switch (action) {
+        case PortalAction::SCAN_WIFI:
+        case PortalAction::SAVE_WIFI: return STATUS_BIT(STATUS_WIFI);
+        case PortalAction::SAVE_DEVICE_CONFIG: return STATUS_BIT(STATUS_DEVICE_CONFIG);
+        default: return 0;
+    }
+}
+
 // Definition for portalActionToString
 const char* portalActionToString(PortalAction action) {
     switch (action) {
@@ -38,17 +58,22 @@ const char* portalActionToString(PortalAction action) {
 // Constructor
 CaptivePortal::CaptivePortal(ConfigManager& configManager, WiFiInterface& wifiInterface, EventQueue& eventQueue, OtaManager& otaManager, CardController& cardController)
     : _server(80),
+      _events("/api/events"),
       _configManager(configManager),
       _wifiInterface(wifiInterface),
       _eventQueue(eventQueue),
       _otaManager(otaManager), // Initialize the OtaManager reference
       _cardController(cardController), // Initialize the CardController reference
-      _lastScanTime(0),
+      _cachedNetworks("[]"),
       _action_in_progress(PortalAction::NONE),
       _last_action_completed(PortalAction::NONE),
       _last_action_was_success(false),
       _last_action_message(""),
-      _action_queue() { // Initialize the action queue vector (assuming _action_queue is a member declared in CaptivePortal.h)
+      _action_queue(),
+      _dirtySections(0),
+      _pushedOtaVersion(0),
+      _lastStatusPush(0),
+      _statusEventId(0) { // Initialize the action queue vector (assuming _action_queue is a member declared in CaptivePortal.h)
 }
 
 void CaptivePortal::begin() {
@@ -71,6 +96,16 @@ void CaptivePortal::begin() {
     // New API status endpoint
     // Serial.println("Registering /api/status..."); // DEBUG REMOVED
     _server.on("/api/status", HTTP_GET, std::bind(&CaptivePortal::handleApiStatus, this, std::placeholders::_1));
+    _server.on("/api/metrics", HTTP_GET, std::bind(&CaptivePortal::handleApiMetrics, this, std::placeholders::_1));
+    _server.on("/api/trace", HTTP_GET, std::bind(&CaptivePortal::handleApiTrace, this, std::placeholders::_1));
+
+    // Status push channel; the page falls back to polling /api/status without it
+    _events.onConnect(std::bind(&CaptivePortal::handleEventsConnect, this, std::placeholders::_1));
+    _server.addHandler(&_events);
+    // Connection and API state also change what the wifi section reports
+    SystemController::onStateChange([this](const ControllerState&) {
+        markStatusDirty(STATUS_BIT(STATUS_SYSTEM) | STATUS_BIT(STATUS_WIFI));
+    });
 
     // New async action triggering endpoints
     // Serial.println("Registering /api/actions/start-wifi-scan..."); // DEBUG REMOVED
@@ -134,31 +169,38 @@ void CaptivePortal::handleCorsPreflight(AsyncWebServerRequest *request) {
 }
 
 void CaptivePortal::handleRoot(AsyncWebServerRequest *request) {
-    // Use PORTAL_HTML and its size directly from html_portal.h
-    // Note: beginResponse_P expects uint8_t*, PORTAL_HTML is char*. Casting might be needed
-    // or prefer beginResponse if types are an issue.
-    // For now, let's try with a cast if the compiler insists, otherwise direct usage.
-    AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", 
-                                                               (const uint8_t*)PORTAL_HTML, 
-                                                               sizeof(PORTAL_HTML) - 1);
-    response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-    response->addHeader("Pragma", "no-cache");
-    response->addHeader("Expires", "0");
+    // The page only changes with the firmware, so a browser that already has it
+    // gets a 304 and nothing else
+    if (request->hasHeader("If-None-Match") &&
+        request->header("If-None-Match") == PORTAL_HTML_ETAG) {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        response->addHeader("ETag", PORTAL_HTML_ETAG);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
+        return;
+    }
+
+    // Stored pre-gzipped by htmlconvert.py; every browser accepts gzip
+    AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html",
+                                                               PORTAL_HTML_GZ,
+                                                               PORTAL_HTML_GZ_LEN);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", PORTAL_HTML_ETAG);
+    // Always revalidate, so a firmware update is picked up on the next load
+    response->addHeader("Cache-Control", "no-cache");
     request->send(response);
 }
 
-void CaptivePortal::performWiFiScan() {
-    Serial.println("Starting WiFi Scan...");
-    _wifiInterface.scanNetworks(); // Assuming this is synchronous or handles its own async
-    _cachedNetworks = getNetworksJson();
-    _lastScanTime = millis();
-    Serial.println("WiFi Scan Complete. Cached networks.");
+bool CaptivePortal::performWiFiScan() {
+    // Results are picked up by processAsyncOperations() once the radio is done
+    return _wifiInterface.startScan();
 }
 
 String CaptivePortal::getNetworksJson() {
-    DynamicJsonDocument doc(2048);
-    JsonArray networksArray = doc.to<JsonArray>();
     std::vector<WiFiInterface::NetworkInfo> networks = _wifiInterface.getScannedNetworks();
+    // Each entry holds three members plus a copy of an SSID of at most 32 bytes
+    DynamicJsonDocument doc(JSON_ARRAY_SIZE(networks.size()) + networks.size() * (JSON_OBJECT_SIZE(3) + 33));
+    JsonArray networksArray = doc.to<JsonArray>();
     for (const auto& net : networks) { 
         JsonObject netObj = networksArray.createNestedObject(); 
         netObj["ssid"] = net.ssid;
@@ -171,20 +213,17 @@ String CaptivePortal::getNetworksJson() {
 }
 
 void CaptivePortal::handleScanNetworks(AsyncWebServerRequest *request) {
-    // If cache is older than 10 seconds, request a new scan.
-    // The actual scan is done by processAsyncOperations.
-    // Client polls /api/status for results including the network list.
-    if (millis() - _lastScanTime > 10000) { // Still check cache age to decide if a new scan *request* is needed
-        requestAction(PortalAction::SCAN_WIFI, request); // This will respond with 202 if queued, or 429 if queue full
-    } else {
-        // Cache is fresh, return current cached networks immediately.
-        // This maintains some responsiveness if a recent scan is available.
-        // Alternatively, could also make this path queue an action, and client always polls.
-        // For now, let's return cached if fresh, and queue if stale.
-        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", _cachedNetworks);
-        response->addHeader("Access-Control-Allow-Origin", "*");
-        request->send(response);
+    // Always answer from the cache. If it is older than 10 seconds, also queue
+    // a background scan; the refreshed list arrives via /api/status and /api/events.
+    if (millis() - _wifiInterface.getLastScanTime() > 10000 && !_wifiInterface.isScanning() &&
+        _action_queue.size() < MAX_ACTION_QUEUE_SIZE) {
+        QueuedAction scan;
+        scan.action = PortalAction::SCAN_WIFI;
+        _action_queue.push_back(scan);
     }
+    AsyncWebServerResponse *response = request->beginResponse(200, "application/json", _cachedNetworks);
+    response->addHeader("Access-Control-Allow-Origin", "*");
+    request->send(response);
 }
 
 void CaptivePortal::handleSaveWifi(AsyncWebServerRequest *request) {
@@ -240,6 +279,7 @@ void CaptivePortal::handleSaveDeviceConfig(AsyncWebServerRequest *request) {
              _configManager.setApiKey(apiKey);
         }
         success = true;
+        markStatusDirty(STATUS_BIT(STATUS_DEVICE_CONFIG));
         // No direct EventType mapping for API_CONFIG_UPDATED, so removing for now.
         // Consider if a different existing event is appropriate or if one needs to be added to EventQueue.h
     }
@@ -326,7 +366,7 @@ void CaptivePortal::handleStartUpdate(AsyncWebServerRequest *request) {
     String message = "No update information available or update not available.";
 
     if (lastCheck.updateAvailable && !lastCheck.downloadUrl.isEmpty()) {
-        if (_otaManager.beginUpdate(lastCheck.downloadUrl)) {
+        if (_otaManager.beginUpdate(lastCheck.downloadUrl, lastCheck.sha256, lastCheck.patchUrl)) {
             success = true;
             message = "Update process initiated.";
         } else {
@@ -378,6 +418,11 @@ void CaptivePortal::handleUpdateStatus(AsyncWebServerRequest *request) {
 // --- New method to process async operations ---
 // This should be called periodically from a task (e.g., portalTaskFunction in main.cpp)
 void CaptivePortal::processAsyncOperations() {
+    // Pick up a finished background scan before handling new requests
+    if (_wifiInterface.updateScan()) {
+        _cachedNetworks = getNetworksJson();
+        markStatusDirty(STATUS_BIT(STATUS_WIFI));
+    }
     
     if (_action_in_progress != PortalAction::NONE && !_action_queue.empty()) {
         // This condition implies an action was set as _action_in_progress by requestAction,
@@ -418,9 +463,8 @@ void CaptivePortal::processAsyncOperations() {
         Serial.println("DEBUG: CaptivePortal - About to enter action processing switch statement.");
         switch (actionToProcess) {
             case PortalAction::SCAN_WIFI:
-                performWiFiScan(); 
-                currentActionSuccess = true;
-                currentActionMessage = "WiFi scan completed.";
+                currentActionSuccess = performWiFiScan();
+                currentActionMessage = currentActionSuccess ? "WiFi scan started." : "Failed to start WiFi scan.";
                 break;
             case PortalAction::SAVE_WIFI: {
                 String ssid = current_queued_action.param1; // Use from QueuedAction
@@ -480,7 +524,7 @@ void CaptivePortal::processAsyncOperations() {
 
                 if (lastCheck.updateAvailable && !lastCheck.downloadUrl.isEmpty()) {
                     Serial.println("DEBUG: CaptivePortal - Conditions met to call _otaManager.beginUpdate().");
-                    bool updateBegun = _otaManager.beginUpdate(lastCheck.downloadUrl);
+                    bool updateBegun = _otaManager.beginUpdate(lastCheck.downloadUrl, lastCheck.sha256, lastCheck.patchUrl);
                     Serial.printf("DEBUG: CaptivePortal - _otaManager.beginUpdate() returned: %s\n", updateBegun ? "true" : "false");
                     if (updateBegun) { 
                         currentActionSuccess = true;
@@ -514,93 +558,197 @@ void CaptivePortal::processAsyncOperations() {
         _last_action_was_success = currentActionSuccess;
         _last_action_message = currentActionMessage;
         _action_in_progress = PortalAction::NONE; // Mark PORTAL as done with this action processing cycle.
+        // OTA actions show up through OtaManager's status version instead
+        markStatusDirty(STATUS_BIT(STATUS_PORTAL) | actionStatusSections(actionToProcess));
         Serial.printf("Finished processing action: %s, Success: %d, Msg: %s\n", portalActionToString(actionToProcess), currentActionSuccess, currentActionMessage.c_str());
     }
+
+    pushStatusChanges();
 }
 
 // --- New /api/status endpoint ---
 void CaptivePortal::handleApiStatus(AsyncWebServerRequest *request) {
-    // Serial.println("/api/status HANDLER CALLED"); // Removed to reduce log spam
-    // REMOVE SIMPLIFIED TEST BLOCK
-    // request->send(200, "text/plain", "API Status OK - Simplified"); 
-    // return; 
-
-    // RESTORE ORIGINAL FULL LOGIC
-    DynamicJsonDocument doc(4096); 
-
-    JsonObject portalObj = doc.createNestedObject("portal");
-    portalObj["action_in_progress"] = portalActionToString(_action_in_progress);
-    portalObj["last_action_completed"] = portalActionToString(_last_action_completed);
-    portalObj["last_action_status"] = _last_action_was_success ? "SUCCESS" : (_last_action_completed != PortalAction::NONE ? "ERROR" : "NONE");
-    portalObj["last_action_message"] = _last_action_message;
-
-    // Add specific OTA request status message from the portal's perspective
-    String portalOtaRequestMsg = "";
-    if (_action_in_progress == PortalAction::CHECK_OTA_UPDATE) {
-        portalOtaRequestMsg = "Portal: OTA update check request is pending execution.";
-    } else if (_action_in_progress == PortalAction::START_OTA_UPDATE) {
-        portalOtaRequestMsg = "Portal: OTA update start request is pending execution.";
+    DynamicJsonDocument doc(STATUS_DOC_SIZE);
+    buildStatus(doc);
+
+    String responseJson;
+    serializeJson(doc, responseJson);
+    AsyncWebServerResponse *response = request->beginResponse(200, "application/json", responseJson);
+    response->addHeader("Access-Control-Allow-Origin", "*");
+    response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    response->addHeader("Pragma", "no-cache");
+    response->addHeader("Expires", "0");
+    request->send(response);
+}
+
+void CaptivePortal::handleApiMetrics(AsyncWebServerRequest *request) {
+    // Heap marks are cheap to read, so sample them on demand rather than on a timer
+    Metrics::heapFreeMin.lowerTo(heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    Metrics::heapLargestBlock.set(heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    if (psramFound()) {
+        Metrics::psramFreeMin.lowerTo(heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+        Metrics::psramLargestBlock.set(heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+    }
+
+    bool prometheus = request->hasParam("format") && request->getParam("format")->value() == "prometheus";
+    AsyncResponseStream *response = request->beginResponseStream(
+        prometheus ? "text/plain; version=0.0.4" : "application/json");
+    if (prometheus) {
+        Metrics::writePrometheus(*response);
     } else {
-        // Check if the *last completed* action by the portal was an OTA dispatch
-        if (_last_action_completed == PortalAction::CHECK_OTA_UPDATE || _last_action_completed == PortalAction::START_OTA_UPDATE) {
-            if (_last_action_was_success) {
-                portalOtaRequestMsg = "Portal: Successfully dispatched '" + String(portalActionToString(_last_action_completed)) + "' to OtaManager. Current OtaManager status follows.";
-            } else {
-                portalOtaRequestMsg = "Portal: Failed to dispatch '" + String(portalActionToString(_last_action_completed)) + "'. Error: " + _last_action_message;
-            }
-        }
+        Metrics::writeJson(*response);
     }
-    if (!portalOtaRequestMsg.isEmpty()) {
-        portalObj["portal_ota_action_message"] = portalOtaRequestMsg;
+    response->addHeader("Access-Control-Allow-Origin", "*");
+    response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    request->send(response);
+}
+
+void CaptivePortal::handleApiTrace(AsyncWebServerRequest *request) {
+    // Chunked so the full ring never has to fit in RAM as text; recording
+    // stays paused until the response (and with it the exporter) is freed
+    std::shared_ptr<Trace::Exporter> exporter = std::make_shared<Trace::Exporter>();
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+        [exporter](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return exporter->read(buffer, maxLen);
+        });
+    response->addHeader("Access-Control-Allow-Origin", "*");
+    response->addHeader("Content-Disposition", "attachment; filename=\"deskhog-trace.json\"");
+    request->send(response);
+}
+
+void CaptivePortal::buildStatus(JsonDocument& doc) {
+    for (size_t i = 0; i < STATUS_SECTION_COUNT; i++) {
+        buildStatusSection(i, doc.createNestedObject(STATUS_SECTIONS[i]));
     }
+}
 
-    JsonObject wifiObj = doc.createNestedObject("wifi");
-    wifiObj["is_scanning"] = (_action_in_progress == PortalAction::SCAN_WIFI); 
-    if (_lastScanTime > 0 && !_cachedNetworks.isEmpty()){ 
-        DynamicJsonDocument cachedNetDoc(4096);
-        DeserializationError error = deserializeJson(cachedNetDoc, _cachedNetworks);
-        if (!error) {
-            wifiObj["networks"] = cachedNetDoc.as<JsonArray>(); 
+void CaptivePortal::buildStatusSection(size_t section, JsonObject obj) {
+    switch (section) {
+    case STATUS_PORTAL: {
+        obj["action_in_progress"] = portalActionToString(_action_in_progress);
+        obj["last_action_completed"] = portalActionToString(_last_action_completed);
+        obj["last_action_status"] = _last_action_was_success ? "SUCCESS" : (_last_action_completed != PortalAction::NONE ? "ERROR" : "NONE");
+        obj["last_action_message"] = _last_action_message;
+
+        // Add specific OTA request status message from the portal's perspective
+        String portalOtaRequestMsg = "";
+        if (_action_in_progress == PortalAction::CHECK_OTA_UPDATE) {
+            portalOtaRequestMsg = "Portal: OTA update check request is pending execution.";
+        } else if (_action_in_progress == PortalAction::START_OTA_UPDATE) {
+            portalOtaRequestMsg = "Portal: OTA update start request is pending execution.";
         } else {
-            Serial.printf("Failed to parse cached networks JSON in handleApiStatus: %s\n", error.c_str());
-            wifiObj.createNestedArray("networks");
+            // Check if the *last completed* action by the portal was an OTA dispatch
+            if (_last_action_completed == PortalAction::CHECK_OTA_UPDATE || _last_action_completed == PortalAction::START_OTA_UPDATE) {
+                if (_last_action_was_success) {
+                    portalOtaRequestMsg = "Portal: Successfully dispatched '" + String(portalActionToString(_last_action_completed)) + "' to OtaManager. Current OtaManager status follows.";
+                } else {
+                    portalOtaRequestMsg = "Portal: Failed to dispatch '" + String(portalActionToString(_last_action_completed)) + "'. Error: " + _last_action_message;
+                }
+            }
         }
-    } else {
-        wifiObj.createNestedArray("networks");
+        if (!portalOtaRequestMsg.isEmpty()) {
+            obj["portal_ota_action_message"] = portalOtaRequestMsg;
+        }
+        break;
+    }
+    case STATUS_WIFI:
+        obj["is_scanning"] = _wifiInterface.isScanning() || _action_in_progress == PortalAction::SCAN_WIFI;
+        // Already serialized when the scan finished; embed it as-is
+        obj["networks"] = serialized(_cachedNetworks);
+        obj["last_scan_time"] = _wifiInterface.getLastScanTime();
+        obj["connected_ssid"] = _wifiInterface.getCurrentSsid(); 
+        obj["ip_address"] = _wifiInterface.getIPAddress();
+        obj["is_connected"] = _wifiInterface.isConnected(); 
+        obj["connect_time_ms"] = _wifiInterface.getLastConnectTime();
+        obj["fast_connect"] = _wifiInterface.lastConnectWasFast();
+        break;
+    case STATUS_DEVICE_CONFIG: {
+        obj["team_id"] = _configManager.getTeamId();
+        String apiKey = _configManager.getApiKey();
+        obj["api_key_display"] = apiKey.length() > 0 ? "********" + apiKey.substring(apiKey.length() - 4) : "";
+        obj["api_key_present"] = apiKey.length() > 0;
+        obj["region"] = _configManager.getRegion();
+        break;
+    }
+    case STATUS_OTA: {
+        UpdateStatus status = _otaManager.getStatus();
+        UpdateInfo lastCheck = _otaManager.getLastCheckResult();
+        if (status.status == UpdateStatus::State::MUTEX_BUSY) {
+            markStatusDirty(STATUS_BIT(STATUS_OTA)); // Read it again on the next push
+        }
+        obj["status_code"] = static_cast<int>(status.status);
+        obj["status_message"] = status.message;
+        obj["progress"] = status.progress;
+        obj["current_firmware_version"] = lastCheck.currentVersion; 
+        obj["update_available"] = lastCheck.updateAvailable;     
+        obj["available_version"] = lastCheck.availableVersion;  
+        obj["release_notes"] = lastCheck.releaseNotes;        
+        obj["error_message"] = lastCheck.error;
+        break;
+    }
+    case STATUS_SYSTEM: {
+        ControllerState systemState = SystemController::getFullState();
+        obj["wifi_state"] = static_cast<int>(systemState.wifi_state);
+        obj["api_state"] = static_cast<int>(systemState.api_state);
+        obj["auth_state"] = static_cast<int>(systemState.auth_state);
+        obj["sys_state"] = static_cast<int>(systemState.sys_state);
+        break;
+    }
     }
-    wifiObj["last_scan_time"] = _lastScanTime;
-    wifiObj["connected_ssid"] = _wifiInterface.getCurrentSsid(); 
-    wifiObj["ip_address"] = _wifiInterface.getIPAddress();
-    wifiObj["is_connected"] = _wifiInterface.isConnected(); 
+}
 
-    JsonObject deviceConfigObj = doc.createNestedObject("device_config");
-    deviceConfigObj["team_id"] = _configManager.getTeamId();
-    String apiKey = _configManager.getApiKey();
-    deviceConfigObj["api_key_display"] = apiKey.length() > 0 ? "********" + apiKey.substring(apiKey.length() - 4) : "";
-    deviceConfigObj["api_key_present"] = apiKey.length() > 0;
-    deviceConfigObj["region"] = _configManager.getRegion();
+void CaptivePortal::markStatusDirty(uint32_t sections) {
+    _dirtySections.fetch_or(sections);
+}
 
+void CaptivePortal::pushStatusChanges() {
+    // OtaManager's tasks don't call back, so compare its status version here
+    uint32_t otaVersion = _otaManager.getStatusVersion();
+    if (otaVersion != _pushedOtaVersion) {
+        _pushedOtaVersion = otaVersion;
+        markStatusDirty(STATUS_BIT(STATUS_OTA));
+    }
 
-    JsonObject otaObj = doc.createNestedObject("ota");
-    UpdateStatus status = _otaManager.getStatus();
-    UpdateInfo lastCheck = _otaManager.getLastCheckResult();
-    otaObj["status_code"] = static_cast<int>(status.status);
-    otaObj["status_message"] = status.message;
-    otaObj["progress"] = status.progress;
-    otaObj["current_firmware_version"] = lastCheck.currentVersion; 
-    otaObj["update_available"] = lastCheck.updateAvailable;     
-    otaObj["available_version"] = lastCheck.availableVersion;  
-    otaObj["release_notes"] = lastCheck.releaseNotes;        
-    otaObj["error_message"] = lastCheck.error;               
+    if (_events.count() == 0) {
+        // Nobody listening; the next client gets a full snapshot on connect
+        _dirtySections = 0;
+        return;
+    }
+    if (_dirtySections.load() == 0) {
+        return;
+    }
+    // Let bursts such as OTA progress collapse into one push per interval
+    unsigned long now = millis();
+    if (now - _lastStatusPush < STATUS_PUSH_INTERVAL_MS) {
+        return;
+    }
+    _lastStatusPush = now;
 
+    uint32_t dirty = _dirtySections.exchange(0);
+    for (size_t i = 0; i < STATUS_SECTION_COUNT; i++) {
+        if (!(dirty & STATUS_BIT(i))) {
+            continue;
+        }
+        // The network list is copied in whole, so that section grows with it
+        DynamicJsonDocument doc(i == STATUS_WIFI ? STATUS_SECTION_DOC_SIZE + _cachedNetworks.length()
+                                                 : STATUS_SECTION_DOC_SIZE);
+        buildStatusSection(i, doc.to<JsonObject>());
+        String section;
+        serializeJson(doc, section);
+        if (section != _pushedSections[i]) {
+            _events.send(section.c_str(), STATUS_SECTIONS[i], ++_statusEventId);
+            _pushedSections[i] = section;
+        }
+    }
+}
+
+void CaptivePortal::handleEventsConnect(AsyncEventSourceClient *client) {
+    DynamicJsonDocument doc(STATUS_DOC_SIZE);
+    buildStatus(doc);
     String responseJson;
     serializeJson(doc, responseJson);
-    AsyncWebServerResponse *response = request->beginResponse(200, "application/json", responseJson);
-    response->addHeader("Access-Control-Allow-Origin", "*");
-    response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-    response->addHeader("Pragma", "no-cache");
-    response->addHeader("Expires", "0");
-    request->send(response);
+    // Ask the browser to retry quickly if the device drops the stream
+    client->send(responseJson.c_str(), "status", _statusEventId, STATUS_RECONNECT_MS);
 }
 
 void CaptivePortal::handleRequestWifiScan(AsyncWebServerRequest *request) {
@@ -659,6 +807,7 @@ void CaptivePortal::requestAction(PortalAction action, AsyncWebServerRequest *re
         _last_action_completed = PortalAction::NONE; // Clear previous completed action for this new pending one
         _last_action_was_success = false; // Default until processed
         _last_action_message = "Action '" + String(portalActionToString(action)) + "' received and is pending.";
+        markStatusDirty(STATUS_BIT(STATUS_PORTAL) | actionStatusSections(action));
 
         doc["status"] = "queued";
         doc["message"] = "Action '" + String(portalActionToString(action)) + "' queued.";
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include <vector> // For std::vector
+#include <atomic>
 
 // Attempt to signal ESPAsyncWebServer that WebServer-style definitions are present
 // #define _WEBSERVER_H_ // A common guard for WebServer libraries - REMOVING
@@ -18,6 +19,7 @@
 #include "html_portal.h"  // Include generated HTML header
 #include "EventQueue.h"   // Include the event queue
 #include "config/CardConfig.h"  // Include card configuration structures
+#include <ArduinoJson.h>
 // #include "OtaManager.h" // Will be included in .cpp, forward declare here
 
 class OtaManager; // Forward declaration
@@ -76,11 +78,11 @@ public:
 
 private:
     AsyncWebServer _server;              ///< Web server instance on port 80
+    AsyncEventSource _events;            ///< Server-Sent Events status channel at /api/events
     ConfigManager& _configManager;   ///< Configuration storage reference
     WiFiInterface& _wifiInterface;   ///< WiFi management reference
     EventQueue& _eventQueue;         ///< Event system reference
-    String _cachedNetworks;         ///< Cached JSON of available networks
-    unsigned long _lastScanTime;     ///< Timestamp of last WiFi scan
+    String _cachedNetworks;         ///< Cached JSON of available networks, rebuilt when a scan finishes
     OtaManager& _otaManager;         ///< OTA Update Manager reference
     CardController& _cardController; ///< Card controller reference
 
@@ -102,6 +104,18 @@ private:
     bool _last_action_was_success;
     String _last_action_message;
 
+    // Status push channel state
+    static const size_t STATUS_DOC_SIZE = 4608;            ///< JSON capacity for the full status document
+    static const size_t STATUS_SECTION_DOC_SIZE = 2048;    ///< JSON capacity for one section, plus the network list for wifi
+    static const size_t STATUS_SECTION_COUNT = 5;          ///< portal, wifi, device_config, ota, system
+    static const unsigned long STATUS_PUSH_INTERVAL_MS = 250; ///< Minimum spacing between pushes
+    static const uint32_t STATUS_RECONNECT_MS = 2000;      ///< Browser retry delay after a dropped stream
+    String _pushedSections[STATUS_SECTION_COUNT];          ///< Last JSON sent per section
+    std::atomic<uint32_t> _dirtySections;                  ///< Bit per section changed since the last push; set from any task
+    uint32_t _pushedOtaVersion;                            ///< OtaManager::getStatusVersion() when last compared
+    unsigned long _lastStatusPush;
+    uint32_t _statusEventId;
+
     /**
      * @brief Serve the main portal page
      * Sends static HTML from html_portal.h
@@ -110,7 +124,7 @@ private:
     
     /**
      * @brief Handle network scan request
-     * Returns cached results and triggers new scan if >10s old
+     * Returns cached results and queues a background scan if >10s old
      */
     void handleScanNetworks(AsyncWebServerRequest *request);
     
@@ -171,16 +185,17 @@ private:
     void handle404(AsyncWebServerRequest *request);
 
     /**
-     * @brief Scan and format available networks
+     * @brief Format the WiFiInterface network cache
      * @return JSON string of networks sorted by signal strength
      */
     String getNetworksJson();
 
     /**
-     * @brief Perform WiFi network scan
-     * Updates _cachedNetworks and _lastScanTime
+     * @brief Start a non-blocking WiFi network scan
+     * processAsyncOperations() refreshes _cachedNetworks when it finishes.
+     * @return false if the radio refused to start scanning
      */
-    void performWiFiScan();
+    bool performWiFiScan();
 
     /**
      * @brief Handle request to check for firmware updates.
@@ -201,6 +216,50 @@ private:
 
     // New handlers for async action requests and status
     void handleApiStatus(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Export Metrics as JSON, or Prometheus text with ?format=prometheus
+     * @param request Web request
+     */
+    void handleApiMetrics(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Stream the Trace ring as Chrome trace-event JSON
+     * @param request Web request
+     */
+    void handleApiTrace(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Fill a document with the portal, wifi, device_config, ota and system sections
+     * Shared by /api/status and the /api/events push channel.
+     */
+    void buildStatus(JsonDocument& doc);
+
+    /**
+     * @brief Fill one section of the status document
+     * @param section Index into the section list (portal, wifi, device_config, ota, system)
+     * @param obj Object to fill
+     */
+    void buildStatusSection(size_t section, JsonObject obj);
+
+    /**
+     * @brief Flag status sections for the next push; safe from any task
+     * @param sections Bit per section index
+     */
+    void markStatusDirty(uint32_t sections);
+
+    /**
+     * @brief Rebuild and send the sections flagged since the last push
+     * Called from processAsyncOperations(). Sections are flagged by actions,
+     * finished scans, SystemController state changes and OtaManager's status
+     * version; nothing is built while no client is listening.
+     */
+    void pushStatusChanges();
+
+    /**
+     * @brief Send a new /api/events client the full status document
+     */
+    void handleEventsConnect(AsyncEventSourceClient *client);
     void handleRequestWifiScan(AsyncWebServerRequest *request);
     void handleRequestSaveWifi(AsyncWebServerRequest *request);
     void handleRequestSaveDeviceConfig(AsyncWebServerRequest *request);
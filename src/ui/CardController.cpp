@@ -1,6 +1,8 @@
 #include "ui/CardController.h"
 #include "ui/PaddleCard.h"
 #include "ui/PokedexCard.h"
+#include "Metrics.h"
+#include "Trace.h"
 #include <algorithm>
 
 QueueHandle_t CardController::uiQueue = nullptr;
@@ -520,6 +522,15 @@ void CardController::reconcileCards(const std::vector<CardConfig>& newConfigs) {
             }
         }
         
+        // Insight cards that were removed no longer hold up the load time
+        std::set<String> insightIds;
+        for (const CardConfig& config : sortedConfigs) {
+            if (config.type == CardType::INSIGHT) {
+                insightIds.insert(config.config);
+            }
+        }
+        posthogClient.retainInsights(insightIds);
+        
         // Force another LVGL refresh to ensure everything is properly laid out
         lv_refr_now(NULL);
         
@@ -560,12 +571,17 @@ void CardController::initUIQueue() {
     }
 }
 
-void CardController::processUIQueue() {
-    if (uiQueue == nullptr) return;
+bool CardController::processUIQueue() {
+    if (uiQueue == nullptr) return false;
+
+    UBaseType_t waiting = uxQueueMessagesWaiting(uiQueue);
+    Metrics::uiQueueDepth.set(waiting);
+    Metrics::uiQueueDepthMax.raiseTo(waiting);
 
     UICallback* callback_ptr = nullptr;
     while (xQueueReceive(uiQueue, &callback_ptr, 0) == pdTRUE) {
         if (callback_ptr) {
+            TRACE_SCOPE("ui.callback");
             callback_ptr->execute();
             delete callback_ptr;
         }
@@ -573,7 +589,30 @@ void CardController::processUIQueue() {
     
     // Update active card (for games and other interactive cards)
     if (cardStack) {
-        cardStack->updateActiveCard();
+        return cardStack->updateActiveCard();
+    }
+    return false;
+}
+
+void CardController::waitForUIWork(TickType_t timeout) {
+    if (uiQueue == nullptr) {
+        vTaskDelay(timeout);
+        return;
+    }
+    // Peek so the callback stays queued for processUIQueue()
+    UICallback* pending = nullptr;
+    xQueuePeek(uiQueue, &pending, timeout);
+}
+
+void IRAM_ATTR CardController::wakeUIFromISR() {
+    if (uiQueue == nullptr || uxQueueMessagesWaitingFromISR(uiQueue) > 0) {
+        return;
+    }
+    UICallback* wake = nullptr;
+    BaseType_t woken = pdFALSE;
+    xQueueSendToBackFromISR(uiQueue, &wake, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
     }
 }
 
@@ -599,6 +638,7 @@ void CardController::dispatchToLVGLTask(std::function<void()> update_func, bool
     if (queue_send_result != pdTRUE) {
         Serial.printf("[UI-WARN] UI queue full/error (send_to_front: %d), update discarded. Core: %d\n", 
                       to_front, xPortGetCoreID());
+        Metrics::uiQueueDrops.add();
         delete callback;
     }
 }
@@ -611,8 +651,8 @@ void CardController::handleCardTitleUpdated(const Event& event) {
             if (cardConfig.name != event.title) {
                 cardConfig.name = event.title;
                 
-                // Save the updated configuration to persistent storage
-                configManager.saveCardConfigs(currentCardConfigs);
+                // Only this card's record changes; the card set itself is unchanged
+                configManager.updateCardName(cardConfig.type, cardConfig.config, event.title);
                 
                 Serial.printf("Updated card title for insight %s to: %s\n", 
                              event.insightId.c_str(), event.title.c_str());
@@ -626,7 +666,10 @@ void CardController::handlePokeAPIEvent(const Event& event) {
     // Find the PokedexCard instance (was PokeAPICard)
     auto it = dynamicCards.find(CardType::POKEDEX);
     if (it == dynamicCards.end() || it->second.empty()) {
-        // No Pokedex card exists
+        // No Pokedex card exists (e.g. removed mid-fetch), so nobody owns the PNG
+        if (event.type == EventType::POKEAPI_SPRITE_READY) {
+            delete[] event.byteData;
+        }
         return;
     }
     
@@ -653,15 +696,16 @@ void CardController::handlePokeAPIEvent(const Event& event) {
                 // Queue UI update for sprite display
                 dispatchToLVGLTask([pokeCard, event]() {
                     // Note: byteData ownership is transferred to PokedexCard
-                    pokeCard->onSpriteReceived(event.byteData, event.byteDataSize);
+                    pokeCard->onSpriteReceived(event.intData, event.byteData, event.byteDataSize);
                 });
                 break;
                 
             case EventType::POKEAPI_ERROR: {
+                int id = event.intData;
                 String errorMsg = String(event.stringData);
                 // Queue UI update for error display
-                dispatchToLVGLTask([pokeCard, errorMsg]() {
-                    pokeCard->onFetchError(errorMsg);
+                dispatchToLVGLTask([pokeCard, id, errorMsg]() {
+                    pokeCard->onFetchError(id, errorMsg);
                 });
                 break;
             }
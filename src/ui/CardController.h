@@ -140,8 +140,28 @@ public:
      * 
      * Processes all queued UI updates in the LVGL task context.
      * Should be called regularly from the LVGL handler task.
+     * 
+     * @return true if the active card is animating and needs another pass within a frame
+     */
+    bool processUIQueue();
+
+    /**
+     * @brief Block the LVGL task until UI work is queued or the timeout expires
+     * 
+     * Lets the UI task sleep between frames while still waking the moment
+     * another task dispatches an update.
+     * 
+     * @param timeout Longest time to wait
+     */
+    void waitForUIWork(TickType_t timeout);
+
+    /**
+     * @brief Wake the LVGL task from waitForUIWork() out of an interrupt handler
+     * 
+     * Queues an empty item, which processUIQueue() discards. Does nothing if
+     * the queue already holds work, since the task is then awake anyway.
      */
-    void processUIQueue();
+    static void wakeUIFromISR();
     
     /**
      * @brief Thread-safe method to dispatch UI updates to the LVGL task
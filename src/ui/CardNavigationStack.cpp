@@ -8,7 +8,8 @@ extern Bounce2::Button buttons[];
 #define NUM_BUTTONS 3
 
 CardNavigationStack::CardNavigationStack(lv_obj_t* parent, uint16_t width, uint16_t height)
-    : _parent(parent), _width(width), _height(height), _current_card(0), _mutex_ptr(nullptr) {
+    : _parent(parent), _width(width), _height(height), _current_card(0), _mutex_ptr(nullptr),
+      _handler_card(nullptr), _cached_handler(nullptr) {
     
     // Create main container
     _main_container = lv_obj_create(_parent);
@@ -182,23 +183,17 @@ void CardNavigationStack::handleButtonPress(uint8_t button_index) {
     }
     
     // Try to delegate button press to active card's input handler first
-    lv_obj_t* current_card = lv_obj_get_child(_main_container, _current_card);
+    InputHandler* handler = _current_handler();
     bool handled = false;
     
-    for (const auto& handler_pair : _input_handlers) {
-        if (handler_pair.first == current_card) {
-            // Found a handler for the current card
-            if (handler_pair.second) {
-                handled = handler_pair.second->handleButtonPress(button_index);
-                if (handled) {
-                    // Handler processed the button press, don't do default behavior
-                    if (_mutex_ptr) {
-                        xSemaphoreGive(*_mutex_ptr);
-                    }
-                    return;
-                }
+    if (handler) {
+        handled = handler->handleButtonPress(button_index);
+        if (handled) {
+            // Handler processed the button press, don't do default behavior
+            if (_mutex_ptr) {
+                xSemaphoreGive(*_mutex_ptr);
             }
-            break;
+            return;
         }
     }
     
@@ -222,17 +217,11 @@ void CardNavigationStack::registerInputHandler(lv_obj_t* card, InputHandler* han
     // Don't register null handlers
     if (!card || !handler) return;
     
-    // Check if this card already has a handler
-    for (auto& handler_pair : _input_handlers) {
-        if (handler_pair.first == card) {
-            // Update existing handler
-            handler_pair.second = handler;
-            return;
-        }
+    // Add or replace the handler for this card
+    _input_handlers[card] = handler;
+    if (_handler_card == card) {
+        _cached_handler = handler;
     }
-    
-    // Add new handler
-    _input_handlers.push_back(std::make_pair(card, handler));
 }
 
 void CardNavigationStack::forceUpdateIndicators() {
@@ -246,19 +235,20 @@ void CardNavigationStack::forceUpdateIndicators() {
     lv_obj_invalidate(_scroll_indicator);
 }
 
-void CardNavigationStack::updateActiveCard() {
-    // Get the current card
-    lv_obj_t* currentCard = lv_obj_get_child(_main_container, _current_card);
-    if (!currentCard) return;
-    
-    // Find the input handler for this card
-    for (const auto& handler_pair : _input_handlers) {
-        if (handler_pair.first == currentCard) {
-            // Call update on the handler
-            handler_pair.second->update();
-            break;
-        }
+bool CardNavigationStack::updateActiveCard() {
+    InputHandler* handler = _current_handler();
+    return handler ? handler->update() : false;
+}
+
+InputHandler* CardNavigationStack::_current_handler() {
+    // lv_obj_get_child() indexes the child array directly
+    lv_obj_t* current_card = lv_obj_get_child(_main_container, _current_card);
+    if (current_card != _handler_card) {
+        auto it = current_card ? _input_handlers.find(current_card) : _input_handlers.end();
+        _cached_handler = (it != _input_handlers.end()) ? it->second : nullptr;
+        _handler_card = current_card;
     }
+    return _cached_handler;
 }
 
 void CardNavigationStack::_scroll_event_cb(lv_event_t* e) {
@@ -375,11 +365,11 @@ bool CardNavigationStack::removeCard(lv_obj_t* card) {
     }
     
     // Remove input handler for this card if it exists
-    for (auto it = _input_handlers.begin(); it != _input_handlers.end(); ++it) {
-        if (it->first == card) {
-            _input_handlers.erase(it);
-            break;
-        }
+    _input_handlers.erase(card);
+    if (_handler_card == card) {
+        // A later card could be allocated at the same address
+        _handler_card = nullptr;
+        _cached_handler = nullptr;
     }
     
     // Delete the card from LVGL
@@ -3,7 +3,7 @@
 #include <lvgl.h>
 #include <Arduino.h>
 #include <Bounce2.h>
-#include <vector>
+#include <unordered_map>
 #include "ui/InputHandler.h"
 
 // Forward declaration
@@ -118,8 +118,10 @@ public:
      * 
      * Calls the update() method on the currently active card's InputHandler.
      * Should be called regularly from the main LVGL task.
+     * 
+     * @return true if the active card is animating and wants another update soon
      */
-    void updateActiveCard();
+    bool updateActiveCard();
     
 private:
     /**
@@ -143,6 +145,16 @@ private:
      * Highlights the pip corresponding to active card.
      */
     void _update_scroll_indicator(int active_index);
+
+    /**
+     * @brief Input handler for the card at _current_card, or nullptr
+     *
+     * Runs on every UI tick, so the result is cached against the card
+     * object it was resolved for. The cache is checked against the live
+     * child at _current_card, which keeps it correct across navigation,
+     * insertion and reordering; only a miss touches the handler map.
+     */
+    InputHandler* _current_handler();
     
     // UI elements
     lv_obj_t* _parent;              ///< Parent LVGL object
@@ -160,5 +172,7 @@ private:
     SemaphoreHandle_t* _mutex_ptr;  ///< Optional mutex for thread-safe updates
     
     // Input handling
-    std::vector<std::pair<lv_obj_t*, InputHandler*>> _input_handlers;  ///< Card-specific input handlers
+    std::unordered_map<lv_obj_t*, InputHandler*> _input_handlers;  ///< Card-specific input handlers
+    lv_obj_t* _handler_card;        ///< Card _cached_handler was resolved for
+    InputHandler* _cached_handler;  ///< Handler for _handler_card (may be nullptr)
 }; 
\ No newline at end of file
@@ -53,7 +53,8 @@ void FlappyHogCard::prepareForRemoval() {
 bool FlappyHogCard::update() {
     if (game) {
         game->loop();
-        return true; // Continue receiving updates
+        // Menus only react to button presses, which don't need a fast frame rate
+        return game->is_animating();
     }
     return false;
 }
\ No newline at end of file
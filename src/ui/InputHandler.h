@@ -33,7 +33,9 @@ public:
      * This method is called regularly when the card is active/visible.
      * Cards that don't need updates can use the default empty implementation.
      * 
-     * @return true if the card needs continuous updates, false to stop updates
+     * @return true while the card is animating and needs to be called again
+     *         within a frame; false lets the UI task sleep until the next
+     *         LVGL timer, queued UI update or button poll
      */
     virtual bool update() { return false; }
 }; 
\ No newline at end of file
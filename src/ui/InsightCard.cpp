@@ -6,6 +6,8 @@
 #include "renderers/LineGraphRenderer.h"
 #include "renderers/FunnelRenderer.h"
 #include "hardware/Input.h"
+#include "Metrics.h"
+#include "Trace.h"
 
 
 InsightCard::InsightCard(lv_obj_t* parent, ConfigManager& config, EventQueue& eventQueue,
@@ -94,7 +96,10 @@ InsightCard::~InsightCard() {
 void InsightCard::onEvent(const Event& event) {
     std::shared_ptr<InsightParser> parser = nullptr;
     if (event.jsonData.length() > 0) {
+        TRACE_SCOPE("insight.parse");
+        unsigned long parse_start = millis();
         parser = std::make_shared<InsightParser>(event.jsonData.c_str());
+        Metrics::parseTimeMs.observe(millis() - parse_start);
     } else if (event.parser) {
         parser = event.parser;
     } else {
@@ -106,6 +111,7 @@ void InsightCard::onEvent(const Event& event) {
 }
 
 void InsightCard::handleParsedData(std::shared_ptr<InsightParser> parser) {
+    TRACE_SCOPE("insight.handle");
     if (!parser || !parser->isValid()) {
         Serial.printf("[InsightCard-%s] Invalid data or parse error.\n", _insight_id.c_str());
         if (globalUIDispatch) {
@@ -184,6 +190,7 @@ void InsightCard::handleParsedData(std::shared_ptr<InsightParser> parser) {
                 }
                 lv_display_t* disp = lv_display_get_default();
                 if (disp) {
+                    TRACE_SCOPE("insight.refresh");
                     lv_refr_now(disp);
                 }
             } else {
@@ -156,17 +156,17 @@ bool PaddleCard::update() {
         }
     }
 
-    // Call PaddleGame's update loop if card is valid and game is Playing or in ServeDelay
+    // Run whatever simulation ticks are due; PaddleGame only advances while Playing or in ServeDelay
     if (lv_obj_is_valid(_card_root_obj)) {
-      if (current_game_state == PaddleGame::GameState::Playing || 
-          current_game_state == PaddleGame::GameState::ServeDelay) {
-          _paddle_game_instance.update();
-      }
+      _paddle_game_instance.update(millis());
       updateUi(); // This will call updateMessageLabel() internally
     }
 
     _previous_game_state = current_game_state; // Update previous state for next frame
-    return true; // Continue receiving updates
+
+    // Only a running rally needs frame-rate updates; menus wait for button polls
+    PaddleGame::GameState state = _paddle_game_instance.getState();
+    return state == PaddleGame::GameState::Playing || state == PaddleGame::GameState::ServeDelay;
 }
 
 void PaddleCard::updateUi() {
@@ -11,7 +11,7 @@ public:
     PaddleCard(lv_obj_t* parent);
     ~PaddleCard() override; // Marking as override
 
-    bool update() override; // Returns true to keep receiving updates
+    bool update() override; // Returns true while the game needs frame-rate updates
     bool handleButtonPress(uint8_t button_index) override;
     lv_obj_t* getCard() const; // Matches main's architecture
     void prepareForRemoval() override { markedForRemoval = true; } // Prevent double deletion
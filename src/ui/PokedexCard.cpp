@@ -4,7 +4,7 @@
 #include "EventQueue.h"
 #include <ArduinoJson.h>
 #include <esp_heap_caps.h>
-#include "../../lib/lodepng/lodepng.h"
+#include "ui/SpriteDecoder.h"
 #include "sprites/sprites.h"  // For default Pokemon sprites
 
 extern EventQueue* eventQueue;  // Global event queue
@@ -31,8 +31,67 @@ static void scroll_y_anim_cb(void* obj, int32_t v) {
     lv_obj_set_y((lv_obj_t*)obj, -v);
 }
 
-PokedexCard::PokedexCard(lv_obj_t* parent) : _card(nullptr), _state(IDLE), _isTransitioning(false), 
-    _transitionOverlay(nullptr), _descContainer(nullptr), _lastRequestTime(0) {
+// Map the UTF-8 punctuation and accents PokeAPI uses onto the ASCII our fonts cover
+static String toDisplayText(const String& text) {
+    String clean = "";
+    for (size_t i = 0; i < text.length(); i++) {
+        unsigned char c = (unsigned char)text.charAt(i);
+        
+        // Handle UTF-8 sequences
+        if (c == 0xC3) {
+            // This might be the start of an accented character (2-byte UTF-8)
+            if (i + 1 < text.length()) {
+                unsigned char next = (unsigned char)text.charAt(i+1);
+                if (next == 0xA9) {
+                    // é (lowercase e with acute)
+                    clean += "e";
+                    i += 1;
+                    continue;
+                } else if (next == 0x89) {
+                    // É (uppercase E with acute)
+                    clean += "E";
+                    i += 1;
+                    continue;
+                }
+            }
+        } else if (c == 0xE2) {
+            // This might be the start of a smart quote or em-dash (3-byte UTF-8)
+            if (i + 2 < text.length()) {
+                if (text.charAt(i+1) == 0x80) {
+                    char third = text.charAt(i+2);
+                    if (third == 0x98 || third == 0x99) {
+                        // Smart single quotes
+                        clean += "'";
+                        i += 2;
+                        continue;
+                    } else if (third == 0x9C || third == 0x9D) {
+                        // Smart double quotes
+                        clean += "\"";
+                        i += 2;
+                        continue;
+                    } else if (third == 0x94 || third == 0x93) {
+                        // Em dash or en dash
+                        clean += "-";
+                        i += 2;
+                        continue;
+                    }
+                }
+            }
+        }
+        
+        // Keep only printable ASCII characters
+        if (c >= 32 && c <= 126) {
+            clean += (char)c;
+        } else if (c == '\n' || c == '\r') {
+            clean += ' ';  // Replace newlines with spaces
+        }
+    }
+    
+    return clean;
+}
+
+PokedexCard::PokedexCard(lv_obj_t* parent) : _cache(CACHE_BUDGET_BYTES), _card(nullptr), _state(IDLE), 
+    _isTransitioning(false), _transitionOverlay(nullptr), _descContainer(nullptr), _lastRequestTime(0) {
     
     // Initialize grid cells array
     for (int i = 0; i < 32; i++) {
@@ -48,11 +107,13 @@ PokedexCard::PokedexCard(lv_obj_t* parent) : _card(nullptr), _state(IDLE), _isTr
     _current.id = offlinePokemon[currentOfflineIndex].id;
     _current.name = offlinePokemon[currentOfflineIndex].name;
     _current.description = offlinePokemon[currentOfflineIndex].description;
-    _current.sprite = (lv_img_dsc_t*)offlinePokemon[currentOfflineIndex].sprite;
+    _current.sprite = SpriteCache::wrapStatic(offlinePokemon[currentOfflineIndex].sprite);
     
     _pending.pngData = nullptr;
     _pending.pngSize = 0;
-    _pending.sprite = nullptr;
+    
+    _prefetch.pngData = nullptr;
+    clearPrefetch();
     
     _card = lv_obj_create(parent);
     lv_obj_set_size(_card, LV_PCT(100), LV_PCT(100));
@@ -109,15 +170,20 @@ void PokedexCard::updatePokemonDisplay() {
     _current.name = _pending.name;
     _current.description = _pending.description;
     
-    // Free old sprite if exists
-    freeSprite(_current.sprite);
+    // Keep the old sprite alive until the image widget has switched source
+    SpriteCache::SpriteRef previousSprite = _current.sprite;
     
     // Use the already-decoded sprite
     _current.sprite = _pending.sprite;
-    _pending.sprite = nullptr; // Transfer ownership
+    _pending.sprite.reset();
     
     // Update display
     displayPokemon();
+    
+    if (_pressTime > 0) {
+        Serial.printf("[PokedexCard] Press-to-display for #%d: %lu ms\n", _current.id, millis() - _pressTime);
+        _pressTime = 0;
+    }
 }
 
 void PokedexCard::displayPokemon() {
@@ -138,9 +204,8 @@ void PokedexCard::displayPokemon() {
     startTextScrolling();
     
     // Update sprite if available
-    if (_current.sprite != nullptr) {
-        
-        lv_img_set_src(_spriteImg, _current.sprite);
+    if (_current.sprite) {
+        lv_img_set_src(_spriteImg, _current.sprite.get());
     }
 }
 
@@ -156,11 +221,11 @@ bool PokedexCard::handleButtonPress(uint8_t button_index) {
             return true;
         }
         
-        // Generate random Pokemon ID (All generations 1-9)
-        int randomId = random(1, 1026);  // Up to Gen 9 (Paldea region)
+        // Show the Pokemon chosen (and usually already fetched) in the background
+        int nextId = (_prefetch.id > 0) ? _prefetch.id : random(1, MAX_POKEMON_ID + 1);
         
         // Start fetch sequence
-        startFetchSequence(randomId);
+        startFetchSequence(nextId);
         
         return true;
     }
@@ -179,133 +244,140 @@ bool PokedexCard::canMakeRequest() {
 }
 
 void PokedexCard::startFetchSequence(int id) {
-    // First check cache
+    _pressTime = millis();
+    
+    // First check cache (a finished prefetch lands here)
     if (checkCache(id)) {
         // Found in cache! Start transition immediately
+        clearPrefetch();
+        startBattleTransition();
+        return;
+    }
+    
+    _pending.id = id;
+    
+    // Prefetch still in flight: take over whatever half has arrived
+    if (_prefetch.inFlight && _prefetch.id == id) {
+        Serial.printf("[PokedexCard] Adopting in-flight prefetch of #%d\n", id);
+        _pending.pngData = _prefetch.pngData;
+        _pending.pngSize = _prefetch.pngSize;
+        _prefetch.pngData = nullptr;
+        if (_prefetch.haveSpecies) {
+            _pending.name = _prefetch.name;
+            _pending.description = _prefetch.description;
+            _state = FETCHING_SPRITE;
+        } else {
+            _state = FETCHING_SPECIES;
+        }
+        clearPrefetch();
         startBattleTransition();
         return;
     }
+    clearPrefetch();
     
     // Not in cache, proceed with network fetch
     _state = FETCHING_SPECIES;
-    _pending.id = id;
     
     // Start the battle transition immediately
     startBattleTransition();
     
-    // Queue network request via EventQueue
+    // Species and sprite are fetched in parallel and may arrive in either order
     Event event;
     event.type = EventType::POKEAPI_FETCH_REQUEST;
     event.intData = id;
     eventQueue->publishEvent(event);
 }
 
-void PokedexCard::onDataReceived(int id, const String& name, const String& description) {
-    if (_state != FETCHING_SPECIES && _state != FETCHING_SPRITE) {
-        return;  // Ignore if not expecting data
+void PokedexCard::startPrefetch() {
+    if (_prefetch.id > 0 || !eventQueue) {
+        return;  // Already chosen
     }
     
-    Serial.printf("[PokedexCard] onDataReceived: id=%d, name='%s', desc='%s'\n", 
-                  id, name.c_str(), description.c_str());
+    int id;
+    do {
+        id = random(1, MAX_POKEMON_ID + 1);
+    } while (id == _current.id);
+    _prefetch.id = id;
     
-    // Clean up the description text - handle common Pokemon characters
-    String cleanDesc = "";
-    for (size_t i = 0; i < description.length(); i++) {
-        unsigned char c = (unsigned char)description.charAt(i);
-        
-        // Handle UTF-8 sequences
-        if (c == 0xC3) {
-            // This might be the start of an accented character (2-byte UTF-8)
-            if (i + 1 < description.length()) {
-                unsigned char next = (unsigned char)description.charAt(i+1);
-                if (next == 0xA9) {
-                    // é (lowercase e with acute)
-                    cleanDesc += "e";
-                    i += 1;
-                    continue;
-                } else if (next == 0x89) {
-                    // É (uppercase E with acute)
-                    cleanDesc += "E";
-                    i += 1;
-                    continue;
-                }
-            }
-        } else if (c == 0xE2) {
-            // This might be the start of a smart quote or em-dash (3-byte UTF-8)
-            if (i + 2 < description.length()) {
-                if (description.charAt(i+1) == 0x80) {
-                    char third = description.charAt(i+2);
-                    if (third == 0x98 || third == 0x99) {
-                        // Smart single quotes
-                        cleanDesc += "'";
-                        i += 2;
-                        continue;
-                    } else if (third == 0x9C || third == 0x9D) {
-                        // Smart double quotes
-                        cleanDesc += "\"";
-                        i += 2;
-                        continue;
-                    } else if (third == 0x94 || third == 0x93) {
-                        // Em dash or en dash
-                        cleanDesc += "-";
-                        i += 2;
-                        continue;
-                    }
-                }
-            }
-        }
-        
-        // Keep only printable ASCII characters
-        if (c >= 32 && c <= 126) {
-            cleanDesc += (char)c;
-        } else if (c == '\n' || c == '\r') {
-            cleanDesc += ' ';  // Replace newlines with spaces
-        }
+    if (_cache.contains(id)) {
+        return;  // Next press is served from cache
     }
     
-    // Also clean the name (Pokemon names can have accented characters)
-    String cleanName = "";
-    for (size_t i = 0; i < name.length(); i++) {
-        unsigned char c = (unsigned char)name.charAt(i);
-        
-        // Handle UTF-8 sequences
-        if (c == 0xC3) {
-            if (i + 1 < name.length()) {
-                unsigned char next = (unsigned char)name.charAt(i+1);
-                if (next == 0xA9) {
-                    cleanName += "e";  // é -> e
-                    i += 1;
-                    continue;
-                } else if (next == 0x89) {
-                    cleanName += "E";  // É -> E
-                    i += 1;
-                    continue;
-                }
-            }
-        }
-        
-        // Keep printable ASCII
-        if (c >= 32 && c <= 126) {
-            cleanName += (char)c;
+    _prefetch.inFlight = true;
+    _prefetch.haveSpecies = false;
+    
+    // Low priority: the network task only runs this when it has nothing else to do
+    Event event;
+    event.type = EventType::POKEAPI_PREFETCH_REQUEST;
+    event.intData = id;
+    if (!eventQueue->publishEvent(event)) {
+        _prefetch.inFlight = false;
+    }
+}
+
+void PokedexCard::clearPrefetch() {
+    if (_prefetch.pngData) {
+        delete[] _prefetch.pngData;
+        _prefetch.pngData = nullptr;
+    }
+    _prefetch.pngSize = 0;
+    _prefetch.id = 0;
+    _prefetch.inFlight = false;
+    _prefetch.haveSpecies = false;
+    _prefetch.name = "";
+    _prefetch.description = "";
+}
+
+void PokedexCard::onDataReceived(int id, const String& name, const String& description) {
+    // Background prefetch: remember the text until its sprite arrives
+    if (_prefetch.inFlight && id == _prefetch.id) {
+        _prefetch.name = toDisplayText(name);
+        _prefetch.description = toDisplayText(description);
+        _prefetch.haveSpecies = true;
+        if (_prefetch.pngData) {
+            uint8_t* pngData = _prefetch.pngData;
+            _prefetch.pngData = nullptr;
+            finishPrefetch(pngData, _prefetch.pngSize);
         }
+        return;
     }
     
+    if ((_state != FETCHING_SPECIES && _state != FETCHING_SPRITE) || id != _pending.id) {
+        return;  // Ignore if not expecting data
+    }
+    
+    Serial.printf("[PokedexCard] onDataReceived: id=%d, name='%s', desc='%s'\n", 
+                  id, name.c_str(), description.c_str());
+    
     _pending.id = id;
-    _pending.name = cleanName;
-    _pending.description = cleanDesc;
+    _pending.name = toDisplayText(name);
+    _pending.description = toDisplayText(description);
+    
+    // Sprite may have beaten the species data here
+    if (_pending.pngData) {
+        transitionToNewPokemon();
+        return;
+    }
     
     // Update state
     _state = FETCHING_SPRITE;
-    
-    // Now request the sprite
-    Event event;
-    event.type = EventType::POKEAPI_FETCH_SPRITE;
-    event.intData = id;
-    eventQueue->publishEvent(event);
 }
 
-void PokedexCard::onSpriteReceived(uint8_t* pngData, size_t pngSize) {
-    if (_state != FETCHING_SPRITE) {
+void PokedexCard::onSpriteReceived(int id, uint8_t* pngData, size_t pngSize) {
+    // Background prefetch: decode straight into the cache for the next press
+    if (_prefetch.inFlight && id == _prefetch.id) {
+        if (_prefetch.haveSpecies) {
+            finishPrefetch(pngData, pngSize);
+        } else {
+            // Hold it until the species data arrives
+            delete[] _prefetch.pngData;
+            _prefetch.pngData = pngData;
+            _prefetch.pngSize = pngSize;
+        }
+        return;
+    }
+    
+    if ((_state != FETCHING_SPECIES && _state != FETCHING_SPRITE) || id != _pending.id) {
         delete[] pngData;  // Clean up if not expecting
         return;
     }
@@ -313,22 +385,59 @@ void PokedexCard::onSpriteReceived(uint8_t* pngData, size_t pngSize) {
     Serial.printf("[PokedexCard] Received sprite PNG: %d bytes\n", pngSize);
     
     // Store the PNG data temporarily
+    delete[] _pending.pngData;
     _pending.pngData = pngData;
     _pending.pngSize = pngSize;
     
+    // Still waiting on the species data
+    if (_state == FETCHING_SPECIES) {
+        return;
+    }
+    
     // Transition to new Pokemon
     transitionToNewPokemon();
 }
 
-void PokedexCard::onFetchError(const String& error) {
+void PokedexCard::finishPrefetch(uint8_t* pngData, size_t pngSize) {
+    SpriteCache::SpriteRef sprite = SpriteCache::adopt(decodePngToLvgl(_prefetch.id, pngData, pngSize));
+    if (sprite) {
+        addToCache(_prefetch.id, _prefetch.name, _prefetch.description, sprite);
+        Serial.printf("[PokedexCard] Prefetched #%d (%s)\n", _prefetch.id, _prefetch.name.c_str());
+    } else {
+        // Not cached, so showing it fetches and decodes it again
+        Serial.printf("[PokedexCard] Prefetched sprite for #%d did not decode, dropping it\n", _prefetch.id);
+    }
+    delete[] pngData;
+    _prefetch.inFlight = false;
+    _prefetch.pngSize = 0;
+    _prefetch.name = "";
+    _prefetch.description = "";
+}
+
+void PokedexCard::onFetchError(int id, const String& error) {
+    // A failed prefetch is silent; the next press just fetches normally
+    if (_prefetch.inFlight && id == _prefetch.id) {
+        Serial.printf("[PokedexCard] Prefetch of #%d failed: %s\n", id, error.c_str());
+        clearPrefetch();
+        return;
+    }
+    
+    // Species and sprite fail independently; only the first error counts
+    if ((_state != FETCHING_SPECIES && _state != FETCHING_SPRITE) || id != _pending.id) {
+        return;
+    }
+    
     Serial.printf("[PokedexCard] Fetch error: %s\n", error.c_str());
     
+    // Keep the old sprite alive until the image widget has switched source
+    SpriteCache::SpriteRef previousSprite = _current.sprite;
+    
     // Cycle to next offline Pokemon on error
     currentOfflineIndex = (currentOfflineIndex + 1) % OFFLINE_POKEMON_COUNT;
     _current.id = offlinePokemon[currentOfflineIndex].id;
     _current.name = offlinePokemon[currentOfflineIndex].name;
     _current.description = "Network error. Showing offline Pokemon.";
-    _current.sprite = (lv_img_dsc_t*)offlinePokemon[currentOfflineIndex].sprite;
+    _current.sprite = SpriteCache::wrapStatic(offlinePokemon[currentOfflineIndex].sprite);
     
     // Clear pending data
     if (_pending.pngData) {
@@ -359,7 +468,8 @@ void PokedexCard::transitionToNewPokemon() {
     
     // Decode PNG to LVGL format
     if (_pending.pngData && _pending.pngSize > 0) {
-        _pending.sprite = decodePngToLvgl(_pending.pngData, _pending.pngSize);
+        lv_img_dsc_t* decoded = decodePngToLvgl(_pending.id, _pending.pngData, _pending.pngSize);
+        _pending.sprite = SpriteCache::adopt(decoded ? decoded : createPlaceholderSprite(_pending.id));
         
         // Clean up PNG data after decoding
         delete[] _pending.pngData;
@@ -386,100 +496,30 @@ void PokedexCard::transitionToNewPokemon() {
     }
 }
 
-lv_img_dsc_t* PokedexCard::decodePngToLvgl(uint8_t* pngData, size_t pngSize) {
-    Serial.printf("[PokedexCard] Decoding PNG to LVGL format (%d bytes)\n", pngSize);
-    
-    // Check PNG signature and print first bytes for debugging
-    Serial.printf("[PokedexCard] First 8 bytes: %02X %02X %02X %02X %02X %02X %02X %02X\n",
-                 pngData[0], pngData[1], pngData[2], pngData[3], 
-                 pngData[4], pngData[5], pngData[6], pngData[7]);
-    
-    if (pngSize < 8 || pngData[0] != 0x89 || pngData[1] != 'P' || pngData[2] != 'N' || pngData[3] != 'G') {
-        Serial.printf("[PokedexCard] Invalid PNG signature!\n");
-        return createPlaceholderSprite();
-    }
-    
-    // Decode PNG using lodepng
-    unsigned char* decodedImage = nullptr;
-    unsigned width, height;
-    
-    // Decode to RGBA format - use generic decode to handle indexed PNGs
-    // LCT_RGBA = 6, bitdepth = 8 for RGBA8888
-    unsigned error = lodepng_decode_memory(&decodedImage, &width, &height, 
-                                           (const unsigned char*)pngData, (size_t)pngSize,
-                                           6, 8);  // 6=LCT_RGBA, 8=8 bits per channel
-    
-    if (error) {
-        Serial.printf("[PokedexCard] PNG decode error %u\n", error);
-        // Fall back to colored placeholder
-        return createPlaceholderSprite();
-    }
-    
-    Serial.printf("[PokedexCard] Decoded PNG: %ux%u pixels\n", width, height);
-    
-    // Calculate size for LVGL format (ARGB8888)
-    size_t dataSize = width * height * 4;
-    
-    // Allocate sprite data in PSRAM
-    uint8_t* lvglData = (uint8_t*)heap_caps_malloc(dataSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!lvglData) {
-        Serial.println("[PokedexCard] Failed to allocate memory for LVGL sprite");
-        free(decodedImage);
-        return createPlaceholderSprite();
-    }
-    
-    // Convert from RGBA to ARGB (LVGL format)
-    // lodepng gives us RGBA, but LVGL expects ARGB
-    uint32_t* dstPixels = (uint32_t*)lvglData;
-    
-    for (size_t i = 0; i < width * height; i++) {
-        // decodedImage is a byte array with RGBA format
-        uint8_t* srcBytes = (uint8_t*)decodedImage;
-        size_t srcIndex = i * 4;
-        
-        uint8_t r = srcBytes[srcIndex + 0];
-        uint8_t g = srcBytes[srcIndex + 1]; 
-        uint8_t b = srcBytes[srcIndex + 2];
-        uint8_t a = srcBytes[srcIndex + 3];
-        
-        // Pack as ARGB8888 for LVGL
-        dstPixels[i] = (a << 24) | (r << 16) | (g << 8) | b;
-    }
-    
-    // Free the decoded image from lodepng
-    free(decodedImage);
+lv_img_dsc_t* PokedexCard::decodePngToLvgl(int id, uint8_t* pngData, size_t pngSize) {
+    Serial.printf("[PokedexCard] Decoding PNG to LVGL format (%u bytes)\n", (unsigned)pngSize);
     
-    // Create LVGL image descriptor  
-    lv_img_dsc_t* sprite = (lv_img_dsc_t*)heap_caps_malloc(sizeof(lv_img_dsc_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    SpriteDecoder::Stats stats;
+    lv_img_dsc_t* sprite = SpriteDecoder::decodePng(pngData, pngSize, &stats);
     if (!sprite) {
-        heap_caps_free(lvglData);
-        return createPlaceholderSprite();
+        return nullptr;
     }
     
-    sprite->header.magic = LV_IMAGE_HEADER_MAGIC;  // Must be 0x19 for LVGL 9
-    sprite->header.cf = LV_COLOR_FORMAT_ARGB8888;
-    sprite->header.flags = 0;  // No special flags needed
-    sprite->header.w = width;
-    sprite->header.h = height;
-    sprite->header.stride = width * 4;  // 4 bytes per pixel for ARGB8888
-    sprite->header.reserved_2 = 0;
-    sprite->data_size = dataSize;
-    sprite->data = lvglData;
-    
-    Serial.printf("[PokedexCard] Successfully decoded sprite for Pokemon #%d (%ux%u)\n", 
-                 _pending.id, width, height);
+    Serial.printf("[PokedexCard] Decoded sprite for Pokemon #%d (%ux%u, %u bytes) in %lu ms, %u KB heap at peak while decoding\n", 
+                 id, (unsigned)sprite->header.w, (unsigned)sprite->header.h, (unsigned)sprite->data_size,
+                 stats.decodeMs, (unsigned)(stats.peakHeapBytes / 1024));
     
     // Log PSRAM usage
     size_t freePSRAM = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
-    Serial.printf("[PokedexCard] Free PSRAM after allocation: %d KB\n", freePSRAM / 1024);
+    Serial.printf("[PokedexCard] Free PSRAM after allocation: %u KB\n", (unsigned)(freePSRAM / 1024));
     
     return sprite;
 }
 
-lv_img_dsc_t* PokedexCard::createPlaceholderSprite() {
+lv_img_dsc_t* PokedexCard::createPlaceholderSprite(int id) {
     const int width = 96;
     const int height = 96;
-    const int bytesPerPixel = 4; // ARGB8888
+    const int bytesPerPixel = 2; // RGB565, fully opaque
     size_t dataSize = width * height * bytesPerPixel;
     
     // Allocate in PSRAM for placeholder sprites
@@ -490,28 +530,27 @@ lv_img_dsc_t* PokedexCard::createPlaceholderSprite() {
     }
     
     // Create a colored pattern based on Pokemon ID
-    uint32_t baseColor = 0xFF000000; // Alpha = 255
-    baseColor |= ((_pending.id * 7) % 256) << 16;  // Red
-    baseColor |= ((_pending.id * 13) % 256) << 8;  // Green  
-    baseColor |= ((_pending.id * 17) % 256);       // Blue
+    uint32_t baseR = (id * 7) % 256;
+    uint32_t baseG = (id * 13) % 256;
+    uint32_t baseB = (id * 17) % 256;
     
     // Fill with gradient pattern
-    uint32_t* pixels = (uint32_t*)imgData;
+    uint16_t* pixels = (uint16_t*)imgData;
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
             int idx = y * width + x;
             
             // Add some pattern variation
             int brightness = 100 + ((x + y) % 50);
-            uint32_t r = ((baseColor >> 16) & 0xFF) * brightness / 150;
-            uint32_t g = ((baseColor >> 8) & 0xFF) * brightness / 150;
-            uint32_t b = (baseColor & 0xFF) * brightness / 150;
+            uint32_t r = baseR * brightness / 150;
+            uint32_t g = baseG * brightness / 150;
+            uint32_t b = baseB * brightness / 150;
             
             if (r > 255) r = 255;
             if (g > 255) g = 255;
             if (b > 255) b = 255;
             
-            pixels[idx] = 0xFF000000 | (r << 16) | (g << 8) | b;
+            pixels[idx] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
         }
     }
     
@@ -523,16 +562,16 @@ lv_img_dsc_t* PokedexCard::createPlaceholderSprite() {
     }
     
     sprite->header.magic = LV_IMAGE_HEADER_MAGIC;  // Must be 0x19 for LVGL 9
-    sprite->header.cf = LV_COLOR_FORMAT_ARGB8888;
+    sprite->header.cf = LV_COLOR_FORMAT_RGB565;
     sprite->header.flags = 0;  // No special flags needed
     sprite->header.w = width;
     sprite->header.h = height;
-    sprite->header.stride = width * 4;  // 4 bytes per pixel for ARGB8888
+    sprite->header.stride = width * bytesPerPixel;
     sprite->header.reserved_2 = 0;
     sprite->data_size = dataSize;
     sprite->data = imgData;
     
-    Serial.printf("[PokedexCard] Created placeholder sprite for Pokemon #%d\n", _pending.id);
+    Serial.printf("[PokedexCard] Created placeholder sprite for Pokemon #%d\n", id);
     return sprite;
 }
 
@@ -786,24 +825,9 @@ void PokedexCard::cleanupTransition() {
     
     // Add to cache if we just loaded new data (not from cache)
     if (_state == TRANSITIONING) {
-        // Add to cache (create a copy of the sprite for cache)
-        lv_img_dsc_t* cacheSprite = nullptr;
+        // Add to cache (shares the displayed sprite, no copy)
         if (_current.sprite) {
-            cacheSprite = (lv_img_dsc_t*)heap_caps_malloc(sizeof(lv_img_dsc_t), MALLOC_CAP_SPIRAM);
-            if (cacheSprite) {
-                *cacheSprite = *_current.sprite;
-                
-                // Clone the pixel data
-                size_t dataSize = _current.sprite->data_size;
-                uint8_t* newData = (uint8_t*)heap_caps_malloc(dataSize, MALLOC_CAP_SPIRAM);
-                if (newData) {
-                    memcpy(newData, _current.sprite->data, dataSize);
-                    cacheSprite->data = newData;
-                    addToCache(_current.id, _current.name, _current.description, cacheSprite);
-                } else {
-                    heap_caps_free(cacheSprite);
-                }
-            }
+            addToCache(_current.id, _current.name, _current.description, _current.sprite);
         }
         
         // Return to idle state
@@ -811,135 +835,64 @@ void PokedexCard::cleanupTransition() {
         
         Serial.printf("[PokedexCard] Transition complete - Now showing %s (#%d)\n", 
                      _current.name.c_str(), _current.id);
-    }
-}
-
-void PokedexCard::freeSprite(lv_img_dsc_t*& sprite) {
-    if (sprite) {
-        // Check if this is any static sprite - don't free them!
-        for (int i = 0; i < OFFLINE_POKEMON_COUNT; i++) {
-            if (sprite == (lv_img_dsc_t*)offlinePokemon[i].sprite) {
-                sprite = nullptr;
-                return;
-            }
-        }
-        
-        // Only free dynamically allocated sprites
-        if (sprite->data) {
-            Serial.printf("[PokedexCard] Freeing sprite data (%d bytes)\n", sprite->data_size);
-            heap_caps_free((void*)sprite->data);
-        }
-        heap_caps_free(sprite);
-        sprite = nullptr;
         
-        // Log free PSRAM
-        size_t freePSRAM = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
-        Serial.printf("[PokedexCard] Free PSRAM: %d KB\n", freePSRAM / 1024);
+        // Get the next one ready while this one is on screen
+        startPrefetch();
     }
 }
 
 PokedexCard::~PokedexCard() {
+    // Stop animations that call back into this card
+    lv_anim_del(this, nullptr);
+    _state = IDLE;
     cleanupTransition();  // Clean up any ongoing transition
     
-    // Free sprites
-    freeSprite(_current.sprite);
-    freeSprite(_pending.sprite);
+    // Don't let the network task keep working for a card that's gone
+    if (_prefetch.inFlight && eventQueue) {
+        Event event;
+        event.type = EventType::POKEAPI_PREFETCH_CANCEL;
+        event.intData = _prefetch.id;
+        eventQueue->publishEvent(event);
+    }
     
     // Free pending PNG data if exists
     if (_pending.pngData) {
         delete[] _pending.pngData;
         _pending.pngData = nullptr;
     }
+    clearPrefetch();
     
     if (_card) {
         lv_obj_del_async(_card);
         _card = nullptr;
     }
-    
-    // Clear cache
-    clearCache();
 }
 
 // Cache management methods
 bool PokedexCard::checkCache(int id) {
-    for (const auto& cached : _cache) {
-        if (cached.id == id) {
-            // Found in cache! Prepare pending data for transition
-            _pending.id = cached.id;
-            _pending.name = cached.name;
-            _pending.description = cached.description;
-            
-            // Clone the sprite data (don't share the same pointer)
-            if (cached.sprite) {
-                _pending.sprite = (lv_img_dsc_t*)heap_caps_malloc(sizeof(lv_img_dsc_t), MALLOC_CAP_SPIRAM);
-                if (_pending.sprite) {
-                    *_pending.sprite = *cached.sprite;
-                    
-                    // Clone the pixel data
-                    size_t dataSize = cached.sprite->data_size;
-                    uint8_t* newData = (uint8_t*)heap_caps_malloc(dataSize, MALLOC_CAP_SPIRAM);
-                    if (newData) {
-                        memcpy(newData, cached.sprite->data, dataSize);
-                        _pending.sprite->data = newData;
-                    } else {
-                        heap_caps_free(_pending.sprite);
-                        _pending.sprite = nullptr;
-                    }
-                }
-            }
-            
-            Serial.printf("[PokedexCard] Found Pokemon #%d in cache: %s\n", id, cached.name.c_str());
-            _state = TRANSITIONING;  // Mark as transitioning for cached data
-            return true;
-        }
-    }
-    return false;
-}
-
-void PokedexCard::addToCache(int id, const String& name, const String& description, lv_img_dsc_t* sprite) {
-    // Check if already in cache
-    for (auto& cached : _cache) {
-        if (cached.id == id) {
-            // Update existing entry
-            cached.name = name;
-            cached.description = description;
-            if (cached.sprite) {
-                freeSprite(cached.sprite);
-            }
-            cached.sprite = sprite;
-            Serial.printf("[PokedexCard] Updated Pokemon #%d in cache\n", id);
-            return;
-        }
+    const SpriteCache::Entry* cached = _cache.get(id);
+    if (!cached) {
+        return false;
     }
     
-    // If cache is full, remove oldest entry
-    if (_cache.size() >= MAX_CACHE_SIZE) {
-        if (_cache[0].sprite) {
-            freeSprite(_cache[0].sprite);
-        }
-        _cache.erase(_cache.begin());
-        Serial.println("[PokedexCard] Cache full, removed oldest entry");
-    }
-    
-    // Add new entry
-    CachedPokemon newEntry;
-    newEntry.id = id;
-    newEntry.name = name;
-    newEntry.description = description;
-    newEntry.sprite = sprite;
+    // Found in cache! Prepare pending data for transition, sharing the cached sprite
+    _pending.id = cached->id;
+    _pending.name = cached->name;
+    _pending.description = cached->description;
+    _pending.sprite = cached->sprite;
     
-    _cache.push_back(newEntry);
-    Serial.printf("[PokedexCard] Added Pokemon #%d to cache (%d/%d)\n", id, (int)_cache.size(), MAX_CACHE_SIZE);
+    Serial.printf("[PokedexCard] Found Pokemon #%d in cache: %s\n", id, cached->name.c_str());
+    _state = TRANSITIONING;  // Mark as transitioning for cached data
+    return true;
 }
 
-void PokedexCard::clearCache() {
-    for (auto& cached : _cache) {
-        if (cached.sprite) {
-            freeSprite(cached.sprite);
-        }
-    }
-    _cache.clear();
-    Serial.println("[PokedexCard] Cache cleared");
+void PokedexCard::addToCache(int id, const String& name, const String& description, const SpriteCache::SpriteRef& sprite) {
+    size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    _cache.put(id, name, description, sprite);
+    size_t freeAfter = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    
+    Serial.printf("[PokedexCard] Free PSRAM: %d KB before caching #%d, %d KB after\n", 
+                  freeBefore / 1024, id, freeAfter / 1024);
 }
 
 void PokedexCard::startTextScrolling() {
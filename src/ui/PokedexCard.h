@@ -2,6 +2,7 @@
 
 #include <lvgl.h>
 #include "InputHandler.h"
+#include "ui/SpriteCache.h"
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 #include <vector>
@@ -19,8 +20,8 @@ public:
     
     // Called from network task when data is ready
     void onDataReceived(int id, const String& name, const String& description);
-    void onSpriteReceived(uint8_t* pngData, size_t pngSize);
-    void onFetchError(const String& error);
+    void onSpriteReceived(int id, uint8_t* pngData, size_t pngSize);
+    void onFetchError(int id, const String& error);
 
 private:
     // Current Pokemon (displayed)
@@ -28,7 +29,7 @@ private:
         int id;
         String name;
         String description;
-        lv_img_dsc_t* sprite;
+        SpriteCache::SpriteRef sprite;
     } _current;
     
     // Pending Pokemon (being fetched)
@@ -38,24 +39,29 @@ private:
         String description;
         uint8_t* pngData;
         size_t pngSize;
-        lv_img_dsc_t* sprite;
+        SpriteCache::SpriteRef sprite;
     } _pending;
     
-    // Cache for fetched Pokemon (keep up to 5)
-    struct CachedPokemon {
-        int id;
+    // Next Pokemon, fetched in the background while the current one is shown
+    struct {
+        int id;            // 0 = not chosen yet
+        bool inFlight;     // Species/sprite fetch still running
+        bool haveSpecies;
         String name;
         String description;
-        lv_img_dsc_t* sprite;
-    };
-    static const int MAX_CACHE_SIZE = 5;
-    std::vector<CachedPokemon> _cache;
+        uint8_t* pngData;  // Sprite that arrived before the species data
+        size_t pngSize;
+    } _prefetch;
     
-    // Network state
+    // Cache for fetched Pokemon, shares sprites with _current
+    static const size_t CACHE_BUDGET_BYTES = 192 * 1024;  // ~7 decoded 96x96 sprites
+    SpriteCache _cache;
+    
+    // Network state (species and sprite are requested together)
     enum State {
         IDLE,
-        FETCHING_SPECIES,
-        FETCHING_SPRITE,
+        FETCHING_SPECIES,  // Waiting for species data; the sprite may already be in _pending
+        FETCHING_SPRITE,   // Have species data, waiting for the sprite
         DECODING,
         TRANSITIONING
     } _state = IDLE;
@@ -78,16 +84,12 @@ private:
     void displayPokemon();
     void transitionToNewPokemon();
     void startTextScrolling();
-    lv_img_dsc_t* decodePngToLvgl(uint8_t* pngData, size_t pngSize);
-    lv_img_dsc_t* createPlaceholderSprite();
-    
-    // Memory management
-    void freeSprite(lv_img_dsc_t*& sprite);
+    lv_img_dsc_t* decodePngToLvgl(int id, uint8_t* pngData, size_t pngSize);  // nullptr if it did not decode
+    lv_img_dsc_t* createPlaceholderSprite(int id);
     
     // Cache management
     bool checkCache(int id);
-    void addToCache(int id, const String& name, const String& description, lv_img_dsc_t* sprite);
-    void clearCache();
+    void addToCache(int id, const String& name, const String& description, const SpriteCache::SpriteRef& sprite);
     
     // Battle transition methods
     void startBattleTransition();
@@ -102,6 +104,11 @@ private:
     
     // Network fetching
     void startFetchSequence(int id);
+    void startPrefetch();
+    void clearPrefetch();
+    void finishPrefetch(uint8_t* pngData, size_t pngSize);
+    static const int MAX_POKEMON_ID = 1025;  // Up to Gen 9 (Paldea region)
+    unsigned long _pressTime = 0;            // For press-to-display latency logging
     
     // For random selection
     unsigned long _lastRequestTime = 0;
@@ -0,0 +1,119 @@
+#include "ui/RenderProfiler.h"
+#include "Metrics.h"
+
+lv_display_t* RenderProfiler::_display = nullptr;
+RenderProfiler::Profile* RenderProfiler::_active = nullptr;
+RenderProfiler::Profile* RenderProfiler::_pending = nullptr;
+uint32_t RenderProfiler::_refreshStartUs = 0;
+uint32_t RenderProfiler::_refreshPx = 0;
+uint32_t RenderProfiler::_lastMemSample = 0;
+
+RenderProfiler::Scope::Scope(Profile& profile)
+    : _profile(profile), _outer(_active), _startUs(micros()) {
+    if (_profile.series < 0) {
+        // All three families are only grown here, so they share series indexes
+        _profile.series = Metrics::renderUpdateUsMax.addSeries(_profile.name);
+        Metrics::renderRefreshUsMax.addSeries(_profile.name);
+        Metrics::renderInvalidatedPx.addSeries(_profile.name);
+    }
+    _profile.invalidatedPx = 0;
+    _active = &_profile;
+}
+
+RenderProfiler::Scope::~Scope() {
+    uint32_t elapsed = micros() - _startUs;
+    _profile.updates++;
+    if (elapsed > _profile.updateUsMax) {
+        _profile.updateUsMax = elapsed;
+        Metrics::renderUpdateUsMax.set(_profile.series, elapsed);
+    }
+
+    _active = _outer;
+    _pending = &_profile;
+}
+
+void RenderProfiler::attach(lv_display_t* display) {
+    if (!display || _display) {
+        return;
+    }
+    _display = display;
+    lv_display_add_event_cb(display, invalidateEventCb, LV_EVENT_INVALIDATE_AREA, nullptr);
+    lv_display_add_event_cb(display, refreshStartEventCb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(display, refreshReadyEventCb, LV_EVENT_REFR_READY, nullptr);
+    sampleMemory();
+}
+
+void RenderProfiler::invalidateEventCb(lv_event_t* e) {
+    const lv_area_t* area = static_cast<const lv_area_t*>(lv_event_get_param(e));
+    if (!area) {
+        return;
+    }
+
+    // Clip to the screen; objects can be partly off it
+    int32_t x1 = area->x1 < 0 ? 0 : area->x1;
+    int32_t y1 = area->y1 < 0 ? 0 : area->y1;
+    int32_t x2 = area->x2;
+    int32_t y2 = area->y2;
+    int32_t max_x = lv_display_get_horizontal_resolution(_display) - 1;
+    int32_t max_y = lv_display_get_vertical_resolution(_display) - 1;
+    if (x2 > max_x) x2 = max_x;
+    if (y2 > max_y) y2 = max_y;
+    if (x2 < x1 || y2 < y1) {
+        return;
+    }
+
+    uint32_t pixels = (uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1);
+    _refreshPx += pixels;
+    Metrics::invalidatedPixels.add(pixels);
+
+    // Layout runs inside the refresh, so late invalidations belong to the pending update
+    Profile* owner = _active ? _active : _pending;
+    if (owner) {
+        owner->invalidatedPx += pixels;
+    }
+}
+
+void RenderProfiler::refreshStartEventCb(lv_event_t* e) {
+    _refreshStartUs = micros();
+}
+
+void RenderProfiler::refreshReadyEventCb(lv_event_t* e) {
+    if (_refreshPx == 0) {
+        return; // Nothing was drawn
+    }
+    uint32_t elapsed = micros() - _refreshStartUs;
+    _refreshPx = 0;
+    Metrics::refreshTimeUs.observe(elapsed);
+
+    if (_pending && !_active) {
+        Profile& profile = *_pending;
+        _pending = nullptr;
+
+        Metrics::renderInvalidatedPx.set(profile.series, profile.invalidatedPx);
+        if (elapsed > profile.refreshUsMax) {
+            profile.refreshUsMax = elapsed;
+            Metrics::renderRefreshUsMax.set(profile.series, elapsed);
+        }
+        if (!profile.warned && elapsed > REFRESH_BUDGET_US) {
+            profile.warned = true;
+            Serial.printf("RenderProfiler: WARNING %s refresh took %u us for %u pixels (budget %u us)\n",
+                          profile.name, (unsigned)elapsed, (unsigned)profile.invalidatedPx,
+                          (unsigned)REFRESH_BUDGET_US);
+        }
+    }
+
+    if (millis() - _lastMemSample >= MEM_SAMPLE_INTERVAL_MS) {
+        sampleMemory();
+    }
+}
+
+void RenderProfiler::sampleMemory() {
+    _lastMemSample = millis();
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    Metrics::lvglMemUsed.set(mon.total_size - mon.free_size);
+    Metrics::lvglMemUsedMax.raiseTo(mon.max_used);
+    Metrics::lvglMemFragPct.set(mon.frag_pct);
+#endif
+}
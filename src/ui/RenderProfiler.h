@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * @class RenderProfiler
+ * @brief Per-renderer update cost, refresh time and invalidated area
+ *
+ * Hooked into the display's invalidate and refresh events. Code that changes
+ * what a card shows wraps the change in a Scope naming a Profile. The scope
+ * times the UI-thread work, and the pixels it invalidates and the next
+ * display refresh (render plus flush) are charged to that profile. Only the
+ * visible card invalidates anything, so this attributes the drawing cost of
+ * an update to the renderer that caused it.
+ *
+ * Results go to Metrics (render_*{renderer}, ui_refresh_us, lvgl_mem_*). The
+ * first refresh a profile causes beyond REFRESH_BUDGET_US is logged as a
+ * warning, so a renderer change that slows drawing shows up on the console.
+ *
+ * UI thread only.
+ */
+class RenderProfiler {
+public:
+    static const uint32_t REFRESH_BUDGET_US = 33333;     ///< One frame at 30 fps
+    static const uint32_t MEM_SAMPLE_INTERVAL_MS = 1000; ///< lv_mem_monitor walks the heap; keep it rare
+
+    /**
+     * @brief Accumulated results for one renderer; declare as a static
+     */
+    struct Profile {
+        const char* name;
+        int series;                 ///< Index in the render_* metric families, -1 until first use
+        uint32_t updates;
+        uint32_t updateUsMax;
+        uint32_t refreshUsMax;
+        uint32_t invalidatedPx;     ///< Latest update and its refresh
+        bool warned;
+
+        constexpr explicit Profile(const char* profileName)
+            : name(profileName), series(-1), updates(0), updateUsMax(0),
+              refreshUsMax(0), invalidatedPx(0), warned(false) {}
+    };
+
+    /**
+     * @brief Times the enclosing block and charges its redraw to a profile
+     */
+    class Scope {
+    public:
+        explicit Scope(Profile& profile);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Profile& _profile;
+        Profile* _outer;
+        uint32_t _startUs;
+    };
+
+    /**
+     * @brief Register for the display's invalidate and refresh events
+     */
+    static void attach(lv_display_t* display);
+
+private:
+    static void invalidateEventCb(lv_event_t* e);
+    static void refreshStartEventCb(lv_event_t* e);
+    static void refreshReadyEventCb(lv_event_t* e);
+    static void sampleMemory();
+
+    static lv_display_t* _display;
+    static Profile* _active;        ///< Innermost open scope
+    static Profile* _pending;       ///< Profile the next refresh is charged to
+    static uint32_t _refreshStartUs;
+    static uint32_t _refreshPx;     ///< Pixels invalidated since the last refresh
+    static uint32_t _lastMemSample;
+};
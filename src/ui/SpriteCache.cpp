@@ -0,0 +1,85 @@
+#include "ui/SpriteCache.h"
+#include <esp_heap_caps.h>
+
+SpriteCache::SpriteCache(size_t budgetBytes)
+    : _budgetBytes(budgetBytes)
+    , _bytesUsed(0) {
+}
+
+const SpriteCache::Entry* SpriteCache::get(int id) {
+    auto found = _index.find(id);
+    if (found == _index.end()) {
+        return nullptr;
+    }
+
+    // Move to the front without reallocating the node
+    _lru.splice(_lru.begin(), _lru, found->second);
+    return &_lru.front();
+}
+
+bool SpriteCache::put(int id, const String& name, const String& description, SpriteRef sprite) {
+    size_t bytes = entryBytes(sprite, name, description);
+
+    auto found = _index.find(id);
+    if (found != _index.end()) {
+        remove(found->second);
+    }
+
+    if (bytes > _budgetBytes) {
+        Serial.printf("[SpriteCache] #%d needs %u bytes, over the %u byte budget; not cached\n",
+                      id, bytes, _budgetBytes);
+        return false;
+    }
+
+    while (!_lru.empty() && _bytesUsed + bytes > _budgetBytes) {
+        const Entry& oldest = _lru.back();
+        Serial.printf("[SpriteCache] Evicting #%d (%u bytes, %s)\n", oldest.id, oldest.bytes,
+                      oldest.sprite.use_count() > 1 ? "still displayed" : "freed");
+        remove(std::prev(_lru.end()));
+    }
+
+    _lru.push_front(Entry{id, name, description, sprite, bytes});
+    _index[id] = _lru.begin();
+    _bytesUsed += bytes;
+
+    Serial.printf("[SpriteCache] Cached #%d (%u entries, %u/%u bytes)\n",
+                  id, (unsigned)_index.size(), _bytesUsed, _budgetBytes);
+    return true;
+}
+
+void SpriteCache::clear() {
+    _lru.clear();
+    _index.clear();
+    _bytesUsed = 0;
+}
+
+void SpriteCache::remove(std::list<Entry>::iterator it) {
+    _bytesUsed -= it->bytes;
+    _index.erase(it->id);
+    _lru.erase(it);
+}
+
+size_t SpriteCache::entryBytes(const SpriteRef& sprite, const String& name, const String& description) {
+    size_t bytes = name.length() + description.length();
+    if (sprite) {
+        bytes += sizeof(lv_img_dsc_t) + sprite->data_size;
+    }
+    return bytes;
+}
+
+SpriteCache::SpriteRef SpriteCache::adopt(lv_img_dsc_t* sprite) {
+    if (!sprite) {
+        return SpriteRef();
+    }
+
+    return SpriteRef(sprite, [](lv_img_dsc_t* dsc) {
+        if (dsc->data) {
+            heap_caps_free((void*)dsc->data);
+        }
+        heap_caps_free(dsc);
+    });
+}
+
+SpriteCache::SpriteRef SpriteCache::wrapStatic(const lv_img_dsc_t* sprite) {
+    return SpriteRef(const_cast<lv_img_dsc_t*>(sprite), [](lv_img_dsc_t*) {});
+}
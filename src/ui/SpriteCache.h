@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+/**
+ * @class SpriteCache
+ * @brief Byte-budgeted LRU cache of decoded sprites, keyed by id
+ *
+ * Sprites are reference counted, so the sprite on screen and the cached copy
+ * are the same allocation. Evicting an entry only drops the cache's
+ * reference; pixel data is freed once the last holder lets go.
+ *
+ * Lookups and insertions are O(1). When an insertion would exceed the byte
+ * budget, least recently used entries are evicted until it fits.
+ *
+ * Not thread-safe: use from the LVGL task only.
+ */
+class SpriteCache {
+public:
+    /// Shared handle to a decoded sprite
+    using SpriteRef = std::shared_ptr<lv_img_dsc_t>;
+
+    /**
+     * @struct Entry
+     * @brief A cached sprite and the text shown alongside it
+     */
+    struct Entry {
+        int id;               ///< Cache key (e.g. Pokemon number)
+        String name;          ///< Display name
+        String description;   ///< Display description
+        SpriteRef sprite;     ///< Shared sprite
+        size_t bytes;         ///< Bytes charged against the budget
+    };
+
+    /**
+     * @brief Constructor
+     * @param budgetBytes Maximum bytes of sprite data and text held by the cache
+     */
+    explicit SpriteCache(size_t budgetBytes);
+
+    /**
+     * @brief Look up an entry and mark it most recently used
+     * @param id Cache key
+     * @return The entry, or nullptr if not cached. Valid until the next put/clear.
+     */
+    const Entry* get(int id);
+
+    /**
+     * @brief Check for an entry without touching LRU order
+     */
+    bool contains(int id) const { return _index.find(id) != _index.end(); }
+
+    /**
+     * @brief Insert or replace an entry, evicting older entries to stay within budget
+     * @return false if the entry is larger than the whole budget and was not cached
+     */
+    bool put(int id, const String& name, const String& description, SpriteRef sprite);
+
+    /**
+     * @brief Drop all entries
+     */
+    void clear();
+
+    size_t size() const { return _index.size(); }
+    size_t bytesUsed() const { return _bytesUsed; }
+    size_t budget() const { return _budgetBytes; }
+
+    /**
+     * @brief Take ownership of a heap_caps-allocated sprite (descriptor and pixel data)
+     * @param sprite Sprite to adopt, may be nullptr
+     */
+    static SpriteRef adopt(lv_img_dsc_t* sprite);
+
+    /**
+     * @brief Wrap a sprite compiled into flash; it is never freed
+     */
+    static SpriteRef wrapStatic(const lv_img_dsc_t* sprite);
+
+    /**
+     * @brief Bytes an entry for this sprite and text would be charged
+     */
+    static size_t entryBytes(const SpriteRef& sprite, const String& name, const String& description);
+
+private:
+    void remove(std::list<Entry>::iterator it);
+
+    size_t _budgetBytes;
+    size_t _bytesUsed;
+    std::list<Entry> _lru;                                        ///< Front is most recently used
+    std::unordered_map<int, std::list<Entry>::iterator> _index;  ///< id -> position in _lru
+};
@@ -0,0 +1,132 @@
+#include "ui/SpriteDecoder.h"
+#include <esp_heap_caps.h>
+
+// Decode state shared with the pngle callbacks
+struct SpriteDecoder::Context {
+    uint8_t* pixels;      ///< RGB565 plane followed by the A8 plane
+    uint32_t width;
+    uint32_t height;
+    bool complete;        ///< pngle reached IEND
+    size_t heapLowWater;  ///< Least free heap seen during the decode
+};
+
+void SpriteDecoder::sampleHeap(Context* ctx) {
+    // pngle allocates with plain malloc, which lands in internal RAM or PSRAM
+    // depending on size, so watch both
+    size_t freeNow = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    if (freeNow < ctx->heapLowWater) {
+        ctx->heapLowWater = freeNow;
+    }
+}
+
+void SpriteDecoder::initCallback(pngle_t* pngle, uint32_t w, uint32_t h) {
+    Context* ctx = (Context*)pngle_get_user_data(pngle);
+
+    if (w == 0 || h == 0 || w > MAX_DIMENSION || h > MAX_DIMENSION) {
+        Serial.printf("[SpriteDecoder] Unexpected sprite size %ux%u\n", w, h);
+        return;
+    }
+
+    // Single RGB565A8 allocation, filled row by row as the PNG inflates
+    ctx->pixels = (uint8_t*)heap_caps_calloc(w * h * 3, 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (ctx->pixels) {
+        ctx->width = w;
+        ctx->height = h;
+    }
+    sampleHeap(ctx);
+}
+
+void SpriteDecoder::drawCallback(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t rgba[4]) {
+    Context* ctx = (Context*)pngle_get_user_data(pngle);
+    if (!ctx->pixels) return;
+
+    // Once per row is enough to catch the inflater's buffers at their largest
+    if (x == 0) {
+        sampleHeap(ctx);
+    }
+
+    uint8_t alpha = rgba[3];
+    uint16_t color = 0;
+    if (alpha) {
+        color = ((rgba[0] & 0xF8) << 8) | ((rgba[1] & 0xFC) << 3) | (rgba[2] >> 3);
+    }
+
+    uint16_t* colorPlane = (uint16_t*)ctx->pixels;
+    uint8_t* alphaPlane = ctx->pixels + ctx->width * ctx->height * 2;
+
+    // Interlaced images are drawn as progressively smaller blocks
+    uint32_t xEnd = (x + w < ctx->width) ? x + w : ctx->width;
+    uint32_t yEnd = (y + h < ctx->height) ? y + h : ctx->height;
+    for (uint32_t row = y; row < yEnd; row++) {
+        for (uint32_t col = x; col < xEnd; col++) {
+            uint32_t idx = row * ctx->width + col;
+            colorPlane[idx] = color;
+            alphaPlane[idx] = alpha;
+        }
+    }
+}
+
+void SpriteDecoder::doneCallback(pngle_t* pngle) {
+    Context* ctx = (Context*)pngle_get_user_data(pngle);
+    ctx->complete = true;
+}
+
+lv_img_dsc_t* SpriteDecoder::decodePng(const uint8_t* pngData, size_t pngSize, Stats* stats) {
+    if (pngSize < 8 || pngData[0] != 0x89 || pngData[1] != 'P' || pngData[2] != 'N' || pngData[3] != 'G') {
+        Serial.printf("[SpriteDecoder] Invalid PNG signature!\n");
+        return nullptr;
+    }
+
+    unsigned long decodeStart = millis();
+    size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    Context ctx = { nullptr, 0, 0, false, freeBefore };
+
+    pngle_t* pngle = pngle_new();
+    if (!pngle) {
+        Serial.println("[SpriteDecoder] Failed to allocate PNG decoder");
+        return nullptr;
+    }
+    sampleHeap(&ctx);
+
+    pngle_set_user_data(pngle, &ctx);
+    pngle_set_init_callback(pngle, initCallback);
+    pngle_set_draw_callback(pngle, drawCallback);
+    pngle_set_done_callback(pngle, doneCallback);
+
+    int fed = pngle_feed(pngle, pngData, pngSize);
+    if (fed < 0) {
+        Serial.printf("[SpriteDecoder] PNG decode error: %s\n", pngle_error(pngle));
+    } else if (!ctx.complete) {
+        Serial.printf("[SpriteDecoder] PNG ended after %u bytes without IEND\n", (unsigned)pngSize);
+    }
+    pngle_destroy(pngle);
+
+    if (fed < 0 || !ctx.complete || !ctx.pixels) {
+        if (ctx.pixels) {
+            heap_caps_free(ctx.pixels);
+        }
+        return nullptr;
+    }
+
+    lv_img_dsc_t* sprite = (lv_img_dsc_t*)heap_caps_malloc(sizeof(lv_img_dsc_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!sprite) {
+        heap_caps_free(ctx.pixels);
+        return nullptr;
+    }
+
+    sprite->header.magic = LV_IMAGE_HEADER_MAGIC;  // Must be 0x19 for LVGL 9
+    sprite->header.cf = LV_COLOR_FORMAT_RGB565A8;
+    sprite->header.flags = 0;  // No special flags needed
+    sprite->header.w = ctx.width;
+    sprite->header.h = ctx.height;
+    sprite->header.stride = ctx.width * 2;  // Stride of the RGB565 plane; the A8 plane follows it
+    sprite->header.reserved_2 = 0;
+    sprite->data_size = ctx.width * ctx.height * 3;
+    sprite->data = ctx.pixels;
+
+    if (stats) {
+        stats->decodeMs = millis() - decodeStart;
+        stats->peakHeapBytes = freeBefore > ctx.heapLowWater ? freeBefore - ctx.heapLowWater : 0;
+    }
+    return sprite;
+}
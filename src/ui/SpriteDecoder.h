@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <pngle.h>
+
+/**
+ * @class SpriteDecoder
+ * @brief Streams a PNG through pngle into a single RGB565A8 allocation
+ *
+ * The decoded sprite is one heap_caps block of pixel data (RGB565 plane
+ * followed by the A8 plane) plus its descriptor, ready for
+ * SpriteCache::adopt(). Nothing is allocated for the PNG beyond pngle's own
+ * state.
+ */
+class SpriteDecoder {
+public:
+    /**
+     * @struct Stats
+     * @brief What a decode cost
+     */
+    struct Stats {
+        unsigned long decodeMs;   ///< Wall time of the decode
+        size_t peakHeapBytes;     ///< Most heap in use by the decode at once, decoder state and pixels
+    };
+
+    static const uint32_t MAX_DIMENSION = 256;  ///< PokeAPI sprites are 96x96
+
+    /**
+     * @brief Decode a PNG into an RGB565A8 sprite
+     * @param pngData PNG file contents
+     * @param pngSize Length of pngData
+     * @param stats Optional; filled in when the decode succeeds
+     * @return Sprite allocated with heap_caps, or nullptr if the data is not
+     *         a complete PNG within MAX_DIMENSION or memory ran out
+     */
+    static lv_img_dsc_t* decodePng(const uint8_t* pngData, size_t pngSize, Stats* stats = nullptr);
+
+private:
+    struct Context;
+
+    static void initCallback(pngle_t* pngle, uint32_t w, uint32_t h);
+    static void drawCallback(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t rgba[4]);
+    static void doneCallback(pngle_t* pngle);
+    static void sampleHeap(Context* ctx);
+};
@@ -0,0 +1,41 @@
+#include "ui/UiPacer.h"
+
+UiPacer::UiPacer(uint32_t now)
+    : _lastPoll(now), _lastActivity(now), _lastInterrupt(now), _settling(false) {
+}
+
+uint32_t UiPacer::pollIntervalMs(uint32_t now) const {
+    if (_settling && now - _lastInterrupt < BUTTON_SETTLE_MS) {
+        return BUTTON_SETTLE_POLL_MS;
+    }
+    return now - _lastActivity >= BUTTON_IDLE_AFTER_MS ? BUTTON_POLL_IDLE_MS : BUTTON_POLL_MS;
+}
+
+bool UiPacer::pollDue(uint32_t now, bool interrupted) {
+    if (interrupted) {
+        _lastInterrupt = now;
+        _settling = true;
+    }
+    if (!interrupted && now - _lastPoll < pollIntervalMs(now)) {
+        return false;
+    }
+    _lastPoll = now;
+    return true;
+}
+
+void UiPacer::buttonActivity(uint32_t now) {
+    _lastActivity = now;
+}
+
+uint32_t UiPacer::waitMs(uint32_t now, bool animating, uint32_t untilNextTimer) const {
+    uint32_t interval = pollIntervalMs(now);
+    uint32_t sincePoll = now - _lastPoll;
+    uint32_t wait = sincePoll >= interval ? 0 : interval - sincePoll;
+    if (animating && wait > FRAME_MS) {
+        wait = FRAME_MS;
+    }
+    if (untilNextTimer < wait) {
+        wait = untilNextTimer;
+    }
+    return wait > 0 ? wait : 1;
+}
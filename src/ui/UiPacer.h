@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @class UiPacer
+ * @brief When the UI task polls the buttons and how long it may sleep
+ *
+ * The UI task sleeps until whichever comes first: the next LVGL timer, a
+ * queued UI update, the next frame while a card animates, or the next
+ * button poll. Polls run every BUTTON_POLL_MS, and every BUTTON_POLL_IDLE_MS
+ * once nobody has pressed anything for BUTTON_IDLE_AFTER_MS. A button
+ * interrupt wakes the task at once; it then polls every BUTTON_SETTLE_POLL_MS
+ * until Bounce2 has had time to debounce the press.
+ *
+ * Times are millis(). It has no hardware dependencies, so the task loop can
+ * be run against a simulated clock.
+ */
+class UiPacer {
+public:
+    static const uint32_t FRAME_MS = 5;                 ///< While a game or other card is animating
+    static const uint32_t BUTTON_POLL_MS = 50;          ///< While buttons have been used recently
+    static const uint32_t BUTTON_POLL_IDLE_MS = 100;    ///< After BUTTON_IDLE_AFTER_MS without a press
+    static const uint32_t BUTTON_IDLE_AFTER_MS = 30000;
+    static const uint32_t BUTTON_SETTLE_POLL_MS = 5;    ///< Bounce2's debounce interval
+    static const uint32_t BUTTON_SETTLE_MS = 50;        ///< How long after an interrupt to poll that fast
+
+    explicit UiPacer(uint32_t now);
+
+    /**
+     * @brief Whether to poll the buttons on this pass; if so, the poll is counted as done
+     * @param now millis()
+     * @param interrupted A button interrupt fired since the last call
+     */
+    bool pollDue(uint32_t now, bool interrupted);
+
+    /**
+     * @brief A poll saw a button change state
+     */
+    void buttonActivity(uint32_t now);
+
+    /**
+     * @brief How long the task may sleep after this pass
+     * @param now millis()
+     * @param animating The active card wants another frame
+     * @param untilNextTimer ms until LVGL's next timer, or UINT32_MAX if none
+     * @return ms to wait, at least 1 so lower-priority tasks still run
+     */
+    uint32_t waitMs(uint32_t now, bool animating, uint32_t untilNextTimer) const;
+
+    /**
+     * @brief Current button poll interval
+     */
+    uint32_t pollIntervalMs(uint32_t now) const;
+
+private:
+    uint32_t _lastPoll;
+    uint32_t _lastActivity;
+    uint32_t _lastInterrupt;
+    bool _settling;
+};
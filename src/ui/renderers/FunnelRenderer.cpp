@@ -1,6 +1,9 @@
 #include "FunnelRenderer.h"
 #include "NumberFormat.h"
 #include <algorithm> // For std::min, std::max
+#include "ui/RenderProfiler.h"
+
+static RenderProfiler::Profile renderProfile("funnel");
 
 FunnelRenderer::FunnelRenderer()
     : _funnel_main_container(nullptr) {
@@ -218,6 +221,7 @@ void FunnelRenderer::updateDisplay(InsightParser& parser, const String& title_st
 
     // Dispatch UI update
     dispatchToUI([this, captured_steps_data = std::move(ui_steps_data), step_count, breakdown_count, available_width_for_bars]() {
+        RenderProfiler::Scope profile(renderProfile);
         if (!areElementsValid()) {
             Serial.println("[FunnelRenderer-WARN] Funnel elements invalid in updateDisplay lambda.");
             return;
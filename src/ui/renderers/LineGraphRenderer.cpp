@@ -1,6 +1,9 @@
 #include "LineGraphRenderer.h"
 #include <memory> // For std::unique_ptr for data arrays
 #include <algorithm> // For std::min
+#include "ui/RenderProfiler.h"
+
+static RenderProfiler::Profile renderProfile("line_graph");
 
 LineGraphRenderer::LineGraphRenderer()
     : _chart(nullptr), _series(nullptr) {
@@ -107,6 +110,7 @@ void LineGraphRenderer::updateDisplay(InsightParser& parser, const String& title
     }
 
     dispatchToUI([this, captured_values = std::move(values_for_lambda), point_count, max_val, scale_factor]() {
+        RenderProfiler::Scope profile(renderProfile);
         if (!areElementsValid()) {
             Serial.println("[LineGraphRenderer-WARN] Chart/Series invalid in updateDisplay lambda.");
             return;
@@ -1,5 +1,8 @@
 #include "NumericCardRenderer.h"
 #include "NumberFormat.h"
+#include "ui/RenderProfiler.h"
+
+static RenderProfiler::Profile renderProfile("numeric");
 
 NumericCardRenderer::NumericCardRenderer()
     : _value_label(nullptr) {
@@ -47,6 +50,7 @@ void NumericCardRenderer::updateDisplay(InsightParser& parser, const String& tit
     // Data processing (getting value) is done here.
     // LVGL operations are dispatched to the UI thread.
     dispatchToUI([this, value, p = String(prefix ? prefix : ""), s = String(suffix ? suffix : "")]() {
+        RenderProfiler::Scope profile(renderProfile);
         // Serial.printf("[NumericRenderer] Updating display on UI thread. Label: %p, Core: %d\n", _value_label, xPortGetCoreID());
         if (isValidLVGLObject(_value_label)) {
             char numeric_buffer[32];
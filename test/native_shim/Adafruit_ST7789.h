@@ -0,0 +1,4 @@
+#pragma once
+
+// Only the type is needed by DisplayInterface.h
+class Adafruit_ST7789;
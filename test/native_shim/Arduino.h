@@ -0,0 +1,349 @@
+#pragma once
+
+// Minimal Arduino core for the native test environment. Covers the parts of
+// String, Print, Stream and the timing functions that the units built
+// off-device use; it is not a general replacement for the ESP32 core.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+
+// The ESP32 core's Arduino.h brings in FreeRTOS as well
+#include "freertos/FreeRTOS.h"
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+
+using std::max;
+using std::min;
+
+template <typename T, typename L, typename H>
+inline T constrain(T value, L low, H high) {
+    return value < (T)low ? (T)low : (value > (T)high ? (T)high : value);
+}
+
+namespace native_clock {
+inline std::chrono::steady_clock::time_point start() {
+    static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    return origin;
+}
+
+/** @brief Time added to millis() and micros() by advanceMillis() */
+inline std::atomic<unsigned long>& skippedMs() {
+    static std::atomic<unsigned long> skipped(0);
+    return skipped;
+}
+}
+
+inline unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - native_clock::start()).count() + native_clock::skippedMs().load();
+}
+
+inline unsigned long micros() {
+    return (unsigned long)(uint32_t)(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - native_clock::start()).count() + native_clock::skippedMs().load() * 1000ull);
+}
+
+/**
+ * @brief Move millis() and micros() forward without waiting (host only)
+ *
+ * For suites that step timeouts measured with millis() in simulated time.
+ * FreeRTOS ticks and delay() still follow the wall clock.
+ */
+inline void advanceMillis(unsigned long ms) {
+    native_clock::skippedMs() += ms;
+}
+
+inline void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline void yield() {
+    std::this_thread::yield();
+}
+
+// newlib has strlcpy; glibc only gained it in 2.38
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t copied = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, copied);
+        dst[copied] = '\0';
+    }
+    return length;
+}
+
+#define F(string_literal) (string_literal)
+
+// No clock to set; the host's is already right
+inline void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1,
+                       const char* server2 = nullptr, const char* server3 = nullptr) {}
+
+// Number bases for String(value, base) and print()
+#define BIN 2
+#define OCT 8
+#define DEC 10
+#define HEX 16
+
+/**
+ * @class String
+ * @brief Arduino String backed by std::string
+ */
+class String {
+public:
+    String() {}
+    String(const char* s) : _s(s ? s : "") {}
+    String(const char* s, size_t length) : _s(s, length) {}
+    String(const std::string& s) : _s(s) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(int v, unsigned char base = 10) : _s(formatInteger((long long)v, base)) {}
+    explicit String(unsigned int v, unsigned char base = 10) : _s(formatInteger((long long)v, base)) {}
+    explicit String(long v, unsigned char base = 10) : _s(formatInteger((long long)v, base)) {}
+    explicit String(unsigned long v, unsigned char base = 10) : _s(formatInteger((long long)v, base)) {}
+    explicit String(double v, unsigned int decimals = 2) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        _s = buf;
+    }
+
+    const char* c_str() const { return _s.c_str(); }
+    size_t length() const { return _s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(size_t size) { _s.reserve(size); return true; }
+    const std::string& str() const { return _s; }
+
+    char charAt(size_t i) const { return i < _s.size() ? _s[i] : 0; }
+    void setCharAt(size_t i, char c) { if (i < _s.size()) _s[i] = c; }
+    char operator[](size_t i) const { return charAt(i); }
+    char& operator[](size_t i) { return _s[i]; }
+
+    bool concat(const String& s) { _s += s._s; return true; }
+    bool concat(const char* s) { if (s) _s += s; return true; }
+    bool concat(char c) { _s += c; return true; }
+    String& operator+=(const String& s) { _s += s._s; return *this; }
+    String& operator+=(const char* s) { if (s) _s += s; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    String& operator+=(int v) { _s += std::to_string(v); return *this; }
+    String& operator+=(unsigned int v) { _s += std::to_string(v); return *this; }
+    String& operator+=(long v) { _s += std::to_string(v); return *this; }
+    String& operator+=(unsigned long v) { _s += std::to_string(v); return *this; }
+
+    bool equals(const String& s) const { return _s == s._s; }
+    bool equalsIgnoreCase(const String& s) const {
+        if (_s.size() != s._s.size()) return false;
+        for (size_t i = 0; i < _s.size(); i++) {
+            if (tolower((unsigned char)_s[i]) != tolower((unsigned char)s._s[i])) return false;
+        }
+        return true;
+    }
+    bool operator==(const String& s) const { return _s == s._s; }
+    bool operator==(const char* s) const { return _s == (s ? s : ""); }
+    bool operator!=(const String& s) const { return _s != s._s; }
+    bool operator!=(const char* s) const { return !(*this == s); }
+    bool operator<(const String& s) const { return _s < s._s; }
+    int compareTo(const String& s) const { return _s.compare(s._s); }
+
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return _s.size() >= suffix._s.size() &&
+               _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+    }
+
+    int indexOf(char c, size_t from = 0) const { return toIndex(_s.find(c, from)); }
+    int indexOf(const String& s, size_t from = 0) const { return toIndex(_s.find(s._s, from)); }
+    int indexOf(const char* s, size_t from = 0) const { return toIndex(_s.find(s, from)); }
+    int lastIndexOf(char c) const { return toIndex(_s.rfind(c)); }
+    int lastIndexOf(const String& s) const { return toIndex(_s.rfind(s._s)); }
+
+    String substring(size_t from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(size_t from, size_t to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= _s.size()) return String();
+        return String(_s.substr(from, to - from));
+    }
+
+    void replace(char find, char replacement) { std::replace(_s.begin(), _s.end(), find, replacement); }
+    void replace(const String& find, const String& replacement) {
+        if (find._s.empty()) return;
+        size_t pos = 0;
+        while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+            _s.replace(pos, find._s.size(), replacement._s);
+            pos += replacement._s.size();
+        }
+    }
+    void remove(size_t index) { if (index < _s.size()) _s.erase(index); }
+    void remove(size_t index, size_t count) { if (index < _s.size()) _s.erase(index, count); }
+    void trim() {
+        size_t first = _s.find_first_not_of(" \t\r\n\f\v");
+        if (first == std::string::npos) { _s.clear(); return; }
+        size_t last = _s.find_last_not_of(" \t\r\n\f\v");
+        _s = _s.substr(first, last - first + 1);
+    }
+    void toLowerCase() { for (char& c : _s) c = tolower((unsigned char)c); }
+    void toUpperCase() { for (char& c : _s) c = toupper((unsigned char)c); }
+
+    long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_s.c_str(), nullptr); }
+    double toDouble() const { return strtod(_s.c_str(), nullptr); }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b._s); }
+    friend String operator+(const String& a, char b) { return String(a._s + b); }
+
+private:
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    static std::string formatInteger(long long v, unsigned char base) {
+        if (base == 10) return std::to_string(v);
+        if (v == 0) return "0";
+        bool negative = v < 0;
+        unsigned long long u = negative ? -(unsigned long long)v : (unsigned long long)v;
+        std::string out;
+        while (u) {
+            int digit = u % base;
+            out.insert(out.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+            u /= base;
+        }
+        return negative ? "-" + out : out;
+    }
+
+    std::string _s;
+};
+
+namespace std {
+template <>
+struct hash<String> {
+    size_t operator()(const String& s) const { return hash<std::string>()(s.str()); }
+};
+}
+
+/**
+ * @class Print
+ * @brief Byte sink with Arduino's print helpers
+ */
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned int v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(double v, int decimals = 2) { return printf("%.*f", decimals, v); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& v) { size_t n = print(v); return n + println(); }
+
+    size_t printf(const char* format, ...) {
+        char stackBuf[256];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(stackBuf, sizeof(stackBuf), format, args);
+        va_end(args);
+        if (len < 0) return 0;
+        if ((size_t)len < sizeof(stackBuf)) return write((const uint8_t*)stackBuf, len);
+
+        std::string big(len + 1, '\0');
+        va_start(args, format);
+        vsnprintf(&big[0], big.size(), format, args);
+        va_end(args);
+        return write((const uint8_t*)big.data(), len);
+    }
+};
+
+/**
+ * @class Stream
+ * @brief Readable Print, as implemented by network clients
+ */
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(uint8_t* buffer, size_t length) {
+        size_t n = 0;
+        while (n < length) {
+            int c = read();
+            if (c < 0) break;
+            buffer[n++] = (uint8_t)c;
+        }
+        return n;
+    }
+    size_t readBytes(char* buffer, size_t length) { return readBytes((uint8_t*)buffer, length); }
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+
+    size_t write(uint8_t) override { return 0; }
+    using Print::write;
+
+protected:
+    unsigned long _timeout = 1000;
+};
+
+/**
+ * @class HardwareSerial
+ * @brief Serial goes to stdout so test logs stay readable
+ */
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t* buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    using Print::write;
+    operator bool() const { return true; }
+};
+
+inline HardwareSerial Serial;
+
+/** @brief The host's heap_caps serves SPIRAM requests from malloc */
+inline bool psramFound() { return true; }
+
+/**
+ * @class EspClass
+ * @brief restart() counts the reboot and ends the calling task, since on the
+ * device nothing after it runs
+ */
+class EspClass {
+public:
+    void restart() {
+        _restarts++;
+        vTaskDelete(NULL);
+    }
+    int restartCount() const { return _restarts.load(); }
+
+private:
+    std::atomic<int> _restarts{0};
+};
+
+inline EspClass ESP;
@@ -0,0 +1,32 @@
+#pragma once
+
+// Bounce2 for the native test environment: enough for Input.h to compile.
+// Suites drive CardNavigationStack::handleButtonPress() directly, so the
+// buttons never report a press unless a suite calls press().
+
+#include <Arduino.h>
+
+namespace Bounce2 {
+
+class Button {
+public:
+    void attach(int pin, int mode) {}
+    void interval(uint16_t intervalMs) {}
+    void setPressedState(bool state) {}
+    bool update() {
+        _pressed = false;
+        return false;
+    }
+    bool pressed() const { return _pressed; }
+    bool released() const { return false; }
+    bool isPressed() const { return false; }
+    int read() const { return LOW; }
+
+    /** @brief Report a press from pressed() until the next update(), as one debounced press (host only) */
+    void press() { _pressed = true; }
+
+private:
+    bool _pressed = false;
+};
+
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+// Answers nothing on the host; WifiInterface only starts and stops it
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+class DNSServer {
+public:
+    bool start(uint16_t port, const String& domainName, const IPAddress& resolvedIP) { return true; }
+    void stop() {}
+    void processNextRequest() {}
+};
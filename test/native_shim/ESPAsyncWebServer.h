@@ -0,0 +1,338 @@
+#pragma once
+
+// ESPAsyncWebServer without sockets, for suites that drive a portal's
+// handlers. Routes registered with on() are kept; a test looks the server up
+// by port, hands it a request and reads back the response the handler sent.
+// AsyncEventSource keeps the events it sends instead of writing them to
+// browsers, and a test connects clients to it by hand.
+
+#include <Arduino.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value, bool post) : _name(name), _value(value), _post(post) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    bool isPost() const { return _post; }
+
+private:
+    String _name;
+    String _value;
+    bool _post;
+};
+
+/**
+ * @class AsyncWebServerResponse
+ * @brief A response as the handler built it: status, headers and body
+ */
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String& contentType, const std::string& body = std::string())
+        : _code(code), _contentType(contentType), _body(body) {}
+    virtual ~AsyncWebServerResponse() = default;
+
+    void addHeader(const char* name, const String& value) { _headers.emplace_back(String(name), value); }
+
+    int code() const { return _code; }
+    const String& contentType() const { return _contentType; }
+    const std::vector<std::pair<String, String>>& headers() const { return _headers; }
+
+    /** @brief A header the handler added, or "" (host only) */
+    String header(const char* name) const {
+        for (const auto& header : _headers) {
+            if (header.first.equalsIgnoreCase(name)) {
+                return header.second;
+            }
+        }
+        return String();
+    }
+
+    /** @brief The body bytes that would go on the wire; chunked responses are read to the end (host only) */
+    virtual std::string content() { return _body; }
+
+protected:
+    int _code;
+    String _contentType;
+    std::vector<std::pair<String, String>> _headers;
+    std::string _body;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    explicit AsyncResponseStream(const String& contentType) : AsyncWebServerResponse(200, contentType) {}
+    size_t write(uint8_t c) override {
+        _body += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        _body.append((const char*)buffer, size);
+        return size;
+    }
+    using Print::write;
+};
+
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncChunkedResponse : public AsyncWebServerResponse {
+public:
+    AsyncChunkedResponse(const String& contentType, AwsResponseFiller filler)
+        : AsyncWebServerResponse(200, contentType), _filler(filler) {}
+
+    std::string content() override {
+        uint8_t buffer[1024];
+        size_t n;
+        while ((n = _filler(buffer, sizeof(buffer), _body.size())) > 0) {
+            _body.append((const char*)buffer, n);
+        }
+        return _body;
+    }
+
+private:
+    AwsResponseFiller _filler;
+};
+
+/**
+ * @class AsyncWebServerRequest
+ * @brief A request built by the test; owns the response the handler sends
+ */
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(WebRequestMethodComposite method, const String& url) : _method(method), _url(url) {}
+    ~AsyncWebServerRequest() { free(_tempObject); }
+
+    /** @brief Add a request header (host only) */
+    void addHeader(const String& name, const String& value) { _headers.emplace_back(name, value); }
+    /** @brief Add a query (post = false) or form (post = true) parameter (host only) */
+    void addParam(const String& name, const String& value, bool post = false) { _params.emplace_back(name, value, post); }
+    /** @brief Request body handed to the route's body handler (host only) */
+    void setBody(const std::string& body) { _body = body; }
+    const std::string& body() const { return _body; }
+
+    WebRequestMethodComposite method() const { return _method; }
+    const String& url() const { return _url; }
+
+    bool hasHeader(const char* name) const { return findHeader(name) != nullptr; }
+    const String& header(const char* name) const {
+        static const String empty;
+        const String* value = findHeader(name);
+        return value ? *value : empty;
+    }
+
+    bool hasParam(const char* name, bool post = false) const { return getParam(name, post) != nullptr; }
+    const AsyncWebParameter* getParam(const char* name, bool post = false) const {
+        for (const AsyncWebParameter& param : _params) {
+            if (param.name() == name && param.isPost() == post) {
+                return &param;
+            }
+        }
+        return nullptr;
+    }
+
+    AsyncWebServerResponse* beginResponse(int code, const char* contentType = "", const String& content = String()) {
+        return new AsyncWebServerResponse(code, contentType, content.str());
+    }
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t len) {
+        return new AsyncWebServerResponse(code, contentType, std::string((const char*)content, len));
+    }
+    AsyncResponseStream* beginResponseStream(const char* contentType) { return new AsyncResponseStream(contentType); }
+    AsyncWebServerResponse* beginChunkedResponse(const char* contentType, AwsResponseFiller filler) {
+        return new AsyncChunkedResponse(contentType, filler);
+    }
+
+    void send(AsyncWebServerResponse* response) { _response.reset(response); }
+    void send(int code, const char* contentType = "", const String& content = String()) {
+        send(beginResponse(code, contentType, content));
+    }
+    void redirect(const char* url) {
+        AsyncWebServerResponse* response = beginResponse(302);
+        response->addHeader("Location", url);
+        send(response);
+    }
+
+    /** @brief What the handler sent, or nullptr (host only) */
+    AsyncWebServerResponse* response() const { return _response.get(); }
+
+    void* _tempObject = nullptr;
+
+private:
+    const String* findHeader(const char* name) const {
+        for (const auto& header : _headers) {
+            if (header.first.equalsIgnoreCase(name)) {
+                return &header.second;
+            }
+        }
+        return nullptr;
+    }
+
+    WebRequestMethodComposite _method;
+    String _url;
+    std::vector<std::pair<String, String>> _headers;
+    std::vector<AsyncWebParameter> _params;
+    std::string _body;
+    std::unique_ptr<AsyncWebServerResponse> _response;
+};
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data,
+                           size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)>
+    ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() = default;
+};
+
+/**
+ * @class AsyncEventSourceClient
+ * @brief One connected browser; keeps every event sent to it
+ */
+class AsyncEventSourceClient {
+public:
+    struct Event {
+        std::string event;
+        std::string data;
+        uint32_t id;
+        uint32_t reconnect;
+    };
+
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+        _events.push_back({ event ? event : "", message ? message : "", id, reconnect });
+    }
+
+    /** @brief Everything sent to this client so far (host only) */
+    std::vector<Event>& events() { return _events; }
+
+private:
+    std::vector<Event> _events;
+};
+
+typedef std::function<void(AsyncEventSourceClient* client)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+    explicit AsyncEventSource(const String& url) : _url(url) {}
+
+    const String& url() const { return _url; }
+    void onConnect(ArEventHandlerFunction callback) { _onConnect = callback; }
+    size_t count() const { return _clients.size(); }
+
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+        for (auto& client : _clients) {
+            client->send(message, event, id, reconnect);
+        }
+    }
+
+    /** @brief Open a stream as a browser would; onConnect runs before this returns (host only) */
+    AsyncEventSourceClient* connect() {
+        _clients.emplace_back(new AsyncEventSourceClient());
+        if (_onConnect) {
+            _onConnect(_clients.back().get());
+        }
+        return _clients.back().get();
+    }
+
+    /** @brief Drop every client (host only) */
+    void disconnectAll() { _clients.clear(); }
+
+private:
+    String _url;
+    ArEventHandlerFunction _onConnect;
+    std::vector<std::unique_ptr<AsyncEventSourceClient>> _clients;
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : _port(port) { servers().push_back(this); }
+    ~AsyncWebServer() { servers().erase(std::find(servers().begin(), servers().end(), this)); }
+
+    void begin() { _running = true; }
+    void end() { _running = false; }
+
+    void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+            ArUploadHandlerFunction onUpload = nullptr, ArBodyHandlerFunction onBody = nullptr) {
+        _routes.push_back({ uri, method, onRequest, onBody });
+    }
+    void onNotFound(ArRequestHandlerFunction onRequest) { _notFound = onRequest; }
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler) {
+        _handlers.push_back(handler);
+        return *handler;
+    }
+
+    /** @brief The last server created on a port, or nullptr (host only) */
+    static AsyncWebServer* onPort(uint16_t port) {
+        for (auto it = servers().rbegin(); it != servers().rend(); ++it) {
+            if ((*it)->_port == port) return *it;
+        }
+        return nullptr;
+    }
+
+    bool running() const { return _running; }
+
+    /** @brief An event source added with addHandler(), by path (host only) */
+    AsyncEventSource* eventSource(const char* url) {
+        for (AsyncWebHandler* handler : _handlers) {
+            AsyncEventSource* source = dynamic_cast<AsyncEventSource*>(handler);
+            if (source && source->url() == url) return source;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Run a request through the first matching route, or the not-found handler (host only)
+     * @return The request, holding the response that was sent
+     */
+    std::unique_ptr<AsyncWebServerRequest> handle(std::unique_ptr<AsyncWebServerRequest> request) {
+        for (const Route& route : _routes) {
+            if ((route.method & request->method()) && request->url() == route.uri.c_str()) {
+                if (route.onBody && !request->body().empty()) {
+                    std::string body = request->body();
+                    route.onBody(request.get(), (uint8_t*)&body[0], body.size(), 0, body.size());
+                }
+                route.onRequest(request.get());
+                return request;
+            }
+        }
+        if (_notFound) {
+            _notFound(request.get());
+        }
+        return request;
+    }
+
+private:
+    struct Route {
+        std::string uri;
+        WebRequestMethodComposite method;
+        ArRequestHandlerFunction onRequest;
+        ArBodyHandlerFunction onBody;
+    };
+
+    static std::vector<AsyncWebServer*>& servers() {
+        static std::vector<AsyncWebServer*> all;
+        return all;
+    }
+
+    uint16_t _port;
+    bool _running = false;
+    std::vector<Route> _routes;
+    std::vector<AsyncWebHandler*> _handlers;
+    ArRequestHandlerFunction _notFound;
+};
@@ -0,0 +1,278 @@
+#pragma once
+
+// HTTPClient over host sockets, for suites that run a client against a local
+// server (see scripts/mock_posthog.py and scripts/mock_pokeapi.py). Plain
+// http:// only, one request per connection, with the ESP32 core's 5 s read
+// timeout by default. As on the device, getString() returns whatever arrived
+// if the connection closes mid-body, and getStreamPtr() reads the body as it
+// arrives. https:// URLs are refused, and the CA passed to begin() is ignored.
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <errno.h>
+#include <netdb.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_PARTIAL_CONTENT 206
+#define HTTP_CODE_MOVED_PERMANENTLY 301
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+    HTTPC_DISABLE_FOLLOW_REDIRECTS,
+    HTTPC_STRICT_FOLLOW_REDIRECTS,
+    HTTPC_FORCE_FOLLOW_REDIRECTS
+} followRedirects_t;
+
+class HTTPClient {
+public:
+    static const int READ_TIMEOUT_MS = 5000;
+
+    HTTPClient() : _body(*this), _socket(-1), _size(-1), _timeoutMs(READ_TIMEOUT_MS) {}
+    ~HTTPClient() { end(); }
+
+    void setReuse(bool reuse) {}
+    void useHTTP10(bool http10) {}
+    void setTimeout(uint16_t timeoutMs) { _timeoutMs = timeoutMs; }
+    void setConnectTimeout(int32_t connectTimeoutMs) {}
+    void setFollowRedirects(followRedirects_t follow) {}   // The mock servers do not redirect
+
+    void addHeader(const String& name, const String& value) {
+        _headers += std::string(name.c_str()) + ": " + value.c_str() + "\r\n";
+    }
+
+    bool begin(WiFiClient& client, const String& url) { return begin(url); }
+
+    bool begin(const String& url, const char* rootCa = nullptr) {
+        end();
+        _size = -1;
+        _pending.clear();
+        _headers.clear();
+        _responseHeaders.clear();
+        std::string full(url.c_str());
+        if (full.compare(0, 7, "http://") != 0) {
+            _host.clear();
+            return false;
+        }
+        std::string rest = full.substr(7);
+        size_t slash = rest.find('/');
+        std::string hostPort = rest.substr(0, slash);
+        _path = slash == std::string::npos ? "/" : rest.substr(slash);
+        size_t colon = hostPort.find(':');
+        _host = hostPort.substr(0, colon);
+        _port = colon == std::string::npos ? "80" : hostPort.substr(colon + 1);
+        return true;
+    }
+
+    /** @brief Response headers to keep for header() */
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+        _collect.assign(headerKeys, headerKeys + headerKeysCount);
+    }
+
+    /** @brief A collected header of the last response, or "" */
+    String header(const char* name) {
+        for (const auto& header : _responseHeaders) {
+            if (strcasecmp(header.first.c_str(), name) == 0) {
+                return String(header.second);
+            }
+        }
+        return String();
+    }
+
+    int GET() {
+        if (_host.empty() || !connectToHost()) {
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+
+        std::string request = "GET " + _path + " HTTP/1.1\r\nHost: " + _host + ":" + _port +
+                              "\r\n" + _headers + "Connection: close\r\n\r\n";
+        if (send(_socket, request.data(), request.size(), MSG_NOSIGNAL) != (ssize_t)request.size()) {
+            end();
+            return HTTPC_ERROR_SEND_HEADER_FAILED;
+        }
+
+        std::string head;
+        size_t headerEnd;
+        char buf[4096];
+        while ((headerEnd = head.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t n = recv(_socket, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                end();
+                return n < 0 ? HTTPC_ERROR_READ_TIMEOUT : HTTPC_ERROR_CONNECTION_LOST;
+            }
+            head.append(buf, n);
+        }
+        _pending = head.substr(headerEnd + 4);
+        head.resize(headerEnd);
+        _responseHeaders.clear();
+
+        size_t lineStart = 0;
+        while (lineStart < head.size()) {
+            size_t lineEnd = head.find("\r\n", lineStart);
+            std::string line = head.substr(lineStart, lineEnd == std::string::npos ? std::string::npos : lineEnd - lineStart);
+            if (strncasecmp(line.c_str(), "Content-Length:", 15) == 0) {
+                _size = atoi(line.c_str() + 15);
+            }
+            size_t colon = line.find(':');
+            for (const std::string& key : _collect) {
+                if (colon == key.size() && strncasecmp(line.c_str(), key.c_str(), colon) == 0) {
+                    size_t value = line.find_first_not_of(' ', colon + 1);
+                    _responseHeaders.emplace_back(key, value == std::string::npos ? "" : line.substr(value));
+                }
+            }
+            lineStart = lineEnd == std::string::npos ? head.size() : lineEnd + 2;
+        }
+
+        size_t space = head.find(' ');
+        return space == std::string::npos ? HTTPC_ERROR_CONNECTION_LOST : atoi(head.c_str() + space + 1);
+    }
+
+    /** @brief Content-Length of the last response, or -1 if it had none */
+    int getSize() const { return _size; }
+
+    String getString() {
+        std::string body;
+        body.swap(_pending);
+        char buf[4096];
+        while (_socket >= 0 && (_size < 0 || (int)body.size() < _size)) {
+            ssize_t n = recv(_socket, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                break;
+            }
+            body.append(buf, n);
+        }
+        if (_size >= 0 && (int)body.size() > _size) {
+            body.resize(_size);
+        }
+        return String(body);
+    }
+
+    /** @brief The response body, read as it arrives */
+    WiFiClient* getStreamPtr() { return &_body; }
+
+    /** @brief Body bytes are still buffered or the server has not closed yet */
+    bool connected() { return _body.available() > 0 || _socket >= 0; }
+
+    static String errorToString(int error) {
+        char text[32];
+        snprintf(text, sizeof(text), "HTTPC error %d", error);
+        return String(text);
+    }
+
+    void end() {
+        if (_socket >= 0) {
+            close(_socket);
+            _socket = -1;
+        }
+    }
+
+private:
+    /**
+     * @brief Body stream over the connection; reads what has arrived without
+     * blocking, and readBytes() waits up to the client timeout like Arduino's
+     */
+    class BodyStream : public WiFiClient {
+    public:
+        explicit BodyStream(HTTPClient& http) : _http(http) {}
+
+        int available() override {
+            if (_http._pending.empty() && _http._socket >= 0) {
+                char buf[4096];
+                ssize_t n = recv(_http._socket, buf, sizeof(buf), MSG_DONTWAIT);
+                if (n > 0) {
+                    _http._pending.append(buf, n);
+                } else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                    _http.end();
+                }
+            }
+            return (int)_http._pending.size();
+        }
+
+        int read() override {
+            if (available() <= 0) return -1;
+            uint8_t c = (uint8_t)_http._pending[0];
+            _http._pending.erase(0, 1);
+            return c;
+        }
+
+        int peek() override {
+            return available() > 0 ? (uint8_t)_http._pending[0] : -1;
+        }
+
+        int read(uint8_t* buffer, size_t size) override {
+            size_t n = std::min(size, (size_t)std::max(available(), 0));
+            memcpy(buffer, _http._pending.data(), n);
+            _http._pending.erase(0, n);
+            return (int)n;
+        }
+
+        size_t readBytes(uint8_t* buffer, size_t length) override {
+            size_t n = 0;
+            while (n < length) {
+                if (_http._pending.empty()) {
+                    if (_http._socket < 0) break;
+                    char buf[4096];
+                    ssize_t got = recv(_http._socket, buf, sizeof(buf), 0);   // Bounded by SO_RCVTIMEO
+                    if (got <= 0) {
+                        _http.end();
+                        break;
+                    }
+                    _http._pending.append(buf, got);
+                }
+                size_t take = std::min(length - n, _http._pending.size());
+                memcpy(buffer + n, _http._pending.data(), take);
+                _http._pending.erase(0, take);
+                n += take;
+            }
+            return n;
+        }
+        using Stream::readBytes;
+
+        uint8_t connected() override { return _http._socket >= 0; }
+
+    private:
+        HTTPClient& _http;
+    };
+
+    bool connectToHost() {
+        addrinfo hints = {};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addresses = nullptr;
+        if (getaddrinfo(_host.c_str(), _port.c_str(), &hints, &addresses) != 0) {
+            return false;
+        }
+        _socket = socket(addresses->ai_family, addresses->ai_socktype, addresses->ai_protocol);
+        bool connected = _socket >= 0 && connect(_socket, addresses->ai_addr, addresses->ai_addrlen) == 0;
+        freeaddrinfo(addresses);
+        if (!connected) {
+            end();
+            return false;
+        }
+        timeval timeout = { (time_t)(_timeoutMs / 1000), (suseconds_t)(_timeoutMs % 1000) * 1000 };
+        setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        return true;
+    }
+
+    BodyStream _body;
+    int _socket;
+    std::string _host;
+    std::string _port;
+    std::string _path;
+    std::string _headers;   ///< Added with addHeader(), sent with the next GET
+    std::string _pending;   ///< Body bytes received but not read yet
+    std::vector<std::string> _collect;   ///< Set by collectHeaders()
+    std::vector<std::pair<std::string, std::string>> _responseHeaders;
+    int _size;
+    uint32_t _timeoutMs;
+};
@@ -0,0 +1,148 @@
+#pragma once
+
+// In-memory NVS for the native tests. Namespaces persist for the life of the
+// process, so a second Preferences on the same namespace sees earlier writes
+// the way a reboot would. Every access is counted in Preferences::stats so
+// tests can check how much flash traffic a change causes.
+
+#include <Arduino.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+    /**
+     * @brief Flash traffic since the last resetStats()
+     */
+    struct Stats {
+        uint32_t reads = 0;         ///< get*, isKey and getBytesLength calls
+        uint32_t writes = 0;        ///< put* calls
+        uint32_t removes = 0;       ///< remove calls that deleted a key
+        size_t bytesWritten = 0;    ///< Value bytes passed to put*
+    };
+
+    using Namespace = std::map<std::string, std::vector<uint8_t>>;
+
+    static Stats& stats() {
+        static Stats s;
+        return s;
+    }
+
+    static void resetStats() {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        stats() = Stats();
+    }
+
+    /**
+     * @brief Direct access to stored keys, for seeding and inspecting flash in tests
+     */
+    static Namespace& storage(const char* name) {
+        static std::map<std::string, Namespace> all;
+        return all[name];
+    }
+
+    static void eraseAll(const char* name) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        storage(name).clear();
+    }
+
+    bool begin(const char* name, bool readOnly = false) {
+        _name = name;
+        _open = true;
+        return true;
+    }
+
+    void end() { _open = false; }
+
+    bool isKey(const char* key) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        stats().reads++;
+        return keys().count(key) > 0;
+    }
+
+    bool remove(const char* key) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        bool removed = keys().erase(key) > 0;
+        if (removed) stats().removes++;
+        return removed;
+    }
+
+    size_t putBytes(const char* key, const void* value, size_t length) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        const uint8_t* bytes = (const uint8_t*)value;
+        keys()[key] = std::vector<uint8_t>(bytes, bytes + length);
+        stats().writes++;
+        stats().bytesWritten += length;
+        return length;
+    }
+
+    size_t getBytesLength(const char* key) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        stats().reads++;
+        auto found = keys().find(key);
+        return found == keys().end() ? 0 : found->second.size();
+    }
+
+    size_t getBytes(const char* key, void* buffer, size_t maxLength) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        stats().reads++;
+        auto found = keys().find(key);
+        if (found == keys().end() || found->second.size() > maxLength) return 0;
+        memcpy(buffer, found->second.data(), found->second.size());
+        return found->second.size();
+    }
+
+    size_t putString(const char* key, const String& value) {
+        return putBytes(key, value.c_str(), value.length());
+    }
+
+    String getString(const char* key, const String& defaultValue = String()) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        stats().reads++;
+        auto found = keys().find(key);
+        if (found == keys().end()) return defaultValue;
+        return String((const char*)found->second.data(), found->second.size());
+    }
+
+    size_t putBool(const char* key, bool value) {
+        uint8_t stored = value ? 1 : 0;
+        return putBytes(key, &stored, sizeof(stored));
+    }
+
+    bool getBool(const char* key, bool defaultValue = false) {
+        uint8_t stored = defaultValue ? 1 : 0;
+        return getValue(key, stored) ? stored != 0 : defaultValue;
+    }
+
+    size_t putInt(const char* key, int32_t value) {
+        return putBytes(key, &value, sizeof(value));
+    }
+
+    int32_t getInt(const char* key, int32_t defaultValue = 0) {
+        int32_t stored = defaultValue;
+        return getValue(key, stored) ? stored : defaultValue;
+    }
+
+private:
+    static std::recursive_mutex& mutex() {
+        static std::recursive_mutex m;
+        return m;
+    }
+
+    Namespace& keys() { return storage(_name.c_str()); }
+
+    template <typename T>
+    bool getValue(const char* key, T& value) {
+        std::lock_guard<std::recursive_mutex> guard(mutex());
+        stats().reads++;
+        auto found = keys().find(key);
+        if (found == keys().end() || found->second.size() != sizeof(T)) return false;
+        memcpy(&value, found->second.data(), sizeof(T));
+        return true;
+    }
+
+    std::string _name;
+    bool _open = false;
+};
@@ -0,0 +1,6 @@
+#pragma once
+
+// Only the name is needed by DisplayInterface.h; nothing on the host drives
+// a panel
+
+#include <Arduino.h>
@@ -0,0 +1,207 @@
+#pragma once
+
+// The ESP32 core's Update over a file, for suites that flash an image on the
+// host. Writes are buffered into 4 KB sectors and the first 16 bytes are held
+// back until end(), as on the device, so an image only becomes whole once it
+// is finalised. A test can give each sector a write time to stand in for
+// flash erase and program. The image magic byte is not checked.
+
+#include <Arduino.h>
+#include <cstdio>
+#include <string>
+
+#define U_FLASH 0
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+#define UPDATE_ERROR_OK (0)
+#define UPDATE_ERROR_WRITE (1)
+#define UPDATE_ERROR_ERASE (2)
+#define UPDATE_ERROR_READ (3)
+#define UPDATE_ERROR_SPACE (4)
+#define UPDATE_ERROR_SIZE (5)
+#define UPDATE_ERROR_STREAM (6)
+#define UPDATE_ERROR_MD5 (7)
+#define UPDATE_ERROR_MAGIC_BYTE (8)
+#define UPDATE_ERROR_ACTIVATE (9)
+#define UPDATE_ERROR_NO_PARTITION (10)
+#define UPDATE_ERROR_BAD_ARGUMENT (11)
+#define UPDATE_ERROR_ABORT (12)
+
+class UpdateClass {
+public:
+    static const size_t SECTOR_SIZE = 4096;
+    static const size_t DEFERRED_BYTES = 16;   ///< Written last, by end()
+
+    UpdateClass() { reset(); }
+    ~UpdateClass() { closeFile(); }
+
+    /**
+     * @brief Back the update partition with a file (host only)
+     * @param path Truncated by every begin()
+     * @param capacity Partition size; larger images fail begin()
+     */
+    void setPartition(const std::string& path, size_t capacity) {
+        _path = path;
+        _capacity = capacity;
+    }
+
+    /** @brief Time each 4 KB sector takes to erase and program (host only) */
+    void setSectorWriteTime(uint32_t micros) { _sectorWriteUs = micros; }
+
+    const std::string& partitionPath() const { return _path; }
+    size_t partitionSize() const { return _capacity; }
+    size_t sectorsWritten() const { return _sectors; }
+    int abortCount() const { return _aborts; }
+    bool ended() const { return _ended; }
+
+    bool begin(size_t size, int command = U_FLASH) {
+        if (_running) {
+            _error = UPDATE_ERROR_BAD_ARGUMENT;
+            return false;
+        }
+        reset();
+        if (size == 0 || size == UPDATE_SIZE_UNKNOWN || size > _capacity) {
+            _error = UPDATE_ERROR_SIZE;
+            return false;
+        }
+        closeFile();
+        _file = _path.empty() ? nullptr : fopen(_path.c_str(), "w+b");
+        if (!_file) {
+            _error = UPDATE_ERROR_NO_PARTITION;
+            return false;
+        }
+        _size = size;
+        _running = true;
+        return true;
+    }
+
+    size_t write(uint8_t* data, size_t length) {
+        if (_error != UPDATE_ERROR_OK || !_running) {
+            return 0;
+        }
+        if (length > remaining()) {
+            fail(UPDATE_ERROR_SPACE);
+            return 0;
+        }
+        size_t left = length;
+        while (_bufferLength + left > SECTOR_SIZE) {
+            size_t take = SECTOR_SIZE - _bufferLength;
+            memcpy(_buffer + _bufferLength, data + (length - left), take);
+            _bufferLength += take;
+            if (!writeBuffer()) {
+                return length - left;
+            }
+            left -= take;
+        }
+        memcpy(_buffer + _bufferLength, data + (length - left), left);
+        _bufferLength += left;
+        if (_bufferLength == remaining() && !writeBuffer()) {
+            return length - left;
+        }
+        return length;
+    }
+
+    bool end(bool evenIfRemaining = false) {
+        if (_error != UPDATE_ERROR_OK || !_running) {
+            return false;
+        }
+        if (!evenIfRemaining && _progress != _size) {
+            fail(UPDATE_ERROR_ABORT);
+            return false;
+        }
+        if (_bufferLength > 0 && !writeBuffer()) {
+            return false;
+        }
+        // The held-back header goes in last, which is what makes the image bootable
+        fseek(_file, 0, SEEK_SET);
+        fwrite(_header, 1, min(_size, DEFERRED_BYTES), _file);
+        fflush(_file);
+        _running = false;
+        _ended = true;
+        return true;
+    }
+
+    void abort() {
+        _aborts++;
+        fail(UPDATE_ERROR_ABORT);
+    }
+
+    bool isRunning() const { return _running; }
+    bool canRollBack() const { return false; }
+    size_t progress() const { return _progress; }
+    size_t remaining() const { return _size - _progress; }
+    uint8_t getError() const { return _error; }
+
+    const char* errorString() const {
+        static const char* const names[] = {
+            "No Error", "Flash Write Failed", "Flash Erase Failed", "Flash Read Failed", "Not Enough Space",
+            "Bad Size Given", "Stream Read Timeout", "MD5 Check Failed", "Wrong Magic Byte",
+            "Could Not Activate The Firmware", "Partition Could Not be Found", "Bad Argument", "Aborted"
+        };
+        return _error < sizeof(names) / sizeof(names[0]) ? names[_error] : "UNKNOWN";
+    }
+
+private:
+    void reset() {
+        _size = 0;
+        _progress = 0;
+        _bufferLength = 0;
+        _sectors = 0;
+        _error = UPDATE_ERROR_OK;
+        _running = false;
+        _ended = false;
+    }
+
+    void fail(uint8_t error) {
+        _error = error;
+        _running = false;
+        _bufferLength = 0;
+    }
+
+    bool writeBuffer() {
+        if (_sectorWriteUs > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(_sectorWriteUs));
+        }
+        // Flash is erased to 0xFF; the first bytes stay that way until end()
+        size_t skip = 0;
+        if (_progress == 0) {
+            skip = min(_bufferLength, DEFERRED_BYTES);
+            memcpy(_header, _buffer, skip);
+            memset(_buffer, 0xFF, skip);
+        }
+        if (fseek(_file, _progress, SEEK_SET) != 0 ||
+            fwrite(_buffer, 1, _bufferLength, _file) != _bufferLength) {
+            fail(UPDATE_ERROR_WRITE);
+            return false;
+        }
+        fflush(_file);   // Readable through esp_partition_read() straight away, like flash
+        _progress += _bufferLength;
+        _bufferLength = 0;
+        _sectors++;
+        return true;
+    }
+
+    void closeFile() {
+        if (_file) {
+            fclose(_file);
+            _file = nullptr;
+        }
+    }
+
+    std::string _path;
+    size_t _capacity = 0x1F0000;   ///< ota_1 in partitions.csv
+    uint32_t _sectorWriteUs = 0;
+    FILE* _file = nullptr;
+    uint8_t _buffer[SECTOR_SIZE];
+    uint8_t _header[DEFERRED_BYTES];
+    size_t _bufferLength;
+    size_t _size;
+    size_t _progress;
+    size_t _sectors;
+    int _aborts = 0;
+    uint8_t _error;
+    bool _running;
+    bool _ended;
+};
+
+inline UpdateClass Update;
@@ -0,0 +1,292 @@
+#pragma once
+
+// WiFi for the host. Until a suite starts a station connect, the host counts
+// as online and nothing here talks to a radio. Suites that test connecting
+// add simulated access points; begin() then joins one after a set time and
+// loop() delivers the driver's events on the caller's task.
+
+#include <Arduino.h>
+#include <vector>
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+typedef arduino_event_id_t WiFiEvent_t;
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA2_ENTERPRISE,
+    WIFI_AUTH_WPA3_PSK,
+    WIFI_AUTH_WPA2_WPA3_PSK,
+} wifi_auth_mode_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+typedef enum { WIFI_PS_NONE = 0, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+class IPAddress {
+public:
+    IPAddress() : _bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+    uint8_t operator[](int index) const { return _bytes[index]; }
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+        return String(buf);
+    }
+    /** @brief Stands in for Printable, so Serial.println(WiFi.localIP()) works */
+    operator String() const { return toString(); }
+
+private:
+    uint8_t _bytes[4];
+};
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED,
+} wl_status_t;
+
+/**
+ * @class WiFiClient
+ * @brief Transport handed to HTTPClient; the host HTTPClient opens its own
+ * sockets and reads response bodies through a WiFiClient of its own
+ */
+class WiFiClient : public Stream {
+public:
+    virtual ~WiFiClient() = default;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    /** @brief Read up to size bytes that have already arrived */
+    virtual int read(uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (n < size && available() > 0) {
+            buffer[n++] = (uint8_t)read();
+        }
+        return (int)n;
+    }
+    virtual uint8_t connected() { return 0; }
+    using Stream::readBytes;
+};
+
+/**
+ * @class WiFiClass
+ * @brief The station side of the ESP32 WiFi library over simulated access points
+ */
+class WiFiClass {
+public:
+    /** @brief A network the simulated radio can hear */
+    struct AccessPoint {
+        String ssid;
+        String password;
+        uint8_t bssid[6];
+        int32_t channel;
+        int32_t rssi;
+    };
+
+    /** @brief How long the simulated driver takes, in millis() time */
+    struct Timing {
+        unsigned long directedJoinMs = 300;   ///< begin() with a BSSID and channel: associate, no scan
+        unsigned long scanJoinMs = 2500;      ///< begin() with only an SSID: scan every channel, then associate
+        unsigned long dhcpMs = 150;           ///< From association to an IP address
+        unsigned long scanMs = 2000;          ///< scanNetworks()
+    };
+
+    wl_status_t status() {
+        if (!_stationUsed) return WL_CONNECTED;
+        return _gotIp ? WL_CONNECTED : WL_DISCONNECTED;
+    }
+
+    void onEvent(WiFiEventCb callback) { _handlers.push_back(callback); }
+    bool mode(wifi_mode_t mode) { _mode = mode; return true; }
+    wifi_mode_t getMode() { return _mode; }
+    bool setSleep(wifi_ps_type_t type) { return true; }
+    bool setSleep(bool enabled) { return true; }
+    void macAddress(uint8_t* mac) {
+        static const uint8_t address[6] = { 0x24, 0x6F, 0x28, 0xDE, 0x5C, 0x0A };
+        memcpy(mac, address, 6);
+    }
+
+    /**
+     * @brief Join a network; with a BSSID and channel the driver tries only that access point
+     *
+     * A directed join to an access point that is not there never reports
+     * anything, as with the IDF driver, unless failDirectedJoins() was called.
+     */
+    wl_status_t begin(const char* ssid, const char* password = nullptr, int32_t channel = 0,
+                      const uint8_t* bssid = nullptr, bool connect = true) {
+        _stationUsed = true;
+        _beginCount++;
+        _lastBeginDirected = bssid != nullptr && channel > 0;
+        if (_lastBeginDirected) {
+            _directedBeginCount++;
+        }
+        _pendingAp = -1;
+        _pendingFailure = false;
+
+        if (_lastBeginDirected) {
+            for (size_t i = 0; i < _accessPoints.size(); i++) {
+                const AccessPoint& ap = _accessPoints[i];
+                if (ap.ssid == ssid && ap.channel == channel && memcmp(ap.bssid, bssid, 6) == 0) {
+                    _pendingAp = (int)i;
+                }
+            }
+            _pendingAt = millis() + _timing.directedJoinMs;
+            _pendingFailure = _pendingAp < 0 && _reportDirectedFailure;
+        } else {
+            // Strongest access point with the SSID, as the driver's scan picks
+            for (size_t i = 0; i < _accessPoints.size(); i++) {
+                if (_accessPoints[i].ssid == ssid &&
+                    (_pendingAp < 0 || _accessPoints[i].rssi > _accessPoints[_pendingAp].rssi)) {
+                    _pendingAp = (int)i;
+                }
+            }
+            _pendingAt = millis() + _timing.scanJoinMs;
+            _pendingFailure = _pendingAp < 0;
+        }
+        if (_pendingAp >= 0 && _accessPoints[_pendingAp].password != (password ? password : "")) {
+            _pendingAp = -1;
+            _pendingFailure = true;
+        }
+        _joining = true;
+        return WL_DISCONNECTED;
+    }
+
+    bool disconnect(bool wifiOff = false, bool eraseAp = false) {
+        bool wasAssociated = _associated;
+        _joining = false;
+        _associated = false;
+        _gotIp = false;
+        _connectedAp = -1;
+        if (wasAssociated) {
+            _events.push_back(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+        }
+        return true;
+    }
+
+    String SSID() { return _connectedAp >= 0 ? _accessPoints[_connectedAp].ssid : String(); }
+    uint8_t* BSSID() { return _connectedAp >= 0 ? _accessPoints[_connectedAp].bssid : nullptr; }
+    int32_t channel() { return _connectedAp >= 0 ? _accessPoints[_connectedAp].channel : 0; }
+    int8_t RSSI() { return _connectedAp >= 0 ? (int8_t)_accessPoints[_connectedAp].rssi : 0; }
+    IPAddress localIP() { return _gotIp ? IPAddress(192, 168, 1, 42) : IPAddress(); }
+
+    int16_t scanNetworks(bool async = false, bool showHidden = false) {
+        _scanDoneAt = millis() + _timing.scanMs;
+        _scanResults.clear();
+        _scanning = true;
+        return async ? WIFI_SCAN_RUNNING : scanComplete();
+    }
+    int16_t scanComplete() {
+        if (!_scanning) return _scanResults.empty() ? WIFI_SCAN_FAILED : (int16_t)_scanResults.size();
+        if ((long)(millis() - _scanDoneAt) < 0) return WIFI_SCAN_RUNNING;
+        _scanning = false;
+        _scanResults = _accessPoints;
+        return (int16_t)_scanResults.size();
+    }
+    void scanDelete() { _scanResults.clear(); _scanning = false; }
+    String SSID(uint8_t i) { return i < _scanResults.size() ? _scanResults[i].ssid : String(); }
+    int32_t RSSI(uint8_t i) { return i < _scanResults.size() ? _scanResults[i].rssi : 0; }
+    wifi_auth_mode_t encryptionType(uint8_t i) {
+        return i < _scanResults.size() && _scanResults[i].password.length() == 0 ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+    }
+
+    bool softAPConfig(IPAddress local, IPAddress gateway, IPAddress subnet) { _apIP = local; return true; }
+    bool softAP(const char* ssid, const char* password = nullptr) { return true; }
+    IPAddress softAPIP() { return _apIP; }
+    bool softAPdisconnect(bool wifiOff = false) { return true; }
+    uint8_t softAPgetStationNum() { return 0; }
+
+    /**
+     * @brief Deliver the events that are due by millis() to the onEvent() handlers (host only)
+     */
+    void loop() {
+        unsigned long now = millis();
+        if (_joining && (long)(now - _pendingAt) >= 0) {
+            _joining = false;
+            if (_pendingAp >= 0) {
+                _associated = true;
+                _connectedAp = _pendingAp;
+                _ipAt = now + _timing.dhcpMs;
+                _events.push_back(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+            } else if (_pendingFailure) {
+                _events.push_back(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+            }
+        }
+        if (_associated && !_gotIp && (long)(now - _ipAt) >= 0) {
+            _gotIp = true;
+            _events.push_back(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+        }
+        std::vector<arduino_event_id_t> due;
+        due.swap(_events);
+        for (arduino_event_id_t event : due) {
+            for (WiFiEventCb handler : _handlers) {
+                handler(event);
+            }
+        }
+    }
+
+    // --- Simulation setup and counts (host only) ---
+
+    void addAccessPoint(const AccessPoint& ap) { _accessPoints.push_back(ap); }
+    void clearAccessPoints() { _accessPoints.clear(); }
+    Timing& timing() { return _timing; }
+    /** @brief Make a directed join to a missing access point end in STA_DISCONNECTED */
+    void failDirectedJoins(bool report) { _reportDirectedFailure = report; }
+    /** @brief Drop the link and forget every attempt, keeping access points and handlers */
+    void reset() {
+        disconnect();
+        _events.clear();
+        _beginCount = _directedBeginCount = 0;
+        _lastBeginDirected = false;
+    }
+    int beginCount() const { return _beginCount; }
+    int directedBeginCount() const { return _directedBeginCount; }
+    bool lastBeginWasDirected() const { return _lastBeginDirected; }
+
+private:
+    std::vector<WiFiEventCb> _handlers;
+    std::vector<AccessPoint> _accessPoints;
+    std::vector<AccessPoint> _scanResults;
+    std::vector<arduino_event_id_t> _events;
+    Timing _timing;
+    wifi_mode_t _mode = WIFI_OFF;
+    IPAddress _apIP;
+    bool _stationUsed = false;
+    bool _joining = false;
+    bool _associated = false;
+    bool _gotIp = false;
+    bool _pendingFailure = false;
+    bool _reportDirectedFailure = false;
+    bool _scanning = false;
+    int _pendingAp = -1;
+    int _connectedAp = -1;
+    unsigned long _pendingAt = 0;
+    unsigned long _ipAt = 0;
+    unsigned long _scanDoneAt = 0;
+    int _beginCount = 0;
+    int _directedBeginCount = 0;
+    bool _lastBeginDirected = false;
+};
+
+inline WiFiClass WiFi;
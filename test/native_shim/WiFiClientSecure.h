@@ -0,0 +1,11 @@
+#pragma once
+
+// TLS client type for headers that mention it. The host HTTPClient only
+// speaks plain http://, so nothing here does TLS.
+
+#include <WiFi.h>
+
+class WiFiClientSecure : public WiFiClient {
+public:
+    void setInsecure() {}
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+// heap_caps on the host: plain malloc, with a count of live allocations so
+// tests can check that ownership hand-offs free what they should. Free size
+// follows everything the process has allocated (glibc's in-use bytes), so a
+// low-water mark taken around a call covers libraries that use malloc.
+
+#include <malloc.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+inline long& heap_caps_live_allocations() {
+    static long live = 0;
+    return live;
+}
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    void* p = malloc(size);
+    if (p) heap_caps_live_allocations()++;
+    return p;
+}
+
+inline void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void* p = calloc(n, size);
+    if (p) heap_caps_live_allocations()++;
+    return p;
+}
+
+inline void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    void* p = realloc(ptr, size);
+    if (p && !ptr) heap_caps_live_allocations()++;
+    return p;
+}
+
+inline void heap_caps_free(void* ptr) {
+    if (ptr) heap_caps_live_allocations()--;
+    free(ptr);
+}
+
+inline size_t heap_caps_get_free_size(uint32_t caps) { return 8 * 1024 * 1024 - mallinfo2().uordblks; }
+inline size_t heap_caps_get_total_size(uint32_t caps) { return 8 * 1024 * 1024; }
+inline size_t heap_caps_get_minimum_free_size(uint32_t caps) { return 8 * 1024 * 1024; }
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 4 * 1024 * 1024; }
+inline void heap_caps_malloc_extmem_enable(size_t limit) {}
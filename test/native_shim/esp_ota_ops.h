@@ -0,0 +1,72 @@
+#pragma once
+
+// The two app partitions of partitions.csv. The update partition reads back
+// the file native_shim/Update.h writes to; the running one reads
+// whatever file a test points it at, or fails if none.
+
+#include <cstdio>
+#include <string>
+#include "esp_task_wdt.h"
+#include "Update.h"
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_APP_OTA_0 = 0x10,
+    ESP_PARTITION_SUBTYPE_APP_OTA_1 = 0x11,
+} esp_partition_subtype_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+namespace native_ota {
+inline std::string& runningImagePath() {
+    static std::string path;
+    return path;
+}
+
+inline const esp_partition_t* partition(int index) {
+    static const esp_partition_t partitions[2] = {
+        { ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_OTA_0, 0x10000, 0x1F0000, "ota_0" },
+        { ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_OTA_1, 0x200000, 0x1F0000, "ota_1" },
+    };
+    return &partitions[index];
+}
+}
+
+/** @brief Back the running partition with a file (host only) */
+inline void esp_ota_set_running_image(const std::string& path) { native_ota::runningImagePath() = path; }
+
+inline const esp_partition_t* esp_ota_get_running_partition() { return native_ota::partition(0); }
+
+inline const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t* start_from) {
+    return native_ota::partition(1);
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size) {
+    const std::string& path = partition == native_ota::partition(1) ? Update.partitionPath()
+                                                                    : native_ota::runningImagePath();
+    if (path.empty() || src_offset + size > partition->size) {
+        return ESP_FAIL;
+    }
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return ESP_FAIL;
+    }
+    // Unwritten flash reads as erased
+    memset(dst, 0xFF, size);
+    bool ok = fseek(file, (long)src_offset, SEEK_SET) == 0;
+    if (ok) {
+        fread(dst, 1, size, file);
+    }
+    fclose(file);
+    return ok ? ESP_OK : ESP_FAIL;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() {
+    return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - native_clock::start()).count();
+}
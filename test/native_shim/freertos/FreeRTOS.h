@@ -0,0 +1,252 @@
+#pragma once
+
+// FreeRTOS on std::thread for the native tests. Covers tasks with direct
+// notifications, queues, mutexes and binary semaphores; one tick is one
+// millisecond. Tasks are detached threads. vTaskDelete(NULL) ends the calling
+// task; deleting another task only marks it deleted, since a thread cannot be
+// stopped from outside.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTICKS_TO_MS(ticks) ((uint32_t)(ticks))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define errQUEUE_FULL 0
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define configMAX_PRIORITIES 25
+
+namespace native_rtos {
+
+/** @brief Waits until pred() or the timeout; portMAX_DELAY waits forever */
+template <typename Pred>
+inline bool waitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock, TickType_t ticks, Pred pred) {
+    if (ticks == portMAX_DELAY) {
+        cv.wait(lock, pred);
+        return true;
+    }
+    return cv.wait_for(lock, std::chrono::milliseconds(ticks), pred);
+}
+
+struct Task {
+    std::string name;
+    uint32_t stackDepth = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t notifyValue = 0;
+    std::atomic<bool> deleted{false};
+};
+
+struct Queue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t itemSize;
+};
+
+/** @brief Thrown by vTaskDelete(NULL) and caught at the bottom of the task's thread */
+struct TaskExit {};
+
+inline std::mutex& registryMutex() {
+    static std::mutex m;
+    return m;
+}
+
+inline std::vector<Task*>& registry() {
+    static std::vector<Task*>* tasks = new std::vector<Task*>();
+    return *tasks;
+}
+
+inline Task*& currentSlot() {
+    thread_local Task* current = nullptr;
+    return current;
+}
+
+/** @brief The calling thread's task; threads not started by xTaskCreate get one on first use */
+inline Task* current() {
+    Task*& slot = currentSlot();
+    if (!slot) {
+        slot = new Task();
+        slot->name = "main";
+        std::lock_guard<std::mutex> guard(registryMutex());
+        registry().push_back(slot);
+    }
+    return slot;
+}
+
+} // namespace native_rtos
+
+typedef native_rtos::Task* TaskHandle_t;
+typedef native_rtos::Queue* QueueHandle_t;
+typedef native_rtos::Queue* SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline TickType_t xTaskGetTickCount() {
+    return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                          void* parameter, UBaseType_t priority, TaskHandle_t* handle,
+                                          BaseType_t core) {
+    native_rtos::Task* task = new native_rtos::Task();
+    task->name = name ? name : "";
+    task->stackDepth = stackDepth;
+    {
+        std::lock_guard<std::mutex> guard(native_rtos::registryMutex());
+        native_rtos::registry().push_back(task);
+    }
+    if (handle) {
+        *handle = task;
+    }
+    std::thread([function, parameter, task]() {
+        native_rtos::currentSlot() = task;
+        try {
+            function(parameter);
+        } catch (const native_rtos::TaskExit&) {
+        }
+        task->deleted = true;
+    }).detach();
+    return pdPASS;
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                              void* parameter, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(function, name, stackDepth, parameter, priority, handle, tskNO_AFFINITY);
+}
+
+inline void vTaskDelete(TaskHandle_t task) {
+    if (!task || task == native_rtos::current()) {
+        native_rtos::current()->deleted = true;
+        throw native_rtos::TaskExit();
+    }
+    task->deleted = true;
+}
+
+/** @brief Only a task suspending itself is supported; it sleeps until deleted */
+inline void vTaskSuspend(TaskHandle_t task) {
+    native_rtos::Task* self = native_rtos::current();
+    if (task && task != self) {
+        return;
+    }
+    while (!self->deleted) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    throw native_rtos::TaskExit();
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return native_rtos::current();
+}
+
+/** @brief Newest live task with this name, like the IDF's lookup */
+inline TaskHandle_t xTaskGetHandle(const char* name) {
+    std::lock_guard<std::mutex> guard(native_rtos::registryMutex());
+    auto& tasks = native_rtos::registry();
+    for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+        if (!(*it)->deleted && (*it)->name == name) {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+inline const char* pcTaskGetName(TaskHandle_t task) {
+    return (task ? task : native_rtos::current())->name.c_str();
+}
+
+/** @brief Host threads have no measurable stack; report a quarter of it as never used */
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return (task ? task : native_rtos::current())->stackDepth / 4;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> guard(task->mutex);
+        task->notifyValue++;
+    }
+    task->cv.notify_all();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    native_rtos::Task* task = native_rtos::current();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (!native_rtos::waitFor(task->cv, lock, ticks, [task]() { return task->notifyValue > 0; })) {
+        return 0;
+    }
+    uint32_t value = task->notifyValue;
+    task->notifyValue = clearOnExit ? 0 : value - 1;
+    return value;
+}
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    native_rtos::Queue* queue = new native_rtos::Queue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!native_rtos::waitFor(queue->cv, lock, ticks, [queue]() { return queue->items.size() < queue->length; })) {
+        return errQUEUE_FULL;
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->cv.notify_all();
+    return pdPASS;
+}
+
+#define xQueueSendToBack xQueueSend
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!native_rtos::waitFor(queue->cv, lock, ticks, [queue]() { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->cv.notify_all();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> guard(queue->mutex);
+    return queue->items.size();
+}
+
+inline BaseType_t xQueueReset(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> guard(queue->mutex);
+    queue->items.clear();
+    queue->cv.notify_all();
+    return pdPASS;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+// Semaphores are queues of one-byte tokens, as in FreeRTOS itself
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 1);
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t mutex = xQueueCreate(1, 1);
+    uint8_t token = 0;
+    xQueueSend(mutex, &token, 0);
+    return mutex;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    uint8_t token;
+    return xQueueReceive(semaphore, &token, ticks);
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    uint8_t token = 0;
+    return xQueueSend(semaphore, &token, 0);
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    vQueueDelete(semaphore);
+}
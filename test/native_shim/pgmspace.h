@@ -0,0 +1,7 @@
+#pragma once
+
+// Flash and RAM share one address space on the host
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
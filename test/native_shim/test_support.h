@@ -0,0 +1,218 @@
+#pragma once
+
+// Helpers shared by the native test suites: fixture loading, an in-memory
+// Stream that hands out data in network-sized pieces, a wall clock for the
+// benchmarks, scratch files, and a runner for the local stand-in servers in
+// scripts/.
+
+#include <Arduino.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef TEST_DATA_DIR
+#define TEST_DATA_DIR "test/data"
+#endif
+
+/**
+ * @brief Read a fixture from test/data, or return an empty string if it is missing
+ */
+inline std::string loadTestData(const char* name) {
+    std::ifstream file(std::string(TEST_DATA_DIR) + "/" + name, std::ios::binary);
+    if (!file) {
+        printf("test_support: missing fixture %s/%s\n", TEST_DATA_DIR, name);
+        return std::string();
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+/**
+ * @class MemoryStream
+ * @brief Stream over a buffer that reports at most chunkSize bytes available at a time
+ */
+class MemoryStream : public Stream {
+public:
+    MemoryStream(const std::string& data, size_t chunkSize)
+        : _data(data), _position(0), _chunkSize(chunkSize), _bytesRead(0) {}
+
+    int available() override {
+        size_t remaining = _data.size() - _position;
+        return (int)(remaining < _chunkSize ? remaining : _chunkSize);
+    }
+
+    int read() override {
+        if (_position >= _data.size()) return -1;
+        _bytesRead++;
+        return (uint8_t)_data[_position++];
+    }
+
+    int peek() override {
+        return _position < _data.size() ? (uint8_t)_data[_position] : -1;
+    }
+
+    size_t readBytes(uint8_t* buffer, size_t length) override {
+        size_t remaining = _data.size() - _position;
+        size_t n = length < remaining ? length : remaining;
+        memcpy(buffer, _data.data() + _position, n);
+        _position += n;
+        _bytesRead += n;
+        return n;
+    }
+    using Stream::readBytes;
+
+    size_t bytesRead() const { return _bytesRead; }
+
+private:
+    std::string _data;
+    size_t _position;
+    size_t _chunkSize;
+    size_t _bytesRead;
+};
+
+/**
+ * @class BenchTimer
+ * @brief Microsecond wall clock for host benchmarks
+ */
+class BenchTimer {
+public:
+    BenchTimer() : _start(std::chrono::steady_clock::now()) {}
+    double elapsedUs() const {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @class TempFile
+ * @brief A file under /tmp that is deleted with the object
+ */
+class TempFile {
+public:
+    explicit TempFile(const char* prefix) {
+        std::string pattern = std::string("/tmp/") + prefix + "XXXXXX";
+        std::vector<char> name(pattern.begin(), pattern.end());
+        name.push_back('\0');
+        int fd = mkstemp(name.data());
+        if (fd >= 0) {
+            close(fd);
+            _path = name.data();
+        }
+    }
+    ~TempFile() {
+        if (!_path.empty()) {
+            unlink(_path.c_str());
+        }
+    }
+
+    const std::string& path() const { return _path; }
+
+    bool write(const std::string& contents) const {
+        std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+        return (bool)file;
+    }
+
+    std::string read() const {
+        std::ifstream file(_path, std::ios::binary);
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+private:
+    std::string _path;
+};
+
+/**
+ * @class MockServer
+ * @brief Runs one of the scripts/mock_*.py servers on a free local port
+ *
+ * The server prints "<name>: serving on http://HOST:PORT" first and its
+ * stats as the last line when stopped. Needs python3 on the PATH.
+ */
+class MockServer {
+public:
+    MockServer() : _pid(-1), _output(nullptr) { _url[0] = '\0'; }
+    ~MockServer() { stop(); }
+
+    /**
+     * @brief Start a script from scripts/ with extra command line options
+     */
+    bool start(const char* script, const std::string& options) {
+        stop();
+        std::string command = std::string("exec python3 ") + TEST_DATA_DIR + "/../../scripts/" + script +
+                              " --host 127.0.0.1 --port 0 " + options;
+        int fds[2];
+        if (pipe(fds) != 0) {
+            return false;
+        }
+        _pid = fork();
+        if (_pid == 0) {
+            dup2(fds[1], STDOUT_FILENO);
+            close(fds[0]);
+            close(fds[1]);
+            execl("/bin/sh", "sh", "-c", command.c_str(), (char*)nullptr);
+            _exit(127);
+        }
+        close(fds[1]);
+        _output = fdopen(fds[0], "r");
+
+        char line[128];
+        const char* port = nullptr;
+        if (fgets(line, sizeof(line), _output)) {
+            port = strrchr(line, ':');
+        }
+        if (!port) {
+            printf("test_support: mock server did not start: %s\n", command.c_str());
+            stop();
+            return false;
+        }
+        snprintf(_url, sizeof(_url), "http://127.0.0.1:%d", atoi(port + 1));
+        return true;
+    }
+
+    /** @brief Base URL, e.g. http://127.0.0.1:40123 */
+    const char* url() const { return _url; }
+
+    /**
+     * @brief Stop the server and return its closing stats line
+     */
+    std::string stop() {
+        std::string stats;
+        if (_pid > 0) {
+            kill(_pid, SIGTERM);
+            char line[512];
+            while (fgets(line, sizeof(line), _output)) {
+                stats = line;
+            }
+            waitpid(_pid, nullptr, 0);
+            fclose(_output);
+            _pid = -1;
+            _output = nullptr;
+        }
+        return stats;
+    }
+
+    /**
+     * @brief One count from a stats line, or -1 if it is not there
+     */
+    static long stat(const std::string& stats, const char* key) {
+        std::string field = std::string("\"") + key + "\": ";
+        size_t at = stats.find(field);
+        return at == std::string::npos ? -1 : atol(stats.c_str() + at + field.size());
+    }
+
+private:
+    pid_t _pid;
+    FILE* _output;
+    char _url[64];
+};
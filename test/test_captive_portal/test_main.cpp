@@ -0,0 +1,221 @@
+#include <unity.h>
+#include <Preferences.h>
+#include "test_support.h"
+
+// CaptivePortal and the units it reads status from are built into this suite;
+// native_shim/ESPAsyncWebServer.h runs its handlers without sockets
+#include "EventQueue.cpp"
+#include "SystemController.cpp"
+#include "ConfigManager.cpp"
+#include "OtaManager.cpp"
+#include "ui/CaptivePortal.cpp"
+
+// The radio is not simulated here; the portal only reads what it last reported
+WiFiInterface::WiFiInterface(ConfigManager& configManager, EventQueue& eventQueue)
+    : _configManager(configManager), _eventQueue(&eventQueue), _state(WiFiState::DISCONNECTED),
+      _dnsServer(nullptr), _ui(nullptr), _lastStatusCheck(0), _connectionStartTime(0), _connectionTimeout(0) {}
+void WiFiInterface::onStateChange(WiFiStateCallback callback) {}
+bool WiFiInterface::startScan() { return false; }
+bool WiFiInterface::updateScan() { return false; }
+bool WiFiInterface::isScanning() const { return false; }
+bool WiFiInterface::isConnected() const { return true; }
+String WiFiInterface::getCurrentSsid() const { return "DeskHog Office"; }
+String WiFiInterface::getIPAddress() const { return "192.168.1.42"; }
+unsigned long WiFiInterface::getLastConnectTime() const { return 0; }
+bool WiFiInterface::lastConnectWasFast() const { return false; }
+unsigned long WiFiInterface::getLastScanTime() const { return 0; }
+std::vector<WiFiInterface::NetworkInfo> WiFiInterface::getScannedNetworks() const { return {}; }
+
+std::vector<CardDefinition> CardController::getCardDefinitions() const { return {}; }
+
+static const unsigned long PUSH_INTERVAL_MS = 250;   // CaptivePortal::STATUS_PUSH_INTERVAL_MS
+
+// Built once and never destroyed, as in main.cpp, since ConfigManager and
+// OtaManager keep tasks that point back at them
+static EventQueue* eventQueue;
+static ConfigManager* configManager;
+static WiFiInterface* wifiInterface;
+static OtaManager* otaManager;
+static CaptivePortal* portal;
+// Never constructed: the portal only calls getCardDefinitions(), stubbed above
+alignas(CardController) static unsigned char cardControllerStorage[sizeof(CardController)];
+
+static AsyncWebServer* server;
+static AsyncEventSource* events;
+static AsyncEventSourceClient* client;
+
+static std::unique_ptr<AsyncWebServerRequest> get(const char* url, const char* ifNoneMatch = nullptr) {
+    std::unique_ptr<AsyncWebServerRequest> request(new AsyncWebServerRequest(HTTP_GET, url));
+    if (ifNoneMatch) {
+        request->addHeader("If-None-Match", ifNoneMatch);
+    }
+    return server->handle(std::move(request));
+}
+
+/**
+ * @brief Uncompressed size from a gzip member's trailer (RFC 1952 ISIZE)
+ */
+static uint32_t gzipInputSize(const std::string& body) {
+    const uint8_t* trailer = (const uint8_t*)body.data() + body.size() - 4;
+    return trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((uint32_t)trailer[3] << 24);
+}
+
+/**
+ * @brief Send whatever is still pending and forget it, then wait until the next push may go at once
+ */
+static void settle() {
+    delay(PUSH_INTERVAL_MS + 10);
+    portal->processAsyncOperations();
+    client->events().clear();
+    delay(PUSH_INTERVAL_MS + 10);
+}
+
+static std::vector<std::string> sentEventNames() {
+    std::vector<std::string> names;
+    for (const auto& event : client->events()) {
+        names.push_back(event.event);
+    }
+    return names;
+}
+
+void setUp() {
+    events->disconnectAll();
+    client = events->connect();
+    SystemController::setApiState(ApiState::API_NONE);
+    settle();
+}
+
+void tearDown() {}
+
+void test_root_serves_gzipped_page_with_etag() {
+    auto request = get("/");
+    AsyncWebServerResponse* response = request->response();
+    TEST_ASSERT_NOT_NULL(response);
+    TEST_ASSERT_EQUAL(200, response->code());
+    TEST_ASSERT_EQUAL_STRING("gzip", response->header("Content-Encoding").c_str());
+    TEST_ASSERT_EQUAL_STRING(PORTAL_HTML_ETAG, response->header("ETag").c_str());
+    TEST_ASSERT_EQUAL_STRING("no-cache", response->header("Cache-Control").c_str());
+
+    std::string body = response->content();
+    TEST_ASSERT_EQUAL(PORTAL_HTML_GZ_LEN, body.size());
+    TEST_ASSERT_EQUAL_HEX8(0x1f, (uint8_t)body[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x8b, (uint8_t)body[1]);
+    TEST_ASSERT_EQUAL_HEX8(8, (uint8_t)body[2]);   // deflate
+    uint32_t htmlSize = gzipInputSize(body);
+    TEST_ASSERT_GREATER_THAN(body.size(), htmlSize);
+    printf("CaptivePortal: / sends %u bytes gzipped for %u bytes of HTML\n", (unsigned)body.size(), htmlSize);
+}
+
+void test_root_with_matching_etag_is_not_modified() {
+    auto request = get("/", PORTAL_HTML_ETAG);
+    AsyncWebServerResponse* response = request->response();
+    TEST_ASSERT_NOT_NULL(response);
+    TEST_ASSERT_EQUAL(304, response->code());
+    TEST_ASSERT_EQUAL(0, response->content().size());
+    TEST_ASSERT_EQUAL_STRING(PORTAL_HTML_ETAG, response->header("ETag").c_str());
+    printf("CaptivePortal: / revalidated with If-None-Match sends 0 body bytes instead of %u\n",
+           (unsigned)PORTAL_HTML_GZ_LEN);
+}
+
+void test_root_with_stale_etag_sends_page() {
+    // A page cached from an older firmware
+    auto request = get("/", "\"0000000000000000\"");
+    TEST_ASSERT_EQUAL(200, request->response()->code());
+    TEST_ASSERT_EQUAL(PORTAL_HTML_GZ_LEN, request->response()->content().size());
+}
+
+void test_connect_sends_full_snapshot() {
+    AsyncEventSourceClient* second = events->connect();
+    TEST_ASSERT_EQUAL(1, second->events().size());
+    TEST_ASSERT_EQUAL_STRING("status", second->events()[0].event.c_str());
+    const std::string& snapshot = second->events()[0].data;
+    for (const char* section : STATUS_SECTIONS) {
+        TEST_ASSERT_TRUE_MESSAGE(snapshot.find(std::string("\"") + section + "\":") != std::string::npos, section);
+    }
+}
+
+void test_push_sends_only_changed_sections() {
+    // A state change marks both system and wifi; only system's JSON changes
+    SystemController::setApiState(ApiState::API_CONFIGURED);
+    portal->processAsyncOperations();
+
+    std::vector<std::string> sent = sentEventNames();
+    TEST_ASSERT_EQUAL(1, sent.size());
+    TEST_ASSERT_EQUAL_STRING("system", sent[0].c_str());
+    TEST_ASSERT_TRUE(client->events()[0].data.find("\"api_state\":3") != std::string::npos);
+    uint32_t firstId = client->events()[0].id;
+
+    // Nothing changed since, so nothing is resent however often it is asked
+    delay(PUSH_INTERVAL_MS + 10);
+    portal->processAsyncOperations();
+    portal->processAsyncOperations();
+    TEST_ASSERT_EQUAL(1, client->events().size());
+
+    SystemController::setApiState(ApiState::API_CONFIG_INVALID);
+    delay(PUSH_INTERVAL_MS + 10);
+    portal->processAsyncOperations();
+    TEST_ASSERT_EQUAL(2, client->events().size());
+    TEST_ASSERT_EQUAL_STRING("system", client->events()[1].event.c_str());
+    TEST_ASSERT_EQUAL(firstId + 1, client->events()[1].id);
+}
+
+void test_push_is_held_for_interval_and_collapsed() {
+    SystemController::setApiState(ApiState::API_AWAITING_CONFIG);
+    portal->processAsyncOperations();
+    unsigned long firstPush = millis();
+    TEST_ASSERT_EQUAL(1, client->events().size());
+
+    // Two more changes inside the interval are held back
+    SystemController::setApiState(ApiState::API_CONFIG_INVALID);
+    portal->processAsyncOperations();
+    SystemController::setApiState(ApiState::API_CONFIGURED);
+    delay(PUSH_INTERVAL_MS / 2);
+    portal->processAsyncOperations();
+    TEST_ASSERT_EQUAL(1, client->events().size());
+
+    // and go out as one push of the latest state once it has passed
+    while (millis() - firstPush < PUSH_INTERVAL_MS) {
+        delay(5);
+    }
+    portal->processAsyncOperations();
+    TEST_ASSERT_EQUAL(2, client->events().size());
+    TEST_ASSERT_TRUE(client->events()[1].data.find("\"api_state\":3") != std::string::npos);
+    printf("CaptivePortal: 3 changes within %lu ms sent as 2 events\n", PUSH_INTERVAL_MS);
+}
+
+void test_no_clients_builds_nothing_and_next_client_is_current() {
+    events->disconnectAll();
+    SystemController::setApiState(ApiState::API_CONFIGURED);
+    delay(PUSH_INTERVAL_MS + 10);
+    portal->processAsyncOperations();
+
+    // The change is in the newcomer's snapshot and not pushed again after it
+    client = events->connect();
+    TEST_ASSERT_EQUAL(1, client->events().size());
+    TEST_ASSERT_TRUE(client->events()[0].data.find("\"api_state\":3") != std::string::npos);
+    portal->processAsyncOperations();
+    TEST_ASSERT_EQUAL(1, client->events().size());
+}
+
+int main(int argc, char** argv) {
+    eventQueue = new EventQueue();
+    configManager = new ConfigManager(*eventQueue);
+    configManager->begin();
+    wifiInterface = new WiFiInterface(*configManager, *eventQueue);
+    otaManager = new OtaManager("1.0.0", "PostHog", "DeskHog");
+    portal = new CaptivePortal(*configManager, *wifiInterface, *eventQueue, *otaManager,
+                               reinterpret_cast<CardController&>(cardControllerStorage));
+    portal->begin();
+    server = AsyncWebServer::onPort(80);
+    events = server->eventSource("/api/events");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_root_serves_gzipped_page_with_etag);
+    RUN_TEST(test_root_with_matching_etag_is_not_modified);
+    RUN_TEST(test_root_with_stale_etag_sends_page);
+    RUN_TEST(test_connect_sends_full_snapshot);
+    RUN_TEST(test_push_sends_only_changed_sections);
+    RUN_TEST(test_push_is_held_for_interval_and_collapsed);
+    RUN_TEST(test_no_clients_builds_nothing_and_next_client_is_current);
+    return UNITY_END();
+}
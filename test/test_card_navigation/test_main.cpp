@@ -0,0 +1,199 @@
+#include <unity.h>
+#include <initializer_list>
+#include <vector>
+#include <lvgl.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "test_support.h"
+
+// Built into this suite rather than the shared native sources, since it
+// needs the buttons array main.cpp defines
+#include "ui/CardNavigationStack.cpp"
+
+Bounce2::Button buttons[NUM_BUTTONS];
+
+static const uint16_t SCREEN_WIDTH = 240;
+static const uint16_t SCREEN_HEIGHT = 135;
+static const uint32_t BENCH_TICKS = 200000;
+
+/**
+ * @brief Counts the calls a card receives; claims the center button only
+ */
+class CountingHandler : public InputHandler {
+public:
+    bool handleButtonPress(uint8_t button_index) override {
+        presses++;
+        return button_index == Input::BUTTON_CENTER;
+    }
+
+    bool update() override {
+        updates++;
+        return false;
+    }
+
+    uint32_t presses = 0;
+    uint32_t updates = 0;
+};
+
+/**
+ * @brief A stack of count cards, each with its own handler
+ */
+struct CardStackFixture {
+    CardNavigationStack* stack;
+    std::vector<lv_obj_t*> cards;
+    std::vector<CountingHandler> handlers;
+
+    explicit CardStackFixture(size_t count) : handlers(count) {
+        // Never deleted: the stack has no destructor, its objects go with the screen
+        stack = new CardNavigationStack(lv_screen_active(), SCREEN_WIDTH, SCREEN_HEIGHT);
+        for (size_t i = 0; i < count; i++) {
+            lv_obj_t* card = lv_obj_create(lv_screen_active());
+            stack->addCard(card);
+            stack->registerInputHandler(card, &handlers[i]);
+            cards.push_back(card);
+        }
+    }
+};
+
+static uint8_t drawBuffer[SCREEN_WIDTH * 10 * 2];
+
+static uint32_t tickGet() {
+    return millis();
+}
+
+static void flushDiscard(lv_display_t* display, const lv_area_t* area, uint8_t* pixels) {
+    lv_display_flush_ready(display);
+}
+
+void setUp() {}
+
+void tearDown() {
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_update_reaches_only_the_active_card() {
+    CardStackFixture fixture(5);
+    for (int i = 0; i < 10; i++) {
+        fixture.stack->updateActiveCard();
+    }
+    TEST_ASSERT_EQUAL(10, fixture.handlers[0].updates);
+
+    fixture.stack->goToCard(3);
+    fixture.stack->updateActiveCard();
+    TEST_ASSERT_EQUAL(1, fixture.handlers[3].updates);
+    TEST_ASSERT_EQUAL(10, fixture.handlers[0].updates);
+    for (int i : { 1, 2, 4 }) {
+        TEST_ASSERT_EQUAL(0, fixture.handlers[i].updates);
+    }
+}
+
+void test_unclaimed_buttons_navigate() {
+    CardStackFixture fixture(3);
+    fixture.stack->handleButtonPress(Input::BUTTON_CENTER);
+    TEST_ASSERT_EQUAL(0, fixture.stack->getCurrentIndex());
+
+    fixture.stack->handleButtonPress(Input::BUTTON_DOWN);
+    TEST_ASSERT_EQUAL(1, fixture.stack->getCurrentIndex());
+    fixture.stack->handleButtonPress(Input::BUTTON_CENTER);
+    TEST_ASSERT_EQUAL(1, fixture.handlers[1].presses);
+
+    // Every press is offered to the card first; up from the first card wraps to the last
+    fixture.stack->handleButtonPress(Input::BUTTON_UP);
+    fixture.stack->handleButtonPress(Input::BUTTON_UP);
+    TEST_ASSERT_EQUAL(2, fixture.stack->getCurrentIndex());
+    TEST_ASSERT_EQUAL(3, fixture.handlers[0].presses);
+    TEST_ASSERT_EQUAL(2, fixture.handlers[1].presses);
+}
+
+void test_reregistering_replaces_the_cached_handler() {
+    CardStackFixture fixture(2);
+    fixture.stack->updateActiveCard();
+
+    CountingHandler replacement;
+    fixture.stack->registerInputHandler(fixture.cards[0], &replacement);
+    fixture.stack->updateActiveCard();
+    TEST_ASSERT_EQUAL(1, fixture.handlers[0].updates);
+    TEST_ASSERT_EQUAL(1, replacement.updates);
+}
+
+void test_removed_card_stops_receiving_updates() {
+    CardStackFixture fixture(3);
+    fixture.stack->goToCard(1);
+    fixture.stack->updateActiveCard();
+
+    TEST_ASSERT_TRUE(fixture.stack->removeCard(fixture.cards[1]));
+    TEST_ASSERT_EQUAL(0, fixture.stack->getCurrentIndex());
+    fixture.stack->updateActiveCard();
+    TEST_ASSERT_EQUAL(1, fixture.handlers[1].updates);
+    TEST_ASSERT_EQUAL(1, fixture.handlers[0].updates);
+
+    // A card without a handler is ticked without calling anything
+    lv_obj_t* plain = lv_obj_create(lv_screen_active());
+    fixture.stack->addCard(plain);
+    fixture.stack->goToCard(2);
+    TEST_ASSERT_FALSE(fixture.stack->updateActiveCard());
+    TEST_ASSERT_EQUAL(1, fixture.handlers[0].updates);
+    TEST_ASSERT_EQUAL(0, fixture.handlers[2].updates);
+}
+
+void test_per_tick_benchmark() {
+    for (size_t count : { (size_t)5, (size_t)50, (size_t)200 }) {
+        CardStackFixture fixture(count);
+        // The last card is the worst case for a walk of the handler list
+        fixture.stack->goToCard(count - 1);
+        CountingHandler& active = fixture.handlers[count - 1];
+
+        BenchTimer updateTimer;
+        for (uint32_t i = 0; i < BENCH_TICKS; i++) {
+            fixture.stack->updateActiveCard();
+        }
+        double updateNs = updateTimer.elapsedUs() * 1000.0 / BENCH_TICKS;
+
+        BenchTimer pressTimer;
+        for (uint32_t i = 0; i < BENCH_TICKS; i++) {
+            fixture.stack->handleButtonPress(Input::BUTTON_CENTER);
+        }
+        double pressNs = pressTimer.elapsedUs() * 1000.0 / BENCH_TICKS;
+
+        // The lookup updateActiveCard() did before handlers were cached
+        std::vector<std::pair<lv_obj_t*, InputHandler*>> list;
+        for (size_t i = 0; i < count; i++) {
+            list.push_back(std::make_pair(fixture.cards[i], &fixture.handlers[i]));
+        }
+        BenchTimer walkTimer;
+        for (uint32_t i = 0; i < BENCH_TICKS; i++) {
+            lv_obj_t* current = lv_obj_get_child(lv_obj_get_parent(fixture.cards[0]), count - 1);
+            for (const auto& entry : list) {
+                if (entry.first == current) {
+                    entry.second->update();
+                    break;
+                }
+            }
+        }
+        double walkNs = walkTimer.elapsedUs() * 1000.0 / BENCH_TICKS;
+
+        TEST_ASSERT_EQUAL(2 * BENCH_TICKS, active.updates);
+        TEST_ASSERT_EQUAL(BENCH_TICKS, active.presses);
+        printf("CardNavigationStack: %u cards: update %.1f ns/tick, center press %.1f ns; list walk %.1f ns/tick\n",
+               (unsigned)count, updateNs, pressNs, walkNs);
+        if (count == 200) {
+            TEST_ASSERT_TRUE(updateNs < walkNs);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    lv_init();
+    lv_tick_set_cb(tickGet);
+    lv_display_t* display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+    lv_display_set_flush_cb(display, flushDiscard);
+    lv_display_set_buffers(display, drawBuffer, nullptr, sizeof(drawBuffer), LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_update_reaches_only_the_active_card);
+    RUN_TEST(test_unclaimed_buttons_navigate);
+    RUN_TEST(test_reregistering_replaces_the_cached_handler);
+    RUN_TEST(test_removed_card_stops_receiving_updates);
+    RUN_TEST(test_per_tick_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,274 @@
+#include <unity.h>
+#include <Preferences.h>
+#include "test_support.h"
+
+// Built into this suite rather than the shared native sources, since it needs
+// the stubs below
+#include "ConfigManager.cpp"
+
+void SystemController::setApiState(ApiState state) {}
+bool EventQueue::publishEvent(EventType eventType, const String& insightId) { return true; }
+
+static const char* CARD_NAMESPACE = "cards";
+static const size_t TARGET_CARDS = 50;    // The most cards the portal is expected to hold
+
+/**
+ * @brief A manager as main.cpp has it: started once and never destroyed, since its writer task keeps a pointer
+ */
+static ConfigManager* startManager() {
+    ConfigManager* manager = new ConfigManager();
+    manager->begin();
+    return manager;
+}
+
+/**
+ * @brief Cards shaped like the portal's: short insight IDs with a readable name each
+ */
+static std::vector<CardConfig> makeCards(size_t count) {
+    std::vector<CardConfig> cards;
+    for (size_t i = 0; i < count; i++) {
+        if (i % 10 == 9) {
+            cards.emplace_back(CardType::FRIEND, "", (int)i, "Max the hedgehog");
+        } else {
+            cards.emplace_back(CardType::INSIGHT, "aB3dE" + String((unsigned)(100 + i)), (int)i,
+                               "Weekly active users #" + String((unsigned)i));
+        }
+    }
+    return cards;
+}
+
+/**
+ * @brief The "config_list" JSON earlier firmware wrote for these cards
+ */
+static String legacyJson(const std::vector<CardConfig>& cards) {
+    String json = "[";
+    for (size_t i = 0; i < cards.size(); i++) {
+        if (i > 0) json += ",";
+        json += "{\"type\":\"" + cardTypeToString(cards[i].type) + "\",\"config\":\"" + cards[i].config +
+                "\",\"order\":" + String(cards[i].order) + ",\"name\":\"" + cards[i].name + "\"}";
+    }
+    return json + "]";
+}
+
+static void seedLegacyCards(const String& json) {
+    Preferences prefs;
+    prefs.begin(CARD_NAMESPACE);
+    prefs.putString("config_list", json);
+}
+
+static size_t storedCardBytes() {
+    size_t bytes = 0;
+    for (const auto& entry : Preferences::storage(CARD_NAMESPACE)) {
+        bytes += entry.second.size();
+    }
+    return bytes;
+}
+
+static void assertSameCards(const std::vector<CardConfig>& expected, const std::vector<CardConfig>& actual) {
+    TEST_ASSERT_EQUAL(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        TEST_ASSERT_TRUE(expected[i].type == actual[i].type);
+        TEST_ASSERT_EQUAL(expected[i].order, actual[i].order);
+        TEST_ASSERT_EQUAL_STRING(expected[i].config.c_str(), actual[i].config.c_str());
+        TEST_ASSERT_EQUAL_STRING(expected[i].name.c_str(), actual[i].name.c_str());
+    }
+}
+
+void setUp() {
+    Preferences::eraseAll("wifi_config");
+    Preferences::eraseAll(CARD_NAMESPACE);
+    Preferences::eraseAll("insights");
+    Preferences::resetStats();
+}
+
+void tearDown() {}
+
+void test_records_survive_reboot() {
+    std::vector<CardConfig> cards = makeCards(TARGET_CARDS);
+    ConfigManager* first = startManager();
+    first->saveCardConfigs(cards);
+    first->flush();
+
+    ConfigManager* second = startManager();
+    assertSameCards(cards, second->getCardConfigs());
+    TEST_ASSERT_EQUAL(TARGET_CARDS + 1, Preferences::storage(CARD_NAMESPACE).size());
+}
+
+void test_rename_rewrites_one_record() {
+    std::vector<CardConfig> cards = makeCards(TARGET_CARDS);
+    ConfigManager* manager = startManager();
+    manager->saveCardConfigs(cards);
+    manager->flush();
+    Preferences::resetStats();
+
+    TEST_ASSERT_TRUE(manager->updateCardName(CardType::INSIGHT, cards[20].config, "Renamed"));
+    manager->flush();
+    TEST_ASSERT_EQUAL(1, Preferences::stats().writes);
+    TEST_ASSERT_EQUAL(0, Preferences::stats().removes);
+
+    TEST_ASSERT_FALSE(manager->updateCardName(CardType::INSIGHT, "missing", "Nobody"));
+}
+
+void test_removing_cards_drops_their_records() {
+    std::vector<CardConfig> cards = makeCards(TARGET_CARDS);
+    ConfigManager* manager = startManager();
+    manager->saveCardConfigs(cards);
+    manager->flush();
+    Preferences::resetStats();
+
+    cards.resize(TARGET_CARDS - 2);
+    manager->saveCardConfigs(cards);
+    manager->flush();
+
+    // The surviving records are untouched; only the index changes
+    TEST_ASSERT_EQUAL(1, Preferences::stats().writes);
+    TEST_ASSERT_EQUAL(2, Preferences::stats().removes);
+    TEST_ASSERT_EQUAL(0, Preferences::storage(CARD_NAMESPACE).count("card_49"));
+}
+
+void test_damaged_record_is_dropped_and_rewritten() {
+    std::vector<CardConfig> cards = makeCards(5);
+    ConfigManager* first = startManager();
+    first->saveCardConfigs(cards);
+    first->flush();
+
+    Preferences::storage(CARD_NAMESPACE)["card_2"].back() ^= 0xFF;
+
+    ConfigManager* second = startManager();
+    cards.erase(cards.begin() + 2);
+    assertSameCards(cards, second->getCardConfigs());
+
+    // The survivors are written back in order so the slots line up again
+    second->flush();
+    ConfigManager* third = startManager();
+    assertSameCards(cards, third->getCardConfigs());
+    TEST_ASSERT_EQUAL(0, Preferences::storage(CARD_NAMESPACE).count("card_4"));
+}
+
+void test_unknown_card_type_is_dropped() {
+    std::vector<CardConfig> cards = makeCards(4);
+    cards[3].type = LAST_CARD_TYPE;
+    ConfigManager* first = startManager();
+    first->saveCardConfigs(cards);
+    first->flush();
+
+    // A well-formed record whose type is one past the last, as a newer firmware might write
+    const size_t typeOffset = 1;   // CardRecordHeader is packed: version, type, order, lengths, crc
+    const size_t crcOffset = 10;
+    std::vector<uint8_t>& record = Preferences::storage(CARD_NAMESPACE)["card_1"];
+    record[typeOffset] = static_cast<uint8_t>(LAST_CARD_TYPE) + 1;
+    memset(record.data() + crcOffset, 0, sizeof(uint32_t));
+    uint32_t crc = esp_rom_crc32_le(0, record.data(), record.size());
+    memcpy(record.data() + crcOffset, &crc, sizeof(crc));
+
+    ConfigManager* second = startManager();
+    cards.erase(cards.begin() + 1);
+    assertSameCards(cards, second->getCardConfigs());
+}
+
+void test_legacy_list_is_migrated() {
+    std::vector<CardConfig> cards = makeCards(3);
+    seedLegacyCards(legacyJson(cards));
+
+    ConfigManager* manager = startManager();
+    assertSameCards(cards, manager->getCardConfigs());
+    manager->flush();
+
+    Preferences::Namespace& stored = Preferences::storage(CARD_NAMESPACE);
+    TEST_ASSERT_EQUAL(0, stored.count("config_list"));
+    TEST_ASSERT_EQUAL(1, stored.count("cards_idx"));
+    TEST_ASSERT_EQUAL(1, stored.count("card_2"));
+
+    ConfigManager* rebooted = startManager();
+    assertSameCards(cards, rebooted->getCardConfigs());
+}
+
+void test_large_legacy_list_is_migrated() {
+    // Well past the 2 KB document the JSON reader used to parse into
+    std::vector<CardConfig> cards = makeCards(TARGET_CARDS);
+    String json = legacyJson(cards);
+    TEST_ASSERT_GREATER_THAN(2048, json.length());
+    seedLegacyCards(json);
+
+    ConfigManager* manager = startManager();
+    assertSameCards(cards, manager->getCardConfigs());
+    manager->flush();
+    TEST_ASSERT_EQUAL(0, Preferences::storage(CARD_NAMESPACE).count("config_list"));
+}
+
+void test_unreadable_legacy_list_is_kept() {
+    const String truncated = "[{\"type\":\"INSIGHT\",\"config\":\"aB3dE1\",\"ord";
+    seedLegacyCards(truncated);
+    Preferences::resetStats();
+
+    ConfigManager* manager = startManager();
+    TEST_ASSERT_EQUAL(0, manager->getCardConfigs().size());
+    manager->flush();
+
+    // Nothing is written over the only copy of the user's cards
+    Preferences::Namespace& stored = Preferences::storage(CARD_NAMESPACE);
+    TEST_ASSERT_EQUAL(0, Preferences::stats().writes);
+    TEST_ASSERT_EQUAL(0, Preferences::stats().removes);
+    TEST_ASSERT_EQUAL(1, stored.count("config_list"));
+    TEST_ASSERT_EQUAL(0, stored.count("cards_idx"));
+
+    // Cards added afterwards are stored as records alongside it
+    std::vector<CardConfig> cards = makeCards(2);
+    manager->saveCardConfigs(cards);
+    manager->flush();
+    TEST_ASSERT_EQUAL(1, stored.count("config_list"));
+    ConfigManager* rebooted = startManager();
+    assertSameCards(cards, rebooted->getCardConfigs());
+}
+
+void test_fifty_cards_benchmark() {
+    std::vector<CardConfig> cards = makeCards(TARGET_CARDS);
+    String json = legacyJson(cards);
+    ConfigManager* manager = startManager();
+    Preferences::resetStats();
+
+    BenchTimer saveTimer;
+    manager->saveCardConfigs(cards);
+    manager->flush();
+    double saveUs = saveTimer.elapsedUs();
+    Preferences::Stats saved = Preferences::stats();
+    size_t storedBytes = storedCardBytes();
+
+    Preferences::resetStats();
+    BenchTimer loadTimer;
+    ConfigManager* rebooted = startManager();
+    double loadUs = loadTimer.elapsedUs();
+    TEST_ASSERT_EQUAL(TARGET_CARDS, rebooted->getCardConfigs().size());
+
+    printf("ConfigManager: %u cards as JSON would be %u bytes in one key\n",
+           (unsigned)TARGET_CARDS, (unsigned)json.length());
+    printf("ConfigManager: as records %u bytes in %u keys; first save %u writes in %.0f us, boot load %.0f us\n",
+           (unsigned)storedBytes, (unsigned)Preferences::storage(CARD_NAMESPACE).size(),
+           (unsigned)saved.writes, saveUs, loadUs);
+
+    // One write per card plus the index, and no bigger than the JSON it replaces
+    TEST_ASSERT_EQUAL(TARGET_CARDS + 1, saved.writes);
+    TEST_ASSERT_LESS_THAN(json.length(), storedBytes);
+
+    Preferences::resetStats();
+    BenchTimer renameTimer;
+    rebooted->updateCardName(CardType::INSIGHT, cards[0].config, "Renamed");
+    rebooted->flush();
+    printf("ConfigManager: renaming one card wrote %u bytes in %.0f us\n",
+           (unsigned)Preferences::stats().bytesWritten, renameTimer.elapsedUs());
+    TEST_ASSERT_LESS_THAN(64, Preferences::stats().bytesWritten);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_records_survive_reboot);
+    RUN_TEST(test_rename_rewrites_one_record);
+    RUN_TEST(test_removing_cards_drops_their_records);
+    RUN_TEST(test_damaged_record_is_dropped_and_rewritten);
+    RUN_TEST(test_unknown_card_type_is_dropped);
+    RUN_TEST(test_legacy_list_is_migrated);
+    RUN_TEST(test_large_legacy_list_is_migrated);
+    RUN_TEST(test_unreadable_legacy_list_is_kept);
+    RUN_TEST(test_fifty_cards_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,179 @@
+#include <unity.h>
+#include <Preferences.h>
+
+// Built into this suite rather than the shared native sources, since it needs
+// the stubs below
+#include "ConfigManager.cpp"
+
+void SystemController::setApiState(ApiState state) {}
+bool EventQueue::publishEvent(EventType eventType, const String& insightId) { return true; }
+
+static const char* WIFI_NAMESPACE = "wifi_config";
+static const char* CARD_NAMESPACE = "cards";
+static const unsigned long WRITER_SETTLE_MS = 1500;  // The writer's 1 s quiet period plus margin
+
+/**
+ * @brief A manager as main.cpp has it: started once and never destroyed, since its writer task keeps a pointer
+ */
+static ConfigManager* startManager() {
+    ConfigManager* manager = new ConfigManager();
+    manager->begin();
+    return manager;
+}
+
+static void seedConfiguredDevice() {
+    Preferences prefs;
+    prefs.begin(WIFI_NAMESPACE);
+    prefs.putBool("has_creds", true);
+    prefs.putString("ssid", "DeskHog Office");
+    prefs.putString("password", "hunter22");
+    prefs.putInt("team_id", 12345);
+    prefs.putString("api_key", "phx_test");
+    prefs.putString("region", "eu");
+}
+
+static void waitForWriter() {
+    delay(WRITER_SETTLE_MS);
+}
+
+void setUp() {
+    Preferences::eraseAll(WIFI_NAMESPACE);
+    Preferences::eraseAll(CARD_NAMESPACE);
+    Preferences::eraseAll("insights");
+    Preferences::resetStats();
+}
+
+void tearDown() {}
+
+void test_begin_reads_each_key_once() {
+    seedConfiguredDevice();
+    Preferences::resetStats();
+
+    ConfigManager* manager = startManager();
+    uint32_t readsAtBoot = Preferences::stats().reads;
+    TEST_ASSERT_GREATER_THAN(0, readsAtBoot);
+    TEST_ASSERT_EQUAL(0, Preferences::stats().writes);
+
+    // Getters are served from the snapshot
+    String ssid, password;
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(manager->getWiFiCredentials(ssid, password));
+        TEST_ASSERT_EQUAL(12345, manager->getTeamId());
+        TEST_ASSERT_EQUAL_STRING("phx_test", manager->getApiKey().c_str());
+        TEST_ASSERT_EQUAL_STRING("eu", manager->getRegion().c_str());
+        manager->getCardConfigs();
+    }
+    TEST_ASSERT_EQUAL_STRING("DeskHog Office", ssid.c_str());
+    TEST_ASSERT_EQUAL(readsAtBoot, Preferences::stats().reads);
+    printf("ConfigManager: boot read %u keys, 500 getter calls read 0\n", (unsigned)readsAtBoot);
+}
+
+void test_burst_of_saves_is_one_write() {
+    ConfigManager* manager = startManager();
+    Preferences::resetStats();
+
+    for (int i = 0; i < 20; i++) {
+        manager->setTeamId(1000 + i);
+    }
+    // Nothing reaches flash while changes keep arriving
+    TEST_ASSERT_EQUAL(0, Preferences::stats().writes);
+
+    waitForWriter();
+    TEST_ASSERT_EQUAL(1, Preferences::stats().writes);
+
+    Preferences prefs;
+    prefs.begin(WIFI_NAMESPACE);
+    TEST_ASSERT_EQUAL(1019, prefs.getInt("team_id", -1));
+    printf("ConfigManager: 20 saves, %u flash write(s)\n", (unsigned)Preferences::stats().writes);
+}
+
+void test_flush_writes_pending_changes_now() {
+    // What the deep sleep and OTA reboot paths rely on
+    ConfigManager* manager = startManager();
+    Preferences::resetStats();
+
+    manager->setApiKey("phx_rotated");
+    manager->setRegion("us");
+    manager->flush();
+    TEST_ASSERT_EQUAL(2, Preferences::stats().writes);
+
+    Preferences prefs;
+    prefs.begin(WIFI_NAMESPACE);
+    TEST_ASSERT_EQUAL_STRING("phx_rotated", prefs.getString("api_key").c_str());
+
+    // The writer finds nothing left to do
+    waitForWriter();
+    TEST_ASSERT_EQUAL(2, Preferences::stats().writes);
+}
+
+void test_flush_without_changes_writes_nothing() {
+    seedConfiguredDevice();
+    ConfigManager* manager = startManager();
+    Preferences::resetStats();
+
+    manager->flush();
+    TEST_ASSERT_EQUAL(0, Preferences::stats().writes);
+    TEST_ASSERT_EQUAL(0, Preferences::stats().removes);
+}
+
+void test_unchanged_link_hint_is_not_rewritten() {
+    seedConfiguredDevice();
+    ConfigManager* manager = startManager();
+    const uint8_t bssid[6] = { 0x24, 0x0A, 0xC4, 0x01, 0x02, 0x03 };
+
+    manager->saveWiFiLinkHint(bssid, 6);
+    manager->flush();
+    Preferences::resetStats();
+
+    // Every connect reports the access point again; only a change is written
+    for (int i = 0; i < 10; i++) {
+        manager->saveWiFiLinkHint(bssid, 6);
+    }
+    manager->flush();
+    TEST_ASSERT_EQUAL(0, Preferences::stats().writes);
+
+    manager->saveWiFiLinkHint(bssid, 11);
+    manager->flush();
+    TEST_ASSERT_EQUAL(1, Preferences::stats().writes);
+}
+
+void test_changed_credentials_drop_link_hint() {
+    seedConfiguredDevice();
+    ConfigManager* manager = startManager();
+    const uint8_t bssid[6] = { 0x24, 0x0A, 0xC4, 0x01, 0x02, 0x03 };
+    manager->saveWiFiLinkHint(bssid, 6);
+    manager->saveWiFiCredentials("Other Network", "password2");
+    manager->flush();
+
+    uint8_t hintBssid[6];
+    int32_t channel = 0;
+    TEST_ASSERT_FALSE(manager->getWiFiLinkHint(hintBssid, channel));
+    TEST_ASSERT_EQUAL(0, Preferences::storage(WIFI_NAMESPACE).count("wifi_link"));
+}
+
+void test_reboot_sees_flushed_values() {
+    ConfigManager* first = startManager();
+    first->saveWiFiCredentials("DeskHog Office", "hunter22");
+    first->setTeamId(777);
+    first->clearApiKey();
+    first->flush();
+
+    ConfigManager* second = startManager();
+    String ssid, password;
+    TEST_ASSERT_TRUE(second->getWiFiCredentials(ssid, password));
+    TEST_ASSERT_EQUAL_STRING("hunter22", password.c_str());
+    TEST_ASSERT_EQUAL(777, second->getTeamId());
+    TEST_ASSERT_TRUE(second->getApiKey().isEmpty());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_reads_each_key_once);
+    RUN_TEST(test_burst_of_saves_is_one_write);
+    RUN_TEST(test_flush_writes_pending_changes_now);
+    RUN_TEST(test_flush_without_changes_writes_nothing);
+    RUN_TEST(test_unchanged_link_hint_is_not_rewritten);
+    RUN_TEST(test_changed_credentials_drop_link_hint);
+    RUN_TEST(test_reboot_sees_flushed_values);
+    return UNITY_END();
+}
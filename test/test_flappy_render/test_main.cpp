@@ -0,0 +1,120 @@
+#include <unity.h>
+#include <lvgl.h>
+#include "test_support.h"
+
+// Built into this suite rather than the shared native sources, since it
+// needs the buttons array main.cpp defines
+#include "flappy_bird.cpp"
+
+#define NUM_BUTTONS 3
+Bounce2::Button buttons[NUM_BUTTONS];
+
+// The game's labels use LVGL's built-in font; the custom fonts are only built for the device
+const lv_font_t* Style::_label_font = &lv_font_montserrat_14;
+const lv_font_t* Style::_value_font = &lv_font_montserrat_14;
+const lv_font_t* Style::_large_value_font = &lv_font_montserrat_14;
+const lv_font_t* Style::_loud_noises_font = &lv_font_montserrat_14;
+bool Style::_fonts_initialized = true;
+void Style::initFonts() {}
+
+static const uint32_t FRAME_MS = 16;         // About 60 fps from the LVGL task
+static const uint32_t FLAP_EVERY_FRAMES = 33; // 528 ms: each flap climbs about as far as the bird fell since the last
+static const uint32_t PLAY_MS = 4000;        // Both pipes are on screen by the end, neither has reached the bird
+static const uint32_t SCREEN_PX = FB_SCREEN_WIDTH * FB_SCREEN_HEIGHT;
+// Most a frame should redraw: both pipe columns moved by a pixel, and the
+// bird moved by up to 4 px. A full redraw would be SCREEN_PX.
+static const uint32_t MAX_FRAME_PX = 2 * (PIPE_WIDTH + 1) * FB_SCREEN_HEIGHT + BIRD_SIZE * (BIRD_SIZE + 4);
+
+static uint8_t drawBuffer[FB_SCREEN_WIDTH * 10 * 2];
+static lv_display_t* display;
+static uint32_t flushedPx;
+
+static uint32_t tickGet() {
+    return millis();
+}
+
+static void flushCount(lv_display_t* display, const lv_area_t* area, uint8_t* pixels) {
+    flushedPx += lv_area_get_size(area);
+    lv_display_flush_ready(display);
+}
+
+/**
+ * @brief One pass of the LVGL task frameMs after the last: the card's update, then a refresh
+ * @return Pixels sent to the display for this frame
+ */
+static uint32_t frame(FlappyBirdGame& game, uint32_t frameMs = FRAME_MS) {
+    advanceMillis(frameMs);
+    game.loop();
+    buttons[Input::BUTTON_CENTER].update();
+    flushedPx = 0;
+    lv_refr_now(display);
+    return flushedPx;
+}
+
+/**
+ * @brief A game set up on the screen, drawn once and started
+ */
+static FlappyBirdGame* startGame() {
+    FlappyBirdGame* game = new FlappyBirdGame();
+    game->setup(lv_screen_active());
+    lv_refr_now(display);
+    buttons[Input::BUTTON_CENTER].press();
+    frame(*game);   // Also redraws where the start message was
+    TEST_ASSERT_TRUE(game->is_animating());
+    return game;
+}
+
+static void endGame(FlappyBirdGame* game) {
+    game->cleanup();
+    delete game;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_frames_redraw_only_moving_sprites() {
+    FlappyBirdGame* game = startGame();
+
+    uint32_t frames = 0;
+    uint32_t maxPx = 0;
+    uint64_t totalPx = 0;
+    for (uint32_t elapsed = 0; elapsed < PLAY_MS; elapsed += FRAME_MS) {
+        if (frames % FLAP_EVERY_FRAMES == 0) {
+            buttons[Input::BUTTON_CENTER].press();
+        }
+        uint32_t px = frame(*game);
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(MAX_FRAME_PX, px, "A frame redrew more than the sprites that moved");
+        maxPx = px > maxPx ? px : maxPx;
+        totalPx += px;
+        frames++;
+    }
+    TEST_ASSERT_TRUE_MESSAGE(game->is_animating(), "The bird should still be flying");
+
+    uint32_t avgPx = totalPx / frames;
+    TEST_ASSERT_LESS_OR_EQUAL(SCREEN_PX / 10, avgPx);
+    printf("FlappyBird: %u frames at %u ms, avg %u px redrawn (%u%% of screen), max %u px (%u%%)\n",
+           frames, FRAME_MS, avgPx, avgPx * 100 / SCREEN_PX, maxPx, maxPx * 100 / SCREEN_PX);
+    endGame(game);
+}
+
+void test_frame_without_a_whole_pixel_of_motion_redraws_nothing() {
+    FlappyBirdGame* game = startGame();
+    frame(*game);
+
+    // No time has passed, so no tick ran and nothing moved
+    TEST_ASSERT_EQUAL(0, frame(*game, 0));
+    endGame(game);
+}
+
+int main(int argc, char** argv) {
+    lv_init();
+    lv_tick_set_cb(tickGet);
+    display = lv_display_create(FB_SCREEN_WIDTH, FB_SCREEN_HEIGHT);
+    lv_display_set_flush_cb(display, flushCount);
+    lv_display_set_buffers(display, drawBuffer, nullptr, sizeof(drawBuffer), LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_redraw_only_moving_sprites);
+    RUN_TEST(test_frame_without_a_whole_pixel_of_motion_redraws_nothing);
+    return UNITY_END();
+}
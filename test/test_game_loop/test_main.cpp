@@ -0,0 +1,222 @@
+#include <unity.h>
+#include <cstdlib>
+#include <initializer_list>
+#include "game/GameLoop.h"
+#include "game/PaddleGame.h"
+
+static const int16_t PLAY_WIDTH = 240;     // The card's play area on the 240x135 display
+static const int16_t PLAY_HEIGHT = 135;
+static const unsigned SEED = 1234;
+
+struct GameResult {
+    PaddleGame::GameState state;
+    int playerScore;
+    int aiScore;
+    Coordinates ball;
+    Coordinates player;
+    Coordinates ai;
+};
+
+/**
+ * @brief Play from a fixed seed for duration_ms, with frames spaced by nextFrame()
+ *
+ * The last frame always lands on duration_ms, so every run simulates the same
+ * number of ticks however the frames in between fell.
+ */
+template <typename NextFrame>
+static GameResult play(uint32_t start_ms, uint32_t duration_ms, bool holdDown, NextFrame nextFrame) {
+    srand(SEED);
+    PaddleGame game(PLAY_WIDTH, PLAY_HEIGHT);
+    if (holdDown) {
+        game.movePlayerPaddle(false, true);
+    }
+
+    uint32_t end_ms = start_ms + duration_ms;
+    for (uint32_t now = start_ms; now - start_ms < duration_ms; now += nextFrame()) {
+        game.update(now);
+    }
+    game.update(end_ms);
+
+    GameResult result = { game.getState(), game.getPlayerScore(), game.getAiScore(),
+                          game.getBallCoordinates(), game.getPlayerPaddleCoordinates(),
+                          game.getAiPaddleCoordinates() };
+    return result;
+}
+
+static void assertSameResult(const GameResult& expected, const GameResult& actual) {
+    TEST_ASSERT_TRUE(expected.state == actual.state);
+    TEST_ASSERT_EQUAL(expected.playerScore, actual.playerScore);
+    TEST_ASSERT_EQUAL(expected.aiScore, actual.aiScore);
+    TEST_ASSERT_EQUAL(expected.ball.x, actual.ball.x);
+    TEST_ASSERT_EQUAL(expected.ball.y, actual.ball.y);
+    TEST_ASSERT_EQUAL(expected.player.y, actual.player.y);
+    TEST_ASSERT_EQUAL(expected.ai.y, actual.ai.y);
+}
+
+static void checkSameResultAtAnyFrameRate(uint32_t duration) {
+    GameResult reference = play(0, duration, false, []() { return 10u; });
+    // Long enough to serve and score, so this exercises more than the serve delay
+    TEST_ASSERT_GREATER_THAN(0, reference.playerScore + reference.aiScore);
+
+    for (uint32_t frame : { 5u, 16u, 33u, 47u }) {
+        GameResult result = play(0, duration, false, [frame]() { return frame; });
+        assertSameResult(reference, result);
+    }
+
+    // Uneven frames, as when the UI queue is busy
+    uint32_t lcg = 42;
+    GameResult jittered = play(0, duration, false, [&lcg]() {
+        lcg = lcg * 1664525u + 1013904223u;
+        return 1 + (lcg >> 16) % 45;
+    });
+    assertSameResult(reference, jittered);
+    printf("PaddleGame: after %u s at 5-47 ms frames: player %d, AI %d, ball at %d,%d\n",
+           (unsigned)(duration / 1000), reference.playerScore, reference.aiScore,
+           reference.ball.x, reference.ball.y);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_fixed_point_helpers() {
+    TEST_ASSERT_EQUAL(3 * FIXED_ONE, intToFixed(3));
+    TEST_ASSERT_EQUAL(FIXED_ONE / 2, floatToFixed(0.5f));
+    TEST_ASSERT_EQUAL(-FIXED_ONE / 4, floatToFixed(-0.25f));
+    // Rounds towards negative infinity, so motion is smooth across zero
+    TEST_ASSERT_EQUAL(0, fixedToInt(FIXED_ONE - 1));
+    TEST_ASSERT_EQUAL(-1, fixedToInt(-1));
+    TEST_ASSERT_EQUAL(intToFixed(15), lerpFixed(intToFixed(10), intToFixed(20), FIXED_ONE / 2));
+    TEST_ASSERT_EQUAL(intToFixed(10), lerpFixed(intToFixed(10), intToFixed(20), 0));
+}
+
+void test_advance_counts_whole_ticks() {
+    GameLoop loop;
+    TEST_ASSERT_EQUAL(0, loop.advance(1000));   // The first call only starts the clock
+    TEST_ASSERT_EQUAL(2, loop.advance(1025));
+    TEST_ASSERT_EQUAL(FIXED_ONE / 2, loop.alpha());
+    TEST_ASSERT_EQUAL(1, loop.advance(1030));
+    TEST_ASSERT_EQUAL(0, loop.alpha());
+    TEST_ASSERT_EQUAL(0, loop.advance(1039));
+    TEST_ASSERT_EQUAL(3, loop.ticks());
+}
+
+void test_stall_runs_at_most_catch_up_ticks() {
+    GameLoop loop;
+    loop.advance(0);
+    TEST_ASSERT_EQUAL(GameLoop::MAX_CATCH_UP_TICKS, loop.advance(1003));
+    // The backlog is dropped, not carried into later frames
+    TEST_ASSERT_EQUAL(0, loop.advance(1006));
+    TEST_ASSERT_EQUAL(1, loop.advance(1013));
+}
+
+void test_reset_discards_idle_time() {
+    GameLoop loop;
+    loop.advance(0);
+    loop.advance(4);
+    loop.reset(5000);
+    TEST_ASSERT_EQUAL(0, loop.alpha());
+    TEST_ASSERT_EQUAL(1, loop.advance(5010));
+}
+
+void test_millis_wraparound() {
+    GameLoop loop;
+    loop.advance(0xFFFFFFF0u);
+    TEST_ASSERT_EQUAL(3, loop.advance(0x00000010u));   // 32 ms across the wrap
+}
+
+void test_paddle_same_result_at_any_frame_rate() {
+    // Mid-game, and a minute in once the game has been won
+    for (uint32_t duration : { 20000u, 60000u }) {
+        checkSameResultAtAnyFrameRate(duration);
+    }
+}
+
+
+void test_paddle_input_same_at_any_frame_rate() {
+    GameResult reference = play(0, 3000, true, []() { return 10u; });
+    TEST_ASSERT_EQUAL(PLAY_HEIGHT - PaddleGame::PADDLE_HEIGHT, reference.player.y);
+    for (uint32_t frame : { 5u, 16u, 33u }) {
+        assertSameResult(reference, play(0, 3000, true, [frame]() { return frame; }));
+    }
+}
+
+void test_paddle_speed_is_per_tick_not_per_frame() {
+    // Held for 50 ms from the centre: five ticks of 6 px, however many frames.
+    // Drawing interpolates from the previous tick, so at a tick boundary the
+    // paddle is shown where the last tick started.
+    for (uint32_t frame : { 5u, 10u, 25u, 50u }) {
+        srand(SEED);
+        PaddleGame game(PLAY_WIDTH, PLAY_HEIGHT);
+        game.setState(PaddleGame::GameState::Playing);   // Skip the serve delay
+        int16_t startY = game.getPlayerPaddleCoordinates().y;
+        game.update(0);
+        game.movePlayerPaddle(false, true);
+        for (uint32_t now = frame; now <= 50; now += frame) {
+            game.update(now);
+        }
+        TEST_ASSERT_EQUAL(startY + 24, game.getPlayerPaddleCoordinates().y);
+    }
+}
+
+void test_paddle_speed_matches_tuned_rate() {
+    // Tuned at 3 px per 5 ms pass of the LVGL task: 600 px/s whatever the tick
+    srand(SEED);
+    PaddleGame game(PLAY_WIDTH, PLAY_HEIGHT);
+    game.setState(PaddleGame::GameState::Playing);
+    int16_t startY = game.getPlayerPaddleCoordinates().y;
+    game.update(0);
+    game.movePlayerPaddle(false, true);
+    game.update(40);
+    game.update(50);   // Shown where the fifth tick started: 40 ms of motion
+    TEST_ASSERT_EQUAL(startY + 3 * 40 / TUNED_PASS_MS, game.getPlayerPaddleCoordinates().y);
+}
+
+void test_paused_game_does_not_catch_up() {
+    srand(SEED);
+    PaddleGame game(PLAY_WIDTH, PLAY_HEIGHT);
+    for (uint32_t now = 0; now <= 2000; now += 10) {   // Past the serve, so the ball is moving
+        game.update(now);
+    }
+    Coordinates before = game.getBallCoordinates();
+
+    game.setState(PaddleGame::GameState::Paused);
+    game.update(10000);
+    game.setState(PaddleGame::GameState::Playing);
+    game.update(10000);
+    Coordinates after = game.getBallCoordinates();
+    TEST_ASSERT_EQUAL(before.x, after.x);
+    TEST_ASSERT_EQUAL(before.y, after.y);
+}
+
+void test_interpolated_position_between_ticks() {
+    srand(SEED);
+    PaddleGame game(PLAY_WIDTH, PLAY_HEIGHT);
+    game.setState(PaddleGame::GameState::Playing);
+    int16_t startY = game.getPlayerPaddleCoordinates().y;
+    game.update(0);
+    game.movePlayerPaddle(false, true);
+    game.update(10);     // One tick of 6 px, drawn from where it started
+    TEST_ASSERT_EQUAL(startY, game.getPlayerPaddleCoordinates().y);
+    game.update(15);     // Halfway on: 3 px
+    TEST_ASSERT_EQUAL(startY + 3, game.getPlayerPaddleCoordinates().y);
+    game.update(20);
+    TEST_ASSERT_EQUAL(startY + 6, game.getPlayerPaddleCoordinates().y);
+    game.update(29);     // 6 + 0.9 * 6 px
+    TEST_ASSERT_EQUAL(startY + 11, game.getPlayerPaddleCoordinates().y);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fixed_point_helpers);
+    RUN_TEST(test_advance_counts_whole_ticks);
+    RUN_TEST(test_stall_runs_at_most_catch_up_ticks);
+    RUN_TEST(test_reset_discards_idle_time);
+    RUN_TEST(test_millis_wraparound);
+    RUN_TEST(test_paddle_same_result_at_any_frame_rate);
+    RUN_TEST(test_paddle_input_same_at_any_frame_rate);
+    RUN_TEST(test_paddle_speed_is_per_tick_not_per_frame);
+    RUN_TEST(test_paddle_speed_matches_tuned_rate);
+    RUN_TEST(test_paused_game_does_not_catch_up);
+    RUN_TEST(test_interpolated_position_between_ticks);
+    return UNITY_END();
+}
@@ -0,0 +1,2 @@
+// One font per translation unit: the generated files share static names
+#include "fonts/font_label.c"
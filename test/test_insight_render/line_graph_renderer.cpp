@@ -0,0 +1,3 @@
+// Each renderer keeps its RenderProfiler::Profile in a file-scope static of the
+// same name, so each is built in a translation unit of its own
+#include "ui/renderers/LineGraphRenderer.cpp"
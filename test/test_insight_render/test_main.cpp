@@ -0,0 +1,349 @@
+#include <unity.h>
+#include <lvgl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <functional>
+#include <vector>
+#include "test_support.h"
+
+// Built into this suite rather than the shared native sources, since the
+// renderers need Style's fonts and globalUIDispatch. Each renderer is built
+// in its own file of this suite (their profiles share a name).
+#include "posthog/parsers/InsightParser.cpp"
+#include "ui/RenderProfiler.cpp"
+#include "ui/renderers/NumericCardRenderer.h"
+#include "ui/renderers/LineGraphRenderer.h"
+#include "ui/renderers/FunnelRenderer.h"
+
+// The device fonts, built from include/fonts by the font_*.c files of this suite
+const lv_font_t* Style::_label_font = &font_label;
+const lv_font_t* Style::_value_font = &font_value;
+const lv_font_t* Style::_large_value_font = &font_value_large;
+const lv_font_t* Style::_loud_noises_font = &font_value;
+bool Style::_fonts_initialized = true;
+void Style::initFonts() {}
+
+// Updates the renderers dispatch, run by runUIQueue() the way processUIQueue() would
+static std::vector<std::function<void()>> uiQueue;
+std::function<void(std::function<void()>, bool)> globalUIDispatch =
+    [](std::function<void()> func, bool to_front) {
+        if (to_front) {
+            uiQueue.insert(uiQueue.begin(), std::move(func));
+        } else {
+            uiQueue.push_back(std::move(func));
+        }
+    };
+
+static const int32_t SCREEN_W = 240;
+static const int32_t SCREEN_H = 135;
+static const uint32_t SCREEN_PX = SCREEN_W * SCREEN_H;
+
+// Thresholds. Render time is host time, so the budget only catches a
+// renderer that got an order of magnitude slower; the device is far slower.
+static const uint32_t RENDER_BUDGET_US = RenderProfiler::REFRESH_BUDGET_US;
+// LVGL heap a card may hold. The device pool is 32 KB for the whole UI, and
+// host pointers are twice the size, so this is roughly a quarter of it there.
+static const uint32_t CARD_MEM_MAX = 16 * 1024;
+// Growth over the recorded baseline that fails the suite
+static const uint32_t MEM_REGRESSION_PCT = 10;
+static const uint32_t INVALIDATED_REGRESSION_PCT = 10;
+// Golden comparison: a pixel differs when a channel is off by more than
+// two RGB565 steps, and at most this share of the screen may differ
+static const int GOLDEN_CHANNEL_TOLERANCE = 16;
+static const uint32_t GOLDEN_MAX_DIFF_PX = SCREEN_PX / 200;
+
+static uint8_t drawBuffer[SCREEN_W * 10 * 2];
+static uint16_t panel[SCREEN_W * SCREEN_H];     ///< What the panel shows, RGB565
+static lv_display_t* display;
+static uint32_t flushedPx;
+
+static uint32_t tickGet() {
+    return millis();
+}
+
+static void flushToPanel(lv_display_t* display, const lv_area_t* area, uint8_t* pixels) {
+    int32_t width = lv_area_get_width(area);
+    const uint16_t* source = reinterpret_cast<const uint16_t*>(pixels);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&panel[y * SCREEN_W + area->x1], source, width * sizeof(uint16_t));
+        source += width;
+    }
+    flushedPx += lv_area_get_size(area);
+    lv_display_flush_ready(display);
+}
+
+static void runUIQueue() {
+    std::vector<std::function<void()>> pending;
+    pending.swap(uiQueue);
+    for (auto& func : pending) {
+        func();
+    }
+}
+
+static uint32_t lvglMemUsed() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+/**
+ * @brief What one card cost to show
+ */
+struct RenderResult {
+    uint32_t updateUs;          ///< Running the renderer's dispatched update
+    uint32_t refreshUs;         ///< The display refresh that followed
+    uint32_t memBytes;          ///< LVGL heap held by the card once shown
+    uint32_t invalidatedPx;     ///< As RenderProfiler reports it for the update
+    uint32_t flushedPx;         ///< Pixels the update's refresh sent to the panel
+};
+
+/**
+ * @brief Card, title and content container laid out the way InsightCard does
+ * @return The content container the renderer draws into
+ */
+static lv_obj_t* createCard(lv_obj_t* card, const char* title) {
+    lv_obj_set_size(card, SCREEN_W, SCREEN_H);
+    lv_obj_set_style_bg_color(card, Style::backgroundColor(), 0);
+    lv_obj_set_style_pad_all(card, 0, 0);
+    lv_obj_set_style_border_width(card, 0, 0);
+    lv_obj_set_style_radius(card, 0, 0);
+
+    lv_obj_t* flex_col = lv_obj_create(card);
+    lv_obj_set_size(flex_col, lv_pct(100), lv_pct(100));
+    lv_obj_set_style_pad_all(flex_col, 5, 0);
+    lv_obj_set_style_pad_row(flex_col, 5, 0);
+    lv_obj_set_flex_flow(flex_col, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_flex_align(flex_col, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_clear_flag(flex_col, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_opa(flex_col, LV_OPA_0, 0);
+    lv_obj_set_style_border_width(flex_col, 0, 0);
+
+    lv_obj_t* title_label = lv_label_create(flex_col);
+    lv_obj_set_width(title_label, lv_pct(100));
+    lv_obj_set_style_text_color(title_label, Style::labelColor(), 0);
+    lv_obj_set_style_text_font(title_label, Style::labelFont(), 0);
+    lv_label_set_long_mode(title_label, LV_LABEL_LONG_DOT);
+    lv_label_set_text(title_label, title);
+
+    lv_obj_t* content = lv_obj_create(flex_col);
+    lv_obj_set_width(content, lv_pct(100));
+    lv_obj_set_flex_grow(content, 1);
+    lv_obj_set_style_bg_opa(content, LV_OPA_0, 0);
+    lv_obj_set_style_border_width(content, 0, 0);
+    lv_obj_set_style_pad_all(content, 0, 0);
+    return content;
+}
+
+/**
+ * @brief Latest render_invalidated_pixels for a renderer's profile
+ */
+static uint32_t reportedInvalidatedPx(const char* profile) {
+    for (size_t i = 0; i < Metrics::renderInvalidatedPx.seriesCount(); i++) {
+        if (strcmp(Metrics::renderInvalidatedPx.seriesLabel(i), profile) == 0) {
+            return Metrics::renderInvalidatedPx.value(i);
+        }
+    }
+    TEST_FAIL_MESSAGE("The renderer reported no invalidated area");
+    return 0;
+}
+
+/**
+ * @brief Show a fixture the way InsightCard does on a rebuild, then tear it down
+ *
+ * Creates the renderer's elements, refreshes, passes it the parsed fixture
+ * and runs the update it dispatches, then refreshes again. panel holds the
+ * finished card when this returns.
+ */
+static RenderResult renderCard(InsightRendererBase& renderer, const char* fixture, const char* profile) {
+    std::string json = loadTestData(fixture);
+    TEST_ASSERT_FALSE_MESSAGE(json.empty(), fixture);
+    InsightParser parser(json.c_str());
+    TEST_ASSERT_TRUE_MESSAGE(parser.isValid(), fixture);
+
+    char title[64] = "";
+    parser.getName(title, sizeof(title));
+    char prefix[16] = "";
+    char suffix[16] = "";
+    if (parser.getInsightType() == InsightParser::InsightType::NUMERIC_CARD) {
+        parser.getNumericFormattingPrefix(prefix, sizeof(prefix));
+        parser.getNumericFormattingSuffix(suffix, sizeof(suffix));
+    }
+
+    RenderResult result = {};
+    uint32_t memBefore = lvglMemUsed();
+    lv_obj_t* card = lv_obj_create(lv_screen_active());
+    lv_obj_t* content = createCard(card, title);
+    renderer.createElements(content);
+    lv_obj_invalidate(content);
+    lv_refr_now(display);
+
+    renderer.updateDisplay(parser, String(title), prefix, suffix);
+    BenchTimer update;
+    runUIQueue();
+    result.updateUs = (uint32_t)update.elapsedUs();
+
+    flushedPx = 0;
+    BenchTimer refresh;
+    lv_refr_now(display);
+    result.refreshUs = (uint32_t)refresh.elapsedUs();
+    result.flushedPx = flushedPx;
+    result.memBytes = lvglMemUsed() - memBefore;
+    result.invalidatedPx = reportedInvalidatedPx(profile);
+
+    renderer.clearElements();
+    lv_obj_delete(card);
+    lv_refr_now(display);
+    return result;
+}
+
+static bool recording() {
+    const char* record = getenv("RENDER_RECORD");
+    return record && record[0] && strcmp(record, "0") != 0;
+}
+
+static std::string renderPath(const char* name, const char* extension) {
+    return std::string(TEST_DATA_DIR) + "/render/" + name + extension;
+}
+
+/**
+ * @brief The panel as a binary PPM, 8 bits a channel
+ */
+static std::string panelToPpm() {
+    char header[32];
+    int headerLen = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", (int)SCREEN_W, (int)SCREEN_H);
+    std::string ppm(header, headerLen);
+    ppm.reserve(headerLen + SCREEN_PX * 3);
+    for (uint32_t i = 0; i < SCREEN_PX; i++) {
+        uint16_t c = panel[i];
+        uint8_t r = (c >> 11) & 0x1F;
+        uint8_t g = (c >> 5) & 0x3F;
+        uint8_t b = c & 0x1F;
+        ppm += (char)((r << 3) | (r >> 2));
+        ppm += (char)((g << 2) | (g >> 4));
+        ppm += (char)((b << 3) | (b >> 2));
+    }
+    return ppm;
+}
+
+static bool writeFile(const std::string& path, const std::string& contents) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool ok = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    return fclose(file) == 0 && ok;
+}
+
+/**
+ * @brief Pixels whose color differs from the golden image beyond the tolerance
+ */
+static uint32_t countDifferingPx(const std::string& golden, const std::string& actual) {
+    TEST_ASSERT_EQUAL_MESSAGE(golden.size(), actual.size(), "Golden image has a different size or header");
+    size_t header = actual.size() - SCREEN_PX * 3;
+    uint32_t differing = 0;
+    for (size_t i = header; i + 2 < actual.size(); i += 3) {
+        for (size_t c = 0; c < 3; c++) {
+            if (abs((int)(uint8_t)golden[i + c] - (int)(uint8_t)actual[i + c]) > GOLDEN_CHANNEL_TOLERANCE) {
+                differing++;
+                break;
+            }
+        }
+    }
+    return differing;
+}
+
+/**
+ * @brief Baseline metrics recorded with the golden image, "<key> <value>" a line
+ */
+static bool loadBaseline(const char* name, uint32_t* memBytes, uint32_t* invalidatedPx) {
+    std::string text = loadTestData((std::string("render/") + name + ".metrics").c_str());
+    return sscanf(text.c_str(), "mem_bytes %u\ninvalidated_px %u", memBytes, invalidatedPx) == 2;
+}
+
+/**
+ * @brief Check a render against the thresholds, its baseline and its golden image
+ *
+ * With RENDER_RECORD set, records the image and baseline instead. Without a
+ * golden image the thresholds are still enforced and the test is ignored.
+ */
+static void checkRender(const char* name, const RenderResult& result) {
+    printf("InsightRender: %s update %u us, refresh %u us, LVGL heap %u bytes, "
+           "invalidated %u px (%u%% of screen), flushed %u px\n",
+           name, result.updateUs, result.refreshUs, result.memBytes,
+           result.invalidatedPx, result.invalidatedPx * 100 / SCREEN_PX, result.flushedPx);
+
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(RENDER_BUDGET_US, result.updateUs + result.refreshUs,
+                                      "Update and refresh took longer than a 30 fps frame");
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(CARD_MEM_MAX, result.memBytes, "Card holds too much LVGL heap");
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, result.flushedPx, "The update drew nothing");
+
+    std::string image = panelToPpm();
+    if (recording()) {
+        char metrics[64];
+        snprintf(metrics, sizeof(metrics), "mem_bytes %u\ninvalidated_px %u\n", result.memBytes, result.invalidatedPx);
+        mkdir((std::string(TEST_DATA_DIR) + "/render").c_str(), 0755);
+        TEST_ASSERT_TRUE(writeFile(renderPath(name, ".ppm"), image));
+        TEST_ASSERT_TRUE(writeFile(renderPath(name, ".metrics"), metrics));
+        TEST_IGNORE_MESSAGE("Recorded the golden image and baseline");
+    }
+
+    uint32_t baseMem, baseInvalidated;
+    if (loadBaseline(name, &baseMem, &baseInvalidated)) {
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(baseMem + baseMem * MEM_REGRESSION_PCT / 100, result.memBytes,
+                                          "LVGL heap regressed against the baseline");
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(baseInvalidated + baseInvalidated * INVALIDATED_REGRESSION_PCT / 100,
+                                          result.invalidatedPx, "Invalidated area regressed against the baseline");
+    }
+
+    std::string golden = loadTestData((std::string("render/") + name + ".ppm").c_str());
+    if (golden.empty()) {
+        TEST_IGNORE_MESSAGE("No golden image; run with RENDER_RECORD=1 to record one");
+    }
+    uint32_t differing = countDifferingPx(golden, image);
+    if (differing > GOLDEN_MAX_DIFF_PX) {
+        std::string actualPath = std::string("/tmp/") + name + "_actual.ppm";
+        writeFile(actualPath, image);
+        printf("InsightRender: %s differs from its golden image in %u px; this render is at %s\n",
+               name, differing, actualPath.c_str());
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(GOLDEN_MAX_DIFF_PX, differing, "Render differs from the golden image");
+}
+
+void setUp() {
+    uiQueue.clear();
+}
+
+void tearDown() {}
+
+void test_numeric_card() {
+    NumericCardRenderer renderer;
+    checkRender("numeric", renderCard(renderer, "posthog_insight_number.json", "numeric"));
+}
+
+void test_line_graph_card() {
+    LineGraphRenderer renderer;
+    checkRender("line_graph", renderCard(renderer, "posthog_insight_line_graph.json", "line_graph"));
+}
+
+void test_funnel_card() {
+    FunnelRenderer renderer;
+    checkRender("funnel", renderCard(renderer, "posthog_insight_funnel.json", "funnel"));
+}
+
+int main(int argc, char** argv) {
+    lv_init();
+    lv_tick_set_cb(tickGet);
+    display = lv_display_create(SCREEN_W, SCREEN_H);
+    lv_display_set_flush_cb(display, flushToPanel);
+    lv_display_set_buffers(display, drawBuffer, nullptr, sizeof(drawBuffer), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(lv_screen_active(), LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(lv_screen_active(), 0, 0);
+    RenderProfiler::attach(display);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_numeric_card);
+    RUN_TEST(test_line_graph_card);
+    RUN_TEST(test_funnel_card);
+    return UNITY_END();
+}
@@ -0,0 +1,302 @@
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "network/JsonStreamExtractor.h"
+#include "test_support.h"
+
+using ValueType = JsonStreamExtractor::ValueType;
+
+static const char* SPECIES_FIXTURE = "pokeapi_species_25.json";
+static const char* EXPECTED_FLAVOR_TEXT =
+    "It has small electric sacs on both its\ncheeks. If threatened, it looses electric\n"
+    "charges from the sacs.";
+
+struct Species {
+    std::string name;
+    std::string description;
+    size_t bytesRead = 0;
+    bool stopped = false;
+};
+
+// Same selection as PokeAPIClient::parseSpeciesStream: the root name and the
+// first flavor text whose entry turns out to be English
+static Species extractSpecies(const std::string& json, size_t chunkSize) {
+    Species result;
+    std::string candidate;
+    bool candidateIsEnglish = false;
+
+    JsonStreamExtractor extractor;
+    extractor.onValue([&](const char* path, const char* value, ValueType type) {
+        if (type != ValueType::STRING) {
+            return true;
+        }
+        if (result.name.empty() && strcmp(path, "name") == 0) {
+            result.name = value;
+        } else if (result.description.empty() && strcmp(path, "flavor_text_entries[].flavor_text") == 0) {
+            candidate = value;
+        } else if (result.description.empty() && strcmp(path, "flavor_text_entries[].language.name") == 0) {
+            candidateIsEnglish = strcmp(value, "en") == 0;
+        }
+        return result.name.empty() || result.description.empty();
+    });
+    extractor.onObjectEnd([&](const char* path) {
+        if (result.description.empty() && strcmp(path, "flavor_text_entries[]") == 0) {
+            if (candidateIsEnglish) {
+                result.description = candidate;
+            }
+            candidate.clear();
+            candidateIsEnglish = false;
+        }
+        return result.name.empty() || result.description.empty();
+    });
+
+    MemoryStream stream(json, chunkSize);
+    result.bytesRead = extractor.parseStream(stream, (int)json.size(), 100);
+    result.stopped = extractor.isStopped();
+    return result;
+}
+
+struct Collected {
+    std::vector<std::string> paths;
+    std::vector<std::string> values;
+    std::vector<ValueType> types;
+    std::vector<std::string> objectEnds;
+};
+
+static bool feedAll(JsonStreamExtractor& extractor, Collected& out, const std::string& json) {
+    extractor.onValue([&](const char* path, const char* value, ValueType type) {
+        out.paths.push_back(path);
+        out.values.push_back(value);
+        out.types.push_back(type);
+        return true;
+    });
+    extractor.onObjectEnd([&](const char* path) {
+        out.objectEnds.push_back(path);
+        return true;
+    });
+    return extractor.feed((const uint8_t*)json.data(), json.size());
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_species_fixture_any_chunk_size() {
+    std::string json = loadTestData(SPECIES_FIXTURE);
+    TEST_ASSERT_TRUE_MESSAGE(json.size() > 0, "species fixture missing");
+
+    for (size_t chunk : { (size_t)1, (size_t)3, (size_t)7, (size_t)64, JsonStreamExtractor::READ_CHUNK_SIZE }) {
+        Species species = extractSpecies(json, chunk);
+        TEST_ASSERT_EQUAL_STRING("pikachu", species.name.c_str());
+        TEST_ASSERT_EQUAL_STRING(EXPECTED_FLAVOR_TEXT, species.description.c_str());
+        TEST_ASSERT_TRUE(species.stopped);
+    }
+}
+
+void test_stops_reading_once_fields_found() {
+    // Root name first: the extractor should stop at the first English entry
+    std::string json =
+        "{\"name\":\"bulbasaur\",\"flavor_text_entries\":["
+        "{\"flavor_text\":\"Une graine\",\"language\":{\"name\":\"fr\"}},"
+        "{\"flavor_text\":\"A strange seed\",\"language\":{\"name\":\"en\"}},"
+        "{\"flavor_text\":\"never read\",\"language\":{\"name\":\"en\"}}"
+        "],\"padding\":\"" + std::string(4000, 'x') + "\"}";
+
+    Species species = extractSpecies(json, 16);
+    TEST_ASSERT_EQUAL_STRING("bulbasaur", species.name.c_str());
+    TEST_ASSERT_EQUAL_STRING("A strange seed", species.description.c_str());
+    TEST_ASSERT_TRUE(species.stopped);
+    TEST_ASSERT_LESS_THAN(json.size() / 2, species.bytesRead);
+}
+
+void test_nested_name_is_not_root_name() {
+    std::string json = "{\"color\":{\"name\":\"green\"},\"names\":[{\"name\":\"Bisasam\"}],\"name\":\"bulbasaur\"}";
+    JsonStreamExtractor extractor;
+    Collected out;
+    TEST_ASSERT_FALSE(feedAll(extractor, out, json));
+    TEST_ASSERT_TRUE(extractor.isComplete());
+
+    TEST_ASSERT_EQUAL(3, out.paths.size());
+    TEST_ASSERT_EQUAL_STRING("color.name", out.paths[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("names[].name", out.paths[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("name", out.paths[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("bulbasaur", out.values[2].c_str());
+
+    // The root object closes last, with an empty path
+    TEST_ASSERT_EQUAL(3, out.objectEnds.size());
+    TEST_ASSERT_EQUAL_STRING("color", out.objectEnds[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("names[]", out.objectEnds[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("", out.objectEnds[2].c_str());
+}
+
+void test_literal_types() {
+    std::string json = "{\"a\":-1.5e3,\"b\":true,\"c\":false,\"d\":null,\"e\":[1,[],{}],\"f\":0}";
+    JsonStreamExtractor extractor;
+    Collected out;
+    feedAll(extractor, out, json);
+    TEST_ASSERT_TRUE(extractor.isComplete());
+
+    TEST_ASSERT_EQUAL(6, out.values.size());
+    TEST_ASSERT_EQUAL_STRING("-1.5e3", out.values[0].c_str());
+    TEST_ASSERT_TRUE(out.types[0] == ValueType::NUMBER);
+    TEST_ASSERT_TRUE(out.types[1] == ValueType::BOOLEAN);
+    TEST_ASSERT_TRUE(out.types[2] == ValueType::BOOLEAN);
+    TEST_ASSERT_TRUE(out.types[3] == ValueType::NULL_VALUE);
+    TEST_ASSERT_EQUAL_STRING("e[]", out.paths[4].c_str());
+    TEST_ASSERT_EQUAL_STRING("f", out.paths[5].c_str());
+}
+
+void test_string_escapes_decode_to_utf8() {
+    std::string json = "{\"s\":\"q\\\"b\\\\s\\/n\\n\\u00e9\\u30d4\\ud83d\\ude00\\udc00\"}";
+    JsonStreamExtractor extractor;
+    Collected out;
+    feedAll(extractor, out, json);
+    TEST_ASSERT_TRUE(extractor.isComplete());
+    TEST_ASSERT_EQUAL(1, out.values.size());
+    // Lone low surrogate becomes U+FFFD
+    TEST_ASSERT_EQUAL_STRING("q\"b\\s/n\n\xC3\xA9\xE3\x83\x94\xF0\x9F\x98\x80\xEF\xBF\xBD", out.values[0].c_str());
+}
+
+void test_long_values_are_truncated() {
+    std::string longText(1000, 'a');
+    std::string json = "{\"t\":\"" + longText + "\",\"after\":1}";
+    JsonStreamExtractor extractor;
+    Collected out;
+    feedAll(extractor, out, json);
+    TEST_ASSERT_TRUE(extractor.isComplete());
+    TEST_ASSERT_EQUAL(JsonStreamExtractor::MAX_VALUE_LENGTH - 1, out.values[0].size());
+    TEST_ASSERT_EQUAL_STRING("after", out.paths[1].c_str());
+}
+
+void test_overlong_paths_are_skipped() {
+    std::string key(JsonStreamExtractor::MAX_PATH_LENGTH + 10, 'k');
+    std::string json = "{\"" + key + "\":{\"inner\":1},\"short\":2}";
+    JsonStreamExtractor extractor;
+    Collected out;
+    feedAll(extractor, out, json);
+    TEST_ASSERT_TRUE(extractor.isComplete());
+
+    // Nothing under the truncated path is reported, and the path recovers afterwards
+    TEST_ASSERT_EQUAL(1, out.paths.size());
+    TEST_ASSERT_EQUAL_STRING("short", out.paths[0].c_str());
+}
+
+void test_malformed_input_is_an_error() {
+    const char* bad[] = {
+        "{\"a\":[1,}",
+        "{\"a\" 1}",
+        "{\"a\":tru}",
+        "[1 2]",
+        "{\"a\":\"\\x\"}",
+        "{\"a\":\"\\u12g4\"}",
+        "]",
+    };
+    for (const char* json : bad) {
+        JsonStreamExtractor extractor;
+        Collected out;
+        feedAll(extractor, out, json);
+        TEST_ASSERT_TRUE_MESSAGE(extractor.hasError(), json);
+    }
+}
+
+void test_nesting_beyond_max_depth_is_an_error() {
+    std::string json(JsonStreamExtractor::MAX_DEPTH + 1, '[');
+    JsonStreamExtractor extractor;
+    Collected out;
+    TEST_ASSERT_FALSE(feedAll(extractor, out, json));
+    TEST_ASSERT_TRUE(extractor.hasError());
+}
+
+void test_reset_allows_reuse() {
+    JsonStreamExtractor extractor;
+    Collected out;
+    feedAll(extractor, out, "{\"a\":1}");
+    TEST_ASSERT_TRUE(extractor.isComplete());
+
+    extractor.reset();
+    TEST_ASSERT_FALSE(extractor.isComplete());
+    TEST_ASSERT_EQUAL(0, extractor.bytesConsumed());
+    extractor.feed((const uint8_t*)"[\"b\"]", 5);
+    TEST_ASSERT_TRUE(extractor.isComplete());
+    TEST_ASSERT_EQUAL_STRING("[]", out.paths.back().c_str());
+}
+
+void test_closed_connection_ends_a_body_without_length() {
+    // No Content-Length, and the server hangs up partway through the document
+    std::string json = loadTestData(SPECIES_FIXTURE).substr(0, 2000);
+    MemoryStream stream(json, 64);
+    JsonStreamExtractor extractor;
+
+    BenchTimer timer;
+    size_t bytesRead = extractor.parseStream(stream, -1, 5000, [&stream]() { return stream.available() > 0; });
+    double elapsedMs = timer.elapsedUs() / 1000;
+
+    TEST_ASSERT_EQUAL(json.size(), bytesRead);
+    TEST_ASSERT_FALSE(extractor.isComplete());
+    // Returns when the connection closes, not after the idle timeout
+    TEST_ASSERT_LESS_THAN(100, (int)elapsedMs);
+}
+
+// The scanner this replaced appended every byte to a String, searched it for
+// a marker after each byte and trimmed it back with substring every 1000 bytes
+static size_t legacyScan(const std::string& json) {
+    String buffer = "";
+    size_t hits = 0;
+    for (char c : json) {
+        buffer += c;
+        if (buffer.length() > 2000) {
+            buffer = buffer.substring(1000);
+        }
+        if (buffer.indexOf("\"is_mythical\":") != -1) {
+            hits++;
+            buffer = "";
+        }
+    }
+    return hits;
+}
+
+void test_benchmark_species_fixture() {
+    std::string json = loadTestData(SPECIES_FIXTURE);
+    TEST_ASSERT_TRUE_MESSAGE(json.size() > 0, "species fixture missing");
+
+    const int runs = 20;
+    BenchTimer extractTimer;
+    size_t bytesRead = 0;
+    for (int i = 0; i < runs; i++) {
+        bytesRead = extractSpecies(json, JsonStreamExtractor::READ_CHUNK_SIZE).bytesRead;
+    }
+    double extractUs = extractTimer.elapsedUs() / runs;
+
+    BenchTimer legacyTimer;
+    for (int i = 0; i < runs; i++) {
+        legacyScan(json);
+    }
+    double legacyUs = legacyTimer.elapsedUs() / runs;
+
+    printf("JsonStreamExtractor: %u byte species document, read %u bytes\n",
+           (unsigned)json.size(), (unsigned)bytesRead);
+    printf("JsonStreamExtractor: extractor %.0f us (%.1f MB/s), legacy String scan %.0f us (%.1fx)\n",
+           extractUs, json.size() / extractUs, legacyUs, legacyUs / extractUs);
+    printf("JsonStreamExtractor: state %u bytes, stream chunk %u bytes\n",
+           (unsigned)sizeof(JsonStreamExtractor), (unsigned)JsonStreamExtractor::READ_CHUNK_SIZE);
+
+    // Fixed memory is the point; keep the whole parser under 1 KB
+    TEST_ASSERT_LESS_THAN(1024, sizeof(JsonStreamExtractor));
+    TEST_ASSERT_LESS_THAN(legacyUs, extractUs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_species_fixture_any_chunk_size);
+    RUN_TEST(test_stops_reading_once_fields_found);
+    RUN_TEST(test_nested_name_is_not_root_name);
+    RUN_TEST(test_literal_types);
+    RUN_TEST(test_string_escapes_decode_to_utf8);
+    RUN_TEST(test_long_values_are_truncated);
+    RUN_TEST(test_overlong_paths_are_skipped);
+    RUN_TEST(test_malformed_input_is_an_error);
+    RUN_TEST(test_nesting_beyond_max_depth_is_an_error);
+    RUN_TEST(test_reset_allows_reuse);
+    RUN_TEST(test_closed_connection_ends_a_body_without_length);
+    RUN_TEST(test_benchmark_species_fixture);
+    return UNITY_END();
+}
@@ -0,0 +1,217 @@
+#include <unity.h>
+#include <cmath>
+#include <vector>
+#include "hardware/LedStatus.h"
+
+static const uint32_t RUN_MS = 10000;
+static const uint32_t OLD_POLL_MS = 5;     // What the LED task polled at before keyframes
+
+/**
+ * @brief What the LED task did over a run
+ */
+struct LedTaskRun {
+    uint32_t wakeups;
+    uint32_t shows;                 ///< Wakeups that changed the pixel
+    std::vector<LedColor> colors;   ///< Color computed at each wakeup
+};
+
+/**
+ * @brief Run the LED task loop against a simulated clock
+ *
+ * Mirrors neoPixelTaskFunction and NeoPixelController::update(): compute the
+ * frame, show it if it changed, then sleep until the next keyframe plus a tick.
+ */
+static LedTaskRun runLedTask(LedPattern pattern, uint32_t durationMs, uint8_t progress = 0) {
+    LedTaskRun run = {};
+    LedColor shown = { 0, 0, 0 };
+    uint32_t now = 0;
+    while (now < durationMs) {
+        uint32_t nextMs;
+        LedColor color = LedStatus::frameAt(pattern, now, progress, &nextMs);
+        run.wakeups++;
+        run.colors.push_back(color);
+        if (color != shown) {
+            shown = color;
+            run.shows++;
+        }
+        if (nextMs == LedStatus::FOREVER) {
+            break;
+        }
+        now += nextMs + 1;
+    }
+    return run;
+}
+
+static double perSecond(uint32_t count) {
+    return count * 1000.0 / RUN_MS;
+}
+
+static int meanLevel(const LedColor& color) {
+    return (color.r + color.g + color.b) / 3;
+}
+
+static void clearStatus() {
+    LedStatus::set(LedStatus::FETCHING, false);
+    LedStatus::set(LedStatus::WIFI_LOST, false);
+    LedStatus::set(LedStatus::OTA, false);
+    LedStatus::setOtaProgress(0);
+    // Let any error run out
+    uint32_t holdMs;
+    LedStatus::current(millis() + LedStatus::ERROR_HOLD_MS + 1, &holdMs);
+}
+
+void setUp() {
+    clearStatus();
+}
+
+void tearDown() {}
+
+void test_sine_table_matches_sin() {
+    for (int angle = 0; angle < 256; angle++) {
+        int expected = (int)lround(127.0 * sin(angle * 2.0 * PI / 256.0));
+        TEST_ASSERT_EQUAL(expected, LedStatus::sin8(angle));
+    }
+}
+
+void test_fetching_pulse_sequence() {
+    uint32_t nextMs;
+    // Starts mid-level, peaks a quarter of the way in and bottoms out at the floor
+    LedColor start = LedStatus::frameAt(LedPattern::FETCHING, 0, 0, &nextMs);
+    TEST_ASSERT_TRUE((start == LedColor{ 0, 31, 127 }));
+    TEST_ASSERT_EQUAL(LedStatus::PULSE_STEP_MS, nextMs);
+
+    LedColor peak = LedStatus::frameAt(LedPattern::FETCHING, LedStatus::FETCH_PERIOD_MS / 4, 0, &nextMs);
+    TEST_ASSERT_TRUE((peak == LedColor{ 0, 63, 254 }));
+    LedColor trough = LedStatus::frameAt(LedPattern::FETCHING, LedStatus::FETCH_PERIOD_MS * 3 / 4, 0, &nextMs);
+    TEST_ASSERT_TRUE((trough == LedColor{ 0, 2, 8 }));
+
+    // Holds between keyframes and repeats every period
+    for (uint32_t t = 0; t < LedStatus::FETCH_PERIOD_MS; t += 7) {
+        LedColor color = LedStatus::frameAt(LedPattern::FETCHING, t, 0, &nextMs);
+        LedColor keyframe = LedStatus::frameAt(LedPattern::FETCHING, t - t % LedStatus::PULSE_STEP_MS, 0, &nextMs);
+        LedColor later = LedStatus::frameAt(LedPattern::FETCHING, t + 3 * LedStatus::FETCH_PERIOD_MS, 0, &nextMs);
+        TEST_ASSERT_TRUE(color == keyframe);
+        TEST_ASSERT_TRUE(color == later);
+        TEST_ASSERT_EQUAL(0, color.r);
+        TEST_ASSERT_GREATER_OR_EQUAL(8, color.b);
+    }
+}
+
+void test_idle_breathing_stays_above_the_floor() {
+    uint32_t nextMs;
+    for (uint32_t t = 0; t < 2 * LedStatus::BREATH_PERIOD_MS; t += LedStatus::PULSE_STEP_MS) {
+        LedColor color = LedStatus::frameAt(LedPattern::IDLE, t, 0, &nextMs);
+        TEST_ASSERT_GREATER_OR_EQUAL(12, color.r);
+        TEST_ASSERT_GREATER_OR_EQUAL(12, color.g);
+        TEST_ASSERT_GREATER_OR_EQUAL(12, color.b);
+    }
+    // Brightest a quarter of the way through a breath, dimmest three quarters through
+    LedColor bright = LedStatus::frameAt(LedPattern::IDLE, LedStatus::BREATH_PERIOD_MS / 4, 0, &nextMs);
+    LedColor dim = LedStatus::frameAt(LedPattern::IDLE, LedStatus::BREATH_PERIOD_MS * 3 / 4, 0, &nextMs);
+    TEST_ASSERT_GREATER_THAN(200, meanLevel(bright));
+    TEST_ASSERT_LESS_THAN(60, meanLevel(dim));
+}
+
+void test_blink_sequences() {
+    LedTaskRun wifi = runLedTask(LedPattern::WIFI_LOST, 4000);
+    TEST_ASSERT_EQUAL(4, wifi.wakeups);
+    for (size_t i = 0; i < wifi.colors.size(); i++) {
+        LedColor expected = i % 2 == 0 ? LedColor{ 160, 64, 0 } : LedColor{ 0, 0, 0 };
+        TEST_ASSERT_TRUE(wifi.colors[i] == expected);
+    }
+
+    LedTaskRun error = runLedTask(LedPattern::ERROR, LedStatus::ERROR_BLINK_MS * 6);
+    TEST_ASSERT_EQUAL(6, error.wakeups);
+    for (size_t i = 0; i < error.colors.size(); i++) {
+        LedColor expected = i % 2 == 0 ? LedColor{ 255, 0, 0 } : LedColor{ 0, 0, 0 };
+        TEST_ASSERT_TRUE(error.colors[i] == expected);
+    }
+}
+
+void test_ota_brightens_with_progress() {
+    uint32_t nextMs;
+    LedColor start = LedStatus::frameAt(LedPattern::OTA, 0, 0, &nextMs);
+    TEST_ASSERT_EQUAL(LedStatus::FOREVER, nextMs);
+    TEST_ASSERT_TRUE((start == LedColor{ 16, 0, 32 }));
+    LedColor half = LedStatus::frameAt(LedPattern::OTA, 0, 50, &nextMs);
+    LedColor done = LedStatus::frameAt(LedPattern::OTA, 0, 100, &nextMs);
+    TEST_ASSERT_GREATER_THAN(start.b, half.b);
+    TEST_ASSERT_TRUE((done == LedColor{ 127, 0, 255 }));
+    TEST_ASSERT_TRUE(LedStatus::frameAt(LedPattern::OTA, 0, 250, &nextMs) == done);
+}
+
+void test_keyframes_are_never_skipped() {
+    // Waking a tick after each keyframe still lands in every step, in order
+    LedTaskRun run = runLedTask(LedPattern::FETCHING, LedStatus::FETCH_PERIOD_MS);
+    uint32_t steps = LedStatus::FETCH_PERIOD_MS / LedStatus::PULSE_STEP_MS;
+    TEST_ASSERT_EQUAL(steps, run.wakeups);
+    uint32_t nextMs;
+    for (uint32_t step = 0; step < steps; step++) {
+        LedColor expected = LedStatus::frameAt(LedPattern::FETCHING, step * LedStatus::PULSE_STEP_MS, 0, &nextMs);
+        TEST_ASSERT_TRUE(run.colors[step] == expected);
+    }
+}
+
+void test_pattern_priority() {
+    uint32_t holdMs;
+    TEST_ASSERT_TRUE(LedStatus::current(millis(), &holdMs) == LedPattern::IDLE);
+    TEST_ASSERT_EQUAL(LedStatus::FOREVER, holdMs);
+
+    LedStatus::set(LedStatus::FETCHING, true);
+    TEST_ASSERT_TRUE(LedStatus::current(millis(), &holdMs) == LedPattern::FETCHING);
+    LedStatus::set(LedStatus::WIFI_LOST, true);
+    TEST_ASSERT_TRUE(LedStatus::current(millis(), &holdMs) == LedPattern::WIFI_LOST);
+
+    // An error shows for ERROR_HOLD_MS, then gives way to what is still active
+    LedStatus::signalError();
+    uint32_t now = millis();
+    TEST_ASSERT_TRUE(LedStatus::current(now, &holdMs) == LedPattern::ERROR);
+    TEST_ASSERT_UINT32_WITHIN(100, LedStatus::ERROR_HOLD_MS, holdMs);
+    TEST_ASSERT_TRUE(LedStatus::current(now + LedStatus::ERROR_HOLD_MS + 1, &holdMs) == LedPattern::WIFI_LOST);
+
+    LedStatus::signalError();
+    LedStatus::set(LedStatus::OTA, true);
+    TEST_ASSERT_TRUE(LedStatus::current(millis(), &holdMs) == LedPattern::OTA);
+    LedStatus::set(LedStatus::OTA, false);
+    TEST_ASSERT_TRUE(LedStatus::current(millis(), &holdMs) == LedPattern::ERROR);
+}
+
+void test_wakeups_per_second() {
+    LedTaskRun idle = runLedTask(LedPattern::IDLE, RUN_MS);
+    LedTaskRun fetching = runLedTask(LedPattern::FETCHING, RUN_MS);
+    LedTaskRun wifi = runLedTask(LedPattern::WIFI_LOST, RUN_MS);
+    LedTaskRun error = runLedTask(LedPattern::ERROR, RUN_MS);
+    LedTaskRun ota = runLedTask(LedPattern::OTA, RUN_MS, 40);
+
+    printf("LedStatus: wakeups/s (pixel writes/s): idle %.1f (%.1f), fetching %.1f (%.1f), wifi lost %.1f (%.1f), "
+           "error %.1f (%.1f), OTA %.1f (%.1f); polling every %u ms was %.0f\n",
+           perSecond(idle.wakeups), perSecond(idle.shows),
+           perSecond(fetching.wakeups), perSecond(fetching.shows),
+           perSecond(wifi.wakeups), perSecond(wifi.shows),
+           perSecond(error.wakeups), perSecond(error.shows),
+           perSecond(ota.wakeups), perSecond(ota.shows),
+           (unsigned)OLD_POLL_MS, 1000.0 / OLD_POLL_MS);
+
+    // At most one wakeup per keyframe, plus the first
+    uint32_t keyframes = RUN_MS / LedStatus::PULSE_STEP_MS + 1;
+    TEST_ASSERT_LESS_OR_EQUAL(keyframes, idle.wakeups);
+    TEST_ASSERT_LESS_OR_EQUAL(keyframes, fetching.wakeups);
+    TEST_ASSERT_LESS_OR_EQUAL(RUN_MS / LedStatus::WIFI_BLINK_MS, wifi.wakeups);
+    TEST_ASSERT_LESS_OR_EQUAL(RUN_MS / LedStatus::ERROR_BLINK_MS + 1, error.wakeups);
+    // A steady pattern wakes once and then waits for a status change
+    TEST_ASSERT_EQUAL(1, ota.wakeups);
+    TEST_ASSERT_TRUE(fetching.shows <= fetching.wakeups);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sine_table_matches_sin);
+    RUN_TEST(test_fetching_pulse_sequence);
+    RUN_TEST(test_idle_breathing_stays_above_the_floor);
+    RUN_TEST(test_blink_sequences);
+    RUN_TEST(test_ota_brightens_with_progress);
+    RUN_TEST(test_keyframes_are_never_skipped);
+    RUN_TEST(test_pattern_priority);
+    RUN_TEST(test_wakeups_per_second);
+    return UNITY_END();
+}
@@ -0,0 +1,262 @@
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Metrics.h"
+#include "test_support.h"
+
+// Registered alongside the firmware's own metrics, so the suite does not
+// depend on what the instrumented code has recorded
+static const uint32_t TEST_BOUNDS[] = { 10, 100, 1000 };
+static Metrics::Counter testCounter("test_events_total", "Events counted by the test");
+static Metrics::Gauge testGauge("test_level", "Level set by the test");
+static Metrics::GaugeFamily testFamily("test_stack_free_bytes", "Per-task value set by the test", "task");
+static Metrics::Histogram testHistogram("test_latency_ms", "Latency observed by the test", TEST_BOUNDS, 3);
+
+/**
+ * @class StringPrint
+ * @brief Print that collects everything written, as the web response would
+ */
+class StringPrint : public Print {
+public:
+    size_t write(uint8_t c) override {
+        text += (char)c;
+        return 1;
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) override {
+        text.append((const char*)buffer, size);
+        return size;
+    }
+
+    std::string text;
+};
+
+static std::string exportJson() {
+    StringPrint out;
+    Metrics::writeJson(out);
+    return out.text;
+}
+
+static std::string exportPrometheus() {
+    StringPrint out;
+    Metrics::writePrometheus(out);
+    return out.text;
+}
+
+static bool hasLine(const std::string& text, const std::string& line) {
+    return text.find("\n" + line + "\n") != std::string::npos || text.compare(0, line.size() + 1, line + "\n") == 0;
+}
+
+static size_t registeredCount() {
+    size_t count = 0;
+    for (const Metrics::Metric* m = Metrics::first(); m; m = m->next()) {
+        count++;
+    }
+    return count;
+}
+
+// Values accumulate across tests, as they do across requests on the device
+static int familySeries = -1;
+
+void setUp() {
+    if (familySeries < 0) {
+        familySeries = testFamily.addSeries("uiTask");
+    }
+}
+
+void tearDown() {}
+
+void test_gauge_watermarks_take_the_first_sample() {
+    static Metrics::Gauge low("test_low_water", "Low-water mark");
+    static Metrics::Gauge high("test_high_water", "High-water mark");
+
+    // A low-water mark must not stick at the initial 0
+    low.lowerTo(5000);
+    TEST_ASSERT_EQUAL(5000, low.value());
+    low.lowerTo(7000);
+    TEST_ASSERT_EQUAL(5000, low.value());
+    low.lowerTo(4000);
+    TEST_ASSERT_EQUAL(4000, low.value());
+
+    high.raiseTo(-20);
+    TEST_ASSERT_EQUAL(-20, high.value());
+    high.raiseTo(-30);
+    TEST_ASSERT_EQUAL(-20, high.value());
+    high.raiseTo(12);
+    TEST_ASSERT_EQUAL(12, high.value());
+}
+
+void test_histogram_buckets_by_upper_bound() {
+    static const uint32_t bounds[] = { 10, 100 };
+    static Metrics::Histogram h("test_bucketing", "Bucket placement", bounds, 2);
+
+    for (uint32_t value : { 0u, 10u, 11u, 100u, 101u, 5000u }) {
+        h.observe(value);
+    }
+    TEST_ASSERT_EQUAL(2, h.bucketCount(0));   // 0 and 10: a bound is inclusive
+    TEST_ASSERT_EQUAL(2, h.bucketCount(1));   // 11 and 100
+    TEST_ASSERT_EQUAL(2, h.bucketCount(2));   // Overflow
+    TEST_ASSERT_EQUAL(6, h.count());
+    TEST_ASSERT_EQUAL(5222, h.sum());
+}
+
+void test_family_stops_at_max_series() {
+    static Metrics::GaugeFamily full("test_full_family", "Family filled by the test", "slot");
+    static const char* labels[] = { "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p" };
+    for (size_t i = 0; i < Metrics::GaugeFamily::MAX_SERIES; i++) {
+        TEST_ASSERT_EQUAL((int)i, full.addSeries(labels[i]));
+    }
+    TEST_ASSERT_EQUAL(-1, full.addSeries("overflow"));
+    TEST_ASSERT_EQUAL(Metrics::GaugeFamily::MAX_SERIES, full.seriesCount());
+
+    // Out of range writes are ignored
+    full.set(Metrics::GaugeFamily::MAX_SERIES, 99);
+}
+
+void test_json_export_parses_and_matches_values() {
+    testCounter.add(3);
+    testGauge.set(-42);
+    testFamily.set(familySeries, 1536);
+    for (uint32_t value : { 5u, 50u, 500u, 5000u, 7u }) {
+        testHistogram.observe(value);
+    }
+
+    std::string json = exportJson();
+    DynamicJsonDocument doc(json.size() * 4 + 4096);
+    TEST_ASSERT_FALSE(deserializeJson(doc, json.c_str(), json.size()));
+    JsonObject root = doc.as<JsonObject>();
+
+    TEST_ASSERT_EQUAL_STRING("counter", root["test_events_total"]["type"].as<String>().c_str());
+    TEST_ASSERT_EQUAL(testCounter.value(), root["test_events_total"]["value"].as<uint32_t>());
+    TEST_ASSERT_EQUAL(-42, root["test_level"]["value"].as<int>());
+    TEST_ASSERT_EQUAL_STRING("task", root["test_stack_free_bytes"]["label"].as<String>().c_str());
+    TEST_ASSERT_EQUAL(1536, root["test_stack_free_bytes"]["values"]["uiTask"].as<int>());
+
+    JsonObject histogram = root["test_latency_ms"].as<JsonObject>();
+    TEST_ASSERT_EQUAL(testHistogram.count(), histogram["count"].as<uint32_t>());
+    TEST_ASSERT_EQUAL(testHistogram.sum(), histogram["sum"].as<uint32_t>());
+    JsonArray buckets = histogram["buckets"].as<JsonArray>();
+    TEST_ASSERT_EQUAL(4, buckets.size());
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(TEST_BOUNDS[i], buckets[i][0].as<uint32_t>());
+        TEST_ASSERT_EQUAL(testHistogram.bucketCount(i), buckets[i][1].as<uint32_t>());
+    }
+    TEST_ASSERT_TRUE(buckets[3][0].isNull());
+    TEST_ASSERT_EQUAL(testHistogram.bucketCount(3), buckets[3][1].as<uint32_t>());
+
+    // Every registered metric is exported, including the firmware's own
+    TEST_ASSERT_EQUAL(registeredCount(), root.size());
+    TEST_ASSERT_TRUE(root["posthog_fetch_ms"].is<JsonObject>());
+}
+
+void test_prometheus_export_is_well_formed() {
+    std::string text = exportPrometheus();
+
+    // Every line is a comment or a sample with an optional label set
+    std::regex sample("[a-zA-Z_][a-zA-Z0-9_]*(\\{[a-z_]+=\"[^\"]*\"\\})? -?[0-9]+");
+    std::istringstream lines(text);
+    std::string line;
+    size_t helpLines = 0;
+    while (std::getline(lines, line)) {
+        if (line.compare(0, 7, "# HELP ") == 0) {
+            helpLines++;
+        } else if (line.compare(0, 7, "# TYPE ") != 0) {
+            TEST_ASSERT_TRUE_MESSAGE(std::regex_match(line, sample), line.c_str());
+        }
+    }
+    TEST_ASSERT_EQUAL(registeredCount(), helpLines);
+
+    TEST_ASSERT_TRUE(hasLine(text, "# TYPE test_events_total counter"));
+    TEST_ASSERT_TRUE(hasLine(text, "test_events_total " + std::to_string(testCounter.value())));
+    TEST_ASSERT_TRUE(hasLine(text, "test_level -42"));
+    TEST_ASSERT_TRUE(hasLine(text, "test_stack_free_bytes{task=\"uiTask\"} 1536"));
+}
+
+void test_prometheus_buckets_are_cumulative() {
+    std::string text = exportPrometheus();
+    uint32_t cumulative = 0;
+    for (size_t i = 0; i < 3; i++) {
+        cumulative += testHistogram.bucketCount(i);
+        TEST_ASSERT_TRUE(hasLine(text, "test_latency_ms_bucket{le=\"" + std::to_string(TEST_BOUNDS[i]) + "\"} " +
+                                       std::to_string(cumulative)));
+    }
+    TEST_ASSERT_TRUE(hasLine(text, "test_latency_ms_bucket{le=\"+Inf\"} " + std::to_string(testHistogram.count())));
+    TEST_ASSERT_TRUE(hasLine(text, "test_latency_ms_count " + std::to_string(testHistogram.count())));
+    TEST_ASSERT_TRUE(hasLine(text, "test_latency_ms_sum " + std::to_string(testHistogram.sum())));
+}
+
+void test_updates_from_many_threads_are_not_lost() {
+    static const uint32_t bounds[] = { 50 };
+    static Metrics::Counter counter("test_threaded_total", "Counted from several threads");
+    static Metrics::Histogram histogram("test_threaded_ms", "Observed from several threads", bounds, 1);
+    const int threads = 4;
+    const uint32_t perThread = 50000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&]() {
+            for (uint32_t i = 0; i < perThread; i++) {
+                counter.add();
+                histogram.observe(i % 100);
+            }
+        });
+    }
+    // Export while the writers run, as a scrape would
+    while (counter.value() < threads * perThread / 2) {
+        exportJson();
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    TEST_ASSERT_EQUAL(threads * perThread, counter.value());
+    TEST_ASSERT_EQUAL(threads * perThread, histogram.count());
+    TEST_ASSERT_EQUAL(threads * perThread / 100 * 51, histogram.bucketCount(0));
+    TEST_ASSERT_EQUAL(threads * perThread, histogram.bucketCount(0) + histogram.bucketCount(1));
+}
+
+void test_export_benchmark() {
+    const int exports = 2000;
+    size_t jsonBytes = 0;
+    size_t textBytes = 0;
+
+    BenchTimer hotTimer;
+    for (int i = 0; i < 1000000; i++) {
+        testHistogram.observe(i & 1023);
+    }
+    double observeNs = hotTimer.elapsedUs() * 1000.0 / 1000000;
+
+    BenchTimer jsonTimer;
+    for (int i = 0; i < exports; i++) {
+        jsonBytes = exportJson().size();
+    }
+    double jsonUs = jsonTimer.elapsedUs() / exports;
+
+    BenchTimer textTimer;
+    for (int i = 0; i < exports; i++) {
+        textBytes = exportPrometheus().size();
+    }
+    double textUs = textTimer.elapsedUs() / exports;
+
+    printf("Metrics: %u metrics; observe %.1f ns; JSON %u bytes in %.1f us, Prometheus %u bytes in %.1f us\n",
+           (unsigned)registeredCount(), observeNs, (unsigned)jsonBytes, jsonUs, (unsigned)textBytes, textUs);
+    TEST_ASSERT_GREATER_THAN(0, jsonBytes);
+    TEST_ASSERT_GREATER_THAN(0, textBytes);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_gauge_watermarks_take_the_first_sample);
+    RUN_TEST(test_histogram_buckets_by_upper_bound);
+    RUN_TEST(test_family_stops_at_max_series);
+    RUN_TEST(test_json_export_parses_and_matches_values);
+    RUN_TEST(test_prometheus_export_is_well_formed);
+    RUN_TEST(test_prometheus_buckets_are_cumulative);
+    RUN_TEST(test_updates_from_many_threads_are_not_lost);
+    RUN_TEST(test_export_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+#include <unity.h>
+#include <esp_heap_caps.h>
+#include <string>
+#include <vector>
+#include "OtaDeltaPatch.h"
+#include "test_support.h"
+
+// Sample images and the patch make_delta.py built between them:
+//   python make_delta.py test/data/ota_old.bin test/data/ota_new.bin -o test/data/ota_old_to_new.patch
+static std::string oldImage;
+static std::string newImage;
+static std::string patch;
+
+struct Applied {
+    std::string output;
+    size_t sourceBytesRead = 0;
+    size_t largestSourceRead = 0;
+    size_t outputCalls = 0;
+    bool headerSeen = false;
+};
+
+/**
+ * @brief Push a patch through the decoder in fixed-size pieces, as the HTTP stream would
+ */
+static bool applyPatch(OtaDeltaPatch& decoder, const std::string& data, size_t chunkSize) {
+    for (size_t pos = 0; pos < data.size(); pos += chunkSize) {
+        size_t n = min(chunkSize, data.size() - pos);
+        if (!decoder.feed((const uint8_t*)data.data() + pos, n)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static OtaDeltaPatch makeDecoder(Applied& applied, const std::string& source) {
+    return OtaDeltaPatch(
+        [&applied, &source](size_t offset, uint8_t* out, size_t length) {
+            if (offset + length > source.size()) {
+                return false;
+            }
+            memcpy(out, source.data() + offset, length);
+            applied.sourceBytesRead += length;
+            applied.largestSourceRead = max(applied.largestSourceRead, length);
+            return true;
+        },
+        [&applied](const uint8_t* data, size_t length) {
+            applied.output.append((const char*)data, length);
+            applied.outputCalls++;
+            return true;
+        },
+        [&applied, &source](const OtaDeltaPatch::Header& header) {
+            applied.headerSeen = true;
+            return header.oldSize == source.size();
+        });
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_fixtures_present() {
+    TEST_ASSERT_TRUE_MESSAGE(oldImage.size() > 0, "ota_old.bin missing");
+    TEST_ASSERT_TRUE_MESSAGE(newImage.size() > 0, "ota_new.bin missing");
+    TEST_ASSERT_TRUE_MESSAGE(patch.size() > OtaDeltaPatch::HEADER_SIZE, "ota_old_to_new.patch missing");
+}
+
+void test_rebuilds_new_image_at_any_chunk_size() {
+    for (size_t chunk : { (size_t)1, (size_t)9, (size_t)1460, patch.size() }) {
+        Applied applied;
+        OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+        TEST_ASSERT_TRUE(applyPatch(decoder, patch, chunk));
+
+        TEST_ASSERT_TRUE(decoder.isComplete());
+        TEST_ASSERT_TRUE(applied.headerSeen);
+        TEST_ASSERT_EQUAL(newImage.size(), decoder.header().newSize);
+        TEST_ASSERT_EQUAL(newImage.size(), decoder.bytesProduced());
+        TEST_ASSERT_EQUAL(newImage.size(), applied.output.size());
+        TEST_ASSERT_TRUE(applied.output == newImage);
+    }
+}
+
+void test_bytes_transferred_against_full_image() {
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_TRUE(applyPatch(decoder, patch, 1460));
+
+    size_t literalBytes = newImage.size() - applied.sourceBytesRead;
+    printf("OtaDeltaPatch: full image %u bytes, patch %u bytes (%.1f%%)\n",
+           (unsigned)newImage.size(), (unsigned)patch.size(), 100.0 * patch.size() / newImage.size());
+    printf("OtaDeltaPatch: %u bytes copied from the running image, %u carried in the patch, %u output writes\n",
+           (unsigned)applied.sourceBytesRead, (unsigned)literalBytes, (unsigned)applied.outputCalls);
+
+    // Every output byte is either copied or carried, and the opcodes cost little on top
+    TEST_ASSERT_LESS_THAN(literalBytes + 1024, patch.size());
+    TEST_ASSERT_LESS_THAN(newImage.size() / 10, patch.size());
+}
+
+void test_source_reads_are_bounded() {
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+    long before = heap_caps_live_allocations();
+    TEST_ASSERT_TRUE(applyPatch(decoder, patch, 1460));
+
+    // One scratch buffer however large the copies are
+    TEST_ASSERT_LESS_OR_EQUAL(OtaDeltaPatch::COPY_CHUNK_SIZE, applied.largestSourceRead);
+    TEST_ASSERT_EQUAL(before + 1, heap_caps_live_allocations());
+}
+
+void test_identical_images_patch_is_tiny() {
+    // A patch for an unchanged image is the header, one COPY and END
+    std::string identity(patch, 0, OtaDeltaPatch::HEADER_SIZE);
+    identity.replace(44, 4, std::string((const char*)&identity[8], 4));
+    const uint8_t copyAll[] = { 0x01, 0, 0, 0, 0,
+                                (uint8_t)oldImage.size(), (uint8_t)(oldImage.size() >> 8),
+                                (uint8_t)(oldImage.size() >> 16), (uint8_t)(oldImage.size() >> 24),
+                                0x00 };
+    identity.append((const char*)copyAll, sizeof(copyAll));
+
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_TRUE(applyPatch(decoder, identity, 64));
+    TEST_ASSERT_TRUE(decoder.isComplete());
+    TEST_ASSERT_TRUE(applied.output == oldImage);
+    TEST_ASSERT_EQUAL(OtaDeltaPatch::HEADER_SIZE + 10, identity.size());
+}
+
+void test_rejects_patch_for_other_image() {
+    std::string otherImage = oldImage + "x";
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, otherImage);
+    TEST_ASSERT_FALSE(applyPatch(decoder, patch, 1460));
+    TEST_ASSERT_TRUE(decoder.hasError());
+    TEST_ASSERT_EQUAL(0, applied.output.size());
+}
+
+void test_rejects_bad_magic_and_version() {
+    std::string badMagic = patch;
+    badMagic[0] = 'X';
+    Applied applied;
+    OtaDeltaPatch magicDecoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_FALSE(applyPatch(magicDecoder, badMagic, 1460));
+    TEST_ASSERT_EQUAL_STRING("Not a delta patch", magicDecoder.error());
+
+    std::string badVersion = patch;
+    badVersion[4] = OtaDeltaPatch::VERSION + 1;
+    OtaDeltaPatch versionDecoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_FALSE(applyPatch(versionDecoder, badVersion, 1460));
+    TEST_ASSERT_EQUAL_STRING("Unsupported patch version", versionDecoder.error());
+}
+
+void test_rejects_copy_outside_old_image() {
+    std::string corrupt(patch, 0, OtaDeltaPatch::HEADER_SIZE);
+    const uint8_t copyPastEnd[] = { 0x01, 0xF0, 0xFF, 0, 0, 0x20, 0, 0, 0 };
+    corrupt.append((const char*)copyPastEnd, sizeof(copyPastEnd));
+
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_FALSE(applyPatch(decoder, corrupt, 1460));
+    TEST_ASSERT_EQUAL_STRING("Copy outside the running image", decoder.error());
+}
+
+void test_truncated_patch_is_incomplete() {
+    std::string truncated(patch, 0, patch.size() / 2);
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_TRUE(applyPatch(decoder, truncated, 1460));
+    TEST_ASSERT_FALSE(decoder.isComplete());
+    TEST_ASSERT_FALSE(decoder.hasError());
+    TEST_ASSERT_LESS_THAN(newImage.size(), decoder.bytesProduced());
+}
+
+void test_data_after_end_is_an_error() {
+    std::string extended = patch + '\0';
+    Applied applied;
+    OtaDeltaPatch decoder = makeDecoder(applied, oldImage);
+    TEST_ASSERT_FALSE(applyPatch(decoder, extended, 1460));
+    TEST_ASSERT_EQUAL_STRING("Data after end of patch", decoder.error());
+}
+
+void test_output_failure_stops_decoding() {
+    size_t writes = 0;
+    OtaDeltaPatch decoder(
+        [](size_t offset, uint8_t* out, size_t length) {
+            memcpy(out, oldImage.data() + offset, length);
+            return true;
+        },
+        [&writes](const uint8_t*, size_t) { return ++writes < 3; },
+        nullptr);
+    TEST_ASSERT_FALSE(applyPatch(decoder, patch, 1460));
+    TEST_ASSERT_TRUE(decoder.hasError());
+    TEST_ASSERT_EQUAL(3, writes);
+}
+
+int main(int argc, char** argv) {
+    oldImage = loadTestData("ota_old.bin");
+    newImage = loadTestData("ota_new.bin");
+    patch = loadTestData("ota_old_to_new.patch");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_fixtures_present);
+    RUN_TEST(test_rebuilds_new_image_at_any_chunk_size);
+    RUN_TEST(test_bytes_transferred_against_full_image);
+    RUN_TEST(test_source_reads_are_bounded);
+    RUN_TEST(test_identical_images_patch_is_tiny);
+    RUN_TEST(test_rejects_patch_for_other_image);
+    RUN_TEST(test_rejects_bad_magic_and_version);
+    RUN_TEST(test_rejects_copy_outside_old_image);
+    RUN_TEST(test_truncated_patch_is_incomplete);
+    RUN_TEST(test_data_after_end_is_an_error);
+    RUN_TEST(test_output_failure_stops_decoding);
+    return UNITY_END();
+}
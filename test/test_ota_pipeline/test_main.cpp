@@ -0,0 +1,297 @@
+#include <unity.h>
+#include <HTTPClient.h>
+#include <Update.h>
+#include <atomic>
+#include <string>
+#include "OtaPipeline.h"
+#include "test_support.h"
+
+// Synthetic firmware served by scripts/mock_ota.py and flashed into a file
+static const size_t IMAGE_SIZE = 1536 * 1024;
+static const size_t SYNC_READ_SIZE = 1460;   // One TCP segment, as the download loop read before the pipeline
+
+static std::string image;
+static TempFile imageFile("ota_image_");
+static TempFile flashFile("ota_flash_");
+static MockServer mock;
+
+/**
+ * @brief Bytes that do not compress or repeat, so a misplaced buffer shows up
+ */
+static std::string syntheticImage(size_t size, uint32_t seed) {
+    std::string data(size, '\0');
+    uint32_t state = seed;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1664525u + 1013904223u;
+        data[i] = (char)(state >> 24);
+    }
+    return data;
+}
+
+static bool startMock(const std::string& options) {
+    return mock.start("mock_ota.py", "--image " + imageFile.path() + " " + options);
+}
+
+static OtaPipeline::Sink updateSink() {
+    return [](const uint8_t* data, size_t length) {
+        return Update.write(const_cast<uint8_t*>(data), length);
+    };
+}
+
+struct Download {
+    bool ok = false;
+    size_t bytes = 0;
+    double seconds = 0;
+};
+
+/**
+ * @brief Fetch /firmware.bin into Update through the pipeline, as OtaManager does
+ */
+static Download pipelinedDownload() {
+    Download result;
+    HTTPClient http;
+    WiFiClient transport;
+    http.begin(transport, String(mock.url()) + "/firmware.bin");
+    BenchTimer timer;
+    if (http.GET() != HTTP_CODE_OK || http.getSize() <= 0) {
+        return result;
+    }
+    size_t totalSize = http.getSize();
+    OtaPipeline pipeline(updateSink());
+    if (!Update.begin(totalSize, U_FLASH) || !pipeline.begin()) {
+        return result;
+    }
+
+    WiFiClient* stream = http.getStreamPtr();
+    size_t received = 0;
+    uint8_t* buffer = nullptr;
+    size_t filled = 0;
+    while (received < totalSize && !pipeline.failed()) {
+        if (!buffer) {
+            buffer = pipeline.acquireBuffer(pdMS_TO_TICKS(1000));
+            filled = 0;
+            if (!buffer) {
+                continue;
+            }
+        }
+        size_t len = stream->available();
+        if (len == 0) {
+            if (!http.connected()) {
+                break;
+            }
+            vTaskDelay(1);
+            continue;
+        }
+        size_t toRead = min(min(OtaPipeline::BUFFER_SIZE - filled, len), totalSize - received);
+        int c = stream->read(buffer + filled, toRead);
+        filled += c;
+        received += c;
+        if (filled == OtaPipeline::BUFFER_SIZE || received == totalSize) {
+            pipeline.submit(buffer, filled);
+            buffer = nullptr;
+        }
+    }
+    if (buffer) {
+        pipeline.release(buffer);
+    }
+
+    bool flashed = pipeline.finish(pdMS_TO_TICKS(30000));
+    result.bytes = pipeline.bytesCommitted();
+    result.ok = flashed && result.bytes == totalSize && Update.end(true);
+    result.seconds = timer.elapsedUs() / 1e6;
+    if (!result.ok) {
+        Update.abort();
+    }
+    return result;
+}
+
+/**
+ * @brief The same download read a segment at a time and written inline
+ */
+static Download synchronousDownload() {
+    Download result;
+    HTTPClient http;
+    WiFiClient transport;
+    http.begin(transport, String(mock.url()) + "/firmware.bin");
+    BenchTimer timer;
+    if (http.GET() != HTTP_CODE_OK || http.getSize() <= 0) {
+        return result;
+    }
+    size_t totalSize = http.getSize();
+    if (!Update.begin(totalSize, U_FLASH)) {
+        return result;
+    }
+
+    WiFiClient* stream = http.getStreamPtr();
+    uint8_t buffer[SYNC_READ_SIZE];
+    while (result.bytes < totalSize) {
+        size_t len = stream->available();
+        if (len == 0) {
+            if (!http.connected()) {
+                break;
+            }
+            vTaskDelay(1);
+            continue;
+        }
+        int c = stream->read(buffer, min(len, sizeof(buffer)));
+        if (Update.write(buffer, c) != (size_t)c) {
+            break;
+        }
+        result.bytes += c;
+    }
+    result.ok = result.bytes == totalSize && Update.end(true);
+    result.seconds = timer.elapsedUs() / 1e6;
+    if (!result.ok) {
+        Update.abort();
+    }
+    return result;
+}
+
+/**
+ * @brief Submit data through a started pipeline in full buffers
+ */
+static void submitAll(OtaPipeline& pipeline, const std::string& data) {
+    for (size_t offset = 0; offset < data.size(); offset += OtaPipeline::BUFFER_SIZE) {
+        uint8_t* buffer = pipeline.acquireBuffer(pdMS_TO_TICKS(5000));
+        TEST_ASSERT_NOT_NULL(buffer);
+        size_t length = min(OtaPipeline::BUFFER_SIZE, data.size() - offset);
+        memcpy(buffer, data.data() + offset, length);
+        TEST_ASSERT_TRUE(pipeline.submit(buffer, length));
+    }
+}
+
+void setUp() {
+    Update.setPartition(flashFile.path(), 0x1F0000);
+    Update.setSectorWriteTime(0);
+}
+
+void tearDown() {
+    if (Update.isRunning()) {
+        Update.abort();
+    }
+    mock.stop();
+}
+
+void test_download_reaches_flash_intact() {
+    TEST_ASSERT_TRUE(startMock(""));
+
+    Download download = pipelinedDownload();
+    TEST_ASSERT_TRUE(download.ok);
+    TEST_ASSERT_EQUAL(IMAGE_SIZE, download.bytes);
+    TEST_ASSERT_TRUE(Update.ended());
+    TEST_ASSERT_TRUE(flashFile.read() == image);
+}
+
+void test_header_reaches_flash_only_at_end() {
+    std::string data = image.substr(0, 100 * 1024);
+    TEST_ASSERT_TRUE(Update.begin(data.size(), U_FLASH));
+    OtaPipeline pipeline(updateSink());
+    TEST_ASSERT_TRUE(pipeline.begin());
+    submitAll(pipeline, data);
+    TEST_ASSERT_TRUE(pipeline.finish(pdMS_TO_TICKS(5000)));
+    TEST_ASSERT_EQUAL(data.size(), pipeline.bytesCommitted());
+
+    // Everything but the deferred header is in flash before end()
+    std::string flashed = flashFile.read();
+    TEST_ASSERT_EQUAL(data.size(), flashed.size());
+    TEST_ASSERT_TRUE(flashed.compare(0, UpdateClass::DEFERRED_BYTES, std::string(UpdateClass::DEFERRED_BYTES, '\xFF')) == 0);
+    TEST_ASSERT_TRUE(flashed.compare(UpdateClass::DEFERRED_BYTES, std::string::npos, data, UpdateClass::DEFERRED_BYTES, std::string::npos) == 0);
+
+    TEST_ASSERT_TRUE(Update.end(true));
+    TEST_ASSERT_TRUE(flashFile.read() == data);
+}
+
+void test_sink_failure_returns_later_buffers_unwritten() {
+    std::atomic<int> calls(0);
+    OtaPipeline pipeline([&calls](const uint8_t* data, size_t length) {
+        return ++calls == 2 ? length / 2 : length;
+    });
+    TEST_ASSERT_TRUE(pipeline.begin());
+    submitAll(pipeline, image.substr(0, 5 * OtaPipeline::BUFFER_SIZE));
+
+    TEST_ASSERT_FALSE(pipeline.finish(pdMS_TO_TICKS(5000)));
+    TEST_ASSERT_TRUE(pipeline.failed());
+    TEST_ASSERT_EQUAL(2, calls.load());
+    TEST_ASSERT_EQUAL(OtaPipeline::BUFFER_SIZE, pipeline.bytesCommitted());
+
+    // Every buffer came back to be reused
+    for (size_t i = 0; i < OtaPipeline::BUFFER_COUNT; i++) {
+        TEST_ASSERT_NOT_NULL(pipeline.acquireBuffer(0));
+    }
+}
+
+void test_stuck_writer_is_aborted_after_its_current_write() {
+    const unsigned long writeMs = 400;
+    std::atomic<int> started(0);
+    std::atomic<int> returned(0);
+    TEST_ASSERT_TRUE(Update.begin(2 * OtaPipeline::BUFFER_SIZE, U_FLASH));
+    OtaPipeline pipeline([&](const uint8_t* data, size_t length) {
+        started++;
+        delay(writeMs);   // Flash busy far longer than the caller will wait
+        size_t written = Update.write(const_cast<uint8_t*>(data), length);
+        returned++;
+        return written;
+    });
+    TEST_ASSERT_TRUE(pipeline.begin());
+    submitAll(pipeline, image.substr(0, 2 * OtaPipeline::BUFFER_SIZE));
+    delay(50);
+
+    unsigned long stopStart = millis();
+    TEST_ASSERT_FALSE(pipeline.finish(pdMS_TO_TICKS(100)));
+    unsigned long stopMs = millis() - stopStart;
+
+    // finish() waited for the write in progress instead of killing the writer under it,
+    // and the buffer behind it was dropped
+    TEST_ASSERT_GREATER_OR_EQUAL(writeMs - 100, stopMs);
+    TEST_ASSERT_EQUAL(1, started.load());
+    TEST_ASSERT_EQUAL(1, returned.load());
+    delay(writeMs + 100);
+    TEST_ASSERT_EQUAL(1, started.load());
+
+    // The caller can now abort the update with nothing writing to it
+    Update.abort();
+    TEST_ASSERT_FALSE(Update.isRunning());
+    // All of the first buffer but its last sector, which Update still holds
+    TEST_ASSERT_EQUAL(OtaPipeline::BUFFER_SIZE / UpdateClass::SECTOR_SIZE - 1, Update.sectorsWritten());
+}
+
+void test_benchmark_download_throughput() {
+    // Network and flash each take about 1.5 s for the image alone
+    const unsigned kbps = 1024;
+    const uint32_t sectorUs = 4000;
+    TEST_ASSERT_TRUE(startMock("--kbps " + std::to_string(kbps)));
+    Update.setSectorWriteTime(sectorUs);
+
+    Download sync = synchronousDownload();
+    TEST_ASSERT_TRUE(sync.ok);
+    Download piped = pipelinedDownload();
+    TEST_ASSERT_TRUE(piped.ok);
+    TEST_ASSERT_TRUE(flashFile.read() == image);
+
+    double networkSeconds = (double)IMAGE_SIZE / (kbps * 1024.0);
+    double flashSeconds = (double)(IMAGE_SIZE / UpdateClass::SECTOR_SIZE) * sectorUs / 1e6;
+    double mb = IMAGE_SIZE / 1048576.0;
+    printf("OtaPipeline: %.2f MB at %u KB/s and %u us per sector: pipelined %.2f MB/s (%.2f s), "
+           "%u byte reads written inline %.2f MB/s (%.2f s); network alone %.2f s, flash alone %.2f s\n",
+           mb, kbps, (unsigned)sectorUs, mb / piped.seconds, piped.seconds,
+           (unsigned)SYNC_READ_SIZE, mb / sync.seconds, sync.seconds, networkSeconds, flashSeconds);
+
+    // Receive and flash overlap, so the pipeline takes well under the two added together.
+    // The inline loop overlaps too on the host, where the socket buffer holds more
+    // than a sector's worth, so it is only a check that the pipeline is no slower.
+    TEST_ASSERT_TRUE(piped.seconds < 0.75 * (networkSeconds + flashSeconds));
+    TEST_ASSERT_TRUE(piped.seconds <= sync.seconds * 1.25);
+}
+
+int main(int argc, char** argv) {
+    image = syntheticImage(IMAGE_SIZE, 0x0DE5C0);
+    imageFile.write(image);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_download_reaches_flash_intact);
+    RUN_TEST(test_header_reaches_flash_only_at_end);
+    RUN_TEST(test_sink_failure_returns_later_buffers_unwritten);
+    RUN_TEST(test_stuck_writer_is_aborted_after_its_current_write);
+    RUN_TEST(test_benchmark_download_throughput);
+    return UNITY_END();
+}
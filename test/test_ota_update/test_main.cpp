@@ -0,0 +1,249 @@
+#include <unity.h>
+#include "test_support.h"
+
+// OtaManager needs the ESP32 core and IDF; the parts it calls are shimmed in
+// native_shim (Update over a file, esp_ota_ops reading it back, the task
+// watchdog, mbedtls SHA-256, HTTPClient over host sockets)
+#include "OtaManager.cpp"
+
+// Synthetic firmware served by scripts/mock_ota.py and flashed into a file
+static const size_t IMAGE_SIZE = 1024 * 1024;
+static const unsigned long UPDATE_TIMEOUT_MS = 30000;
+
+static std::string image;
+static std::string imageSha256;
+static TempFile imageFile("ota_image_");
+static TempFile tamperedFile("ota_tampered_");
+static TempFile flashFile("ota_flash_");
+static MockServer mock;
+
+// One manager for the suite; its update tasks end on their own
+static OtaManager ota("1.0.0", "PostHog", "DeskHog");
+
+/**
+ * @brief Bytes that do not compress or repeat, so a misplaced buffer shows up
+ */
+static std::string syntheticImage(size_t size, uint32_t seed) {
+    std::string data(size, '\0');
+    uint32_t state = seed;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1664525u + 1013904223u;
+        data[i] = (char)(state >> 24);
+    }
+    return data;
+}
+
+static std::string sha256Hex(const std::string& data) {
+    uint8_t digest[32];
+    mbedtls_sha256((const unsigned char*)data.data(), data.size(), digest, 0);
+    char hex[65];
+    for (int i = 0; i < 32; i++) {
+        snprintf(hex + i * 2, 3, "%02x", digest[i]);
+    }
+    return std::string(hex, 64);
+}
+
+static bool startMock(const TempFile& served, const std::string& options) {
+    return mock.start("mock_ota.py", "--image " + served.path() + " " + options);
+}
+
+static bool isFinished(UpdateStatus::State state) {
+    switch (state) {
+        case UpdateStatus::State::CHECKING_VERSION:
+        case UpdateStatus::State::DOWNLOADING:
+        case UpdateStatus::State::WRITING:
+        case UpdateStatus::State::MUTEX_BUSY:
+            return false;
+        default:
+            return true;
+    }
+}
+
+struct Outcome {
+    UpdateStatus::State state = UpdateStatus::State::IDLE;
+    bool restarted = false;
+    unsigned long ms = 0;
+    std::string stats;   ///< The mock server's closing counts
+};
+
+/**
+ * @brief Run beginUpdate() against the mock server until it reboots or gives up
+ */
+static Outcome runUpdate(const std::string& sha256) {
+    Outcome outcome;
+    int restartsBefore = ESP.restartCount();
+    unsigned long start = millis();
+    TEST_ASSERT_TRUE(ota.beginUpdate(String(mock.url()) + "/firmware.bin", sha256.c_str()));
+
+    while (millis() - start < UPDATE_TIMEOUT_MS) {
+        UpdateStatus status = ota.getStatus();
+        // A success reboots after the status is set; a failure aborts Update after it
+        if (status.status == UpdateStatus::State::SUCCESS ? ESP.restartCount() > restartsBefore
+                                                          : isFinished(status.status) && !Update.isRunning()) {
+            outcome.state = status.status;
+            break;
+        }
+        delay(20);
+    }
+    outcome.ms = millis() - start;
+    outcome.restarted = ESP.restartCount() > restartsBefore;
+    outcome.stats = mock.stop();
+    return outcome;
+}
+
+void setUp() {
+    Update.setPartition(flashFile.path(), 0x1F0000);
+}
+
+void tearDown() {
+    mock.stop();
+}
+
+void test_download_flashes_image_and_restarts() {
+    TEST_ASSERT_TRUE(startMock(imageFile, ""));
+
+    Outcome outcome = runUpdate(imageSha256);
+    TEST_ASSERT_EQUAL(UpdateStatus::State::SUCCESS, outcome.state);
+    TEST_ASSERT_TRUE(outcome.restarted);
+    TEST_ASSERT_TRUE(Update.ended());
+    TEST_ASSERT_TRUE(flashFile.read() == image);
+    TEST_ASSERT_EQUAL(1, MockServer::stat(outcome.stats, "requests"));
+    TEST_ASSERT_EQUAL(0, MockServer::stat(outcome.stats, "range_requests"));
+}
+
+void test_cut_connection_resumes_to_identical_image() {
+    // Two drops, each picked up with a Range request from where flash got to
+    TEST_ASSERT_TRUE(startMock(imageFile, "--cut-after 300000 --cuts 2"));
+
+    Outcome outcome = runUpdate(imageSha256);
+    TEST_ASSERT_EQUAL(UpdateStatus::State::SUCCESS, outcome.state);
+    TEST_ASSERT_TRUE(flashFile.read() == image);
+    TEST_ASSERT_EQUAL(2, MockServer::stat(outcome.stats, "cuts"));
+    TEST_ASSERT_EQUAL(2, MockServer::stat(outcome.stats, "range_requests"));
+    // Nothing was downloaded twice
+    TEST_ASSERT_EQUAL(IMAGE_SIZE, MockServer::stat(outcome.stats, "bytes_sent"));
+    printf("OtaManager: resumed twice in %lu ms, %ld bytes sent for a %u byte image\n",
+           outcome.ms, MockServer::stat(outcome.stats, "bytes_sent"), (unsigned)IMAGE_SIZE);
+}
+
+void test_resume_skips_flashed_bytes_when_range_is_ignored() {
+    const size_t cutAfter = 400000;
+    TEST_ASSERT_TRUE(startMock(imageFile, "--cut-after " + std::to_string(cutAfter) + " --ignore-range"));
+
+    Outcome outcome = runUpdate(imageSha256);
+    TEST_ASSERT_EQUAL(UpdateStatus::State::SUCCESS, outcome.state);
+    TEST_ASSERT_TRUE(flashFile.read() == image);
+    TEST_ASSERT_EQUAL(1, MockServer::stat(outcome.stats, "range_requests"));
+    // The whole image came again and its start was thrown away
+    TEST_ASSERT_EQUAL(IMAGE_SIZE + cutAfter, MockServer::stat(outcome.stats, "bytes_sent"));
+}
+
+void test_sha256_matches_published_vectors() {
+    // FIPS 180-2 examples
+    TEST_ASSERT_EQUAL_STRING("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", sha256Hex("").c_str());
+    TEST_ASSERT_EQUAL_STRING("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", sha256Hex("abc").c_str());
+    TEST_ASSERT_EQUAL_STRING("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+                             sha256Hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq").c_str());
+}
+
+void test_tampered_image_is_rejected() {
+    // One flipped bit in the held-back header, the middle and the last byte
+    const size_t offsets[] = { 5, IMAGE_SIZE / 2, IMAGE_SIZE - 1 };
+    for (size_t offset : offsets) {
+        std::string tampered = image;
+        tampered[offset] ^= 0x01;
+        tamperedFile.write(tampered);
+        TEST_ASSERT_TRUE(startMock(tamperedFile, ""));
+        int abortsBefore = Update.abortCount();
+
+        Outcome outcome = runUpdate(imageSha256);
+        TEST_ASSERT_EQUAL_MESSAGE(UpdateStatus::State::ERROR_VERIFY, outcome.state, std::to_string(offset).c_str());
+        TEST_ASSERT_FALSE(outcome.restarted);
+        TEST_ASSERT_FALSE(Update.ended());
+        TEST_ASSERT_EQUAL(abortsBefore + 1, Update.abortCount());
+        // The header never went in, so the partition cannot boot
+        TEST_ASSERT_TRUE(flashFile.read().compare(0, UpdateClass::DEFERRED_BYTES,
+                                                  std::string(UpdateClass::DEFERRED_BYTES, '\xFF')) == 0);
+    }
+}
+
+void test_tampered_image_is_rejected_after_resume() {
+    std::string tampered = image;
+    tampered[IMAGE_SIZE - 100] ^= 0x80;
+    tamperedFile.write(tampered);
+    TEST_ASSERT_TRUE(startMock(tamperedFile, "--cut-after 500000"));
+
+    Outcome outcome = runUpdate(imageSha256);
+    TEST_ASSERT_EQUAL(UpdateStatus::State::ERROR_VERIFY, outcome.state);
+    TEST_ASSERT_EQUAL(1, MockServer::stat(outcome.stats, "range_requests"));
+    TEST_ASSERT_FALSE(outcome.restarted);
+    TEST_ASSERT_FALSE(Update.ended());
+}
+
+void test_tampered_digest_is_rejected() {
+    // The published digest with one hex digit changed, for an untouched image
+    std::string digest = imageSha256;
+    digest[17] = digest[17] == '0' ? '1' : '0';
+    TEST_ASSERT_TRUE(startMock(imageFile, ""));
+    int abortsBefore = Update.abortCount();
+
+    Outcome outcome = runUpdate(digest);
+    TEST_ASSERT_EQUAL(UpdateStatus::State::ERROR_VERIFY, outcome.state);
+    TEST_ASSERT_FALSE(outcome.restarted);
+    TEST_ASSERT_FALSE(Update.ended());
+    TEST_ASSERT_EQUAL(abortsBefore + 1, Update.abortCount());
+}
+
+void test_malformed_digest_never_downloads() {
+    TEST_ASSERT_TRUE(startMock(imageFile, ""));
+
+    TEST_ASSERT_FALSE(ota.beginUpdate(String(mock.url()) + "/firmware.bin", imageSha256.substr(1).c_str()));
+    TEST_ASSERT_FALSE(ota.beginUpdate(String(mock.url()) + "/firmware.bin", ("zz" + imageSha256.substr(2)).c_str()));
+    TEST_ASSERT_EQUAL(UpdateStatus::State::ERROR_VERIFY, ota.getStatus().status);
+    TEST_ASSERT_EQUAL(0, MockServer::stat(mock.stop(), "requests"));
+}
+
+void test_benchmark_sha256_throughput() {
+    // Hashed a pipeline buffer at a time, as the writer task does
+    const int rounds = 8;
+    uint8_t digest[32];
+    BenchTimer timer;
+    for (int round = 0; round < rounds; round++) {
+        mbedtls_sha256_context ctx;
+        mbedtls_sha256_init(&ctx);
+        mbedtls_sha256_starts(&ctx, 0);
+        for (size_t offset = 0; offset < IMAGE_SIZE; offset += OtaPipeline::BUFFER_SIZE) {
+            mbedtls_sha256_update(&ctx, (const unsigned char*)image.data() + offset,
+                                  min(OtaPipeline::BUFFER_SIZE, IMAGE_SIZE - offset));
+        }
+        mbedtls_sha256_finish(&ctx, digest);
+        mbedtls_sha256_free(&ctx);
+    }
+    double usPerMb = timer.elapsedUs() / rounds / (IMAGE_SIZE / 1048576.0);
+    printf("OtaManager: SHA-256 of %u KB in %u byte updates: %.0f us per MB (%.1f MB/s)\n",
+           (unsigned)(IMAGE_SIZE / 1024), (unsigned)OtaPipeline::BUFFER_SIZE, usPerMb, 1e6 / usPerMb);
+
+    char hex[65];
+    for (int i = 0; i < 32; i++) {
+        snprintf(hex + i * 2, 3, "%02x", digest[i]);
+    }
+    TEST_ASSERT_EQUAL_STRING(imageSha256.c_str(), hex);
+}
+
+int main(int argc, char** argv) {
+    image = syntheticImage(IMAGE_SIZE, 0x0DE5C0);
+    imageSha256 = sha256Hex(image);
+    imageFile.write(image);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_download_flashes_image_and_restarts);
+    RUN_TEST(test_cut_connection_resumes_to_identical_image);
+    RUN_TEST(test_resume_skips_flashed_bytes_when_range_is_ignored);
+    RUN_TEST(test_sha256_matches_published_vectors);
+    RUN_TEST(test_tampered_image_is_rejected);
+    RUN_TEST(test_tampered_image_is_rejected_after_resume);
+    RUN_TEST(test_tampered_digest_is_rejected);
+    RUN_TEST(test_malformed_digest_never_downloads);
+    RUN_TEST(test_benchmark_sha256_throughput);
+    return UNITY_END();
+}
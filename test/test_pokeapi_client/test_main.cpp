@@ -0,0 +1,369 @@
+#include <unity.h>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ui/SpriteCache.h"
+#include "ui/SpriteDecoder.h"
+#include "test_support.h"
+
+// The host is a build flag; point it at whichever port the mock server got
+static char mockHost[64];
+#define POKEAPI_HOST mockHost
+
+// Built into this suite rather than the shared native sources, since it
+// needs the EventQueue stubs below
+#include "network/PokeAPIClient.cpp"
+
+static const uint32_t FETCH_TIMEOUT_MS = 20000;
+
+/**
+ * @brief An event a lane published, and when
+ */
+struct Received {
+    Event event;
+    unsigned long atMs;
+};
+
+static std::mutex receivedMutex;
+static std::condition_variable receivedChanged;
+static std::vector<Received> received;
+
+EventQueue::EventQueue(size_t queueSize)
+    : eventQueue(nullptr), callbackMutex(nullptr), taskHandle(nullptr), isRunning(false) {}
+EventQueue::~EventQueue() {}
+void EventQueue::subscribe(EventCallback callback) {}
+
+bool EventQueue::publishEvent(const Event& event) {
+    std::lock_guard<std::mutex> lock(receivedMutex);
+    received.push_back({ event, millis() });
+    receivedChanged.notify_all();
+    return true;
+}
+
+/**
+ * @brief What arrived for one Pokemon
+ */
+struct Fetched {
+    bool haveSpecies = false;
+    bool haveSprite = false;
+    bool failed = false;
+    String name;
+    unsigned long speciesAtMs = 0;
+    unsigned long spriteAtMs = 0;
+    std::vector<uint8_t> png;
+};
+
+/**
+ * @brief Take this Pokemon's events off the received list, waiting up to timeoutMs for the halves asked for
+ */
+static Fetched collect(int id, uint32_t timeoutMs, bool needSpecies = true, bool needSprite = true) {
+    Fetched fetched;
+    std::unique_lock<std::mutex> lock(receivedMutex);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true) {
+        for (auto it = received.begin(); it != received.end(); ) {
+            if (it->event.intData != id) {
+                ++it;
+                continue;
+            }
+            const Event& event = it->event;
+            if (event.type == EventType::POKEAPI_DATA_READY) {
+                fetched.haveSpecies = true;
+                fetched.name = event.stringData;
+                fetched.speciesAtMs = it->atMs;
+            } else if (event.type == EventType::POKEAPI_SPRITE_READY) {
+                fetched.haveSprite = true;
+                fetched.png.assign(event.byteData, event.byteData + event.byteDataSize);
+                fetched.spriteAtMs = it->atMs;
+                delete[] event.byteData;
+            } else if (event.type == EventType::POKEAPI_ERROR) {
+                fetched.failed = true;
+            }
+            it = received.erase(it);
+        }
+        if ((fetched.haveSpecies >= needSpecies && fetched.haveSprite >= needSprite) || fetched.failed) {
+            return fetched;
+        }
+        if (receivedChanged.wait_until(lock, deadline) == std::cv_status::timeout) {
+            return fetched;
+        }
+    }
+}
+
+static PokeAPIClient* client = nullptr;
+static EventQueue events;
+static MockServer mock;
+
+/**
+ * @brief Start scripts/mock_pokeapi.py and point the client at it
+ */
+static bool startMock(const std::string& options) {
+    if (!mock.start("mock_pokeapi.py", options)) {
+        return false;
+    }
+    snprintf(mockHost, sizeof(mockHost), "%s", mock.url());
+    return true;
+}
+
+/**
+ * @brief Decode a fetched sprite into the cache, as PokedexCard::finishPrefetch does
+ */
+static bool cacheFetched(SpriteCache& cache, int id, const Fetched& fetched) {
+    if (!fetched.haveSpecies || !fetched.haveSprite) {
+        return false;
+    }
+    SpriteCache::SpriteRef sprite = SpriteCache::adopt(SpriteDecoder::decodePng(fetched.png.data(), fetched.png.size()));
+    if (!sprite) {
+        return false;
+    }
+    return cache.put(id, fetched.name, "", sprite);
+}
+
+/**
+ * @brief One press on the Pokedex card, from the button to the sprite being ready to draw
+ *
+ * Mirrors PokedexCard: a cached Pokemon is shown at once, anything else is
+ * fetched on both lanes together and shown once both halves are in and the
+ * sprite has been decoded.
+ * @return Milliseconds to display, or -1 if the fetch failed
+ */
+static long pressToDisplay(SpriteCache& cache, int id) {
+    unsigned long pressMs = millis();
+    if (cache.get(id)) {
+        return millis() - pressMs;
+    }
+
+    client->requestSpecies(id);
+    client->requestSprite(id);
+    Fetched fetched = collect(id, FETCH_TIMEOUT_MS);
+    if (!cacheFetched(cache, id, fetched)) {
+        return -1;
+    }
+    return millis() - pressMs;
+}
+
+static long median(std::vector<long> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void setUp() {
+    if (!client) {
+        // Started once and never destroyed, as main.cpp has it; lane tasks cannot be stopped on the host
+        client = new PokeAPIClient(events);
+        client->begin();
+    }
+    std::lock_guard<std::mutex> lock(receivedMutex);
+    received.clear();
+}
+
+void tearDown() {
+    mock.stop();
+}
+
+void test_press_fetches_and_decodes() {
+    TEST_ASSERT_TRUE(startMock("--latency 100"));
+    SpriteCache cache(192 * 1024);
+
+    long ms = pressToDisplay(cache, 25);
+    TEST_ASSERT_GREATER_OR_EQUAL(100, ms);
+    const SpriteCache::Entry* entry = cache.get(25);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_STRING("pokemon-25", entry->name.c_str());
+    TEST_ASSERT_EQUAL(96, entry->sprite->header.w);
+}
+
+void test_prefetched_press_displays_from_cache() {
+    TEST_ASSERT_TRUE(startMock("--latency 300"));
+    SpriteCache cache(192 * 1024);
+
+    long cold = pressToDisplay(cache, 1);
+    TEST_ASSERT_GREATER_OR_EQUAL(300, cold);
+
+    // While #1 is on screen the card prefetches the next one
+    client->requestPrefetch(2);
+    TEST_ASSERT_TRUE(cacheFetched(cache, 2, collect(2, FETCH_TIMEOUT_MS)));
+
+    long warm = pressToDisplay(cache, 2);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, warm);
+    TEST_ASSERT_LESS_THAN(20, warm);
+}
+
+void test_failed_prefetch_leaves_nothing_cached() {
+    TEST_ASSERT_TRUE(startMock("--fail-ids 7"));
+    SpriteCache cache(192 * 1024);
+
+    // Retries back off 1 s then 2 s before the error comes out
+    client->requestPrefetch(7);
+    Fetched fetched = collect(7, FETCH_TIMEOUT_MS);
+    TEST_ASSERT_TRUE(fetched.failed);
+    TEST_ASSERT_FALSE(cacheFetched(cache, 7, fetched));
+    TEST_ASSERT_FALSE(cache.contains(7));
+
+    // Collect the other lane's error too, so it cannot leak into the next test
+    TEST_ASSERT_TRUE(collect(7, FETCH_TIMEOUT_MS).failed);
+}
+
+void test_species_without_length_ends_when_the_server_closes() {
+    TEST_ASSERT_TRUE(startMock("--latency 50 --no-length"));
+    SpriteCache cache(192 * 1024);
+
+    // The species body runs to the end of the connection, so it must not wait out the 5 s idle timeout
+    long ms = pressToDisplay(cache, 133);
+    TEST_ASSERT_GREATER_OR_EQUAL(50, ms);
+    TEST_ASSERT_LESS_THAN(1000, ms);
+}
+
+void test_benchmark_press_to_display_with_prefetch() {
+    const int presses = 6;
+    const uint32_t viewMs = 800;   // Time spent reading each Pokemon before the next press
+    TEST_ASSERT_TRUE(startMock("--latency 250 --jitter 100 --kbps 400 --seed 11"));
+
+    SpriteCache coldCache(192 * 1024);
+    std::vector<long> cold;
+    for (int i = 0; i < presses; i++) {
+        long ms = pressToDisplay(coldCache, 100 + i);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, ms);
+        cold.push_back(ms);
+        delay(viewMs);
+    }
+
+    SpriteCache warmCache(192 * 1024);
+    std::vector<long> warm;
+    TEST_ASSERT_GREATER_OR_EQUAL(0, pressToDisplay(warmCache, 200));
+    for (int i = 1; i <= presses; i++) {
+        // Prefetch while the current one is viewed, then press
+        client->requestPrefetch(200 + i);
+        unsigned long viewStart = millis();
+        cacheFetched(warmCache, 200 + i, collect(200 + i, viewMs));
+        long remaining = (long)viewMs - (long)(millis() - viewStart);
+        if (remaining > 0) {
+            delay(remaining);
+        }
+        long ms = pressToDisplay(warmCache, 200 + i);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, ms);
+        warm.push_back(ms);
+    }
+    std::string server = mock.stop();
+
+    printf("PokeAPIClient: press-to-display median %ld ms without prefetch, %ld ms with (%d presses, %u ms on each)\n",
+           median(cold), median(warm), presses, (unsigned)viewMs);
+    printf("PokeAPIClient: server %s", server.c_str());
+
+    TEST_ASSERT_GREATER_OR_EQUAL(150, median(cold));
+    TEST_ASSERT_LESS_THAN(median(cold) / 4, median(warm));
+}
+
+void test_species_and_sprite_fetch_in_parallel() {
+    TEST_ASSERT_TRUE(startMock("--latency 400"));
+    SpriteCache cache(192 * 1024);
+
+    client->requestSpecies(4);
+    client->requestSprite(4);
+    unsigned long pressMs = millis();
+    Fetched fetched = collect(4, FETCH_TIMEOUT_MS);
+    TEST_ASSERT_TRUE(fetched.haveSpecies && fetched.haveSprite);
+
+    // One after the other would take at least 800 ms
+    long species = (long)(fetched.speciesAtMs - pressMs);
+    long sprite = (long)(fetched.spriteAtMs - pressMs);
+    TEST_ASSERT_LESS_THAN(600, std::max(species, sprite));
+    TEST_ASSERT_LESS_THAN(200, labs(species - sprite));
+    TEST_ASSERT_GREATER_OR_EQUAL(2, MockServer::stat(mock.stop(), "max_in_flight"));
+}
+
+void test_retry_backoff_does_not_block_other_jobs() {
+    TEST_ASSERT_TRUE(startMock("--latency 100 --fail-ids 7"));
+    SpriteCache cache(192 * 1024);
+
+    // #7 fails and backs off for 1 s, then 2 s, on both lanes
+    client->requestSpecies(7);
+    client->requestSprite(7);
+    delay(150);
+    long ms = pressToDisplay(cache, 8);
+    TEST_ASSERT_GREATER_OR_EQUAL(100, ms);
+    TEST_ASSERT_LESS_THAN(600, ms);
+
+    TEST_ASSERT_TRUE(collect(7, FETCH_TIMEOUT_MS).failed);
+    TEST_ASSERT_TRUE(collect(7, FETCH_TIMEOUT_MS).failed);
+}
+
+void test_foreground_is_served_before_prefetch() {
+    TEST_ASSERT_TRUE(startMock("--latency 200"));
+
+    // Keep both lanes busy so everything below is waiting when they free up
+    client->requestSpecies(29);
+    client->requestSprite(29);
+    delay(50);
+    client->requestPrefetch(30);
+    client->requestPrefetch(31);
+    client->requestSpecies(32);
+    client->requestSprite(32);
+
+    TEST_ASSERT_TRUE(collect(29, FETCH_TIMEOUT_MS).haveSprite);
+    Fetched foreground = collect(32, FETCH_TIMEOUT_MS);
+    Fetched first = collect(30, FETCH_TIMEOUT_MS);
+    Fetched second = collect(31, FETCH_TIMEOUT_MS);
+    TEST_ASSERT_TRUE(foreground.haveSpecies && foreground.haveSprite);
+    TEST_ASSERT_TRUE(first.haveSpecies && first.haveSprite);
+    TEST_ASSERT_TRUE(second.haveSpecies && second.haveSprite);
+
+    TEST_ASSERT_LESS_THAN(first.speciesAtMs, foreground.speciesAtMs);
+    TEST_ASSERT_LESS_THAN(first.spriteAtMs, foreground.spriteAtMs);
+    TEST_ASSERT_LESS_OR_EQUAL(second.speciesAtMs, first.speciesAtMs);
+}
+
+void test_benchmark_parallel_fetch_latency() {
+    const int presses = 8;
+    TEST_ASSERT_TRUE(startMock("--latency 300 --jitter 50 --kbps 800 --seed 5"));
+
+    // Baseline: the sprite requested only once the species data is in, as before the lanes
+    std::vector<long> serial;
+    for (int i = 0; i < presses; i++) {
+        int id = 300 + i;
+        unsigned long pressMs = millis();
+        client->requestSpecies(id);
+        Fetched species = collect(id, FETCH_TIMEOUT_MS, true, false);
+        TEST_ASSERT_TRUE(species.haveSpecies);
+        client->requestSprite(id);
+        Fetched sprite = collect(id, FETCH_TIMEOUT_MS, false, true);
+        TEST_ASSERT_TRUE(sprite.haveSprite);
+        serial.push_back((long)(sprite.spriteAtMs - pressMs));
+    }
+
+    std::vector<long> parallel;
+    std::vector<long> skew;
+    for (int i = 0; i < presses; i++) {
+        int id = 400 + i;
+        unsigned long pressMs = millis();
+        client->requestSpecies(id);
+        client->requestSprite(id);
+        Fetched fetched = collect(id, FETCH_TIMEOUT_MS);
+        TEST_ASSERT_TRUE(fetched.haveSpecies && fetched.haveSprite);
+        parallel.push_back((long)(std::max(fetched.speciesAtMs, fetched.spriteAtMs) - pressMs));
+        skew.push_back(labs((long)(fetched.speciesAtMs - fetched.spriteAtMs)));
+    }
+    std::string server = mock.stop();
+
+    printf("PokeAPIClient: both halves in after median %ld ms in parallel, %ld ms one after the other "
+           "(%d Pokemon, lanes %ld ms apart at the median, %ld requests in flight at most)\n",
+           median(parallel), median(serial), presses, median(skew), MockServer::stat(server, "max_in_flight"));
+
+    TEST_ASSERT_LESS_THAN(median(serial) * 3 / 4, median(parallel));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_press_fetches_and_decodes);
+    RUN_TEST(test_prefetched_press_displays_from_cache);
+    RUN_TEST(test_failed_prefetch_leaves_nothing_cached);
+    RUN_TEST(test_species_without_length_ends_when_the_server_closes);
+    RUN_TEST(test_benchmark_press_to_display_with_prefetch);
+    RUN_TEST(test_species_and_sprite_fetch_in_parallel);
+    RUN_TEST(test_retry_backoff_does_not_block_other_jobs);
+    RUN_TEST(test_foreground_is_served_before_prefetch);
+    RUN_TEST(test_benchmark_parallel_fetch_latency);
+    return UNITY_END();
+}
@@ -0,0 +1,300 @@
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <Preferences.h>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test_support.h"
+
+// The API host is a build flag; point it at whichever port the mock server got
+static char mockHost[64];
+#define POSTHOG_API_HOST mockHost
+
+// Built into this suite rather than the shared native sources, since they
+// need the stubs below
+#include "ConfigManager.cpp"
+#include "posthog/PostHogClient.cpp"
+
+static const uint32_t INSIGHT_TASK_PERIOD_MS = 100;   // insightTaskFunction's sleep between process() calls
+static const uint32_t LOAD_TIMEOUT_MS = 60000;
+
+struct Published {
+    String insightId;
+    String json;
+};
+
+static std::vector<Published> published;
+
+void SystemController::setApiState(ApiState state) {}
+bool SystemController::isSystemFullyReady() { return true; }
+
+EventQueue::EventQueue(size_t queueSize)
+    : eventQueue(nullptr), callbackMutex(nullptr), taskHandle(nullptr), isRunning(false) {}
+EventQueue::~EventQueue() {}
+void EventQueue::subscribe(EventCallback callback) {}
+bool EventQueue::publishEvent(EventType eventType, const String& insightId) { return true; }
+
+bool EventQueue::publishEvent(EventType eventType, const String& insightId, const String& jsonData) {
+    published.push_back({ insightId, jsonData });
+    return true;
+}
+
+/**
+ * @brief What loading a set of cards took, from the client's metrics
+ */
+struct LoadRun {
+    bool finished;          ///< The client recorded its all-insights load time
+    uint32_t wallMs;
+    int32_t clientMs;       ///< posthog_all_insights_load_ms
+    uint32_t retries;
+    uint32_t cacheMisses;
+    uint32_t errors;
+    uint32_t bytes;
+};
+
+static MockServer mock;
+static ConfigManager* config = nullptr;
+static EventQueue events;
+
+/**
+ * @brief Start scripts/mock_posthog.py and point the client at it
+ */
+static bool startMock(const char* options) {
+    if (!mock.start("mock_posthog.py", options)) {
+        return false;
+    }
+    snprintf(mockHost, sizeof(mockHost), "%s", mock.url());
+    return true;
+}
+
+/**
+ * @brief Run the client as insightTaskFunction does until every requested insight has settled
+ */
+static LoadRun runUntilLoaded(PostHogClient& client) {
+    uint32_t retries = Metrics::fetchRetries.value();
+    uint32_t cacheMisses = Metrics::fetchCacheMisses.value();
+    uint32_t errors = Metrics::fetchErrors.value();
+    uint32_t bytes = Metrics::fetchBytes.value();
+
+    BenchTimer timer;
+    while (Metrics::allInsightsLoadMs.value() < 0 && timer.elapsedUs() < LOAD_TIMEOUT_MS * 1000.0) {
+        client.process();
+        delay(INSIGHT_TASK_PERIOD_MS);
+    }
+
+    LoadRun run;
+    run.finished = Metrics::allInsightsLoadMs.value() >= 0;
+    run.wallMs = (uint32_t)(timer.elapsedUs() / 1000);
+    run.clientMs = Metrics::allInsightsLoadMs.value();
+    run.retries = Metrics::fetchRetries.value() - retries;
+    run.cacheMisses = Metrics::fetchCacheMisses.value() - cacheMisses;
+    run.errors = Metrics::fetchErrors.value() - errors;
+    run.bytes = Metrics::fetchBytes.value() - bytes;
+    return run;
+}
+
+/**
+ * @brief Request every card's insight, as the card factory does, and run the client until all have loaded
+ */
+static LoadRun loadCards(PostHogClient& client, const std::vector<String>& ids) {
+    for (const String& id : ids) {
+        client.requestInsightData(id);
+    }
+    return runUntilLoaded(client);
+}
+
+static std::vector<String> cardIds(size_t count) {
+    std::vector<String> ids;
+    for (size_t i = 0; i < count; i++) {
+        char id[16];
+        snprintf(id, sizeof(id), "card%02u", (unsigned)i);
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+/**
+ * @brief Whether a published body is a whole insight response for this card, with a result
+ */
+static bool isCompleteInsight(const Published& entry) {
+    DynamicJsonDocument doc(entry.json.length() * 4 + 4096);
+    if (deserializeJson(doc, entry.json.c_str(), entry.json.length())) {
+        return false;
+    }
+    JsonObject insight = doc.as<JsonObject>()["results"][0].as<JsonObject>();
+    return insight["short_id"].as<String>() == entry.insightId && !insight["result"].isNull();
+}
+
+static std::set<String> publishedIds() {
+    std::set<String> ids;
+    for (const Published& entry : published) {
+        ids.insert(entry.insightId);
+    }
+    return ids;
+}
+
+void setUp() {
+    Metrics::allInsightsLoadMs.set(-1);
+    published.clear();
+    if (!config) {
+        // Started once and never destroyed, as main.cpp has it
+        Preferences prefs;
+        prefs.begin("wifi_config");
+        prefs.putInt("team_id", 12345);
+        prefs.putString("api_key", "phx_test");
+        prefs.putString("region", "us");
+        config = new ConfigManager();
+        config->begin();
+    }
+}
+
+void tearDown() {
+    mock.stop();
+}
+
+void test_cards_load_from_a_healthy_server() {
+    TEST_ASSERT_TRUE(startMock(""));
+    PostHogClient client(*config, events);
+    std::vector<String> ids = cardIds(6);
+
+    LoadRun run = loadCards(client, ids);
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_EQUAL(6, published.size());
+    TEST_ASSERT_EQUAL(6, publishedIds().size());
+    uint32_t publishedBytes = 0;
+    for (const Published& entry : published) {
+        TEST_ASSERT_TRUE_MESSAGE(isCompleteInsight(entry), entry.insightId.c_str());
+        publishedBytes += entry.json.length();
+    }
+    TEST_ASSERT_EQUAL(0, run.retries);
+    TEST_ASSERT_EQUAL(0, run.cacheMisses);
+    TEST_ASSERT_EQUAL(publishedBytes, run.bytes);
+}
+
+void test_empty_cached_result_is_fetched_blocking() {
+    TEST_ASSERT_TRUE(startMock("--null-first"));
+    PostHogClient client(*config, events);
+
+    LoadRun run = loadCards(client, cardIds(4));
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_EQUAL(4, run.cacheMisses);
+    TEST_ASSERT_EQUAL(0, run.retries);
+    TEST_ASSERT_EQUAL(4, published.size());
+    for (const Published& entry : published) {
+        TEST_ASSERT_TRUE_MESSAGE(isCompleteInsight(entry), entry.insightId.c_str());
+    }
+}
+
+void test_server_errors_are_retried() {
+    TEST_ASSERT_TRUE(startMock("--error-rate 0.3 --seed 4"));
+    PostHogClient client(*config, events);
+
+    LoadRun run = loadCards(client, cardIds(6));
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_GREATER_THAN(0, run.retries);
+    TEST_ASSERT_EQUAL(6, publishedIds().size());
+}
+
+void test_truncated_bodies_are_retried_not_published() {
+    TEST_ASSERT_TRUE(startMock("--truncate-rate 0.4 --seed 4"));
+    PostHogClient client(*config, events);
+
+    LoadRun run = loadCards(client, cardIds(6));
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_GREATER_THAN(0, run.retries);
+    TEST_ASSERT_EQUAL(6, published.size());
+    for (const Published& entry : published) {
+        TEST_ASSERT_TRUE_MESSAGE(isCompleteInsight(entry), entry.insightId.c_str());
+    }
+}
+
+void test_card_that_never_loads_does_not_stall_the_load_time() {
+    TEST_ASSERT_TRUE(startMock("--fail-ids broken"));
+    PostHogClient client(*config, events);
+    std::vector<String> ids = cardIds(3);
+    ids.push_back("broken");
+
+    // The broken card runs out of retries; the rest still count as loaded
+    LoadRun run = loadCards(client, ids);
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_EQUAL(3, publishedIds().size());
+    TEST_ASSERT_EQUAL(4, run.errors);   // The first attempt and MAX_RETRIES more
+}
+
+void test_removed_card_does_not_stall_the_load_time() {
+    TEST_ASSERT_TRUE(startMock(""));
+    PostHogClient client(*config, events);
+    std::vector<String> ids = cardIds(2);
+    for (const String& id : ids) {
+        client.requestInsightData(id);
+    }
+
+    // Queued last, and its card is removed before it is fetched
+    client.requestInsightData("removed");
+    std::set<String> remaining(ids.begin(), ids.end());
+    client.retainInsights(remaining);
+
+    // Loading finishes with the remaining cards, before the stale request is reached
+    LoadRun run = runUntilLoaded(client);
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_TRUE(publishedIds() == remaining);
+}
+
+void test_cards_rebuilt_while_loading() {
+    TEST_ASSERT_TRUE(startMock("--latency 20"));
+    PostHogClient client(*config, events);
+    std::vector<String> ids = cardIds(6);
+    for (const String& id : ids) {
+        client.requestInsightData(id);
+    }
+    client.requestInsightData("removed");
+    std::set<String> remaining(ids.begin(), ids.end());
+
+    // The event task keeps rebuilding the cards, one dropped, while the insight task settles loads
+    std::atomic<bool> loading(true);
+    std::thread rebuilds([&]() {
+        while (loading.load()) {
+            client.retainInsights(remaining);
+            delay(1);
+        }
+    });
+    LoadRun run = runUntilLoaded(client);
+    loading.store(false);
+    rebuilds.join();
+
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_TRUE(publishedIds() == remaining);
+}
+
+void test_end_to_end_benchmark() {
+    const size_t cards = 12;
+    TEST_ASSERT_TRUE(startMock("--latency 120 --jitter 60 --error-rate 0.1 --null-first "
+                               "--truncate-rate 0.05 --size 16384 --seed 7"));
+    PostHogClient client(*config, events);
+
+    LoadRun run = loadCards(client, cardIds(cards));
+    std::string server = mock.stop();
+
+    TEST_ASSERT_TRUE(run.finished);
+    TEST_ASSERT_EQUAL(cards, publishedIds().size());
+    printf("PostHogClient: %u cards in %u ms (client measured %d ms); %u retries, %u cache misses, "
+           "%u errors, %u bytes received\n",
+           (unsigned)cards, (unsigned)run.wallMs, (int)run.clientMs, (unsigned)run.retries,
+           (unsigned)run.cacheMisses, (unsigned)run.errors, (unsigned)run.bytes);
+    printf("PostHogClient: server %s", server.c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cards_load_from_a_healthy_server);
+    RUN_TEST(test_empty_cached_result_is_fetched_blocking);
+    RUN_TEST(test_server_errors_are_retried);
+    RUN_TEST(test_truncated_bodies_are_retried_not_published);
+    RUN_TEST(test_card_that_never_loads_does_not_stall_the_load_time);
+    RUN_TEST(test_removed_card_does_not_stall_the_load_time);
+    RUN_TEST(test_cards_rebuilt_while_loading);
+    RUN_TEST(test_end_to_end_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,150 @@
+#include <unity.h>
+#include <string>
+#include "ResourceMonitor.h"
+#include "test_support.h"
+
+/**
+ * @class StringPrint
+ * @brief Print that collects the report, as Serial would show it
+ */
+class StringPrint : public Print {
+public:
+    size_t write(uint8_t c) override {
+        text += (char)c;
+        return 1;
+    }
+
+    std::string text;
+};
+
+static ResourceMonitor::TaskSample taskSample(const char* name, uint32_t stackSize, int32_t freeMin) {
+    ResourceMonitor::TaskSample task = {};
+    task.name = name;
+    task.stackSize = stackSize;
+    task.freeMin = freeMin;
+    return task;
+}
+
+static bool waitUntilUnregistered(const char* name) {
+    for (int i = 0; i < 1000 && ResourceMonitor::isRegistered(name); i++) {
+        vTaskDelay(1);
+    }
+    return !ResourceMonitor::isRegistered(name);
+}
+
+static TaskHandle_t selfClearingHandle = nullptr;
+static TaskHandle_t handleSeenByTask = nullptr;
+
+/**
+ * @brief Like the OTA check task: reads and clears its own handle, then ends at once
+ */
+static void selfClearingTask(void* parameter) {
+    handleSeenByTask = selfClearingHandle;
+    selfClearingHandle = nullptr;
+    ResourceMonitor::deleteTask(NULL);
+}
+
+/**
+ * @brief Blocks until notified, like a worker waiting for jobs
+ */
+static void waitingTask(void* parameter) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    ResourceMonitor::deleteTask(NULL);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_suggested_stack_sizes() {
+    // 2000 used: 25% headroom is 500, so the 512 minimum applies; 2512 rounds to 2560
+    TEST_ASSERT_EQUAL(2560, ResourceMonitor::suggestStackSize(taskSample("a", 8192, 6192)));
+    // 6000 used: +1500 is 7500, rounds to 7680
+    TEST_ASSERT_EQUAL(7680, ResourceMonitor::suggestStackSize(taskSample("b", 8192, 2192)));
+    // Exactly on a boundary stays there
+    TEST_ASSERT_EQUAL(2560, ResourceMonitor::suggestStackSize(taskSample("c", 4096, 2048)));
+    TEST_ASSERT_EQUAL(0, ResourceMonitor::suggestStackSize(taskSample("d", 4096, -1)));
+}
+
+void test_report_lines() {
+    ResourceMonitor::TaskSample tasks[] = {
+        taskSample("lvglTask", 8192, 5000),       // Uses 3192; 3990 rounds to 4096, so oversized
+        taskSample("poke_species", 12288, 300),   // Within 512 bytes of the top
+        taskSample("otaUpdateTask", 12288, -1),   // Never ran
+        taskSample("neoPixelTask", 2048, 1000),   // 1048 + 512 rounds to 2048: right-sized
+    };
+    ResourceMonitor::HeapSample heap = { 90000, 61000, 40000, 7000000, 6500000, 4000000 };
+
+    StringPrint out;
+    ResourceMonitor::formatReport(out, tasks, 4, heap);
+
+    const char* expected =
+        "ResourceMonitor: task              stack   peak   free  suggest\r\n"
+        "ResourceMonitor: lvglTask           8192   3192   5000     4096  oversized\n"
+        "ResourceMonitor: poke_species      12288  11988    300    15360  LOW\n"
+        "ResourceMonitor: otaUpdateTask     12288      -      -        -  (not seen)\n"
+        "ResourceMonitor: neoPixelTask       2048   1048   1000     2048\n"
+        "ResourceMonitor: internal heap free 90000, min 61000, largest block 40000\n"
+        "ResourceMonitor: PSRAM free 7000000, min 6500000, largest block 4000000\n";
+    TEST_ASSERT_EQUAL_STRING(expected, out.text.c_str());
+}
+
+void test_report_with_no_tasks() {
+    ResourceMonitor::HeapSample heap = {};
+    StringPrint out;
+    ResourceMonitor::formatReport(out, nullptr, 0, heap);
+    TEST_ASSERT_EQUAL(0, out.text.find("ResourceMonitor: task"));
+    TEST_ASSERT_TRUE(out.text.find("internal heap free 0, min 0") != std::string::npos);
+}
+
+void test_task_registered_until_it_deletes_itself() {
+    TaskHandle_t handle = nullptr;
+    TEST_ASSERT_EQUAL(pdPASS, ResourceMonitor::createTask(waitingTask, "testWorker", 4096, nullptr, 1, &handle, 0));
+    TEST_ASSERT_NOT_NULL(handle);
+    TEST_ASSERT_TRUE(ResourceMonitor::isRegistered("testWorker"));
+
+    xTaskNotifyGive(handle);
+    TEST_ASSERT_TRUE(waitUntilUnregistered("testWorker"));
+}
+
+void test_task_deleted_by_another_is_unregistered() {
+    TaskHandle_t handle = nullptr;
+    ResourceMonitor::createTask(waitingTask, "testVictim", 4096, nullptr, 1, &handle, 0);
+    TEST_ASSERT_TRUE(ResourceMonitor::isRegistered("testVictim"));
+
+    ResourceMonitor::deleteTask(handle);
+    TEST_ASSERT_FALSE(ResourceMonitor::isRegistered("testVictim"));
+}
+
+void test_handle_is_set_before_the_task_runs() {
+    // The task ends immediately, but only after the creator has stored and
+    // registered its handle
+    ResourceMonitor::createTask(selfClearingTask, "testQuick", 4096, nullptr, 1, &selfClearingHandle, 0);
+    TEST_ASSERT_TRUE(waitUntilUnregistered("testQuick"));
+    TEST_ASSERT_NOT_NULL(handleSeenByTask);
+    TEST_ASSERT_NULL(selfClearingHandle);
+}
+
+void test_newest_task_of_a_name_is_sampled() {
+    TaskHandle_t first = nullptr;
+    TaskHandle_t second = nullptr;
+    ResourceMonitor::createTask(waitingTask, "testTwice", 4096, nullptr, 1, &first, 0);
+    ResourceMonitor::createTask(waitingTask, "testTwice", 4096, nullptr, 1, &second, 0);
+
+    // One still runs after the other has gone
+    ResourceMonitor::deleteTask(second);
+    TEST_ASSERT_TRUE(ResourceMonitor::isRegistered("testTwice"));
+    xTaskNotifyGive(first);
+    TEST_ASSERT_TRUE(waitUntilUnregistered("testTwice"));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_suggested_stack_sizes);
+    RUN_TEST(test_report_lines);
+    RUN_TEST(test_report_with_no_tasks);
+    RUN_TEST(test_task_registered_until_it_deletes_itself);
+    RUN_TEST(test_task_deleted_by_another_is_unregistered);
+    RUN_TEST(test_handle_is_set_before_the_task_runs);
+    RUN_TEST(test_newest_task_of_a_name_is_sampled);
+    return UNITY_END();
+}
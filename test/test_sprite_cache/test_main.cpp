@@ -0,0 +1,161 @@
+#include <unity.h>
+#include <esp_heap_caps.h>
+#include <cstring>
+#include "ui/SpriteCache.h"
+
+// A 96x96 RGB565A8 sprite, the size PokedexCard decodes
+static const size_t SPRITE_BYTES = 96 * 96 * 3;
+
+static SpriteCache::SpriteRef makeSprite(size_t dataBytes) {
+    lv_img_dsc_t* dsc = (lv_img_dsc_t*)heap_caps_calloc(1, sizeof(lv_img_dsc_t), MALLOC_CAP_SPIRAM);
+    dsc->data = (const uint8_t*)heap_caps_malloc(dataBytes, MALLOC_CAP_SPIRAM);
+    dsc->data_size = dataBytes;
+    return SpriteCache::adopt(dsc);
+}
+
+static size_t entryCost(const char* name, const char* description) {
+    return sizeof(lv_img_dsc_t) + SPRITE_BYTES + strlen(name) + strlen(description);
+}
+
+static long baselineAllocations;
+
+void setUp() {
+    baselineAllocations = heap_caps_live_allocations();
+}
+
+void tearDown() {}
+
+void test_accounting_matches_entries() {
+    SpriteCache cache(10 * entryCost("", ""));
+    cache.put(1, "bulbasaur", "A strange seed", makeSprite(SPRITE_BYTES));
+    cache.put(2, "ivysaur", "", makeSprite(SPRITE_BYTES));
+
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_EQUAL(entryCost("bulbasaur", "A strange seed") + entryCost("ivysaur", ""), cache.bytesUsed());
+    TEST_ASSERT_EQUAL(SpriteCache::entryBytes(cache.get(1)->sprite, "bulbasaur", "A strange seed"),
+                      cache.get(1)->bytes);
+
+    // Replacing an entry recharges it rather than adding to it
+    cache.put(1, "bulbasaur", "", makeSprite(SPRITE_BYTES));
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_EQUAL(entryCost("bulbasaur", "") + entryCost("ivysaur", ""), cache.bytesUsed());
+
+    cache.clear();
+    TEST_ASSERT_EQUAL(0, cache.size());
+    TEST_ASSERT_EQUAL(0, cache.bytesUsed());
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_evicts_least_recently_inserted() {
+    SpriteCache cache(3 * entryCost("", ""));
+    for (int id = 1; id <= 5; id++) {
+        TEST_ASSERT_TRUE(cache.put(id, "", "", makeSprite(SPRITE_BYTES)));
+        TEST_ASSERT_LESS_OR_EQUAL(cache.budget(), cache.bytesUsed());
+    }
+
+    TEST_ASSERT_EQUAL(3, cache.size());
+    TEST_ASSERT_FALSE(cache.contains(1));
+    TEST_ASSERT_FALSE(cache.contains(2));
+    TEST_ASSERT_TRUE(cache.contains(3));
+    TEST_ASSERT_TRUE(cache.contains(4));
+    TEST_ASSERT_TRUE(cache.contains(5));
+}
+
+void test_get_refreshes_recency() {
+    SpriteCache cache(3 * entryCost("", ""));
+    cache.put(1, "", "", makeSprite(SPRITE_BYTES));
+    cache.put(2, "", "", makeSprite(SPRITE_BYTES));
+    cache.put(3, "", "", makeSprite(SPRITE_BYTES));
+
+    TEST_ASSERT_NOT_NULL(cache.get(1));
+    cache.put(4, "", "", makeSprite(SPRITE_BYTES));
+    TEST_ASSERT_TRUE(cache.contains(1));
+    TEST_ASSERT_FALSE(cache.contains(2));
+
+    // contains() must not count as a use
+    TEST_ASSERT_TRUE(cache.contains(3));
+    cache.put(5, "", "", makeSprite(SPRITE_BYTES));
+    TEST_ASSERT_FALSE(cache.contains(3));
+    TEST_ASSERT_TRUE(cache.contains(1));
+}
+
+void test_large_entry_evicts_several() {
+    SpriteCache cache(4 * entryCost("", ""));
+    for (int id = 1; id <= 4; id++) {
+        cache.put(id, "", "", makeSprite(SPRITE_BYTES));
+    }
+
+    // Needs the room of three small entries
+    cache.put(10, "", "", makeSprite(3 * SPRITE_BYTES));
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_TRUE(cache.contains(10));
+    TEST_ASSERT_TRUE(cache.contains(4));
+    TEST_ASSERT_LESS_OR_EQUAL(cache.budget(), cache.bytesUsed());
+}
+
+void test_oversized_entry_is_rejected() {
+    SpriteCache cache(2 * entryCost("", ""));
+    cache.put(1, "", "", makeSprite(SPRITE_BYTES));
+
+    TEST_ASSERT_FALSE(cache.put(2, "", "", makeSprite(3 * SPRITE_BYTES)));
+    TEST_ASSERT_FALSE(cache.contains(2));
+    TEST_ASSERT_TRUE(cache.contains(1));
+    TEST_ASSERT_EQUAL(entryCost("", ""), cache.bytesUsed());
+}
+
+void test_eviction_keeps_displayed_sprite_alive() {
+    long allocationsPerSprite = 2; // descriptor and pixel data
+    SpriteCache cache(entryCost("", ""));
+
+    SpriteCache::SpriteRef displayed = makeSprite(SPRITE_BYTES);
+    cache.put(1, "", "", displayed);
+    TEST_ASSERT_EQUAL(2, displayed.use_count());
+    TEST_ASSERT_EQUAL_PTR(displayed.get(), cache.get(1)->sprite.get());
+
+    // Evicting drops only the cache's reference
+    cache.put(2, "", "", makeSprite(SPRITE_BYTES));
+    TEST_ASSERT_FALSE(cache.contains(1));
+    TEST_ASSERT_EQUAL(1, displayed.use_count());
+    TEST_ASSERT_EQUAL(baselineAllocations + 2 * allocationsPerSprite, heap_caps_live_allocations());
+
+    // The last holder letting go frees the pixels
+    displayed.reset();
+    TEST_ASSERT_EQUAL(baselineAllocations + allocationsPerSprite, heap_caps_live_allocations());
+    cache.clear();
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_static_sprites_are_never_freed() {
+    static uint8_t pixels[16];
+    static lv_img_dsc_t flashSprite;
+    flashSprite.data = pixels;
+    flashSprite.data_size = sizeof(pixels);
+
+    {
+        SpriteCache cache(1024);
+        cache.put(1, "", "", SpriteCache::wrapStatic(&flashSprite));
+        TEST_ASSERT_EQUAL(sizeof(lv_img_dsc_t) + sizeof(pixels), cache.bytesUsed());
+    }
+    TEST_ASSERT_EQUAL_PTR(pixels, flashSprite.data);
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_text_only_entry() {
+    SpriteCache cache(1024);
+    TEST_ASSERT_TRUE(cache.put(7, "squirtle", "Tiny turtle", SpriteCache::SpriteRef()));
+    TEST_ASSERT_EQUAL(strlen("squirtle") + strlen("Tiny turtle"), cache.bytesUsed());
+    TEST_ASSERT_EQUAL_STRING("squirtle", cache.get(7)->name.c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_accounting_matches_entries);
+    RUN_TEST(test_evicts_least_recently_inserted);
+    RUN_TEST(test_get_refreshes_recency);
+    RUN_TEST(test_large_entry_evicts_several);
+    RUN_TEST(test_oversized_entry_is_rejected);
+    RUN_TEST(test_eviction_keeps_displayed_sprite_alive);
+    RUN_TEST(test_static_sprites_are_never_freed);
+    RUN_TEST(test_text_only_entry);
+    return UNITY_END();
+}
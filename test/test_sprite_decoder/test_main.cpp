@@ -0,0 +1,149 @@
+#include <unity.h>
+#include <esp_heap_caps.h>
+#include <esp_rom_crc.h>
+#include <string>
+#include "ui/SpriteDecoder.h"
+#include "test_support.h"
+
+// 96x96 indexed PNG with a transparent background, like PokeAPI's sprites
+static const char* SPRITE_FIXTURE = "pokeapi_sprite_25.png";
+static const uint32_t SPRITE_SIZE = 96;
+static const size_t SPRITE_BYTES = SPRITE_SIZE * SPRITE_SIZE * 3;
+
+static std::string png;
+static long baselineAllocations;
+
+static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static uint16_t colorAt(const lv_img_dsc_t* sprite, uint32_t x, uint32_t y) {
+    return ((const uint16_t*)sprite->data)[y * sprite->header.w + x];
+}
+
+static uint8_t alphaAt(const lv_img_dsc_t* sprite, uint32_t x, uint32_t y) {
+    return sprite->data[sprite->header.w * sprite->header.h * 2 + y * sprite->header.w + x];
+}
+
+static lv_img_dsc_t* decode(const std::string& data, SpriteDecoder::Stats* stats = nullptr) {
+    return SpriteDecoder::decodePng((const uint8_t*)data.data(), data.size(), stats);
+}
+
+static void freeSprite(lv_img_dsc_t* sprite) {
+    heap_caps_free((void*)sprite->data);
+    heap_caps_free(sprite);
+}
+
+void setUp() {
+    if (png.empty()) {
+        png = loadTestData(SPRITE_FIXTURE);
+    }
+    baselineAllocations = heap_caps_live_allocations();
+}
+
+void tearDown() {}
+
+void test_decodes_to_rgb565a8() {
+    TEST_ASSERT_TRUE_MESSAGE(png.size() > 0, "sprite fixture missing");
+    lv_img_dsc_t* sprite = decode(png);
+    TEST_ASSERT_NOT_NULL(sprite);
+
+    TEST_ASSERT_EQUAL(LV_IMAGE_HEADER_MAGIC, sprite->header.magic);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565A8, sprite->header.cf);
+    TEST_ASSERT_EQUAL(SPRITE_SIZE, sprite->header.w);
+    TEST_ASSERT_EQUAL(SPRITE_SIZE, sprite->header.h);
+    TEST_ASSERT_EQUAL(SPRITE_SIZE * 2, sprite->header.stride);
+    TEST_ASSERT_EQUAL(SPRITE_BYTES, sprite->data_size);
+
+    // Body, cheek and belly from the fixture's palette
+    TEST_ASSERT_EQUAL_HEX16(rgb565(248, 208, 48), colorAt(sprite, 48, 45));
+    TEST_ASSERT_EQUAL_HEX16(rgb565(240, 80, 48), colorAt(sprite, 33, 62));
+    TEST_ASSERT_EQUAL_HEX16(rgb565(232, 168, 24), colorAt(sprite, 48, 80));
+    TEST_ASSERT_EQUAL(255, alphaAt(sprite, 48, 45));
+
+    freeSprite(sprite);
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_transparent_pixels_are_cleared() {
+    lv_img_dsc_t* sprite = decode(png);
+    TEST_ASSERT_NOT_NULL(sprite);
+    for (uint32_t corner : { 0u, SPRITE_SIZE - 1 }) {
+        TEST_ASSERT_EQUAL(0, alphaAt(sprite, corner, corner));
+        TEST_ASSERT_EQUAL_HEX16(0, colorAt(sprite, corner, corner));
+    }
+    freeSprite(sprite);
+}
+
+void test_not_a_png_is_rejected() {
+    TEST_ASSERT_NULL(decode("<html>rate limited</html>"));
+    TEST_ASSERT_NULL(decode(""));
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_truncated_png_is_rejected() {
+    // Cut off partway through the image data; pngle waits for more and never reaches IEND
+    TEST_ASSERT_NULL(decode(png.substr(0, png.size() / 2)));
+    TEST_ASSERT_NULL(decode(png.substr(0, png.size() - 12)));
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_corrupt_png_is_rejected() {
+    std::string corrupt = png;
+    corrupt[corrupt.size() / 2] ^= 0x40;
+    TEST_ASSERT_NULL(decode(corrupt));
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_oversized_png_is_rejected() {
+    // Rewrite the IHDR width past MAX_DIMENSION and fix up its CRC
+    std::string wide = png;
+    uint32_t width = SpriteDecoder::MAX_DIMENSION + 1;
+    wide[16] = (char)(width >> 24);
+    wide[17] = (char)(width >> 16);
+    wide[18] = (char)(width >> 8);
+    wide[19] = (char)width;
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)wide.data() + 12, 17);
+    for (int i = 0; i < 4; i++) {
+        wide[29 + i] = (char)(crc >> (24 - 8 * i));
+    }
+
+    TEST_ASSERT_NULL(decode(wide));
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+void test_benchmark_decode_time_and_memory() {
+    const int runs = 200;
+    SpriteDecoder::Stats stats = {};
+    size_t peakBytes = 0;
+    BenchTimer timer;
+    for (int i = 0; i < runs; i++) {
+        lv_img_dsc_t* sprite = decode(png, &stats);
+        TEST_ASSERT_NOT_NULL(sprite);
+        peakBytes = stats.peakHeapBytes > peakBytes ? stats.peakHeapBytes : peakBytes;
+        freeSprite(sprite);
+    }
+    double decodeUs = timer.elapsedUs() / runs;
+
+    printf("SpriteDecoder: %u byte PNG -> %ux%u RGB565A8 (%u bytes) in %.0f us, peak heap %u bytes "
+           "(%u beyond the pixels)\n",
+           (unsigned)png.size(), (unsigned)SPRITE_SIZE, (unsigned)SPRITE_SIZE, (unsigned)SPRITE_BYTES,
+           decodeUs, (unsigned)peakBytes, (unsigned)(peakBytes - SPRITE_BYTES));
+
+    // The pixels are held in full; the decoder itself adds its inflate window and a few rows
+    TEST_ASSERT_GREATER_OR_EQUAL(SPRITE_BYTES, peakBytes);
+    TEST_ASSERT_LESS_THAN(128 * 1024, peakBytes);
+    TEST_ASSERT_EQUAL(baselineAllocations, heap_caps_live_allocations());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_decodes_to_rgb565a8);
+    RUN_TEST(test_transparent_pixels_are_cleared);
+    RUN_TEST(test_not_a_png_is_rejected);
+    RUN_TEST(test_truncated_png_is_rejected);
+    RUN_TEST(test_corrupt_png_is_rejected);
+    RUN_TEST(test_oversized_png_is_rejected);
+    RUN_TEST(test_benchmark_decode_time_and_memory);
+    return UNITY_END();
+}
@@ -0,0 +1,216 @@
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Trace.h"
+#include "test_support.h"
+
+static const size_t RING_EVENTS = 1024;
+
+static const char* const SCOPE_NAMES[] = { "ui.frame", "net.fetch", "card.update" };
+
+struct TraceCounts {
+    bool parsed;
+    size_t begins;
+    size_t ends;
+    size_t threadNames;
+    size_t unknownNames;
+};
+
+/**
+ * @brief Drain an exporter in pieces of chunkSize, as the chunked web response does
+ */
+static std::string drain(Trace::Exporter& exporter, size_t chunkSize) {
+    std::string json;
+    std::vector<uint8_t> chunk(chunkSize);
+    size_t n;
+    while ((n = exporter.read(chunk.data(), chunk.size())) > 0) {
+        json.append((const char*)chunk.data(), n);
+    }
+    return json;
+}
+
+static bool knownName(const String& name) {
+    for (const char* known : SCOPE_NAMES) {
+        if (name == known) return true;
+    }
+    return false;
+}
+
+static TraceCounts countEvents(const std::string& json) {
+    TraceCounts counts = {};
+    DynamicJsonDocument doc(json.size() * 4 + 4096);
+    if (deserializeJson(doc, json.c_str(), json.size())) {
+        return counts;
+    }
+    counts.parsed = true;
+    for (JsonVariant event : doc.as<JsonObject>()["traceEvents"].as<JsonArray>()) {
+        String phase = event["ph"].as<String>();
+        if (phase == "M") {
+            counts.threadNames++;
+            continue;
+        }
+        if (phase == "B") counts.begins++;
+        if (phase == "E") counts.ends++;
+        if (!knownName(event["name"].as<String>())) counts.unknownNames++;
+    }
+    return counts;
+}
+
+static TraceCounts exportNow() {
+    Trace::Exporter exporter;
+    return countEvents(drain(exporter, 512));
+}
+
+static void recordScopes(size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        TRACE_SCOPE(SCOPE_NAMES[i % 3]);
+    }
+}
+
+void setUp() {
+    Trace::setEnabled(true);
+}
+
+void tearDown() {}
+
+void test_export_is_valid_json() {
+    recordScopes(10);
+    TraceCounts counts = exportNow();
+    TEST_ASSERT_TRUE(counts.parsed);
+    TEST_ASSERT_EQUAL(counts.begins, counts.ends);
+    TEST_ASSERT_GREATER_OR_EQUAL(10, counts.begins);
+    TEST_ASSERT_EQUAL(1, counts.threadNames);   // Every host event is on "host"
+    TEST_ASSERT_EQUAL(0, counts.unknownNames);
+}
+
+void test_chunk_size_does_not_change_output() {
+    recordScopes(20);
+    std::string whole;
+    std::string byteByByte;
+    {
+        Trace::Exporter exporter;
+        whole = drain(exporter, 64 * 1024);
+    }
+    {
+        Trace::Exporter exporter;
+        byteByByte = drain(exporter, 1);
+    }
+    TEST_ASSERT_EQUAL(whole.size(), byteByByte.size());
+    TEST_ASSERT_TRUE(whole == byteByByte);
+}
+
+void test_full_ring_keeps_the_newest_events() {
+    recordScopes(RING_EVENTS * 3);
+    TraceCounts counts = exportNow();
+    TEST_ASSERT_TRUE(counts.parsed);
+    TEST_ASSERT_EQUAL(RING_EVENTS, counts.begins + counts.ends);
+    TEST_ASSERT_EQUAL(0, counts.unknownNames);
+}
+
+void test_recording_resumes_after_the_last_exporter() {
+    recordScopes(RING_EVENTS);
+
+    Trace::Exporter* first = new Trace::Exporter();
+    Trace::Exporter* second = new Trace::Exporter();
+    // Each batch would overwrite the whole ring if it were recorded
+    recordScopes(RING_EVENTS);
+    delete first;
+    recordScopes(RING_EVENTS);
+
+    // Still paused after the first exporter went, so the second reads an
+    // intact ring rather than slots rewritten under it
+    TraceCounts seen = countEvents(drain(*second, 512));
+    TEST_ASSERT_TRUE(seen.parsed);
+    TEST_ASSERT_EQUAL(RING_EVENTS, seen.begins + seen.ends);
+    delete second;
+
+    // And recording again once both are gone
+    {
+        TRACE_SCOPE("resume.check");
+    }
+    TEST_ASSERT_EQUAL(2, exportNow().unknownNames);
+}
+
+void test_exporter_does_not_enable_a_disabled_ring() {
+    recordScopes(4);
+    Trace::setEnabled(false);
+    {
+        Trace::Exporter exporter;
+    }
+    TEST_ASSERT_FALSE(Trace::isEnabled());
+
+    Trace::Exporter* reference = new Trace::Exporter();
+    std::string before = drain(*reference, 512);
+    delete reference;
+    recordScopes(4);
+    Trace::Exporter after;
+    TEST_ASSERT_TRUE(before == drain(after, 512));
+}
+
+void test_export_while_recording_from_many_threads() {
+    recordScopes(RING_EVENTS);
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 3; t++) {
+        writers.emplace_back([&stop]() {
+            while (!stop.load()) {
+                recordScopes(16);
+            }
+        });
+    }
+
+    // Writers are caught mid-record as exporters come and go; any record
+    // they had not finished is skipped rather than exported half-written
+    int exports = 0;
+    BenchTimer timer;
+    while (timer.elapsedUs() < 500000) {
+        TraceCounts counts = exportNow();
+        TEST_ASSERT_TRUE(counts.parsed);
+        TEST_ASSERT_EQUAL(0, counts.unknownNames);
+        TEST_ASSERT_LESS_OR_EQUAL(RING_EVENTS, counts.begins + counts.ends);
+        exports++;
+    }
+    stop.store(true);
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    printf("Trace: %d exports while 3 threads recorded, every one parsed\n", exports);
+}
+
+void test_record_benchmark() {
+    const size_t scopes = 1000000;
+    BenchTimer recordTimer;
+    recordScopes(scopes);
+    double scopeNs = recordTimer.elapsedUs() * 1000.0 / scopes;
+
+    BenchTimer exportTimer;
+    std::string json;
+    {
+        Trace::Exporter exporter;
+        json = drain(exporter, 1436);   // One TCP segment per chunk
+    }
+    double exportUs = exportTimer.elapsedUs();
+
+    printf("Trace: begin+end %.1f ns per scope; %u events exported as %u bytes in %.0f us\n",
+           scopeNs, (unsigned)RING_EVENTS, (unsigned)json.size(), exportUs);
+    TEST_ASSERT_GREATER_THAN(0, json.size());
+}
+
+int main(int argc, char** argv) {
+    // The ring is allocated once per boot, so the suite shares one
+    Trace::begin(RING_EVENTS);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_export_is_valid_json);
+    RUN_TEST(test_chunk_size_does_not_change_output);
+    RUN_TEST(test_full_ring_keeps_the_newest_events);
+    RUN_TEST(test_recording_resumes_after_the_last_exporter);
+    RUN_TEST(test_exporter_does_not_enable_a_disabled_ring);
+    RUN_TEST(test_export_while_recording_from_many_threads);
+    RUN_TEST(test_record_benchmark);
+    return UNITY_END();
+}
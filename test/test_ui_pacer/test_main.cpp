@@ -0,0 +1,238 @@
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+#include "ui/UiPacer.h"
+
+static const uint32_t RUN_MS = 10000;
+static const uint32_t DEBOUNCE_MS = 5;          // Input::configureButtons()
+static const uint32_t NO_TIMER = UINT32_MAX;
+// Before pacing, lvglTask woke every 5 ms and the lv_tick task every 10 ms
+static const uint32_t OLD_WAKEUPS_PER_S = 1000 / 5 + 1000 / 10;
+// Assumed CPU time of a pass that polls and finds nothing to redraw; only
+// used to turn wakeups into a duty cycle for comparison
+static const uint32_t PASS_US = 200;
+
+/**
+ * @brief A button as Bounce2 debounces it with its default stable interval
+ *
+ * update() reports a change once the pin has read the same for DEBOUNCE_MS,
+ * counted from the first poll that saw the new level.
+ */
+struct SimButton {
+    bool level = false;         ///< Pin reads pressed
+    bool unstable = false;
+    bool debounced = false;
+    uint32_t unstableSince = 0;
+    bool interruptArmed = true;
+
+    bool update(uint32_t now) {
+        if (level != unstable) {
+            unstable = level;
+            unstableSince = now;
+        } else if (now - unstableSince >= DEBOUNCE_MS && level != debounced) {
+            unstableSince = now;
+            debounced = level;
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief A change of the pin at a given time
+ */
+struct PinEvent {
+    uint32_t at;
+    bool pressed;
+};
+
+/**
+ * @brief What the UI task did over a run
+ */
+struct UiTaskRun {
+    uint32_t wakeups;
+    std::vector<uint32_t> pressedAt;    ///< When a debounced press was seen
+};
+
+/**
+ * @brief Run the UI task loop against a simulated clock
+ *
+ * Mirrors lvglHandlerTask: LVGL timers and the UI queue, a button poll when
+ * UiPacer says one is due, then waitForUIWork() for UiPacer::waitMs(). A
+ * pin going to its pressed level fires the interrupt, if armed, which wakes
+ * the task at once and masks itself until a poll sees the button released.
+ *
+ * @param timerPeriodMs Period of a repeating LVGL timer, or 0 for none
+ * @param interrupts Whether presses fire the button interrupt
+ * @param startMs Time the run starts; the pacer was created at 0
+ */
+static UiTaskRun runUiTask(uint32_t durationMs, bool animating, uint32_t timerPeriodMs,
+                           std::vector<PinEvent> events = {}, bool interrupts = true,
+                           uint32_t startMs = 0) {
+    UiTaskRun run = {};
+    UiPacer pacer(0);
+    SimButton button;
+    bool interrupted = false;
+    uint32_t nextTimer = startMs + timerPeriodMs;
+    size_t nextEvent = 0;
+    uint32_t now = startMs;
+    uint32_t endMs = startMs + durationMs;
+
+    while (now < endMs) {
+        run.wakeups++;
+        if (timerPeriodMs > 0) {
+            while (nextTimer <= now) {
+                nextTimer += timerPeriodMs;
+            }
+        }
+
+        if (pacer.pollDue(now, interrupted)) {
+            if (button.update(now)) {
+                pacer.buttonActivity(now);
+                if (button.debounced) {
+                    run.pressedAt.push_back(now);
+                }
+            }
+            if (!button.level) {
+                button.interruptArmed = true;
+            }
+        }
+        interrupted = false;
+
+        uint32_t untilTimer = timerPeriodMs > 0 ? nextTimer - now : NO_TIMER;
+        uint32_t wake = now + pacer.waitMs(now, animating, untilTimer);
+
+        // Pin changes while asleep; a press with the interrupt armed ends the sleep
+        while (nextEvent < events.size() && events[nextEvent].at <= wake) {
+            const PinEvent& event = events[nextEvent++];
+            button.level = event.pressed;
+            if (event.pressed && interrupts && button.interruptArmed) {
+                button.interruptArmed = false;
+                interrupted = true;
+                wake = event.at > now ? event.at : now;
+                break;
+            }
+        }
+        now = wake;
+    }
+    return run;
+}
+
+static double perSecond(const UiTaskRun& run) {
+    return run.wakeups * 1000.0 / RUN_MS;
+}
+
+static double dutyPercent(double wakeupsPerSecond) {
+    return wakeupsPerSecond * PASS_US / 10000.0;
+}
+
+/**
+ * @brief How long after pressAt a press of holdMs was seen, or UINT32_MAX if missed
+ */
+static uint32_t pressLatency(uint32_t pressAt, uint32_t holdMs, bool interrupts) {
+    UiTaskRun run = runUiTask(1000, false, 0, { { pressAt, true }, { pressAt + holdMs, false } },
+                              interrupts, pressAt - 500);
+    if (run.pressedAt.empty()) {
+        return UINT32_MAX;
+    }
+    TEST_ASSERT_EQUAL(1, run.pressedAt.size());
+    return run.pressedAt[0] - pressAt;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_static_card_wakes_only_to_poll() {
+    // Pressed recently, then idle
+    UiTaskRun active = runUiTask(RUN_MS, false, 0);
+    UiTaskRun idle = runUiTask(RUN_MS, false, 0, {}, true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    TEST_ASSERT_UINT32_WITHIN(1, RUN_MS / UiPacer::BUTTON_POLL_MS, active.wakeups);
+    TEST_ASSERT_UINT32_WITHIN(1, RUN_MS / UiPacer::BUTTON_POLL_IDLE_MS, idle.wakeups);
+}
+
+void test_lvgl_timers_add_their_own_wakeups() {
+    // A once-a-second timer lands between idle polls: one extra wakeup per period
+    UiTaskRun clock = runUiTask(RUN_MS, false, 1010, {}, true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    TEST_ASSERT_UINT32_WITHIN(2, RUN_MS / UiPacer::BUTTON_POLL_IDLE_MS + RUN_MS / 1010, clock.wakeups);
+
+    // A timer faster than the poll sets the pace on its own
+    UiTaskRun fast = runUiTask(RUN_MS, false, 30, {}, true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    TEST_ASSERT_UINT32_WITHIN(RUN_MS / UiPacer::BUTTON_POLL_IDLE_MS + 1, RUN_MS / 30, fast.wakeups);
+}
+
+void test_animating_card_wakes_every_frame() {
+    UiTaskRun run = runUiTask(RUN_MS, true, 0);
+    TEST_ASSERT_UINT32_WITHIN(1, RUN_MS / UiPacer::FRAME_MS, run.wakeups);
+}
+
+void test_press_after_idle_is_seen_within_a_debounce_with_the_interrupt() {
+    // Land the press at every offset within an idle poll interval
+    uint32_t worst = 0;
+    for (uint32_t offset = 0; offset < UiPacer::BUTTON_POLL_IDLE_MS; offset++) {
+        uint32_t latency = pressLatency(UiPacer::BUTTON_IDLE_AFTER_MS + 1000 + offset, 30, true);
+        TEST_ASSERT_NOT_EQUAL(UINT32_MAX, latency);
+        worst = latency > worst ? latency : worst;
+    }
+    TEST_ASSERT_EQUAL(DEBOUNCE_MS, worst);
+}
+
+void test_press_after_idle_without_the_interrupt_waits_for_two_polls() {
+    // The polled fallback: one poll to see the level, one more to debounce it
+    uint32_t worst = 0;
+    for (uint32_t offset = 0; offset < UiPacer::BUTTON_POLL_IDLE_MS; offset++) {
+        uint32_t latency = pressLatency(UiPacer::BUTTON_IDLE_AFTER_MS + 1000 + offset,
+                                        3 * UiPacer::BUTTON_POLL_IDLE_MS, false);
+        TEST_ASSERT_NOT_EQUAL(UINT32_MAX, latency);
+        worst = latency > worst ? latency : worst;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(2 * UiPacer::BUTTON_POLL_IDLE_MS, worst);
+
+    // A quick tap can fall between idle polls without the interrupt
+    TEST_ASSERT_EQUAL(UINT32_MAX, pressLatency(UiPacer::BUTTON_IDLE_AFTER_MS + 1001, 30, false));
+}
+
+void test_held_button_does_not_keep_waking_the_task() {
+    // The interrupt stays masked while held, so a 2 s hold costs only the settle polls
+    uint32_t pressAt = UiPacer::BUTTON_IDLE_AFTER_MS + 1000;
+    UiTaskRun held = runUiTask(RUN_MS, false, 0, { { pressAt, true }, { pressAt + 2000, false } },
+                               true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    UiTaskRun idle = runUiTask(RUN_MS, false, 0, {}, true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    TEST_ASSERT_EQUAL(1, held.pressedAt.size());
+    uint32_t settlePolls = UiPacer::BUTTON_SETTLE_MS / UiPacer::BUTTON_SETTLE_POLL_MS;
+    // After the press, polls run at BUTTON_POLL_MS until the run ends
+    uint32_t activePolls = (RUN_MS - 1000) / UiPacer::BUTTON_POLL_MS;
+    TEST_ASSERT_LESS_OR_EQUAL(idle.wakeups + settlePolls + activePolls, held.wakeups);
+}
+
+void test_wakeups_and_duty_cycle() {
+    UiTaskRun idle = runUiTask(RUN_MS, false, 0, {}, true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    UiTaskRun active = runUiTask(RUN_MS, false, 0);
+    UiTaskRun clock = runUiTask(RUN_MS, false, 1010, {}, true, UiPacer::BUTTON_IDLE_AFTER_MS);
+    UiTaskRun animating = runUiTask(RUN_MS, true, 0);
+
+    printf("UiPacer: wakeups/s (duty at %u us a pass): static idle %.1f (%.2f%%), static active %.1f (%.2f%%), "
+           "idle with a 1 s timer %.1f (%.2f%%), animating %.1f (%.2f%%); before pacing %u (%.2f%%)\n",
+           (unsigned)PASS_US,
+           perSecond(idle), dutyPercent(perSecond(idle)),
+           perSecond(active), dutyPercent(perSecond(active)),
+           perSecond(clock), dutyPercent(perSecond(clock)),
+           perSecond(animating), dutyPercent(perSecond(animating)),
+           (unsigned)OLD_WAKEUPS_PER_S, dutyPercent(OLD_WAKEUPS_PER_S));
+
+    // A static card should cost a tenth of what the fixed 5 ms loop did, or less
+    TEST_ASSERT_LESS_OR_EQUAL(OLD_WAKEUPS_PER_S / 10, perSecond(active));
+    TEST_ASSERT_LESS_OR_EQUAL(OLD_WAKEUPS_PER_S / 10, perSecond(clock));
+    TEST_ASSERT_LESS_OR_EQUAL(OLD_WAKEUPS_PER_S, perSecond(animating));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_static_card_wakes_only_to_poll);
+    RUN_TEST(test_lvgl_timers_add_their_own_wakeups);
+    RUN_TEST(test_animating_card_wakes_every_frame);
+    RUN_TEST(test_press_after_idle_is_seen_within_a_debounce_with_the_interrupt);
+    RUN_TEST(test_press_after_idle_without_the_interrupt_waits_for_two_polls);
+    RUN_TEST(test_held_button_does_not_keep_waking_the_task);
+    RUN_TEST(test_wakeups_and_duty_cycle);
+    return UNITY_END();
+}
@@ -0,0 +1,172 @@
+#include <unity.h>
+#include <Preferences.h>
+#include "test_support.h"
+
+// Built into this suite rather than the shared native sources, since they
+// need the stubs below. native_shim/WiFi.h simulates the radio.
+#include "ConfigManager.cpp"
+#include "hardware/WifiInterface.cpp"
+
+void SystemController::setApiState(ApiState state) {}
+
+EventQueue::EventQueue(size_t queueSize)
+    : eventQueue(nullptr), callbackMutex(nullptr), taskHandle(nullptr), isRunning(false) {}
+EventQueue::~EventQueue() {}
+void EventQueue::subscribe(EventCallback callback) {}
+bool EventQueue::publishEvent(EventType eventType, const String& insightId) { return true; }
+
+void ProvisioningCard::updateConnectionStatus(const String& status) {}
+void ProvisioningCard::updateIPAddress(const String& ip) {}
+void ProvisioningCard::updateSignalStrength(int strength) {}
+void ProvisioningCard::showQRCode() {}
+
+static const unsigned long STEP_MS = 10;            // How often main.cpp's WiFi task runs process()
+static const unsigned long CONNECT_TIMEOUT_MS = 30000;
+
+// Two access points for the office network; the full connect picks the stronger
+static const WiFiClass::AccessPoint OFFICE_MAIN = { "DeskHog Office", "hunter22", { 0x10, 0x20, 0x30, 0x40, 0x50, 0x01 }, 6, -48 };
+static const WiFiClass::AccessPoint OFFICE_HALL = { "DeskHog Office", "hunter22", { 0x10, 0x20, 0x30, 0x40, 0x50, 0x02 }, 11, -67 };
+// Where the office AP used to be before it was replaced
+static const uint8_t REMOVED_BSSID[6] = { 0x10, 0x20, 0x30, 0x40, 0x50, 0x7F };
+static const int32_t REMOVED_CHANNEL = 1;
+
+// Built once and never destroyed, as in main.cpp
+static EventQueue* eventQueue;
+static ConfigManager* configManager;
+static WiFiInterface* wifi;
+
+struct Attempt {
+    bool connected = false;
+    unsigned long elapsedMs = 0;   ///< Simulated time from connectToStoredNetwork() to the outcome
+};
+
+/**
+ * @brief Connect with stored credentials, stepping simulated time until an IP or the timeout
+ */
+static Attempt connect() {
+    Attempt attempt;
+    unsigned long start = millis();
+    TEST_ASSERT_TRUE(wifi->connectToStoredNetwork(CONNECT_TIMEOUT_MS));
+    while (millis() - start < CONNECT_TIMEOUT_MS + STEP_MS) {
+        advanceMillis(STEP_MS);
+        WiFi.loop();
+        wifi->process();
+        if (wifi->isConnected() && WiFi.status() == WL_CONNECTED) {
+            attempt.connected = true;
+            break;
+        }
+        if (wifi->getState() == WiFiState::AP_MODE) {
+            break;
+        }
+    }
+    attempt.elapsedMs = millis() - start;
+    return attempt;
+}
+
+static void assertHintIs(const WiFiClass::AccessPoint& ap) {
+    uint8_t bssid[6];
+    int32_t channel = 0;
+    TEST_ASSERT_TRUE(configManager->getWiFiLinkHint(bssid, channel));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(ap.bssid, bssid, 6);
+    TEST_ASSERT_EQUAL(ap.channel, channel);
+}
+
+void setUp() {
+    WiFi.reset();
+    WiFi.failDirectedJoins(false);
+}
+
+void tearDown() {}
+
+void test_good_hint_connects_fast() {
+    configManager->saveWiFiLinkHint(OFFICE_MAIN.bssid, OFFICE_MAIN.channel);
+
+    Attempt attempt = connect();
+    TEST_ASSERT_TRUE(attempt.connected);
+    TEST_ASSERT_TRUE(wifi->lastConnectWasFast());
+    TEST_ASSERT_EQUAL(1, WiFi.beginCount());
+    TEST_ASSERT_EQUAL(1, WiFi.directedBeginCount());
+    // Association and DHCP only, no scan
+    unsigned long expectedMs = WiFi.timing().directedJoinMs + WiFi.timing().dhcpMs;
+    TEST_ASSERT_UINT32_WITHIN(3 * STEP_MS, expectedMs, wifi->getLastConnectTime());
+    assertHintIs(OFFICE_MAIN);
+    printf("WiFiInterface: fast connect with a good hint took %lu ms\n", wifi->getLastConnectTime());
+}
+
+void test_stale_hint_falls_back_after_fast_timeout() {
+    // The remembered AP is gone and the driver says nothing about it
+    configManager->saveWiFiLinkHint(REMOVED_BSSID, REMOVED_CHANNEL);
+
+    Attempt attempt = connect();
+    TEST_ASSERT_TRUE(attempt.connected);
+    TEST_ASSERT_FALSE(wifi->lastConnectWasFast());
+    TEST_ASSERT_EQUAL(2, WiFi.beginCount());
+    TEST_ASSERT_EQUAL(1, WiFi.directedBeginCount());
+    TEST_ASSERT_FALSE(WiFi.lastBeginWasDirected());
+    // The full connect started once FAST_CONNECT_TIMEOUT_MS was up
+    unsigned long expectedMs = WiFiInterface::FAST_CONNECT_TIMEOUT_MS + WiFi.timing().scanJoinMs + WiFi.timing().dhcpMs;
+    TEST_ASSERT_UINT32_WITHIN(3 * STEP_MS, expectedMs, wifi->getLastConnectTime());
+    // and the strongest AP it found replaced the stale hint
+    assertHintIs(OFFICE_MAIN);
+    printf("WiFiInterface: stale hint fell back and connected in %lu ms\n", wifi->getLastConnectTime());
+}
+
+void test_stale_hint_reported_by_driver_falls_back_at_once() {
+    WiFi.failDirectedJoins(true);
+    configManager->saveWiFiLinkHint(REMOVED_BSSID, REMOVED_CHANNEL);
+
+    Attempt attempt = connect();
+    TEST_ASSERT_TRUE(attempt.connected);
+    TEST_ASSERT_FALSE(wifi->lastConnectWasFast());
+    TEST_ASSERT_EQUAL(2, WiFi.beginCount());
+    // No waiting out the fast timeout once the driver has given up
+    unsigned long expectedMs = WiFi.timing().directedJoinMs + WiFi.timing().scanJoinMs + WiFi.timing().dhcpMs;
+    TEST_ASSERT_UINT32_WITHIN(3 * STEP_MS, expectedMs, wifi->getLastConnectTime());
+    TEST_ASSERT_LESS_THAN(WiFiInterface::FAST_CONNECT_TIMEOUT_MS, wifi->getLastConnectTime());
+}
+
+void test_no_hint_does_full_connect() {
+    configManager->clearWiFiLinkHint();
+
+    Attempt attempt = connect();
+    TEST_ASSERT_TRUE(attempt.connected);
+    TEST_ASSERT_FALSE(wifi->lastConnectWasFast());
+    TEST_ASSERT_EQUAL(1, WiFi.beginCount());
+    TEST_ASSERT_EQUAL(0, WiFi.directedBeginCount());
+    unsigned long expectedMs = WiFi.timing().scanJoinMs + WiFi.timing().dhcpMs;
+    TEST_ASSERT_UINT32_WITHIN(3 * STEP_MS, expectedMs, wifi->getLastConnectTime());
+    // Saved for next time
+    assertHintIs(OFFICE_MAIN);
+    printf("WiFiInterface: full connect without a hint took %lu ms\n", wifi->getLastConnectTime());
+}
+
+void test_hint_for_second_ap_is_used_while_it_is_up() {
+    // A device last joined on the weaker AP goes straight back to it
+    configManager->saveWiFiLinkHint(OFFICE_HALL.bssid, OFFICE_HALL.channel);
+
+    Attempt attempt = connect();
+    TEST_ASSERT_TRUE(attempt.connected);
+    TEST_ASSERT_TRUE(wifi->lastConnectWasFast());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(OFFICE_HALL.bssid, WiFi.BSSID(), 6);
+    assertHintIs(OFFICE_HALL);
+}
+
+int main(int argc, char** argv) {
+    WiFi.addAccessPoint(OFFICE_MAIN);
+    WiFi.addAccessPoint(OFFICE_HALL);
+
+    eventQueue = new EventQueue();
+    configManager = new ConfigManager(*eventQueue);
+    configManager->begin();
+    configManager->saveWiFiCredentials("DeskHog Office", "hunter22");
+    wifi = new WiFiInterface(*configManager, *eventQueue);
+    wifi->begin();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_good_hint_connects_fast);
+    RUN_TEST(test_stale_hint_falls_back_after_fast_timeout);
+    RUN_TEST(test_stale_hint_reported_by_driver_falls_back_at_once);
+    RUN_TEST(test_no_hint_does_full_connect);
+    RUN_TEST(test_hint_for_second_ap_is_used_while_it_is_up);
+    return UNITY_END();
+}
@@ -0,0 +1,136 @@
+#include <unity.h>
+#include <vector>
+#include "hardware/WifiInterface.h"
+#include "test_support.h"
+
+typedef WiFiInterface::NetworkInfo NetworkInfo;
+
+static NetworkInfo network(const char* ssid, int32_t rssi, uint8_t encryption = WIFI_AUTH_WPA2_PSK) {
+    NetworkInfo net;
+    net.ssid = ssid;
+    net.rssi = rssi;
+    net.encryptionType = encryption;
+    net.lastSeen = 0;
+    return net;
+}
+
+static const NetworkInfo* find(const std::vector<NetworkInfo>& cache, const char* ssid) {
+    for (const NetworkInfo& net : cache) {
+        if (net.ssid == ssid) return &net;
+    }
+    return nullptr;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_one_entry_per_ssid_at_strongest_rssi() {
+    std::vector<NetworkInfo> cache;
+    // A mesh network reports the same SSID from every access point
+    WiFiInterface::mergeScanResults(cache, {
+        network("Office", -71), network("Office", -48), network("Office", -65), network("Cafe", -80)
+    }, 1000);
+
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_EQUAL(-48, find(cache, "Office")->rssi);
+    TEST_ASSERT_EQUAL(1000, find(cache, "Office")->lastSeen);
+}
+
+void test_new_scan_replaces_old_reading() {
+    std::vector<NetworkInfo> cache;
+    WiFiInterface::mergeScanResults(cache, { network("Office", -40) }, 1000);
+
+    // Walking away: the next scan's weaker reading wins over the old strong one
+    WiFiInterface::mergeScanResults(cache, { network("Office", -75, WIFI_AUTH_WPA3_PSK) }, 11000);
+    TEST_ASSERT_EQUAL(-75, find(cache, "Office")->rssi);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA3_PSK, find(cache, "Office")->encryptionType);
+    TEST_ASSERT_EQUAL(11000, find(cache, "Office")->lastSeen);
+}
+
+void test_hidden_networks_are_skipped() {
+    std::vector<NetworkInfo> cache;
+    WiFiInterface::mergeScanResults(cache, { network("", -30), network("Office", -60) }, 1000);
+    TEST_ASSERT_EQUAL(1, cache.size());
+    TEST_ASSERT_NULL(find(cache, ""));
+}
+
+void test_missed_network_stays_until_it_ages_out() {
+    std::vector<NetworkInfo> cache;
+    WiFiInterface::mergeScanResults(cache, { network("Office", -60), network("Neighbour", -85) }, 1000);
+
+    // One scan that misses a weak network does not drop it from the list
+    WiFiInterface::mergeScanResults(cache, { network("Office", -61) }, 1000 + 30000);
+    TEST_ASSERT_NOT_NULL(find(cache, "Neighbour"));
+
+    WiFiInterface::mergeScanResults(cache, { network("Office", -59) }, 1000 + WiFiInterface::NETWORK_CACHE_MAX_AGE_MS);
+    TEST_ASSERT_NOT_NULL(find(cache, "Neighbour"));
+
+    WiFiInterface::mergeScanResults(cache, { network("Office", -62) }, 1001 + WiFiInterface::NETWORK_CACHE_MAX_AGE_MS);
+    TEST_ASSERT_NULL(find(cache, "Neighbour"));
+    TEST_ASSERT_EQUAL(1, cache.size());
+}
+
+void test_sorted_strongest_first_and_stable() {
+    std::vector<NetworkInfo> cache;
+    WiFiInterface::mergeScanResults(cache, {
+        network("C", -70), network("A", -40), network("Tie1", -55), network("B", -90), network("Tie2", -55)
+    }, 1000);
+
+    const char* expected[] = { "A", "Tie1", "Tie2", "C", "B" };
+    TEST_ASSERT_EQUAL(5, cache.size());
+    for (size_t i = 0; i < cache.size(); i++) {
+        TEST_ASSERT_EQUAL_STRING(expected[i], cache[i].ssid.c_str());
+    }
+
+    // A network that got stronger moves up on the next scan
+    WiFiInterface::mergeScanResults(cache, { network("B", -30) }, 2000);
+    TEST_ASSERT_EQUAL_STRING("B", cache[0].ssid.c_str());
+}
+
+void test_capped_to_strongest() {
+    std::vector<NetworkInfo> results;
+    for (int i = 0; i < 35; i++) {
+        results.push_back(network(("Net" + String(i)).c_str(), -40 - i));
+    }
+
+    std::vector<NetworkInfo> cache;
+    WiFiInterface::mergeScanResults(cache, results, 1000);
+    TEST_ASSERT_EQUAL(WiFiInterface::MAX_CACHED_NETWORKS, cache.size());
+    TEST_ASSERT_EQUAL(-40, cache.front().rssi);
+    TEST_ASSERT_EQUAL(-40 - (int)WiFiInterface::MAX_CACHED_NETWORKS + 1, cache.back().rssi);
+}
+
+void test_merge_benchmark() {
+    // A busy apartment block: 60 sightings per scan, many repeated SSIDs
+    std::vector<NetworkInfo> results;
+    for (int i = 0; i < 60; i++) {
+        results.push_back(network(("Flat " + String((i * 7) % 40)).c_str(), -45 - (i * 13) % 50));
+    }
+
+    const int scans = 2000;
+    std::vector<NetworkInfo> cache;
+    BenchTimer timer;
+    for (int scan = 0; scan < scans; scan++) {
+        WiFiInterface::mergeScanResults(cache, results, 1000 + scan * 10000UL);
+    }
+    double perMerge = timer.elapsedUs() / scans;
+
+    TEST_ASSERT_EQUAL(WiFiInterface::MAX_CACHED_NETWORKS, cache.size());
+    for (size_t i = 1; i < cache.size(); i++) {
+        TEST_ASSERT_TRUE(cache[i - 1].rssi >= cache[i].rssi);
+    }
+    printf("WiFiInterface: merging %u sightings into %u cached networks takes %.1f us\n",
+           (unsigned)results.size(), (unsigned)cache.size(), perMerge);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_one_entry_per_ssid_at_strongest_rssi);
+    RUN_TEST(test_new_scan_replaces_old_reading);
+    RUN_TEST(test_hidden_networks_are_skipped);
+    RUN_TEST(test_missed_network_stays_until_it_ages_out);
+    RUN_TEST(test_sorted_strongest_first_and_stable);
+    RUN_TEST(test_capped_to_strongest);
+    RUN_TEST(test_merge_benchmark);
+    return UNITY_END();
+}